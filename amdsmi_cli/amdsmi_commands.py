@@ -48,6 +48,8 @@ class AMDSMICommands():
         self.core_handles = []
         self.stop = ''
         self.group_check_printed = False
+        # Sysfs snapshots of the gpus being listed, taken in one batch
+        self.sysfs_snapshots = {}
 
         amdsmi_init_flag = self.helpers.get_amdsmi_init_flag()
         logging.debug(f"AMDSMI Init Flag: {amdsmi_init_flag}")
@@ -1483,9 +1485,18 @@ class AMDSMICommands():
                 for gpu in args.gpu:
                     stored_gpus.append(gpu)
 
+                # Read the memory usage of all gpus in one batch
+                if "mem_usage" in current_platform_args and args.mem_usage:
+                    try:
+                        snapshots = amdsmi_interface.amdsmi_get_gpu_sysfs_snapshot(stored_gpus)
+                        self.sysfs_snapshots = {gpu.value: snapshot for gpu, snapshot in zip(stored_gpus, snapshots)}
+                    except amdsmi_exception.AmdSmiLibraryException as e:
+                        logging.debug("Failed to get memory usage for gpus %s | %s", stored_gpus, e.get_error_info())
+
                 # Store output from multiple devices
                 for device_handle in args.gpu:
                     self.metric_gpu(args, multiple_devices=True, watching_output=watching_output, gpu=device_handle)
+                self.sysfs_snapshots = {}
 
                 # Reload original gpus
                 args.gpu = stored_gpus
@@ -2283,44 +2294,24 @@ class AMDSMICommands():
                                 'used_gtt': "N/A",
                                 'free_gtt': "N/A"}
 
-                # Total VRAM
-                try:
-                    total_vram = amdsmi_interface.amdsmi_get_gpu_memory_total(args.gpu, amdsmi_interface.AmdSmiMemoryType.VRAM)
-                    memory_usage['total_vram'] = total_vram // (1024*1024)
-                except amdsmi_exception.AmdSmiLibraryException as e:
-                    logging.debug("Failed to get total VRAM memory for gpu %s | %s", gpu_id, e.get_error_info())
-
-                try:
-                    total_visible_vram = amdsmi_interface.amdsmi_get_gpu_memory_total(args.gpu, amdsmi_interface.AmdSmiMemoryType.VIS_VRAM)
-                    memory_usage['total_visible_vram'] = total_visible_vram // (1024*1024)
-                except amdsmi_exception.AmdSmiLibraryException as e:
-                    logging.debug("Failed to get total VIS VRAM memory for gpu %s | %s", gpu_id, e.get_error_info())
-
-                try:
-                    total_gtt = amdsmi_interface.amdsmi_get_gpu_memory_total(args.gpu, amdsmi_interface.AmdSmiMemoryType.GTT)
-                    memory_usage['total_gtt'] = total_gtt // (1024*1024)
-                except amdsmi_exception.AmdSmiLibraryException as e:
-                    logging.debug("Failed to get total GTT memory for gpu %s | %s", gpu_id, e.get_error_info())
-
-                # Used VRAM
-                try:
-                    used_vram = amdsmi_interface.amdsmi_get_gpu_memory_usage(args.gpu, amdsmi_interface.AmdSmiMemoryType.VRAM)
-                    memory_usage['used_vram'] = used_vram // (1024*1024)
-
-                except amdsmi_exception.AmdSmiLibraryException as e:
-                    logging.debug("Failed to get used VRAM memory for gpu %s | %s", gpu_id, e.get_error_info())
-
-                try:
-                    used_visible_vram = amdsmi_interface.amdsmi_get_gpu_memory_usage(args.gpu, amdsmi_interface.AmdSmiMemoryType.VIS_VRAM)
-                    memory_usage['used_visible_vram'] = used_visible_vram // (1024*1024)
-                except amdsmi_exception.AmdSmiLibraryException as e:
-                    logging.debug("Failed to get used VIS VRAM memory for gpu %s | %s", gpu_id, e.get_error_info())
-
+                # Total and used VRAM, visible VRAM and GTT, read in one batch
+                # with those of the other gpus listed, if any
                 try:
-                    used_gtt = amdsmi_interface.amdsmi_get_gpu_memory_usage(args.gpu, amdsmi_interface.AmdSmiMemoryType.GTT)
-                    memory_usage['used_gtt'] = used_gtt // (1024*1024)
+                    snapshot = self.sysfs_snapshots.pop(args.gpu.value, None)
+                    if snapshot is None:
+                        snapshot = amdsmi_interface.amdsmi_get_gpu_sysfs_snapshot([args.gpu])[0]
+                    logging.debug(f"sysfs snapshot dictionary = {snapshot}")
+                    snapshot_keys = {'total_vram': 'vram_total',
+                                     'used_vram': 'vram_used',
+                                     'total_visible_vram': 'vis_vram_total',
+                                     'used_visible_vram': 'vis_vram_used',
+                                     'total_gtt': 'gtt_total',
+                                     'used_gtt': 'gtt_used'}
+                    for key, snapshot_key in snapshot_keys.items():
+                        if snapshot[snapshot_key] != "N/A":
+                            memory_usage[key] = snapshot[snapshot_key] // (1024*1024)
                 except amdsmi_exception.AmdSmiLibraryException as e:
-                    logging.debug("Failed to get used GTT memory for gpu %s | %s", gpu_id, e.get_error_info())
+                    logging.debug("Failed to get memory usage for gpu %s | %s", gpu_id, e.get_error_info())
 
                 # Free VRAM
                 if memory_usage['total_vram'] != "N/A" and memory_usage['used_vram'] != "N/A":
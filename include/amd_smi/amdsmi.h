@@ -623,6 +623,112 @@ typedef struct {
     uint32_t reserved[2];
 } amdsmi_vram_usage_t;
 
+/**
+ * @brief Snapshot of a processor's frequently polled sysfs attributes.
+ * Attributes which could not be read are set to UINT64_MAX.
+ *
+ * @cond @tag{gpu_bm_linux} @endcond
+ */
+typedef struct {
+    uint64_t gfx_activity;       //!< In %, from gpu_busy_percent
+    uint64_t umc_activity;       //!< In %, from mem_busy_percent
+    uint64_t vram_total;         //!< In bytes
+    uint64_t vram_used;          //!< In bytes
+    uint64_t vis_vram_total;     //!< In bytes
+    uint64_t vis_vram_used;      //!< In bytes
+    uint64_t gtt_total;          //!< In bytes
+    uint64_t gtt_used;           //!< In bytes
+    uint64_t pcie_replay_count;
+    amdsmi_status_t status;      //!< ::AMDSMI_STATUS_SUCCESS if any attribute was read
+    uint32_t reserved[13];
+} amdsmi_gpu_sysfs_snapshot_t;
+
+/**
+ * @brief Snapshot of a processor's hwmon sensors, read in one pass.
+ * Sensors which could not be read are set to INT64_MAX.
+ *
+ * @cond @tag{gpu_bm_linux} @endcond
+ */
+typedef struct {
+    int64_t temperature[AMDSMI_TEMPERATURE_TYPE_VRAM + 1];  //!< In C, indexed by ::amdsmi_temperature_type_t (edge, hotspot and vram)
+    int64_t gfx_voltage;            //!< In mV
+    int64_t fan_rpms;               //!< Of the first fan
+    int64_t fan_speed;              //!< Of the first fan, 0 to ::AMDSMI_MAX_FAN_SPEED
+    int64_t average_socket_power;   //!< In uW
+    int64_t current_socket_power;   //!< In uW
+    uint32_t reserved[12];
+} amdsmi_gpu_hwmon_snapshot_t;
+
+/**
+ * @brief Performance counters of one library function on one GPU, see
+ * ::amdsmi_get_lib_perf_stats(). Latency percentiles are estimated from
+ * power of 2 buckets, so are within a factor of 2 of the exact value.
+ *
+ * @cond @tag{gpu_bm_linux} @endcond
+ */
+typedef struct {
+    char api[AMDSMI_MAX_STRING_LENGTH];  //!< Function name (amdsmi_* or the rsmi_* it is built on)
+    uint32_t gpu_index;          //!< GPU the calls were made on; UINT32_MAX if none
+    uint64_t calls;
+    uint64_t total_ns;           //!< Cumulative latency
+    uint64_t min_ns;
+    uint64_t max_ns;
+    uint64_t p50_ns;
+    uint64_t p90_ns;
+    uint64_t p99_ns;
+    uint64_t file_opens;         //!< sysfs/procfs opens, including those of nested calls
+    uint64_t file_reads;         //!< sysfs/procfs reads, including those of nested calls
+    uint64_t ioctls;             //!< DRM and KFD ioctls, including those of nested calls
+    uint32_t reserved[8];
+} amdsmi_lib_perf_stats_t;
+
+/**
+ * @brief Library locks whose waits are counted, see ::amdsmi_get_lib_lock_stats()
+ *
+ * @cond @tag{gpu_bm_linux} @endcond
+ */
+typedef enum {
+    AMDSMI_LIB_LOCK_DEVICE = 0,            //!< A GPU's lock, within this process
+    AMDSMI_LIB_LOCK_DEVICE_CROSS_PROCESS,  //!< A GPU's lock shared with other processes
+                                           //!< (AMDSMI_MUTEX_CROSS_PROCESS=1)
+    AMDSMI_LIB_LOCK_DRM,                   //!< DRM ioctls on a GPU's render node
+    AMDSMI_LIB_LOCK_KFD_EVENT,             //!< KFD event notification setup
+    AMDSMI_LIB_LOCK_LOGGER                 //!< Library log (RSMI_LOGGING)
+} amdsmi_lib_lock_type_t;
+
+#define AMDSMI_LIB_LOCK_WAIT_BUCKETS 40  //!< Buckets of ::amdsmi_lib_lock_stats_t::wait_histogram
+
+/**
+ * @brief Waits for one library lock, on one GPU for the per GPU locks. See
+ * ::amdsmi_get_lib_lock_stats(). Only acquisitions that found the lock
+ * taken, and failed ones, wait; the wait times and their percentiles are of
+ * those. Percentiles are estimated from the histogram, so are within a
+ * factor of 2 of the exact value.
+ *
+ * @cond @tag{gpu_bm_linux} @endcond
+ */
+typedef struct {
+    amdsmi_lib_lock_type_t lock;
+    uint32_t gpu_index;          //!< GPU of the lock; UINT32_MAX for process wide locks, and
+                                 //!< for cross process locks being set up by amdsmi_init()
+    uint64_t acquisitions;
+    uint64_t contended;          //!< Acquisitions that had to wait
+    uint64_t failures;           //!< Not acquired: busy, or timed out (RSMI_MUTEX_TIMEOUT)
+    uint64_t total_wait_ns;
+    uint64_t max_wait_ns;
+    uint64_t p50_wait_ns;
+    uint64_t p90_wait_ns;
+    uint64_t p99_wait_ns;
+    uint64_t wait_histogram[AMDSMI_LIB_LOCK_WAIT_BUCKETS];  //!< Waits in [2^i, 2^(i + 1)) ns;
+                                                            //!< the last bucket holds all above
+    uint32_t holders;            //!< Current holds in this process
+    uint32_t holder_tid;         //!< Thread that last took the lock, while held
+    uint64_t held_ns;            //!< How long the lock has been held, 0 if it is not
+    uint32_t owner_pid;          //!< Cross process locks: process that last locked it, which
+                                 //!< may have unlocked it since; 0 otherwise
+    uint32_t reserved[7];
+} amdsmi_lib_lock_stats_t;
+
 /**
  * @brief This structure hold violation status information.
  *        Note: for MI3x asics and higher, older ASICs will show unsupported.
@@ -1897,6 +2003,150 @@ typedef struct {
     uint16_t xgmi_link_status[AMDSMI_MAX_NUM_XGMI_LINKS]; //!< XGMI link status(up/down)
 } amdsmi_gpu_metrics_t;
 
+/**
+ * @brief GPU metric fields which can be queried with ::amdsmi_get_gpu_metrics_fields.
+ * Availability depends on the gpu metrics version of the device.
+ *
+ * @cond @tag{gpu_bm_linux} @endcond
+ */
+typedef enum {
+    // Temperature
+    AMDSMI_GPU_METRIC_TEMP_EDGE = 0,
+    AMDSMI_GPU_METRIC_FIRST = AMDSMI_GPU_METRIC_TEMP_EDGE,
+    AMDSMI_GPU_METRIC_TEMP_HOTSPOT,
+    AMDSMI_GPU_METRIC_TEMP_MEM,
+    AMDSMI_GPU_METRIC_TEMP_VRGFX,
+    AMDSMI_GPU_METRIC_TEMP_VRSOC,
+    AMDSMI_GPU_METRIC_TEMP_VRMEM,
+    AMDSMI_GPU_METRIC_TEMP_HBM,                      //!< Multi-valued
+
+    // Utilization
+    AMDSMI_GPU_METRIC_AVG_GFX_ACTIVITY,
+    AMDSMI_GPU_METRIC_AVG_UMC_ACTIVITY,
+    AMDSMI_GPU_METRIC_AVG_MM_ACTIVITY,
+    AMDSMI_GPU_METRIC_GFX_ACTIVITY_ACC,
+    AMDSMI_GPU_METRIC_MEM_ACTIVITY_ACC,
+    AMDSMI_GPU_METRIC_VCN_ACTIVITY,                  //!< Multi-valued
+    AMDSMI_GPU_METRIC_JPEG_ACTIVITY,                 //!< Multi-valued
+
+    // Average clocks
+    AMDSMI_GPU_METRIC_AVG_GFXCLK,
+    AMDSMI_GPU_METRIC_AVG_SOCCLK,
+    AMDSMI_GPU_METRIC_AVG_UCLK,
+    AMDSMI_GPU_METRIC_AVG_VCLK0,
+    AMDSMI_GPU_METRIC_AVG_DCLK0,
+    AMDSMI_GPU_METRIC_AVG_VCLK1,
+    AMDSMI_GPU_METRIC_AVG_DCLK1,
+
+    // Current clocks (multi-valued from gpu metrics v1.4)
+    AMDSMI_GPU_METRIC_CURR_GFXCLK,
+    AMDSMI_GPU_METRIC_CURR_SOCCLK,
+    AMDSMI_GPU_METRIC_CURR_UCLK,
+    AMDSMI_GPU_METRIC_CURR_VCLK0,
+    AMDSMI_GPU_METRIC_CURR_DCLK0,
+    AMDSMI_GPU_METRIC_CURR_VCLK1,
+    AMDSMI_GPU_METRIC_CURR_DCLK1,
+
+    // Throttle status
+    AMDSMI_GPU_METRIC_THROTTLE_STATUS,
+    AMDSMI_GPU_METRIC_INDEP_THROTTLE_STATUS,
+    AMDSMI_GPU_METRIC_GFXCLK_LOCK_STATUS,
+
+    // Fan
+    AMDSMI_GPU_METRIC_CURR_FAN_SPEED,
+
+    // Link width/speed
+    AMDSMI_GPU_METRIC_PCIE_LINK_WIDTH,
+    AMDSMI_GPU_METRIC_PCIE_LINK_SPEED,
+    AMDSMI_GPU_METRIC_PCIE_BANDWIDTH_ACC,
+    AMDSMI_GPU_METRIC_PCIE_BANDWIDTH_INST,
+    AMDSMI_GPU_METRIC_XGMI_LINK_WIDTH,
+    AMDSMI_GPU_METRIC_XGMI_LINK_SPEED,
+    AMDSMI_GPU_METRIC_XGMI_READ_DATA_ACC,            //!< Multi-valued
+    AMDSMI_GPU_METRIC_XGMI_WRITE_DATA_ACC,           //!< Multi-valued
+    AMDSMI_GPU_METRIC_PCIE_L0_TO_RECOV_COUNT_ACC,
+    AMDSMI_GPU_METRIC_PCIE_REPLAY_COUNT_ACC,
+    AMDSMI_GPU_METRIC_PCIE_REPLAY_ROVER_COUNT_ACC,
+    AMDSMI_GPU_METRIC_PCIE_NAK_SENT_COUNT_ACC,
+    AMDSMI_GPU_METRIC_PCIE_NAK_RCVD_COUNT_ACC,
+
+    // Power/Energy
+    AMDSMI_GPU_METRIC_AVG_SOCKET_POWER,
+    AMDSMI_GPU_METRIC_CURR_SOCKET_POWER,
+    AMDSMI_GPU_METRIC_ENERGY_ACC,
+
+    // Voltage
+    AMDSMI_GPU_METRIC_VOLTAGE_SOC,
+    AMDSMI_GPU_METRIC_VOLTAGE_GFX,
+    AMDSMI_GPU_METRIC_VOLTAGE_MEM,
+
+    // Timestamps
+    AMDSMI_GPU_METRIC_SYSTEM_CLOCK_COUNTER,
+    AMDSMI_GPU_METRIC_FIRMWARE_TIMESTAMP,
+
+    // Throttle residency
+    AMDSMI_GPU_METRIC_ACCUMULATION_COUNTER,
+    AMDSMI_GPU_METRIC_PROCHOT_RESIDENCY_ACC,
+    AMDSMI_GPU_METRIC_PPT_RESIDENCY_ACC,
+    AMDSMI_GPU_METRIC_SOCKET_THM_RESIDENCY_ACC,
+    AMDSMI_GPU_METRIC_VR_THM_RESIDENCY_ACC,
+    AMDSMI_GPU_METRIC_HBM_THM_RESIDENCY_ACC,
+
+    // Partition
+    AMDSMI_GPU_METRIC_NUM_PARTITION,
+
+    // XCP stats (first XCP)
+    AMDSMI_GPU_METRIC_XCP_GFX_BUSY_INST,             //!< Multi-valued
+    AMDSMI_GPU_METRIC_XCP_JPEG_BUSY,                 //!< Multi-valued
+    AMDSMI_GPU_METRIC_XCP_VCN_BUSY,                  //!< Multi-valued
+    AMDSMI_GPU_METRIC_XCP_GFX_BUSY_ACC,              //!< Multi-valued
+    AMDSMI_GPU_METRIC_PCIE_LC_PERF_OTHER_END_RECOVERY,
+
+    AMDSMI_GPU_METRIC_VRAM_MAX_BANDWIDTH,
+    AMDSMI_GPU_METRIC_XGMI_LINK_STATUS,              //!< Multi-valued
+    AMDSMI_GPU_METRIC_GFX_BELOW_HOST_LIMIT_ACC,      //!< Multi-valued
+    AMDSMI_GPU_METRIC__MAX = AMDSMI_GPU_METRIC_GFX_BELOW_HOST_LIMIT_ACC
+} amdsmi_gpu_metric_field_t;
+
+/**
+ * @brief Max number of values a single ::amdsmi_gpu_metric_field_t can hold.
+ * Largest multi-valued field is AMDSMI_GPU_METRIC_XCP_JPEG_BUSY
+ *
+ * @cond @tag{gpu_bm_linux} @endcond
+ */
+#define AMDSMI_MAX_NUM_GPU_METRIC_FIELD_VALUES AMDSMI_MAX_NUM_JPEG
+
+/**
+ * @brief Value(s) of a single gpu metric field
+ *
+ * @cond @tag{gpu_bm_linux} @endcond
+ */
+typedef struct {
+    amdsmi_status_t status;  //!< ::AMDSMI_STATUS_NOT_SUPPORTED if the field is N/A
+    uint32_t num_values;     //!< Number of valid entries in values
+    uint64_t values[AMDSMI_MAX_NUM_GPU_METRIC_FIELD_VALUES];  //!< Raw values; as reported by gpu metrics
+} amdsmi_gpu_metric_field_value_t;
+
+//! Most samples the background sampler keeps per GPU, see ::amdsmi_sampler_start
+#define AMDSMI_MAX_SAMPLER_HISTORY_DEPTH 1024
+
+/**
+ * @brief Rate(s) of a single gpu metric accumulator field
+ *
+ * Units depend on the field: W for ::AMDSMI_GPU_METRIC_ENERGY_ACC, GB/s for
+ * the XGMI data accumulators, percent of the accumulation counter for the
+ * residency accumulators, and events per second for the other counters.
+ *
+ * @cond @tag{gpu_bm_linux} @endcond
+ */
+typedef struct {
+    amdsmi_status_t status;  //!< ::AMDSMI_STATUS_NO_DATA until a previous read of the field exists
+    uint32_t num_values;     //!< Number of entries in rate and ewma_rate
+    uint64_t interval_ns;    //!< Time between the two reads the rate is derived from
+    double rate[AMDSMI_MAX_NUM_GPU_METRIC_FIELD_VALUES];       //!< Rate over the last interval; NaN if N/A
+    double ewma_rate[AMDSMI_MAX_NUM_GPU_METRIC_FIELD_VALUES];  //!< Exponentially weighted moving average of rate; NaN if N/A
+} amdsmi_gpu_metric_rate_t;
+
 /**
  * @brief XGMI Link Status Type
  *
@@ -1944,6 +2194,93 @@ typedef enum {
     AMDSMI_REG_USR1,
 } amdsmi_reg_type_t;
 
+/**
+ * @brief Queries which can be run asynchronously by ::amdsmi_async_submit,
+ * with the type of the output they expect
+ *
+ * @cond @tag{gpu_bm_linux} @endcond
+ */
+typedef enum {
+    AMDSMI_ASYNC_OP_GPU_METRICS_INFO,   //!< ::amdsmi_get_gpu_metrics_info, amdsmi_gpu_metrics_t
+    AMDSMI_ASYNC_OP_PCI_THROUGHPUT,     //!< ::amdsmi_get_gpu_pci_throughput,
+                                        //!< amdsmi_async_pci_throughput_t
+    AMDSMI_ASYNC_OP_VIOLATION_STATUS,   //!< ::amdsmi_get_violation_status,
+                                        //!< amdsmi_violation_status_t
+    AMDSMI_ASYNC_OP_PROCESS_LIST,       //!< ::amdsmi_get_gpu_process_list,
+                                        //!< amdsmi_async_process_list_t
+    AMDSMI_ASYNC_OP_PM_METRICS_INFO,    //!< ::amdsmi_get_gpu_pm_metrics_info,
+                                        //!< amdsmi_async_name_value_list_t
+    AMDSMI_ASYNC_OP_ACTIVITY,           //!< ::amdsmi_get_gpu_activity, amdsmi_engine_usage_t
+    AMDSMI_ASYNC_OP_POWER_INFO,         //!< ::amdsmi_get_power_info of sensor 0,
+                                        //!< amdsmi_power_info_t
+    AMDSMI_ASYNC_OP__MAX = AMDSMI_ASYNC_OP_POWER_INFO
+} amdsmi_async_op_t;
+
+/**
+ * @brief Identifies a request submitted with ::amdsmi_async_submit; never 0
+ *
+ * @cond @tag{gpu_bm_linux} @endcond
+ */
+typedef uint64_t amdsmi_async_request_t;
+
+/**
+ * @brief Output of ::AMDSMI_ASYNC_OP_PCI_THROUGHPUT
+ *
+ * @cond @tag{gpu_bm_linux} @endcond
+ */
+typedef struct {
+    uint64_t sent;        //!< Bytes sent in the 1 second window
+    uint64_t received;    //!< Bytes received in the 1 second window
+    uint64_t max_pkt_sz;  //!< Maximum packet size
+} amdsmi_async_pci_throughput_t;
+
+/**
+ * @brief Output of ::AMDSMI_ASYNC_OP_PROCESS_LIST
+ *
+ * @cond @tag{gpu_bm_linux} @endcond
+ */
+typedef struct {
+    amdsmi_proc_info_t *list;   //!< Caller provided buffer of max_processes entries
+    uint32_t max_processes;     //!< In: size of list. Out: number of processes, as
+                                //!< ::amdsmi_get_gpu_process_list returns it
+} amdsmi_async_process_list_t;
+
+/**
+ * @brief Output of ::AMDSMI_ASYNC_OP_PM_METRICS_INFO
+ *
+ * @cond @tag{gpu_bm_linux} @endcond
+ */
+typedef struct {
+    amdsmi_name_value_t *metrics;  //!< Allocated by the library on success; free it
+                                   //!< with ::amdsmi_free_name_value_pairs
+    uint32_t num_metrics;          //!< Number of entries in metrics
+} amdsmi_async_name_value_list_t;
+
+/**
+ * @brief A completed asynchronous request, as returned by
+ * ::amdsmi_async_get_completions
+ *
+ * @cond @tag{gpu_bm_linux} @endcond
+ */
+typedef struct {
+    amdsmi_async_request_t request;  //!< As returned by ::amdsmi_async_submit
+    amdsmi_async_op_t op;            //!< The query which was run
+    amdsmi_processor_handle processor_handle;  //!< The processor it was run on
+    void *out;                       //!< The output passed to ::amdsmi_async_submit
+    void *user_data;                 //!< The user data passed to ::amdsmi_async_submit
+    amdsmi_status_t status;          //!< What the query returned
+} amdsmi_async_completion_t;
+
+/**
+ * @brief Called on a library thread when an asynchronous request completes.
+ * It holds up other requests while it runs, so it should return quickly and
+ * not block. It must not call ::amdsmi_shut_down, which then returns
+ * ::AMDSMI_STATUS_BUSY.
+ *
+ * @cond @tag{gpu_bm_linux} @endcond
+ */
+typedef void (*amdsmi_async_callback_t)(const amdsmi_async_completion_t *completion);
+
 /**
  * @brief This structure holds ras feature
  *
@@ -2245,9 +2582,11 @@ amdsmi_status_t amdsmi_init(uint64_t init_flags);
  *  @platform{guest_mvf} @platform{guest_windows}
  *
  *  @details This function shuts down the library and internal data structures and
- *  performs any necessary clean ups.
+ *  performs any necessary clean ups. It can not be called from an
+ *  ::amdsmi_async_callback_t, which runs on a library thread it waits for.
  *
- *  @return ::amdsmi_status_t | ::AMDSMI_STATUS_SUCCESS on success, non-zero on fail
+ *  @return ::amdsmi_status_t | ::AMDSMI_STATUS_SUCCESS on success,
+ *          ::AMDSMI_STATUS_BUSY if called from an asynchronous callback, non-zero on fail
  */
 amdsmi_status_t amdsmi_shut_down(void);
 
@@ -2551,6 +2890,37 @@ amdsmi_status_t amdsmi_get_processor_handle_from_bdf(amdsmi_bdf_t bdf, amdsmi_pr
 amdsmi_status_t
 amdsmi_get_gpu_device_bdf(amdsmi_processor_handle processor_handle, amdsmi_bdf_t *bdf);
 
+/**
+ *  @brief Returns the generation of the given device
+ *
+ *  @ingroup tagProcDiscovery
+ *
+ *  @platform{gpu_bm_linux}
+ *
+ *  @details The generation changes whenever the device may have changed
+ *  underneath the library: its compute or memory partition was
+ *  reconfigured, its DRM nodes were added or removed, the KFD topology was
+ *  updated or the driver was reloaded. Anything an application derived from
+ *  the device (ie: partition layout, process lists, cached static
+ *  information) is still valid as long as the generation is unchanged, so
+ *  it can be checked without re-reading sysfs. The value itself has no
+ *  meaning beyond that.
+ *
+ *  Changes are watched by a library thread started by amdsmi_init(). It
+ *  is not started if RSMI_DEVICE_WATCHER_DISABLE is set to a non-zero value.
+ *
+ *  @param[in]      processor_handle Device which to query
+ *
+ *  @param[out]     generation Pointer to the generation. Must be allocated
+ *                  by user.
+ *
+ *  @return ::amdsmi_status_t | ::AMDSMI_STATUS_SUCCESS on success,
+ *  ::AMDSMI_STATUS_NOT_SUPPORTED if device changes are not watched,
+ *  non-zero on fail
+ */
+amdsmi_status_t
+amdsmi_get_gpu_generation(amdsmi_processor_handle processor_handle, uint64_t *generation);
+
 /**
  *  @brief          Returns the UUID of the device
  *
@@ -2927,6 +3297,48 @@ amdsmi_status_t amdsmi_get_gpu_topo_numa_affinity(amdsmi_processor_handle proces
 amdsmi_status_t amdsmi_get_gpu_pci_throughput(amdsmi_processor_handle processor_handle, uint64_t *sent,
                                               uint64_t *received, uint64_t *max_pkt_sz);
 
+/**
+ *  @brief Get the last measured PCIe traffic without waiting for a
+ *  measurement. It is not supported on virtual machine guest
+ *
+ *  @ingroup tagPCIeQuery
+ *
+ *  @platform{gpu_bm_linux}
+ *
+ *  @details Same as ::amdsmi_get_gpu_pci_throughput(), except that the 1
+ *  second measurement runs on a library thread, back to back, and this
+ *  function returns right away with the last completed window. The age of
+ *  that window, in milliseconds since it closed, is written to @p age_ms.
+ *
+ *  The first call starts the measurements and returns
+ *  ::AMDSMI_STATUS_NO_DATA; a result is available about a second later.
+ *  Measurements stop when the function has not been called for 10 seconds,
+ *  and resume on the next call, which then returns the last window measured
+ *  before with its age. Other calls on the processor are not delayed while a
+ *  measurement is in flight.
+ *
+ *  @param[in] processor_handle a processor handle
+ *
+ *  @param[in,out] sent a pointer to uint64_t to which the number of bytes sent
+ *  in the window will be written. If pointer is NULL, it will be ignored.
+ *
+ *  @param[in,out] received a pointer to uint64_t to which the number of bytes
+ *  received in the window will be written. If pointer is NULL, it will be
+ *  ignored.
+ *
+ *  @param[in,out] max_pkt_sz a pointer to uint64_t to which the maximum packet
+ *  size will be written. If pointer is NULL, it will be ignored.
+ *
+ *  @param[out] age_ms a pointer to uint64_t to which the age of the window in
+ *  milliseconds will be written. Must not be NULL.
+ *
+ *  @return ::amdsmi_status_t | ::AMDSMI_STATUS_SUCCESS on success,
+ *          ::AMDSMI_STATUS_NO_DATA if no window has completed yet, non-zero on fail
+ */
+amdsmi_status_t amdsmi_get_gpu_pci_throughput_latest(amdsmi_processor_handle processor_handle,
+                                                     uint64_t *sent, uint64_t *received,
+                                                     uint64_t *max_pkt_sz, uint64_t *age_ms);
+
 /**
  *  @brief Get PCIe replay counter
  *
@@ -3257,6 +3669,41 @@ amdsmi_status_t
 amdsmi_get_gpu_memory_usage(amdsmi_processor_handle processor_handle, amdsmi_memory_type_t mem_type,
                             uint64_t *used);
 
+/**
+ *  @brief Get a snapshot of the activity and memory usage of several
+ *  processors at once.
+ *
+ *  @ingroup tagMemoryQuery
+ *
+ *  @platform{gpu_bm_linux}
+ *
+ *  @details Given an array of @p num_handles processor handles
+ *  @p processor_handles and an array of @p num_handles
+ *  ::amdsmi_gpu_sysfs_snapshot_t @p snapshots, this function reads the
+ *  gpu/memory busy percentages, the total and used VRAM, visible VRAM and
+ *  GTT memory, and the PCIe replay count of all processors in one batch.
+ *  Where the kernel supports io_uring, all of these reads are submitted
+ *  together; otherwise they are read one after another. Entry i of
+ *  @p snapshots holds the values of @p processor_handles[i]. As with
+ *  ::amdsmi_get_gpu_memory_total and ::amdsmi_get_gpu_memory_usage, the VRAM
+ *  of processors which report none (ie: APUs) is the memory reported by KFD.
+ *
+ *  @param[in] processor_handles an array of processor handles
+ *
+ *  @param[in] num_handles number of entries in @p processor_handles and
+ *  @p snapshots
+ *
+ *  @param[out] snapshots an array of ::amdsmi_gpu_sysfs_snapshot_t which
+ *  will hold the values of each processor
+ *
+ *  @return ::amdsmi_status_t | ::AMDSMI_STATUS_SUCCESS if all processors were
+ *  read (see each snapshot's status for its result), non-zero on fail
+ */
+amdsmi_status_t
+amdsmi_get_gpu_sysfs_snapshot(const amdsmi_processor_handle *processor_handles,
+                              uint32_t num_handles,
+                              amdsmi_gpu_sysfs_snapshot_t *snapshots);
+
 /**
  *  @brief Get the bad pages of a processor. It is not supported on virtual
  *  machine guest
@@ -3595,6 +4042,36 @@ amdsmi_status_t amdsmi_get_gpu_volt_metric(amdsmi_processor_handle processor_han
                                            amdsmi_voltage_type_t sensor_type,
                                            amdsmi_voltage_metric_t metric, int64_t *voltage);
 
+/**
+ *  @brief Get the current temperatures, voltage, fan speed and power of a
+ *  device, read from its hwmon sensors in one pass. It is not supported on
+ *  virtual machine guest
+ *
+ *  @ingroup tagPhysicalStateQuery
+ *
+ *  @platform{gpu_bm_linux}
+ *
+ *  @details Given a processor handle @p processor_handle and a pointer to an
+ *  ::amdsmi_gpu_hwmon_snapshot_t @p snapshot, this function reads all the
+ *  hwmon input sensors of the device while holding the device lock once, and
+ *  writes their values to @p snapshot. The values are those of
+ *  ::amdsmi_get_temp_metric (::AMDSMI_TEMP_CURRENT),
+ *  ::amdsmi_get_gpu_volt_metric (::AMDSMI_VOLT_CURRENT),
+ *  ::amdsmi_get_gpu_fan_rpms, ::amdsmi_get_gpu_fan_speed and the hwmon
+ *  power1_average and power1_input files. Sensors which the device doesn't
+ *  have are set to INT64_MAX.
+ *
+ *  @param[in] processor_handle a processor handle
+ *
+ *  @param[out] snapshot a pointer to an ::amdsmi_gpu_hwmon_snapshot_t to
+ *  which the sensor values will be written
+ *
+ *  @return ::amdsmi_status_t | ::AMDSMI_STATUS_SUCCESS if any sensor could be
+ *  read, ::AMDSMI_STATUS_NOT_SUPPORTED if none could
+ */
+amdsmi_status_t amdsmi_get_gpu_hwmon_snapshot(amdsmi_processor_handle processor_handle,
+                                              amdsmi_gpu_hwmon_snapshot_t *snapshot);
+
 /** @} End tagPhysicalStateQuery */
 
 /*****************************************************************************/
@@ -3910,6 +4387,348 @@ amdsmi_get_gpu_metrics_header_info(amdsmi_processor_handle processor_handle, amd
 amdsmi_status_t amdsmi_get_gpu_metrics_info(amdsmi_processor_handle processor_handle,
                                             amdsmi_gpu_metrics_t *pgpu_metrics);
 
+/**
+ *  @brief Get the gpu metrics information of several processors at once.
+ *
+ *  @ingroup tagClkPowerPerfQuery
+ *
+ *  @platform{gpu_bm_linux}
+ *
+ *  @details Given an array of @p num_handles processor handles
+ *  @p processor_handles, an array of @p num_handles ::amdsmi_gpu_metrics_t
+ *  @p pgpu_metrics and an array of @p num_handles ::amdsmi_status_t
+ *  @p statuses, this function reads the gpu metrics of all processors
+ *  concurrently, on a library worker pool, and returns once all of them are
+ *  done. Entry i of @p pgpu_metrics and @p statuses holds the result of
+ *  ::amdsmi_get_gpu_metrics_info for @p processor_handles[i].
+ *
+ *  @param[in] processor_handles an array of processor handles
+ *
+ *  @param[in] num_handles number of entries in @p processor_handles,
+ *  @p pgpu_metrics and @p statuses
+ *
+ *  @param[out] pgpu_metrics an array of ::amdsmi_gpu_metrics_t which will
+ *  hold the gpu metrics of each processor
+ *
+ *  @param[out] statuses an array of ::amdsmi_status_t which will hold the
+ *  status of each processor's read
+ *
+ *  @return ::amdsmi_status_t | ::AMDSMI_STATUS_SUCCESS if all processors were
+ *  read (see @p statuses for each result), non-zero on fail
+ */
+amdsmi_status_t amdsmi_get_gpu_metrics_info_bulk(const amdsmi_processor_handle *processor_handles,
+                                                 uint32_t num_handles,
+                                                 amdsmi_gpu_metrics_t *pgpu_metrics,
+                                                 amdsmi_status_t *statuses);
+
+/**
+ *  @brief Get a set of gpu metrics fields from a single gpu metrics read.
+ *
+ *  @ingroup tagClkPowerPerfQuery
+ *
+ *  @platform{gpu_bm_linux}
+ *
+ *  @details Given a processor handle @p processor_handle, an array of
+ *  @p num_fields ::amdsmi_gpu_metric_field_t @p fields, and an array of
+ *  @p num_fields ::amdsmi_gpu_metric_field_value_t @p values, this function
+ *  reads the gpu metrics table once and writes the value(s) of each
+ *  requested field to the matching entry of @p values. Fields which are not
+ *  available for the gpu metrics version of the device have their status set
+ *  to ::AMDSMI_STATUS_NOT_SUPPORTED.
+ *
+ *  @param[in] processor_handle a processor handle
+ *
+ *  @param[in] fields an array of ::amdsmi_gpu_metric_field_t to query
+ *
+ *  @param[in] num_fields number of entries in @p fields and @p values
+ *
+ *  @param[out] values an array of ::amdsmi_gpu_metric_field_value_t which
+ *  will hold the field values
+ *
+ *  @return ::amdsmi_status_t | ::AMDSMI_STATUS_SUCCESS on success, non-zero on fail
+ */
+amdsmi_status_t amdsmi_get_gpu_metrics_fields(amdsmi_processor_handle processor_handle,
+                                              const amdsmi_gpu_metric_field_t *fields,
+                                              uint32_t num_fields,
+                                              amdsmi_gpu_metric_field_value_t *values);
+
+/**
+ *  @brief Set the maximum age of the cached gpu metrics snapshot.
+ *
+ *  @ingroup tagClkPowerPerfQuery
+ *
+ *  @platform{gpu_bm_linux}
+ *
+ *  @details Given a processor handle @p processor_handle and an age in
+ *  milliseconds @p max_age_ms, gpu metrics queries for the processor
+ *  (::amdsmi_get_gpu_metrics_info and the APIs built on it) are served from
+ *  the last snapshot read for up to @p max_age_ms. An older snapshot is
+ *  re-read from the driver, and only re-parsed if the firmware timestamp
+ *  changed. A value of 0 (default, unless the RSMI_GPU_METRICS_MAX_AGE_MS
+ *  environment variable is set) re-reads the table on every query.
+ *
+ *  @param[in] processor_handle a processor handle
+ *
+ *  @param[in] max_age_ms maximum age of the snapshot, in milliseconds
+ *
+ *  @return ::amdsmi_status_t | ::AMDSMI_STATUS_SUCCESS on success, non-zero on fail
+ */
+amdsmi_status_t amdsmi_set_gpu_metrics_cache_max_age(amdsmi_processor_handle processor_handle,
+                                                     uint32_t max_age_ms);
+
+/**
+ *  @brief Get the maximum age of the cached gpu metrics snapshot.
+ *
+ *  @ingroup tagClkPowerPerfQuery
+ *
+ *  @platform{gpu_bm_linux}
+ *
+ *  @details Given a processor handle @p processor_handle and a pointer to a
+ *  uint32_t @p max_age_ms, this function will write the maximum age (in
+ *  milliseconds) of the gpu metrics snapshot to @p max_age_ms.
+ *
+ *  @param[in] processor_handle a processor handle
+ *
+ *  @param[out] max_age_ms a pointer to uint32_t to which the maximum age
+ *  will be written
+ *
+ *  @return ::amdsmi_status_t | ::AMDSMI_STATUS_SUCCESS on success, non-zero on fail
+ */
+amdsmi_status_t amdsmi_get_gpu_metrics_cache_max_age(amdsmi_processor_handle processor_handle,
+                                                     uint32_t *max_age_ms);
+
+/**
+ *  @brief Invalidate the cached gpu metrics snapshot.
+ *
+ *  @ingroup tagClkPowerPerfQuery
+ *
+ *  @platform{gpu_bm_linux}
+ *
+ *  @details Given a processor handle @p processor_handle, the next gpu
+ *  metrics query for the processor will re-read and re-parse the metrics
+ *  table, regardless of the snapshot age.
+ *
+ *  @param[in] processor_handle a processor handle
+ *
+ *  @return ::amdsmi_status_t | ::AMDSMI_STATUS_SUCCESS on success, non-zero on fail
+ */
+amdsmi_status_t amdsmi_invalidate_gpu_metrics_cache(amdsmi_processor_handle processor_handle);
+
+/**
+ *  @brief Refresh the cached gpu metrics snapshot.
+ *
+ *  @ingroup tagClkPowerPerfQuery
+ *
+ *  @platform{gpu_bm_linux}
+ *
+ *  @details Given a processor handle @p processor_handle, the metrics table
+ *  is re-read and re-parsed right away, and the snapshot age is reset.
+ *
+ *  @param[in] processor_handle a processor handle
+ *
+ *  @return ::amdsmi_status_t | ::AMDSMI_STATUS_SUCCESS on success, non-zero on fail
+ */
+amdsmi_status_t amdsmi_refresh_gpu_metrics_cache(amdsmi_processor_handle processor_handle);
+
+/**
+ *  @brief Start sampling gpu metrics fields of all GPUs in the background.
+ *
+ *  @ingroup tagClkPowerPerfQuery
+ *
+ *  @platform{gpu_bm_linux}
+ *
+ *  @details Given a period in microseconds @p period_us, an array of
+ *  @p num_fields ::amdsmi_gpu_metric_field_t @p fields and a history depth
+ *  @p history_depth, this function starts a library thread which reads the
+ *  requested fields of every GPU (as ::amdsmi_get_gpu_metrics_fields does)
+ *  once per period, and keeps the last @p history_depth samples of each GPU.
+ *  The samples are read with ::amdsmi_sampler_get_latest and
+ *  ::amdsmi_sampler_get_history, which do not access the device.
+ *  Calling it while the sampler runs restarts it with the new settings and
+ *  drops the samples taken so far.
+ *
+ *  @param[in] period_us sampling period, in microseconds; must not be 0
+ *
+ *  @param[in] fields an array of ::amdsmi_gpu_metric_field_t to sample
+ *
+ *  @param[in] num_fields number of entries in @p fields
+ *
+ *  @param[in] history_depth number of samples kept per GPU; from 1 to
+ *  ::AMDSMI_MAX_SAMPLER_HISTORY_DEPTH
+ *
+ *  @return ::amdsmi_status_t | ::AMDSMI_STATUS_SUCCESS on success, non-zero on fail
+ */
+amdsmi_status_t amdsmi_sampler_start(uint32_t period_us, const amdsmi_gpu_metric_field_t *fields,
+                                     uint32_t num_fields, uint32_t history_depth);
+
+/**
+ *  @brief Stop the background sampler started by ::amdsmi_sampler_start.
+ *
+ *  @ingroup tagClkPowerPerfQuery
+ *
+ *  @platform{gpu_bm_linux}
+ *
+ *  @details Stops the sampler thread and frees the samples. Does nothing if
+ *  the sampler is not running. The sampler is also stopped by
+ *  ::amdsmi_shut_down.
+ *
+ *  @return ::amdsmi_status_t | ::AMDSMI_STATUS_SUCCESS on success, non-zero on fail
+ */
+amdsmi_status_t amdsmi_sampler_stop(void);
+
+/**
+ *  @brief Get the latest background sample of a GPU.
+ *
+ *  @ingroup tagClkPowerPerfQuery
+ *
+ *  @platform{gpu_bm_linux}
+ *
+ *  @details Given a processor handle @p processor_handle, a pointer to a
+ *  uint64_t @p timestamp_ns and an array of @p num_fields
+ *  ::amdsmi_gpu_metric_field_value_t @p values, this function copies the
+ *  latest sample taken by the background sampler. @p values is filled in
+ *  the order of the fields passed to ::amdsmi_sampler_start, and
+ *  @p num_fields must match their number. If the gpu metrics read of the
+ *  sample failed, the status of every value is the failure status.
+ *
+ *  @param[in] processor_handle a processor handle
+ *
+ *  @param[out] timestamp_ns a pointer to uint64_t to which the time of the
+ *  sample (CLOCK_MONOTONIC, in nanoseconds) will be written
+ *
+ *  @param[out] values an array of ::amdsmi_gpu_metric_field_value_t which
+ *  will hold the sampled field values
+ *
+ *  @param[in] num_fields number of entries in @p values
+ *
+ *  @retval ::AMDSMI_STATUS_SUCCESS is returned upon successful call.
+ *          ::AMDSMI_STATUS_NO_DATA is returned if the sampler is not running
+ *            or has not taken a sample yet
+ *  @return ::amdsmi_status_t
+ */
+amdsmi_status_t amdsmi_sampler_get_latest(amdsmi_processor_handle processor_handle,
+                                          uint64_t *timestamp_ns,
+                                          amdsmi_gpu_metric_field_value_t *values,
+                                          uint32_t num_fields);
+
+/**
+ *  @brief Get the recent background samples of a GPU.
+ *
+ *  @ingroup tagClkPowerPerfQuery
+ *
+ *  @platform{gpu_bm_linux}
+ *
+ *  @details Given a processor handle @p processor_handle, a pointer to a
+ *  uint32_t @p num_samples, an array of @p num_samples uint64_t
+ *  @p timestamps_ns and an array of @p num_samples * @p num_fields
+ *  ::amdsmi_gpu_metric_field_value_t @p values, this function copies up to
+ *  @p num_samples of the newest samples taken by the background sampler,
+ *  oldest first. The values of sample i start at @p values[i * num_fields],
+ *  in the order of the fields passed to ::amdsmi_sampler_start, and
+ *  @p num_fields must match their number.
+ *
+ *  @param[in] processor_handle a processor handle
+ *
+ *  @param[in,out] num_samples As input, the number of samples which fit in
+ *  @p timestamps_ns and @p values. As output, the number of samples copied.
+ *
+ *  @param[out] timestamps_ns an array of uint64_t which will hold the time of
+ *  each sample (CLOCK_MONOTONIC, in nanoseconds)
+ *
+ *  @param[out] values an array of ::amdsmi_gpu_metric_field_value_t which
+ *  will hold the sampled field values
+ *
+ *  @param[in] num_fields number of fields per sample
+ *
+ *  @retval ::AMDSMI_STATUS_SUCCESS is returned upon successful call.
+ *          ::AMDSMI_STATUS_NO_DATA is returned if the sampler is not running
+ *            or has not taken a sample yet
+ *  @return ::amdsmi_status_t
+ */
+amdsmi_status_t amdsmi_sampler_get_history(amdsmi_processor_handle processor_handle,
+                                           uint32_t *num_samples, uint64_t *timestamps_ns,
+                                           amdsmi_gpu_metric_field_value_t *values,
+                                           uint32_t num_fields);
+
+/**
+ *  @brief Get the rates of gpu metrics accumulator fields.
+ *
+ *  @ingroup tagClkPowerPerfQuery
+ *
+ *  @platform{gpu_bm_linux}
+ *
+ *  @details Given a processor handle @p processor_handle, an array of
+ *  @p num_fields ::amdsmi_gpu_metric_field_t @p fields and an array of
+ *  @p num_fields ::amdsmi_gpu_metric_rate_t @p rates, this function reads the
+ *  gpu metrics table once and derives the rate of each requested accumulator
+ *  from the value kept from the previous call for the same processor and
+ *  field, along with an exponentially weighted moving average of the rate.
+ *  Wraparound of 32 bit accumulators is accounted for; a reset accumulator
+ *  starts over. The first call for a field has status
+ *  ::AMDSMI_STATUS_NO_DATA.
+ *
+ *  Supported fields are ::AMDSMI_GPU_METRIC_ENERGY_ACC (W),
+ *  ::AMDSMI_GPU_METRIC_XGMI_READ_DATA_ACC and
+ *  ::AMDSMI_GPU_METRIC_XGMI_WRITE_DATA_ACC (GB/s), the residency accumulators
+ *  and ::AMDSMI_GPU_METRIC_GFX_BELOW_HOST_LIMIT_ACC (percent), and
+ *  ::AMDSMI_GPU_METRIC_ACCUMULATION_COUNTER and the PCIe error count
+ *  accumulators (per second).
+ *
+ *  @param[in] processor_handle a processor handle
+ *
+ *  @param[in] fields an array of ::amdsmi_gpu_metric_field_t accumulators
+ *
+ *  @param[in] num_fields number of entries in @p fields and @p rates
+ *
+ *  @param[out] rates an array of ::amdsmi_gpu_metric_rate_t which will hold
+ *  the rates
+ *
+ *  @return ::amdsmi_status_t | ::AMDSMI_STATUS_SUCCESS on success, non-zero on fail
+ */
+amdsmi_status_t amdsmi_get_gpu_metrics_rates(amdsmi_processor_handle processor_handle,
+                                             const amdsmi_gpu_metric_field_t *fields,
+                                             uint32_t num_fields,
+                                             amdsmi_gpu_metric_rate_t *rates);
+
+/**
+ *  @brief Set the smoothing time constant of the gpu metrics rates.
+ *
+ *  @ingroup tagClkPowerPerfQuery
+ *
+ *  @platform{gpu_bm_linux}
+ *
+ *  @details Given a processor handle @p processor_handle and a time constant
+ *  in milliseconds @p time_constant_ms, the moving average returned by
+ *  ::amdsmi_get_gpu_metrics_rates weighs each new rate by
+ *  1 - exp(-interval / @p time_constant_ms). The default is 1000 ms; 0
+ *  disables smoothing.
+ *
+ *  @param[in] processor_handle a processor handle
+ *
+ *  @param[in] time_constant_ms smoothing time constant, in milliseconds
+ *
+ *  @return ::amdsmi_status_t | ::AMDSMI_STATUS_SUCCESS on success, non-zero on fail
+ */
+amdsmi_status_t amdsmi_set_gpu_metrics_rates_time_constant(amdsmi_processor_handle processor_handle,
+                                                           uint32_t time_constant_ms);
+
+/**
+ *  @brief Drop the previous values kept for the gpu metrics rates.
+ *
+ *  @ingroup tagClkPowerPerfQuery
+ *
+ *  @platform{gpu_bm_linux}
+ *
+ *  @details Given a processor handle @p processor_handle, the next call to
+ *  ::amdsmi_get_gpu_metrics_rates starts over as if it was the first one.
+ *  This is done by ::amdsmi_reset_gpu as well.
+ *
+ *  @param[in] processor_handle a processor handle
+ *
+ *  @return ::amdsmi_status_t | ::AMDSMI_STATUS_SUCCESS on success, non-zero on fail
+ */
+amdsmi_status_t amdsmi_reset_gpu_metrics_rates(amdsmi_processor_handle processor_handle);
+
 /**
  *  @brief Get the pm metrics table with provided device index.
  *
@@ -4495,6 +5314,133 @@ amdsmi_status_t amdsmi_get_lib_version(amdsmi_version_t *version);
 
 /** @} End tagVersionQuery */
 
+/*****************************************************************************/
+/** @defgroup tagLibPerfStats Library Performance Counters
+ *  These functions report how long the library's own calls take, and how
+ *  many file reads and ioctls they make, per function and GPU.
+ *  @{
+ */
+
+/**
+ *  @brief Turn the collection of library performance counters on or off
+ *
+ *  @ingroup tagLibPerfStats
+ *
+ *  @platform{gpu_bm_linux}
+ *
+ *  @details Collection is off by default. While it is off, each call costs
+ *  one extra atomic load. Counters collected so far are kept when it is
+ *  turned off; see ::amdsmi_reset_lib_perf_stats(). The library does not
+ *  need to be initialized.
+ *
+ *  @param[in] enabled true to collect counters, false to stop
+ *
+ *  @return ::amdsmi_status_t | ::AMDSMI_STATUS_SUCCESS on success, non-zero on fail
+ */
+amdsmi_status_t amdsmi_set_lib_perf_stats_enabled(bool enabled);
+
+/**
+ *  @brief Get the library performance counters
+ *
+ *  @ingroup tagLibPerfStats
+ *
+ *  @platform{gpu_bm_linux}
+ *
+ *  @details There is one ::amdsmi_lib_perf_stats_t per function and GPU
+ *  called since collection was enabled or last reset, sorted by function
+ *  name and then GPU. A call of an amdsmi function is counted both under
+ *  its own name and under each rsmi function it is built on.
+ *
+ *  If @p stats is nullptr, @p num_stats is set to the number of entries.
+ *  Otherwise, up to @p num_stats entries are written to @p stats and
+ *  @p num_stats is set to the number written.
+ *
+ *  @param[in,out] num_stats As input, the number of entries @p stats can
+ *  hold. As output, the number of entries available or written.
+ *
+ *  @param[out] stats An array of ::amdsmi_lib_perf_stats_t, or nullptr
+ *
+ *  @return ::amdsmi_status_t | ::AMDSMI_STATUS_SUCCESS on success,
+ *  ::AMDSMI_STATUS_OUT_OF_RESOURCES if there were more entries than
+ *  @p num_stats, non-zero on fail
+ */
+amdsmi_status_t amdsmi_get_lib_perf_stats(uint32_t *num_stats, amdsmi_lib_perf_stats_t *stats);
+
+/**
+ *  @brief Clear the library performance counters
+ *
+ *  @ingroup tagLibPerfStats
+ *
+ *  @platform{gpu_bm_linux}
+ *
+ *  @return ::amdsmi_status_t | ::AMDSMI_STATUS_SUCCESS on success, non-zero on fail
+ */
+amdsmi_status_t amdsmi_reset_lib_perf_stats(void);
+
+/**
+ *  @brief Turn the collection of library lock wait statistics on or off
+ *
+ *  @ingroup tagLibPerfStats
+ *
+ *  @platform{gpu_bm_linux}
+ *
+ *  @details Collection is off by default, unless the RSMI_LOCK_STATS_DUMP_SECS
+ *  environment variable is set to a number of seconds. Then it is on from
+ *  ::amdsmi_init() on, and the statistics are printed to stderr that often
+ *  until ::amdsmi_shut_down().
+ *
+ *  While collection is off, each lock costs one extra atomic load. While it
+ *  is on, a lock is first tried without waiting, so that only the waits of
+ *  contended acquisitions are timed. Statistics collected so far are kept
+ *  when it is turned off; see ::amdsmi_reset_lib_lock_stats(). The library
+ *  does not need to be initialized.
+ *
+ *  @param[in] enabled true to collect statistics, false to stop
+ *
+ *  @return ::amdsmi_status_t | ::AMDSMI_STATUS_SUCCESS on success, non-zero on fail
+ */
+amdsmi_status_t amdsmi_set_lib_lock_stats_enabled(bool enabled);
+
+/**
+ *  @brief Get the library lock wait statistics
+ *
+ *  @ingroup tagLibPerfStats
+ *
+ *  @platform{gpu_bm_linux}
+ *
+ *  @details There is one ::amdsmi_lib_lock_stats_t per lock (and GPU) taken
+ *  since collection was enabled or last reset, sorted by lock and then GPU.
+ *
+ *  If @p stats is nullptr, @p num_stats is set to the number of entries.
+ *  Otherwise, up to @p num_stats entries are written to @p stats and
+ *  @p num_stats is set to the number written.
+ *
+ *  @param[in,out] num_stats As input, the number of entries @p stats can
+ *  hold. As output, the number of entries available or written.
+ *
+ *  @param[out] stats An array of ::amdsmi_lib_lock_stats_t, or nullptr
+ *
+ *  @return ::amdsmi_status_t | ::AMDSMI_STATUS_SUCCESS on success,
+ *  ::AMDSMI_STATUS_OUT_OF_RESOURCES if there were more entries than
+ *  @p num_stats, non-zero on fail
+ */
+amdsmi_status_t amdsmi_get_lib_lock_stats(uint32_t *num_stats, amdsmi_lib_lock_stats_t *stats);
+
+/**
+ *  @brief Clear the library lock wait statistics
+ *
+ *  @ingroup tagLibPerfStats
+ *
+ *  @platform{gpu_bm_linux}
+ *
+ *  @details Locks held at the time keep their holder information.
+ *
+ *  @return ::amdsmi_status_t | ::AMDSMI_STATUS_SUCCESS on success, non-zero on fail
+ */
+amdsmi_status_t amdsmi_reset_lib_lock_stats(void);
+
+/** @} End tagLibPerfStats */
+
 /*****************************************************************************/
 /** @defgroup tagECCInfo ECC Information
  *  @{
@@ -5994,10 +6940,15 @@ amdsmi_get_gpu_vram_usage(amdsmi_processor_handle processor_handle, amdsmi_vram_
 /**
  *  @brief          Returns the violations for a processor
  *
- *  Warning: API will be slow due to polling driver for 2 samples. Require
- *  a minimum wait of 100ms between the 2 samples in order to calculate. Otherwise
- *  users would need to use amdsmi_get_gpu_metrics_info for BM. See that API's struct
- *  for calculations.
+ *  The percentages are computed over the interval between the last two
+ *  gpu metrics samples seen for the processor and its partition, which are
+ *  kept between calls.
+ *  Warning: The first call for a processor (and the first after its counters
+ *  were reset) will be slow due to polling driver for 2 samples. Require
+ *  a minimum wait of 100ms between the 2 samples in order to calculate.
+ *  Later calls return immediately, over the interval since an earlier call,
+ *  unless the accumulation counter is not available: then every call polls
+ *  the driver for 2 samples.
  *
  *  @ingroup tagGPUMonitor
  *
@@ -6080,6 +7031,106 @@ amdsmi_get_gpu_process_list(amdsmi_processor_handle processor_handle, uint32_t *
 
 /** @} End tagProcessInfo */
 
+/*****************************************************************************/
+/** @defgroup tagAsyncQuery Asynchronous queries
+ *  These functions run slow queries on library threads, so that callers
+ *  driven by an event loop do not block on them.
+ *  @{
+ */
+
+/**
+ *  @brief Run a query asynchronously.
+ *
+ *  @ingroup tagAsyncQuery
+ *
+ *  @platform{gpu_bm_linux}
+ *
+ *  @details Given a query @p op, a processor handle @p processor_handle and
+ *  a pointer @p out to the output of the query (see ::amdsmi_async_op_t for
+ *  its type), this function queues the query on the library worker pool and
+ *  returns right away. The query then runs as the matching synchronous
+ *  function does, and writes to @p out. @p out must stay valid until the
+ *  request completes.
+ *
+ *  If @p callback is not NULL, it is called with the completion on the
+ *  library thread which ran the query, and should return quickly. Otherwise
+ *  the completion is queued, to be read with ::amdsmi_async_get_completions,
+ *  and the eventfd returned by ::amdsmi_async_get_eventfd becomes readable.
+ *
+ *  ::amdsmi_shut_down waits for the requests in flight: their callbacks are
+ *  called, and queued completions are dropped. Requests submitted once it
+ *  has started are rejected.
+ *
+ *  @param[in] op the query to run
+ *
+ *  @param[in] processor_handle a processor handle
+ *
+ *  @param[out] out a pointer to the output of the query. Must not be NULL.
+ *
+ *  @param[in] callback the function called when the request completes, or
+ *  NULL to queue the completion
+ *
+ *  @param[in] user_data passed back in the completion
+ *
+ *  @param[out] request a pointer to which the id of the request will be
+ *  written. If pointer is NULL, it will be ignored.
+ *
+ *  @return ::amdsmi_status_t | ::AMDSMI_STATUS_SUCCESS if the request was
+ *          queued, ::AMDSMI_STATUS_NOT_INIT if the library is shutting down,
+ *          non-zero on fail
+ */
+amdsmi_status_t amdsmi_async_submit(amdsmi_async_op_t op,
+                                    amdsmi_processor_handle processor_handle, void *out,
+                                    amdsmi_async_callback_t callback, void *user_data,
+                                    amdsmi_async_request_t *request);
+
+/**
+ *  @brief Get an eventfd which is readable while asynchronous completions
+ *  are queued.
+ *
+ *  @ingroup tagAsyncQuery
+ *
+ *  @platform{gpu_bm_linux}
+ *
+ *  @details Writes to @p fd a non-blocking eventfd, to be polled (ie: with
+ *  epoll) for the completions of requests submitted without a callback.
+ *  The eventfd is readable while ::amdsmi_async_get_completions has
+ *  completions to return, and is cleared by it once they are all read; the
+ *  caller does not need to read it. The same eventfd is returned until
+ *  ::amdsmi_shut_down closes it. The caller must not close it.
+ *
+ *  @param[out] fd a pointer to which the eventfd will be written. Must not
+ *  be NULL.
+ *
+ *  @return ::amdsmi_status_t | ::AMDSMI_STATUS_SUCCESS on success, non-zero on fail
+ */
+amdsmi_status_t amdsmi_async_get_eventfd(int *fd);
+
+/**
+ *  @brief Get the queued completions of asynchronous requests.
+ *
+ *  @ingroup tagAsyncQuery
+ *
+ *  @platform{gpu_bm_linux}
+ *
+ *  @details Given an array @p completions of @p num_completions entries,
+ *  this function moves up to @p num_completions of the queued completions,
+ *  oldest first, to @p completions. Only requests submitted without a
+ *  callback are queued. Does not wait.
+ *
+ *  @param[out] completions an array to which the completions will be written
+ *
+ *  @param[in,out] num_completions As input, the number of entries in
+ *  @p completions. As output, the number of completions written; 0 if none
+ *  is queued.
+ *
+ *  @return ::amdsmi_status_t | ::AMDSMI_STATUS_SUCCESS on success, non-zero on fail
+ */
+amdsmi_status_t amdsmi_async_get_completions(amdsmi_async_completion_t *completions,
+                                             uint32_t *num_completions);
+
+/** @} End tagAsyncQuery */
+
 #ifdef ENABLE_ESMI_LIB
 
 /*****************************************************************************/
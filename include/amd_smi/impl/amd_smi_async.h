@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef AMD_SMI_INCLUDE_AMD_SMI_ASYNC_H_
+#define AMD_SMI_INCLUDE_AMD_SMI_ASYNC_H_
+
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include "amd_smi/amdsmi.h"
+
+namespace amd {
+namespace smi {
+
+// Singleton: Asynchronous queries. Requests run on the library worker pool;
+// their completion is either passed to the caller's callback, or queued
+// with an eventfd signalling that the queue is not empty.
+class AMDSmiAsync {
+ public:
+    static AMDSmiAsync& getInstance() {
+        static AMDSmiAsync instance;
+        return instance;
+    }
+    ~AMDSmiAsync() { stop(); }
+
+    amdsmi_status_t submit(amdsmi_async_op_t op, amdsmi_processor_handle processor_handle,
+                           void* out, amdsmi_async_callback_t callback, void* user_data,
+                           amdsmi_async_request_t* request);
+    amdsmi_status_t get_eventfd(int* fd);
+    uint32_t get_completions(amdsmi_async_completion_t* completions,
+                             uint32_t num_completions);
+
+    // Accepts requests, until reject_requests()
+    void start();
+    // First step of a shutdown: later submit() calls fail, so that they can
+    // not start the worker pool again once it is stopped.
+    void reject_requests();
+    // Drops the queued completions and closes the eventfd. The requests in
+    // flight must be done, ie: the worker pool stopped.
+    void stop();
+
+ private:
+    AMDSmiAsync() = default;
+    static amdsmi_status_t run(amdsmi_async_op_t op,
+                               amdsmi_processor_handle processor_handle, void* out);
+    void queue_completion(const amdsmi_async_completion_t& completion);
+
+    std::atomic<amdsmi_async_request_t> next_request_{1};
+
+    // Guards accepting_, and is held while a request is handed to the pool
+    std::mutex submit_mutex_;
+    bool accepting_ = false;
+
+    // Guards the completions and the eventfd, so that the eventfd is
+    // readable exactly while completions are queued.
+    std::mutex mutex_;
+    std::deque<amdsmi_async_completion_t> completions_;
+    int eventfd_ = -1;
+};
+
+}  // namespace smi
+}  // namespace amd
+
+#endif  // AMD_SMI_INCLUDE_AMD_SMI_ASYNC_H_
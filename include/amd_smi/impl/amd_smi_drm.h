@@ -61,6 +61,9 @@ class AMDSmiDrm {
     // when file is not found, the empty string will be returned
     std::string find_file_in_folder(const std::string& folder,
                   const std::string& regex);
+    // The mutex serializing ioctls on one of drm_fds_ and its gpu index,
+    // or drm_mutex_ for any other fd
+    std::mutex& fd_mutex(int fd, uint32_t *gpu_index);
     using DrmCmdWriteFunc = int (*)(int, unsigned long, void *, unsigned long);
     std::vector<int> drm_fds_;  // drm file descriptor by gpu_index
     std::vector<std::string> drm_paths_; // drm path (renderD128 for example)
@@ -74,6 +77,8 @@ class AMDSmiDrm {
     drmGetVersionFunc drm_get_version_;
     drmFreeVersionFunc drm_free_version_;
 
+    // One per drm_fds_ entry, so ioctls on different GPUs run concurrently
+    std::vector<std::unique_ptr<std::mutex>> drm_fd_mutexes_;
     std::mutex drm_mutex_;
 };
 
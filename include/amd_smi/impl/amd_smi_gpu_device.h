@@ -23,9 +23,11 @@
 #ifndef AMD_SMI_INCLUDE_IMPL_AMD_SMI_GPU_DEVICE_H_
 #define AMD_SMI_INCLUDE_IMPL_AMD_SMI_GPU_DEVICE_H_
 
+#include <mutex>
 #include "amd_smi/amdsmi.h"
 #include "amd_smi/impl/amd_smi_processor.h"
 #include "amd_smi/impl/amd_smi_drm.h"
+#include "amd_smi/impl/amd_smi_gpu_metrics_rates.h"
 #include "shared_mutex.h"  // NOLINT
 #include "rocm_smi/rocm_smi_logger.h"
 
@@ -58,7 +60,7 @@ class AMDSmiGPUDevice: public AMDSmiProcessor {
     }
 
     amdsmi_status_t get_drm_data();
-    pthread_mutex_t* get_mutex();
+    shared_mutex_t* get_mutex();
     uint32_t get_gpu_id() const;
     uint32_t get_gpu_fd() const;
     std::string& get_gpu_path();
@@ -85,7 +87,28 @@ class AMDSmiGPUDevice: public AMDSmiProcessor {
     uint32_t get_card_from_bdf() const;
     uint32_t get_render_id() const;
 
+    AMDSmiGpuMetricsRates& get_gpu_metrics_rates() { return gpu_metrics_rates_; }
+
+    // Static information (asic, vram and board info) is gathered once per
+    // device generation, see amdsmi_get_gpu_generation(). load_static_info()
+    // copies out the value kept for the current generation, if any;
+    // otherwise it returns false and sets *generation to what the value
+    // about to be gathered is to be stored with. Nothing is kept while
+    // device changes aren't watched.
+    template <typename T> bool load_static_info(T* info, uint64_t* generation);
+    template <typename T> void store_static_info(const T& info, uint64_t generation);
+
  private:
+    template <typename T>
+    struct StaticInfo {
+        bool is_valid = false;
+        uint64_t generation = 0;
+        T info;
+    };
+    StaticInfo<amdsmi_asic_info_t>& static_info(amdsmi_asic_info_t*) { return static_asic_info_; }
+    StaticInfo<amdsmi_vram_info_t>& static_info(amdsmi_vram_info_t*) { return static_vram_info_; }
+    StaticInfo<amdsmi_board_info_t>& static_info(amdsmi_board_info_t*) { return static_board_info_; }
+
     uint32_t gpu_id_;
     uint32_t fd_;
     std::string path_;
@@ -93,6 +116,11 @@ class AMDSmiGPUDevice: public AMDSmiProcessor {
     uint32_t vendor_id_;
     AMDSmiDrm& drm_;
     GPUComputeProcessList_t compute_process_list_;
+    AMDSmiGpuMetricsRates gpu_metrics_rates_;
+    std::mutex static_info_mutex_;
+    StaticInfo<amdsmi_asic_info_t> static_asic_info_;
+    StaticInfo<amdsmi_vram_info_t> static_vram_info_;
+    StaticInfo<amdsmi_board_info_t> static_board_info_;
     int32_t get_compute_process_list_impl(GPUComputeProcessList_t& compute_process_list,
                                           ComputeProcessListType_t list_type);
 
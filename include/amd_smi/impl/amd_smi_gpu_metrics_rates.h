@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef AMD_SMI_INCLUDE_AMD_SMI_GPU_METRICS_RATES_H_
+#define AMD_SMI_INCLUDE_AMD_SMI_GPU_METRICS_RATES_H_
+
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <utility>
+#include "amd_smi/amdsmi.h"
+
+namespace amd {
+namespace smi {
+
+// Rates of the gpu metrics accumulators of one device. The previous value
+// of every (field, value index) is kept, so each new gpu metrics read
+// yields a rate over the interval since the previous read of that field.
+class AMDSmiGpuMetricsRates {
+ public:
+    static constexpr uint32_t kDefaultTimeConstantMs = 1000;
+
+    // False for fields which are not accumulators
+    static bool is_rate_field(amdsmi_gpu_metric_field_t field);
+
+    // Reads fields (in a single gpu metrics read) and updates their rates
+    amdsmi_status_t get_rates(amdsmi_processor_handle processor_handle,
+                              const amdsmi_gpu_metric_field_t* fields, uint32_t num_fields,
+                              amdsmi_gpu_metric_rate_t* rates);
+
+    // Updates the rates of fields from already read values. time_ns is the
+    // time of the values, acc_counter the accumulation counter read with
+    // them (max uint64 if N/A).
+    void update(uint64_t time_ns, uint64_t acc_counter,
+                const amdsmi_gpu_metric_field_t* fields,
+                const amdsmi_gpu_metric_field_value_t* values, uint32_t num_fields,
+                amdsmi_gpu_metric_rate_t* rates);
+
+    void set_time_constant_ms(uint32_t time_constant_ms);
+    uint32_t get_time_constant_ms();
+
+    // Drops all previous values, ie: after the counters were reset
+    void reset();
+
+ private:
+    struct AccumulatorState {
+        uint64_t prev_value = 0;
+        uint64_t prev_time_ns = 0;
+        uint64_t prev_acc_counter = 0;
+        bool has_rate = false;
+        double rate = 0;
+        double ewma_rate = 0;
+        uint64_t interval_ns = 0;
+    };
+    void update_locked(uint64_t time_ns, uint64_t acc_counter,
+                       amdsmi_gpu_metric_field_t field,
+                       const amdsmi_gpu_metric_field_value_t& value,
+                       amdsmi_gpu_metric_rate_t* rate);
+
+    std::mutex mutex_;
+    uint32_t time_constant_ms_ = kDefaultTimeConstantMs;
+    std::map<std::pair<amdsmi_gpu_metric_field_t, uint32_t>, AccumulatorState> states_;
+};
+
+}  // namespace smi
+}  // namespace amd
+
+#endif  // AMD_SMI_INCLUDE_AMD_SMI_GPU_METRICS_RATES_H_
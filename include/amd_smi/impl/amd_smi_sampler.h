@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef AMD_SMI_INCLUDE_AMD_SMI_SAMPLER_H_
+#define AMD_SMI_INCLUDE_AMD_SMI_SAMPLER_H_
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <vector>
+#include "amd_smi/amdsmi.h"
+
+namespace amd {
+namespace smi {
+
+// Ring of the last samples of one device. Written by the sampler thread
+// only, read by any number of threads without locks: each slot carries a
+// sequence number (odd while being written) which readers check before and
+// after copying the slot out.
+class AMDSmiSampleRing {
+ public:
+    AMDSmiSampleRing(uint32_t num_fields, uint32_t depth);
+
+    void push(uint64_t timestamp_ns, const amdsmi_gpu_metric_field_value_t* values);
+
+    // Returns false if there is no sample yet.
+    bool read_latest(uint64_t* timestamp_ns, amdsmi_gpu_metric_field_value_t* values) const;
+
+    // Copies up to max_samples of the newest samples, oldest first, and
+    // returns how many were copied.
+    uint32_t read_history(uint32_t max_samples, uint64_t* timestamps_ns,
+                          amdsmi_gpu_metric_field_value_t* values) const;
+
+ private:
+    struct Slot {
+        std::atomic<uint64_t> seq{0};
+        std::atomic<uint64_t> timestamp_ns{0};
+        std::unique_ptr<std::atomic<uint64_t>[]> words;
+    };
+    bool read_slot(uint64_t sample, uint64_t* timestamp_ns,
+                   amdsmi_gpu_metric_field_value_t* values) const;
+
+    const uint32_t num_fields_;
+    const uint32_t num_words_;
+    // One more slot than the depth, so that the slot being written is never
+    // part of the history handed out.
+    const uint32_t num_slots_;
+    std::unique_ptr<Slot[]> slots_;
+    std::atomic<uint64_t> num_pushed_{0};
+};
+
+// Singleton: Opt-in background sampler. A single thread reads the selected
+// gpu metrics fields of every GPU at a fixed period into per device rings,
+// so readers get recent samples without any syscall or device lock.
+class AMDSmiSampler {
+ public:
+    static AMDSmiSampler& getInstance() {
+        static AMDSmiSampler instance;
+        return instance;
+    }
+    ~AMDSmiSampler() { stop(); }
+
+    // (Re)starts sampling the fields of the given processors; any previous
+    // history is dropped.
+    amdsmi_status_t start(uint32_t period_us, const amdsmi_gpu_metric_field_t* fields,
+                          uint32_t num_fields, uint32_t history_depth,
+                          const std::vector<amdsmi_processor_handle>& processor_handles);
+    void stop();
+
+    amdsmi_status_t get_latest(amdsmi_processor_handle processor_handle,
+                               uint64_t* timestamp_ns,
+                               amdsmi_gpu_metric_field_value_t* values, uint32_t num_fields);
+    amdsmi_status_t get_history(amdsmi_processor_handle processor_handle,
+                                uint32_t* num_samples, uint64_t* timestamps_ns,
+                                amdsmi_gpu_metric_field_value_t* values, uint32_t num_fields);
+
+ private:
+    AMDSmiSampler() = default;
+    void stop_locked();
+    void sampler_loop();
+    const AMDSmiSampleRing* find_ring(amdsmi_processor_handle processor_handle,
+                                      uint32_t num_fields) const;
+
+    // Serializes start() and stop()
+    std::mutex control_mutex_;
+    // Guards the configuration and rings against start() / stop() while
+    // readers use them; only ever held exclusively with the thread stopped.
+    std::shared_mutex rings_mutex_;
+    std::vector<amdsmi_gpu_metric_field_t> fields_;
+    std::chrono::microseconds period_{0};
+    std::map<amdsmi_processor_handle, std::unique_ptr<AMDSmiSampleRing>> rings_;
+
+    std::mutex thread_mutex_;
+    std::condition_variable thread_cond_;
+    bool stopping_ = false;
+    std::thread thread_;
+};
+
+}  // namespace smi
+}  // namespace amd
+
+#endif  // AMD_SMI_INCLUDE_AMD_SMI_SAMPLER_H_
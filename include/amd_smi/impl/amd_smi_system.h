@@ -62,6 +62,10 @@ class AMDSmiSystem {
 
     amdsmi_status_t init_drm() { return drm_.init();}
 
+    // Generation of the GPU, see amd::smi::Device::generation(). Fails with
+    // AMDSMI_STATUS_NOT_SUPPORTED if device changes are not being watched.
+    amdsmi_status_t get_gpu_generation(uint32_t gpu_index, uint64_t* generation);
+
  private:
     AMDSmiSystem() : init_flag_(AMDSMI_INIT_AMD_GPUS) {}
 
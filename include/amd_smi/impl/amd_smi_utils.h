@@ -32,12 +32,16 @@
 #include "rocm_smi/rocm_smi_utils.h"
 
 
-#define SMIGPUDEVICE_MUTEX(MUTEX) \
-    amd::smi::pthread_wrap _pw(*(MUTEX)); \
-    amd::smi::ScopedPthread _lock(_pw, true); \
+#define SMIGPUDEVICE_MUTEX_MODE(MUTEX, MODE) \
+    amd::smi::ScopedDeviceLock _lock((MUTEX), \
+                                     amd::smi::ScopedDeviceLock::MODE); \
     if (_lock.mutex_not_acquired()) { \
       return AMDSMI_STATUS_BUSY; \
     }
+// For calls that change the device state
+#define SMIGPUDEVICE_MUTEX(MUTEX) SMIGPUDEVICE_MUTEX_MODE(MUTEX, kExclusive)
+// For queries, which run concurrently with each other
+#define SMIGPUDEVICE_MUTEX_SHARED(MUTEX) SMIGPUDEVICE_MUTEX_MODE(MUTEX, kShared)
 
 amdsmi_status_t smi_amdgpu_find_hwmon_dir(amd::smi::AMDSmiGPUDevice* device, std::string* full_path);
 amdsmi_status_t smi_amdgpu_get_board_info(amd::smi::AMDSmiGPUDevice* device, amdsmi_board_info_t *info);
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef AMD_SMI_INCLUDE_AMD_SMI_WORKER_POOL_H_
+#define AMD_SMI_INCLUDE_AMD_SMI_WORKER_POOL_H_
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace amd {
+namespace smi {
+
+// Singleton: Library wide pool of worker threads, used to overlap
+// independent per device work (ie: reading gpu metrics of many GPUs).
+// Threads are only started on first use.
+class AMDSmiWorkerPool {
+ public:
+    static AMDSmiWorkerPool& getInstance() {
+        static AMDSmiWorkerPool instance;
+        return instance;
+    }
+    ~AMDSmiWorkerPool() { stop(); }
+
+    // Runs task(0) ... task(num_tasks - 1) on the pool, and returns once
+    // all of them are done. The calling thread runs tasks too, so it is
+    // safe to call from a task already running on the pool.
+    void run_all(uint32_t num_tasks, const std::function<void(uint32_t)>& task);
+
+    // Queues task to run on the pool, and returns right away.
+    void submit(std::function<void()> task);
+
+    // Joins the worker threads; they are started again on the next use.
+    // Does nothing when called from a worker, which can not join itself.
+    void stop();
+
+    // Whether the calling thread is one of the pool's workers
+    static bool is_worker_thread();
+
+ private:
+    AMDSmiWorkerPool() = default;
+    void start();
+    void worker_loop();
+
+    std::mutex mutex_;
+    std::condition_variable cond_;
+    std::deque<std::function<void()>> tasks_;
+    std::vector<std::thread> workers_;
+    bool stopping_ = false;
+};
+
+}  // namespace smi
+}  // namespace amd
+
+#endif  // AMD_SMI_INCLUDE_AMD_SMI_WORKER_POOL_H_
@@ -82,6 +82,7 @@ except AttributeError:
 
 from .amdsmi_interface import amdsmi_get_processor_handle_from_bdf
 from .amdsmi_interface import amdsmi_get_gpu_device_bdf
+from .amdsmi_interface import amdsmi_get_gpu_generation
 from .amdsmi_interface import amdsmi_get_gpu_device_uuid
 from .amdsmi_interface import amdsmi_get_gpu_enumeration_info
 
@@ -150,6 +151,7 @@ from .amdsmi_interface import amdsmi_get_gpu_fan_speed
 from .amdsmi_interface import amdsmi_get_gpu_fan_speed_max
 from .amdsmi_interface import amdsmi_get_temp_metric
 from .amdsmi_interface import amdsmi_get_gpu_volt_metric
+from .amdsmi_interface import amdsmi_get_gpu_hwmon_snapshot
 
 # # Clock, Power and Performance Query
 from .amdsmi_interface import amdsmi_get_utilization_count
@@ -187,6 +189,7 @@ from .amdsmi_interface import amdsmi_reset_gpu_xgmi_error
 from .amdsmi_interface import amdsmi_get_gpu_bdf_id
 from .amdsmi_interface import amdsmi_get_gpu_pci_bandwidth
 from .amdsmi_interface import amdsmi_get_gpu_pci_throughput
+from .amdsmi_interface import amdsmi_get_gpu_pci_throughput_latest
 from .amdsmi_interface import amdsmi_get_gpu_pci_replay_counter
 from .amdsmi_interface import amdsmi_get_gpu_topo_numa_affinity
 
@@ -196,6 +199,7 @@ from .amdsmi_interface import amdsmi_get_energy_count
 # # Memory information
 from .amdsmi_interface import amdsmi_get_gpu_memory_total
 from .amdsmi_interface import amdsmi_get_gpu_memory_usage
+from .amdsmi_interface import amdsmi_get_gpu_sysfs_snapshot
 from .amdsmi_interface import amdsmi_get_gpu_memory_reserved_pages
 
 # # Events
@@ -242,9 +246,18 @@ from .amdsmi_interface import amdsmi_get_gpu_virtualization_mode_info
 from .amdsmi_interface import amdsmi_get_lib_version
 from .amdsmi_interface import amdsmi_get_rocm_version
 
+# # Library performance counters
+from .amdsmi_interface import amdsmi_set_lib_perf_stats_enabled
+from .amdsmi_interface import amdsmi_get_lib_perf_stats
+from .amdsmi_interface import amdsmi_reset_lib_perf_stats
+from .amdsmi_interface import amdsmi_set_lib_lock_stats_enabled
+from .amdsmi_interface import amdsmi_get_lib_lock_stats
+from .amdsmi_interface import amdsmi_reset_lib_lock_stats
+
 # # Enums
 from .amdsmi_interface import AmdSmiInitFlags
 from .amdsmi_interface import AmdSmiContainerTypes
+from .amdsmi_interface import AmdSmiLibLockType
 from .amdsmi_interface import AmdSmiDeviceType
 from .amdsmi_interface import AmdSmiMmIp
 from .amdsmi_interface import AmdSmiFwBlock
@@ -426,6 +426,14 @@ class AmdSmiLinkType(IntEnum):
     AMDSMI_LINK_TYPE_UNKNOWN = amdsmi_wrapper.AMDSMI_LINK_TYPE_UNKNOWN
 
 
+class AmdSmiLibLockType(IntEnum):
+    AMDSMI_LIB_LOCK_DEVICE = amdsmi_wrapper.AMDSMI_LIB_LOCK_DEVICE
+    AMDSMI_LIB_LOCK_DEVICE_CROSS_PROCESS = amdsmi_wrapper.AMDSMI_LIB_LOCK_DEVICE_CROSS_PROCESS
+    AMDSMI_LIB_LOCK_DRM = amdsmi_wrapper.AMDSMI_LIB_LOCK_DRM
+    AMDSMI_LIB_LOCK_KFD_EVENT = amdsmi_wrapper.AMDSMI_LIB_LOCK_KFD_EVENT
+    AMDSMI_LIB_LOCK_LOGGER = amdsmi_wrapper.AMDSMI_LIB_LOCK_LOGGER
+
+
 class AmdSmiUtilizationCounterType(IntEnum):
     COARSE_GRAIN_GFX_ACTIVITY = amdsmi_wrapper.AMDSMI_COARSE_GRAIN_GFX_ACTIVITY
     COARSE_GRAIN_MEM_ACTIVITY = amdsmi_wrapper.AMDSMI_COARSE_GRAIN_MEM_ACTIVITY
@@ -1690,6 +1698,21 @@ def amdsmi_get_gpu_device_bdf(processor_handle: amdsmi_wrapper.amdsmi_processor_
     return _format_bdf(bdf_info)
 
 
+def amdsmi_get_gpu_generation(processor_handle: amdsmi_wrapper.amdsmi_processor_handle) -> int:
+    if not isinstance(processor_handle, amdsmi_wrapper.amdsmi_processor_handle):
+        raise AmdSmiParameterException(
+            processor_handle, amdsmi_wrapper.amdsmi_processor_handle
+        )
+
+    generation = ctypes.c_uint64()
+    _check_res(
+        amdsmi_wrapper.amdsmi_get_gpu_generation(
+            processor_handle, ctypes.byref(generation))
+    )
+
+    return generation.value
+
+
 def amdsmi_get_gpu_device_uuid(processor_handle: amdsmi_wrapper.amdsmi_processor_handle) -> str:
     if not isinstance(processor_handle, amdsmi_wrapper.amdsmi_processor_handle):
         raise AmdSmiParameterException(
@@ -2637,6 +2660,93 @@ def amdsmi_get_lib_version():
     }
 
 
+def amdsmi_set_lib_perf_stats_enabled(enabled: bool) -> None:
+    if not isinstance(enabled, bool):
+        raise AmdSmiParameterException(enabled, bool)
+
+    _check_res(amdsmi_wrapper.amdsmi_set_lib_perf_stats_enabled(enabled))
+
+
+def amdsmi_get_lib_perf_stats() -> List[Dict[str, Any]]:
+    num_stats = ctypes.c_uint32(0)
+    _check_res(
+        amdsmi_wrapper.amdsmi_get_lib_perf_stats(ctypes.byref(num_stats), None)
+    )
+
+    # Entries may be added between the two calls; those are left out
+    stats = (amdsmi_wrapper.amdsmi_lib_perf_stats_t * num_stats.value)()
+    ret = amdsmi_wrapper.amdsmi_get_lib_perf_stats(ctypes.byref(num_stats), stats)
+    if ret != amdsmi_wrapper.AMDSMI_STATUS_OUT_OF_RESOURCES:
+        _check_res(ret)
+
+    result = []
+    for stat in stats[:num_stats.value]:
+        result.append({
+            "api": stat.api.decode("utf-8"),
+            "gpu_index": "N/A" if stat.gpu_index == 0xFFFFFFFF else stat.gpu_index,
+            "calls": stat.calls,
+            "total_ns": stat.total_ns,
+            "min_ns": stat.min_ns,
+            "max_ns": stat.max_ns,
+            "p50_ns": stat.p50_ns,
+            "p90_ns": stat.p90_ns,
+            "p99_ns": stat.p99_ns,
+            "file_opens": stat.file_opens,
+            "file_reads": stat.file_reads,
+            "ioctls": stat.ioctls,
+        })
+    return result
+
+
+def amdsmi_reset_lib_perf_stats() -> None:
+    _check_res(amdsmi_wrapper.amdsmi_reset_lib_perf_stats())
+
+
+def amdsmi_set_lib_lock_stats_enabled(enabled: bool) -> None:
+    if not isinstance(enabled, bool):
+        raise AmdSmiParameterException(enabled, bool)
+
+    _check_res(amdsmi_wrapper.amdsmi_set_lib_lock_stats_enabled(enabled))
+
+
+def amdsmi_get_lib_lock_stats() -> List[Dict[str, Any]]:
+    num_stats = ctypes.c_uint32(0)
+    _check_res(
+        amdsmi_wrapper.amdsmi_get_lib_lock_stats(ctypes.byref(num_stats), None)
+    )
+
+    # Entries may be added between the two calls; those are left out
+    stats = (amdsmi_wrapper.amdsmi_lib_lock_stats_t * num_stats.value)()
+    ret = amdsmi_wrapper.amdsmi_get_lib_lock_stats(ctypes.byref(num_stats), stats)
+    if ret != amdsmi_wrapper.AMDSMI_STATUS_OUT_OF_RESOURCES:
+        _check_res(ret)
+
+    result = []
+    for stat in stats[:num_stats.value]:
+        result.append({
+            "lock": AmdSmiLibLockType(stat.lock).name,
+            "gpu_index": "N/A" if stat.gpu_index == 0xFFFFFFFF else stat.gpu_index,
+            "acquisitions": stat.acquisitions,
+            "contended": stat.contended,
+            "failures": stat.failures,
+            "total_wait_ns": stat.total_wait_ns,
+            "max_wait_ns": stat.max_wait_ns,
+            "p50_wait_ns": stat.p50_wait_ns,
+            "p90_wait_ns": stat.p90_wait_ns,
+            "p99_wait_ns": stat.p99_wait_ns,
+            "wait_histogram": list(stat.wait_histogram),
+            "holders": stat.holders,
+            "holder_tid": stat.holder_tid if stat.holders else "N/A",
+            "held_ns": stat.held_ns,
+            "owner_pid": stat.owner_pid if stat.owner_pid else "N/A",
+        })
+    return result
+
+
+def amdsmi_reset_lib_lock_stats() -> None:
+    _check_res(amdsmi_wrapper.amdsmi_reset_lib_lock_stats())
+
+
 def amdsmi_topo_get_numa_node_number(
     processor_handle: amdsmi_wrapper.amdsmi_processor_handle,
 ):
@@ -3443,6 +3553,30 @@ def amdsmi_get_gpu_pci_throughput(processor_handle: amdsmi_wrapper.amdsmi_proces
     }
 
 
+def amdsmi_get_gpu_pci_throughput_latest(processor_handle: amdsmi_wrapper.amdsmi_processor_handle):
+    if not isinstance(processor_handle, amdsmi_wrapper.amdsmi_processor_handle):
+        raise AmdSmiParameterException(
+            processor_handle, amdsmi_wrapper.amdsmi_processor_handle
+        )
+
+    sent = ctypes.c_uint64()
+    received = ctypes.c_uint64()
+    max_pkt_sz = ctypes.c_uint64()
+    age_ms = ctypes.c_uint64()
+
+    _check_res(
+        amdsmi_wrapper.amdsmi_get_gpu_pci_throughput_latest(processor_handle, ctypes.byref(
+            sent), ctypes.byref(received), ctypes.byref(max_pkt_sz), ctypes.byref(age_ms))
+    )
+
+    return {
+        'sent': sent.value,
+        'received': received.value,
+        'max_pkt_sz': max_pkt_sz.value,
+        'age_ms': age_ms.value
+    }
+
+
 def amdsmi_get_gpu_pci_replay_counter(processor_handle: amdsmi_wrapper.amdsmi_processor_handle):
     if not isinstance(processor_handle, amdsmi_wrapper.amdsmi_processor_handle):
         raise AmdSmiParameterException(
@@ -3670,6 +3804,43 @@ def amdsmi_get_gpu_memory_usage(processor_handle: amdsmi_wrapper.amdsmi_processo
     return used.value
 
 
+def amdsmi_get_gpu_sysfs_snapshot(
+    processor_handles: List[amdsmi_wrapper.amdsmi_processor_handle],
+) -> List[Dict[str, Any]]:
+    if not isinstance(processor_handles, list):
+        raise AmdSmiParameterException(processor_handles, list)
+    for processor_handle in processor_handles:
+        if not isinstance(processor_handle, amdsmi_wrapper.amdsmi_processor_handle):
+            raise AmdSmiParameterException(
+                processor_handle, amdsmi_wrapper.amdsmi_processor_handle
+            )
+
+    num_handles = len(processor_handles)
+    handles = (amdsmi_wrapper.amdsmi_processor_handle * num_handles)(*processor_handles)
+    snapshots = (amdsmi_wrapper.amdsmi_gpu_sysfs_snapshot_t * num_handles)()
+    _check_res(
+        amdsmi_wrapper.amdsmi_get_gpu_sysfs_snapshot(
+            handles, ctypes.c_uint32(num_handles), snapshots)
+    )
+
+    result = []
+    for snapshot in snapshots:
+        result.append({
+            "status": amdsmi_wrapper.amdsmi_status_t__enumvalues.get(snapshot.status, snapshot.status),
+            "gfx_activity": _validate_if_max_uint(snapshot.gfx_activity, MaxUIntegerTypes.UINT64_T),
+            "umc_activity": _validate_if_max_uint(snapshot.umc_activity, MaxUIntegerTypes.UINT64_T),
+            "vram_total": _validate_if_max_uint(snapshot.vram_total, MaxUIntegerTypes.UINT64_T),
+            "vram_used": _validate_if_max_uint(snapshot.vram_used, MaxUIntegerTypes.UINT64_T),
+            "vis_vram_total": _validate_if_max_uint(snapshot.vis_vram_total, MaxUIntegerTypes.UINT64_T),
+            "vis_vram_used": _validate_if_max_uint(snapshot.vis_vram_used, MaxUIntegerTypes.UINT64_T),
+            "gtt_total": _validate_if_max_uint(snapshot.gtt_total, MaxUIntegerTypes.UINT64_T),
+            "gtt_used": _validate_if_max_uint(snapshot.gtt_used, MaxUIntegerTypes.UINT64_T),
+            "pcie_replay_count": _validate_if_max_uint(snapshot.pcie_replay_count, MaxUIntegerTypes.UINT64_T),
+        })
+
+    return result
+
+
 def amdsmi_set_gpu_od_volt_info(
     processor_handle: amdsmi_wrapper.amdsmi_processor_handle,
     vpoint: int,
@@ -3805,6 +3976,39 @@ def amdsmi_get_gpu_volt_metric(
     return voltage.value
 
 
+def amdsmi_get_gpu_hwmon_snapshot(
+    processor_handle: amdsmi_wrapper.amdsmi_processor_handle,
+) -> Dict[str, Any]:
+    if not isinstance(processor_handle, amdsmi_wrapper.amdsmi_processor_handle):
+        raise AmdSmiParameterException(
+            processor_handle, amdsmi_wrapper.amdsmi_processor_handle
+        )
+
+    snapshot = amdsmi_wrapper.amdsmi_gpu_hwmon_snapshot_t()
+    _check_res(
+        amdsmi_wrapper.amdsmi_get_gpu_hwmon_snapshot(
+            processor_handle, ctypes.byref(snapshot)
+        )
+    )
+
+    # Sensors which could not be read are INT64_MAX
+    def _validate_sensor(value):
+        return "N/A" if value == 0x7FFFFFFFFFFFFFFF else value
+
+    return {
+        "temperature": {
+            "edge": _validate_sensor(snapshot.temperature[AmdSmiTemperatureType.EDGE]),
+            "hotspot": _validate_sensor(snapshot.temperature[AmdSmiTemperatureType.HOTSPOT]),
+            "vram": _validate_sensor(snapshot.temperature[AmdSmiTemperatureType.VRAM]),
+        },
+        "gfx_voltage": _validate_sensor(snapshot.gfx_voltage),
+        "fan_rpms": _validate_sensor(snapshot.fan_rpms),
+        "fan_speed": _validate_sensor(snapshot.fan_speed),
+        "average_socket_power": _validate_sensor(snapshot.average_socket_power),
+        "current_socket_power": _validate_sensor(snapshot.current_socket_power),
+    }
+
+
 def amdsmi_get_utilization_count(
     processor_handle: amdsmi_wrapper.amdsmi_processor_handle,
     counter_types: List[AmdSmiUtilizationCounterType]
@@ -763,6 +763,101 @@ struct_amdsmi_vram_usage_t._fields_ = [
 ]
 
 amdsmi_vram_usage_t = struct_amdsmi_vram_usage_t
+class struct_amdsmi_gpu_sysfs_snapshot_t(Structure):
+    pass
+
+struct_amdsmi_gpu_sysfs_snapshot_t._pack_ = 1 # source:False
+struct_amdsmi_gpu_sysfs_snapshot_t._fields_ = [
+    ('gfx_activity', ctypes.c_uint64),
+    ('umc_activity', ctypes.c_uint64),
+    ('vram_total', ctypes.c_uint64),
+    ('vram_used', ctypes.c_uint64),
+    ('vis_vram_total', ctypes.c_uint64),
+    ('vis_vram_used', ctypes.c_uint64),
+    ('gtt_total', ctypes.c_uint64),
+    ('gtt_used', ctypes.c_uint64),
+    ('pcie_replay_count', ctypes.c_uint64),
+    ('status', amdsmi_status_t),
+    ('reserved', ctypes.c_uint32 * 13),
+]
+
+amdsmi_gpu_sysfs_snapshot_t = struct_amdsmi_gpu_sysfs_snapshot_t
+class struct_amdsmi_gpu_hwmon_snapshot_t(Structure):
+    pass
+
+struct_amdsmi_gpu_hwmon_snapshot_t._pack_ = 1 # source:False
+struct_amdsmi_gpu_hwmon_snapshot_t._fields_ = [
+    ('temperature', ctypes.c_int64 * 3),
+    ('gfx_voltage', ctypes.c_int64),
+    ('fan_rpms', ctypes.c_int64),
+    ('fan_speed', ctypes.c_int64),
+    ('average_socket_power', ctypes.c_int64),
+    ('current_socket_power', ctypes.c_int64),
+    ('reserved', ctypes.c_uint32 * 12),
+]
+
+amdsmi_gpu_hwmon_snapshot_t = struct_amdsmi_gpu_hwmon_snapshot_t
+class struct_amdsmi_lib_perf_stats_t(Structure):
+    pass
+
+struct_amdsmi_lib_perf_stats_t._pack_ = 1 # source:False
+struct_amdsmi_lib_perf_stats_t._fields_ = [
+    ('api', ctypes.c_char * 256),
+    ('gpu_index', ctypes.c_uint32),
+    ('PADDING_0', ctypes.c_ubyte * 4),
+    ('calls', ctypes.c_uint64),
+    ('total_ns', ctypes.c_uint64),
+    ('min_ns', ctypes.c_uint64),
+    ('max_ns', ctypes.c_uint64),
+    ('p50_ns', ctypes.c_uint64),
+    ('p90_ns', ctypes.c_uint64),
+    ('p99_ns', ctypes.c_uint64),
+    ('file_opens', ctypes.c_uint64),
+    ('file_reads', ctypes.c_uint64),
+    ('ioctls', ctypes.c_uint64),
+    ('reserved', ctypes.c_uint32 * 8),
+]
+
+amdsmi_lib_perf_stats_t = struct_amdsmi_lib_perf_stats_t
+
+# values for enumeration 'amdsmi_lib_lock_type_t'
+amdsmi_lib_lock_type_t__enumvalues = {
+    0: 'AMDSMI_LIB_LOCK_DEVICE',
+    1: 'AMDSMI_LIB_LOCK_DEVICE_CROSS_PROCESS',
+    2: 'AMDSMI_LIB_LOCK_DRM',
+    3: 'AMDSMI_LIB_LOCK_KFD_EVENT',
+    4: 'AMDSMI_LIB_LOCK_LOGGER',
+}
+AMDSMI_LIB_LOCK_DEVICE = 0
+AMDSMI_LIB_LOCK_DEVICE_CROSS_PROCESS = 1
+AMDSMI_LIB_LOCK_DRM = 2
+AMDSMI_LIB_LOCK_KFD_EVENT = 3
+AMDSMI_LIB_LOCK_LOGGER = 4
+amdsmi_lib_lock_type_t = ctypes.c_uint32 # enum
+class struct_amdsmi_lib_lock_stats_t(Structure):
+    pass
+
+struct_amdsmi_lib_lock_stats_t._pack_ = 1 # source:False
+struct_amdsmi_lib_lock_stats_t._fields_ = [
+    ('lock', amdsmi_lib_lock_type_t),
+    ('gpu_index', ctypes.c_uint32),
+    ('acquisitions', ctypes.c_uint64),
+    ('contended', ctypes.c_uint64),
+    ('failures', ctypes.c_uint64),
+    ('total_wait_ns', ctypes.c_uint64),
+    ('max_wait_ns', ctypes.c_uint64),
+    ('p50_wait_ns', ctypes.c_uint64),
+    ('p90_wait_ns', ctypes.c_uint64),
+    ('p99_wait_ns', ctypes.c_uint64),
+    ('wait_histogram', ctypes.c_uint64 * 40),
+    ('holders', ctypes.c_uint32),
+    ('holder_tid', ctypes.c_uint32),
+    ('held_ns', ctypes.c_uint64),
+    ('owner_pid', ctypes.c_uint32),
+    ('reserved', ctypes.c_uint32 * 7),
+]
+
+amdsmi_lib_lock_stats_t = struct_amdsmi_lib_lock_stats_t
 class struct_amdsmi_violation_status_t(Structure):
     pass
 
@@ -2253,6 +2348,9 @@ amdsmi_get_processor_handle_from_bdf.argtypes = [amdsmi_bdf_t, ctypes.POINTER(ct
 amdsmi_get_gpu_device_bdf = _libraries['libamd_smi.so'].amdsmi_get_gpu_device_bdf
 amdsmi_get_gpu_device_bdf.restype = amdsmi_status_t
 amdsmi_get_gpu_device_bdf.argtypes = [amdsmi_processor_handle, ctypes.POINTER(union_amdsmi_bdf_t)]
+amdsmi_get_gpu_generation = _libraries['libamd_smi.so'].amdsmi_get_gpu_generation
+amdsmi_get_gpu_generation.restype = amdsmi_status_t
+amdsmi_get_gpu_generation.argtypes = [amdsmi_processor_handle, ctypes.POINTER(ctypes.c_uint64)]
 amdsmi_get_gpu_device_uuid = _libraries['libamd_smi.so'].amdsmi_get_gpu_device_uuid
 amdsmi_get_gpu_device_uuid.restype = amdsmi_status_t
 amdsmi_get_gpu_device_uuid.argtypes = [amdsmi_processor_handle, ctypes.POINTER(ctypes.c_uint32), ctypes.POINTER(ctypes.c_char)]
@@ -2293,6 +2391,9 @@ amdsmi_get_gpu_topo_numa_affinity.argtypes = [amdsmi_processor_handle, ctypes.PO
 amdsmi_get_gpu_pci_throughput = _libraries['libamd_smi.so'].amdsmi_get_gpu_pci_throughput
 amdsmi_get_gpu_pci_throughput.restype = amdsmi_status_t
 amdsmi_get_gpu_pci_throughput.argtypes = [amdsmi_processor_handle, ctypes.POINTER(ctypes.c_uint64), ctypes.POINTER(ctypes.c_uint64), ctypes.POINTER(ctypes.c_uint64)]
+amdsmi_get_gpu_pci_throughput_latest = _libraries['libamd_smi.so'].amdsmi_get_gpu_pci_throughput_latest
+amdsmi_get_gpu_pci_throughput_latest.restype = amdsmi_status_t
+amdsmi_get_gpu_pci_throughput_latest.argtypes = [amdsmi_processor_handle, ctypes.POINTER(ctypes.c_uint64), ctypes.POINTER(ctypes.c_uint64), ctypes.POINTER(ctypes.c_uint64), ctypes.POINTER(ctypes.c_uint64)]
 amdsmi_get_gpu_pci_replay_counter = _libraries['libamd_smi.so'].amdsmi_get_gpu_pci_replay_counter
 amdsmi_get_gpu_pci_replay_counter.restype = amdsmi_status_t
 amdsmi_get_gpu_pci_replay_counter.argtypes = [amdsmi_processor_handle, ctypes.POINTER(ctypes.c_uint64)]
@@ -2333,6 +2434,9 @@ amdsmi_get_gpu_memory_total.argtypes = [amdsmi_processor_handle, amdsmi_memory_t
 amdsmi_get_gpu_memory_usage = _libraries['libamd_smi.so'].amdsmi_get_gpu_memory_usage
 amdsmi_get_gpu_memory_usage.restype = amdsmi_status_t
 amdsmi_get_gpu_memory_usage.argtypes = [amdsmi_processor_handle, amdsmi_memory_type_t, ctypes.POINTER(ctypes.c_uint64)]
+amdsmi_get_gpu_sysfs_snapshot = _libraries['libamd_smi.so'].amdsmi_get_gpu_sysfs_snapshot
+amdsmi_get_gpu_sysfs_snapshot.restype = amdsmi_status_t
+amdsmi_get_gpu_sysfs_snapshot.argtypes = [ctypes.POINTER(ctypes.POINTER(None)), uint32_t, ctypes.POINTER(struct_amdsmi_gpu_sysfs_snapshot_t)]
 amdsmi_get_gpu_bad_page_info = _libraries['libamd_smi.so'].amdsmi_get_gpu_bad_page_info
 amdsmi_get_gpu_bad_page_info.restype = amdsmi_status_t
 amdsmi_get_gpu_bad_page_info.argtypes = [amdsmi_processor_handle, ctypes.POINTER(ctypes.c_uint32), ctypes.POINTER(struct_amdsmi_retired_page_record_t)]
@@ -2369,6 +2473,9 @@ amdsmi_get_gpu_cache_info.argtypes = [amdsmi_processor_handle, ctypes.POINTER(st
 amdsmi_get_gpu_volt_metric = _libraries['libamd_smi.so'].amdsmi_get_gpu_volt_metric
 amdsmi_get_gpu_volt_metric.restype = amdsmi_status_t
 amdsmi_get_gpu_volt_metric.argtypes = [amdsmi_processor_handle, amdsmi_voltage_type_t, amdsmi_voltage_metric_t, ctypes.POINTER(ctypes.c_int64)]
+amdsmi_get_gpu_hwmon_snapshot = _libraries['libamd_smi.so'].amdsmi_get_gpu_hwmon_snapshot
+amdsmi_get_gpu_hwmon_snapshot.restype = amdsmi_status_t
+amdsmi_get_gpu_hwmon_snapshot.argtypes = [amdsmi_processor_handle, ctypes.POINTER(struct_amdsmi_gpu_hwmon_snapshot_t)]
 amdsmi_reset_gpu_fan = _libraries['libamd_smi.so'].amdsmi_reset_gpu_fan
 amdsmi_reset_gpu_fan.restype = amdsmi_status_t
 amdsmi_reset_gpu_fan.argtypes = [amdsmi_processor_handle, uint32_t]
@@ -2465,6 +2572,24 @@ amdsmi_clean_gpu_local_data.argtypes = [amdsmi_processor_handle]
 amdsmi_get_lib_version = _libraries['libamd_smi.so'].amdsmi_get_lib_version
 amdsmi_get_lib_version.restype = amdsmi_status_t
 amdsmi_get_lib_version.argtypes = [ctypes.POINTER(struct_amdsmi_version_t)]
+amdsmi_set_lib_perf_stats_enabled = _libraries['libamd_smi.so'].amdsmi_set_lib_perf_stats_enabled
+amdsmi_set_lib_perf_stats_enabled.restype = amdsmi_status_t
+amdsmi_set_lib_perf_stats_enabled.argtypes = [ctypes.c_bool]
+amdsmi_get_lib_perf_stats = _libraries['libamd_smi.so'].amdsmi_get_lib_perf_stats
+amdsmi_get_lib_perf_stats.restype = amdsmi_status_t
+amdsmi_get_lib_perf_stats.argtypes = [ctypes.POINTER(ctypes.c_uint32), ctypes.POINTER(struct_amdsmi_lib_perf_stats_t)]
+amdsmi_reset_lib_perf_stats = _libraries['libamd_smi.so'].amdsmi_reset_lib_perf_stats
+amdsmi_reset_lib_perf_stats.restype = amdsmi_status_t
+amdsmi_reset_lib_perf_stats.argtypes = []
+amdsmi_set_lib_lock_stats_enabled = _libraries['libamd_smi.so'].amdsmi_set_lib_lock_stats_enabled
+amdsmi_set_lib_lock_stats_enabled.restype = amdsmi_status_t
+amdsmi_set_lib_lock_stats_enabled.argtypes = [ctypes.c_bool]
+amdsmi_get_lib_lock_stats = _libraries['libamd_smi.so'].amdsmi_get_lib_lock_stats
+amdsmi_get_lib_lock_stats.restype = amdsmi_status_t
+amdsmi_get_lib_lock_stats.argtypes = [ctypes.POINTER(ctypes.c_uint32), ctypes.POINTER(struct_amdsmi_lib_lock_stats_t)]
+amdsmi_reset_lib_lock_stats = _libraries['libamd_smi.so'].amdsmi_reset_lib_lock_stats
+amdsmi_reset_lib_lock_stats.restype = amdsmi_status_t
+amdsmi_reset_lib_lock_stats.argtypes = []
 amdsmi_get_gpu_ecc_count = _libraries['libamd_smi.so'].amdsmi_get_gpu_ecc_count
 amdsmi_get_gpu_ecc_count.restype = amdsmi_status_t
 amdsmi_get_gpu_ecc_count.argtypes = [amdsmi_processor_handle, amdsmi_gpu_block_t, ctypes.POINTER(struct_amdsmi_error_count_t)]
@@ -2857,7 +2982,9 @@ __all__ = \
     'AMDSMI_INIT_NON_AMD_GPUS', 'AMDSMI_IOLINK_TYPE_NUMIOLINKTYPES',
     'AMDSMI_IOLINK_TYPE_PCIEXPRESS', 'AMDSMI_IOLINK_TYPE_SIZE',
     'AMDSMI_IOLINK_TYPE_UNDEFINED', 'AMDSMI_IOLINK_TYPE_XGMI',
-    'AMDSMI_LINK_TYPE_INTERNAL', 'AMDSMI_LINK_TYPE_NOT_APPLICABLE',
+    'AMDSMI_LIB_LOCK_DEVICE', 'AMDSMI_LIB_LOCK_DEVICE_CROSS_PROCESS',
+    'AMDSMI_LIB_LOCK_DRM', 'AMDSMI_LIB_LOCK_KFD_EVENT',
+    'AMDSMI_LIB_LOCK_LOGGER', 'AMDSMI_LINK_TYPE_INTERNAL', 'AMDSMI_LINK_TYPE_NOT_APPLICABLE',
     'AMDSMI_LINK_TYPE_PCIE', 'AMDSMI_LINK_TYPE_UNKNOWN',
     'AMDSMI_LINK_TYPE_XGMI', 'AMDSMI_MEMORY_PARTITION_NPS1',
     'AMDSMI_MEMORY_PARTITION_NPS2', 'AMDSMI_MEMORY_PARTITION_NPS4',
@@ -3024,6 +3151,7 @@ __all__ = \
     'amdsmi_get_gpu_enumeration_info',
     'amdsmi_get_gpu_event_notification', 'amdsmi_get_gpu_fan_rpms',
     'amdsmi_get_gpu_fan_speed', 'amdsmi_get_gpu_fan_speed_max',
+    'amdsmi_get_gpu_generation', 'amdsmi_get_gpu_hwmon_snapshot',
     'amdsmi_get_gpu_id', 'amdsmi_get_gpu_kfd_info',
     'amdsmi_get_gpu_mem_overdrive_level',
     'amdsmi_get_gpu_memory_partition',
@@ -3036,7 +3164,8 @@ __all__ = \
     'amdsmi_get_gpu_od_volt_info', 'amdsmi_get_gpu_overdrive_level',
     'amdsmi_get_gpu_pci_bandwidth',
     'amdsmi_get_gpu_pci_replay_counter',
-    'amdsmi_get_gpu_pci_throughput', 'amdsmi_get_gpu_perf_level',
+    'amdsmi_get_gpu_pci_throughput',
+    'amdsmi_get_gpu_pci_throughput_latest', 'amdsmi_get_gpu_perf_level',
     'amdsmi_get_gpu_pm_metrics_info',
     'amdsmi_get_gpu_power_profile_presets',
     'amdsmi_get_gpu_process_isolation', 'amdsmi_get_gpu_process_list',
@@ -3044,6 +3173,7 @@ __all__ = \
     'amdsmi_get_gpu_ras_feature_info',
     'amdsmi_get_gpu_reg_table_info', 'amdsmi_get_gpu_revision',
     'amdsmi_get_gpu_subsystem_id', 'amdsmi_get_gpu_subsystem_name',
+    'amdsmi_get_gpu_sysfs_snapshot',
     'amdsmi_get_gpu_topo_numa_affinity',
     'amdsmi_get_gpu_total_ecc_count', 'amdsmi_get_gpu_vbios_info',
     'amdsmi_get_gpu_vendor_name',
@@ -3052,7 +3182,9 @@ __all__ = \
     'amdsmi_get_gpu_vram_usage', 'amdsmi_get_gpu_vram_vendor',
     'amdsmi_get_gpu_xgmi_link_status',
     'amdsmi_get_hsmp_metrics_table',
-    'amdsmi_get_hsmp_metrics_table_version', 'amdsmi_get_lib_version',
+    'amdsmi_get_hsmp_metrics_table_version',
+    'amdsmi_get_lib_lock_stats', 'amdsmi_get_lib_perf_stats',
+    'amdsmi_get_lib_version',
     'amdsmi_get_link_metrics', 'amdsmi_get_link_topology_nearest',
     'amdsmi_get_minmax_bandwidth_between_processors',
     'amdsmi_get_pcie_info', 'amdsmi_get_power_cap_info',
@@ -3069,8 +3201,10 @@ __all__ = \
     'amdsmi_get_xgmi_plpd', 'amdsmi_gpu_block_t',
     'amdsmi_gpu_cache_info_t', 'amdsmi_gpu_control_counter',
     'amdsmi_gpu_counter_group_supported', 'amdsmi_gpu_create_counter',
-    'amdsmi_gpu_destroy_counter', 'amdsmi_gpu_metrics_t',
-    'amdsmi_gpu_read_counter', 'amdsmi_gpu_validate_ras_eeprom',
+    'amdsmi_gpu_destroy_counter', 'amdsmi_gpu_hwmon_snapshot_t',
+    'amdsmi_gpu_metrics_t',
+    'amdsmi_gpu_read_counter', 'amdsmi_gpu_sysfs_snapshot_t',
+    'amdsmi_gpu_validate_ras_eeprom',
     'amdsmi_gpu_xcp_metrics_t', 'amdsmi_gpu_xgmi_error_status',
     'amdsmi_hsmp_driver_version_t', 'amdsmi_hsmp_freqlimit_src_names',
     'amdsmi_hsmp_metrics_table_t', 'amdsmi_init',
@@ -3078,6 +3212,8 @@ __all__ = \
     'amdsmi_io_bw_encoding_t', 'amdsmi_io_link_type_t',
     'amdsmi_is_P2P_accessible',
     'amdsmi_is_gpu_power_management_enabled', 'amdsmi_kfd_info_t',
+    'amdsmi_lib_lock_stats_t', 'amdsmi_lib_lock_type_t',
+    'amdsmi_lib_perf_stats_t',
     'amdsmi_link_id_bw_type_t', 'amdsmi_link_metrics_t',
     'amdsmi_link_type_t', 'amdsmi_memory_page_status_t',
     'amdsmi_memory_partition_config_t',
@@ -3093,7 +3229,9 @@ __all__ = \
     'amdsmi_processor_handle', 'amdsmi_range_t',
     'amdsmi_ras_err_state_t', 'amdsmi_ras_feature_t',
     'amdsmi_reg_type_t', 'amdsmi_reset_gpu', 'amdsmi_reset_gpu_fan',
-    'amdsmi_reset_gpu_xgmi_error', 'amdsmi_retired_page_record_t',
+    'amdsmi_reset_gpu_xgmi_error', 'amdsmi_reset_lib_lock_stats',
+    'amdsmi_reset_lib_perf_stats',
+    'amdsmi_retired_page_record_t',
     'amdsmi_set_clk_freq', 'amdsmi_set_cpu_core_boostlimit',
     'amdsmi_set_cpu_df_pstate_range',
     'amdsmi_set_cpu_gmi3_link_width_range',
@@ -3112,7 +3250,9 @@ __all__ = \
     'amdsmi_set_gpu_overdrive_level', 'amdsmi_set_gpu_pci_bandwidth',
     'amdsmi_set_gpu_perf_determinism_mode',
     'amdsmi_set_gpu_perf_level', 'amdsmi_set_gpu_power_profile',
-    'amdsmi_set_gpu_process_isolation', 'amdsmi_set_power_cap',
+    'amdsmi_set_gpu_process_isolation',
+    'amdsmi_set_lib_lock_stats_enabled',
+    'amdsmi_set_lib_perf_stats_enabled', 'amdsmi_set_power_cap',
     'amdsmi_set_soc_pstate', 'amdsmi_set_xgmi_plpd',
     'amdsmi_shut_down', 'amdsmi_smu_fw_version_t',
     'amdsmi_socket_handle', 'amdsmi_status_code_to_string',
@@ -3144,10 +3284,13 @@ __all__ = \
     'struct_amdsmi_evt_notification_data_t',
     'struct_amdsmi_freq_volt_region_t', 'struct_amdsmi_frequencies_t',
     'struct_amdsmi_frequency_range_t', 'struct_amdsmi_fw_info_t',
-    'struct_amdsmi_gpu_cache_info_t', 'struct_amdsmi_gpu_metrics_t',
+    'struct_amdsmi_gpu_cache_info_t',
+    'struct_amdsmi_gpu_hwmon_snapshot_t', 'struct_amdsmi_gpu_metrics_t',
+    'struct_amdsmi_gpu_sysfs_snapshot_t',
     'struct_amdsmi_gpu_xcp_metrics_t',
     'struct_amdsmi_hsmp_driver_version_t',
     'struct_amdsmi_hsmp_metrics_table_t', 'struct_amdsmi_kfd_info_t',
+    'struct_amdsmi_lib_lock_stats_t', 'struct_amdsmi_lib_perf_stats_t',
     'struct_amdsmi_link_id_bw_type_t', 'struct_amdsmi_link_metrics_t',
     'struct_amdsmi_memory_partition_config_t',
     'struct_amdsmi_name_value_t', 'struct_amdsmi_od_vddc_point_t',
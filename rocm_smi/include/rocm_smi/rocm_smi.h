@@ -2116,6 +2116,47 @@ rsmi_status_t rsmi_topo_numa_affinity_get(uint32_t dv_ind, int32_t *numa_node);
 rsmi_status_t rsmi_dev_pci_throughput_get(uint32_t dv_ind, uint64_t *sent,
                                     uint64_t *received, uint64_t *max_pkt_sz);
 
+/**
+ *  @brief Get the last measured PCIe traffic without waiting for a
+ *  measurement
+ *
+ *  @details Same as ::rsmi_dev_pci_throughput_get(), except that the 1
+ *  second measurement runs on a library thread, back to back, and this
+ *  function returns right away with the last completed window. The age of
+ *  that window, in milliseconds since it closed, is written to @p age_ms.
+ *
+ *  The first call starts the measurements and returns ::RSMI_STATUS_NO_DATA;
+ *  a result is available about a second later. Measurements stop when the
+ *  function has not been called for 10 seconds, and resume on the next
+ *  call, which then returns the last window measured before with its age.
+ *  The measurement does not hold the device mutex, so other calls on the
+ *  device are not delayed by it.
+ *
+ *  @param[in] dv_ind a device index
+ *
+ *  @param[inout] sent a pointer to uint64_t to which the number of bytes sent
+ *  in the window will be written. If pointer is NULL, it will be ignored.
+ *
+ *  @param[inout] received a pointer to uint64_t to which the number of bytes
+ *  received in the window will be written. If pointer is NULL, it will be
+ *  ignored.
+ *
+ *  @param[inout] max_pkt_sz a pointer to uint64_t to which the maximum packet
+ *  size will be written. If pointer is NULL, it will be ignored.
+ *
+ *  @param[inout] age_ms a pointer to uint64_t to which the age of the window
+ *  in milliseconds will be written.
+ *
+ *  @retval ::RSMI_STATUS_SUCCESS is returned upon successful call.
+ *  @retval ::RSMI_STATUS_NO_DATA no window has completed yet
+ *  @retval ::RSMI_STATUS_NOT_SUPPORTED installed software or hardware does not
+ *  support this function with the given arguments
+ *  @retval ::RSMI_STATUS_INVALID_ARGS the provided arguments are not valid
+ */
+rsmi_status_t rsmi_dev_pci_throughput_latest_get(uint32_t dv_ind,
+                        uint64_t *sent, uint64_t *received,
+                        uint64_t *max_pkt_sz, uint64_t *age_ms);
+
 /**
  *  @brief Get PCIe replay counter
  *
@@ -5341,6 +5382,76 @@ rsmi_dev_metrics_xcd_counter_get(uint32_t dv_ind, uint16_t* xcd_counter_value);
 rsmi_status_t
 rsmi_dev_metrics_log_get(uint32_t dv_ind);
 
+/**
+ *  @brief Set the maximum age of the cached GPU metrics snapshot
+ *
+ *  @details Given a device index @p dv_ind and an age in milliseconds
+ *  @p max_age_ms, GPU metrics queries for the device are served from the
+ *  last snapshot read for up to @p max_age_ms. Once the snapshot is older,
+ *  the table is re-read; it is only re-parsed if the firmware timestamp
+ *  changed. A value of 0 (default, unless RSMI_GPU_METRICS_MAX_AGE_MS is
+ *  set) re-reads the table on every query.
+ *
+ *  @param[in] dv_ind a device index
+ *
+ *  @param[in] max_age_ms maximum age of the snapshot, in milliseconds
+ *
+ *  @retval ::RSMI_STATUS_SUCCESS is returned upon successful call.
+ *
+ */
+rsmi_status_t
+rsmi_dev_gpu_metrics_cache_max_age_set(uint32_t dv_ind, uint32_t max_age_ms);
+
+/**
+ *  @brief Get the maximum age of the cached GPU metrics snapshot
+ *
+ *  @details Given a device index @p dv_ind and a pointer to a uint32_t
+ *  @p max_age_ms, this function will write the current maximum age (in
+ *  milliseconds) of the GPU metrics snapshot to @p max_age_ms.
+ *
+ *  @param[in] dv_ind a device index
+ *
+ *  @param[inout] max_age_ms a pointer to uint32_t to which the maximum age
+ *  will be written
+ *
+ *  @retval ::RSMI_STATUS_SUCCESS is returned upon successful call.
+ *          ::RSMI_STATUS_INVALID_ARGS the provided arguments are not valid
+ *
+ */
+rsmi_status_t
+rsmi_dev_gpu_metrics_cache_max_age_get(uint32_t dv_ind, uint32_t* max_age_ms);
+
+/**
+ *  @brief Invalidate the cached GPU metrics snapshot
+ *
+ *  @details Given a device index @p dv_ind, the next GPU metrics query for
+ *  the device will re-read and re-parse the metrics table, regardless of
+ *  the snapshot age.
+ *
+ *  @param[in] dv_ind a device index
+ *
+ *  @retval ::RSMI_STATUS_SUCCESS is returned upon successful call.
+ *
+ */
+rsmi_status_t
+rsmi_dev_gpu_metrics_cache_invalidate(uint32_t dv_ind);
+
+/**
+ *  @brief Refresh the cached GPU metrics snapshot
+ *
+ *  @details Given a device index @p dv_ind, the metrics table is re-read
+ *  and re-parsed right away, and the snapshot age is reset.
+ *
+ *  @param[in] dv_ind a device index
+ *
+ *  @retval ::RSMI_STATUS_SUCCESS is returned upon successful call.
+ *          ::RSMI_STATUS_NOT_SUPPORTED is returned in case the metrics table
+ *            version is not supported for the given device
+ *
+ */
+rsmi_status_t
+rsmi_dev_gpu_metrics_cache_refresh(uint32_t dv_ind);
+
 /** @} */  // end of DevMetricsHeaderInfoGet
 
 #ifdef __cplusplus
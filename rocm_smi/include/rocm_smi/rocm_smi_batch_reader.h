@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef ROCM_SMI_ROCM_SMI_BATCH_READER_H_
+#define ROCM_SMI_ROCM_SMI_BATCH_READER_H_
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <vector>
+
+#include "rocm_smi/rocm_smi_device.h"
+
+/**
+ *  Batched sysfs reads
+ *
+ *  Reads a set of (device, attribute) requests through the devices'
+ *  persistent sysfs fds, with all reads going out in a single io_uring
+ *  submission. Attributes with no fd open yet are opened in one submission
+ *  before; the fds that can't be kept open are closed in one after. Where
+ *  io_uring is not available (old kernel, seccomp,
+ *  kernel.io_uring_disabled), each is done with its own syscall.
+ */
+namespace amd::smi {
+
+struct SysfsReadRequest_t {
+  Device *device;
+  DevInfoTypes type;
+  char *buf;                // kSysfsTextBufSize is always enough
+  std::size_t buf_size;
+  std::string_view text;    // [out] bytes read, in buf
+  int err;                  // [out] 0 or an errno
+};
+
+class SysfsBatchReader {
+ public:
+  static SysfsBatchReader& getInstance();
+  ~SysfsBatchReader();
+
+  SysfsBatchReader(const SysfsBatchReader&) = delete;
+  SysfsBatchReader& operator=(const SysfsBatchReader&) = delete;
+
+  // Fill in text and err of each of the num_reqs requests. Batches run
+  // concurrently, each on a ring of its own.
+  void read(SysfsReadRequest_t *reqs, std::size_t num_reqs);
+
+ private:
+  SysfsBatchReader() = default;
+
+  struct IoUring;
+  struct RingOp;
+  std::unique_ptr<IoUring> acquire_ring();
+  void release_ring(std::unique_ptr<IoUring> ring);
+  std::unique_ptr<IoUring> setup_io_uring();
+  // Runs the ops on *ring, or one by one if there is none or it fails;
+  // a ring that failed is dropped
+  void run(std::unique_ptr<IoUring> *ring, RingOp *ops, std::size_t num_ops);
+  bool io_uring_run(IoUring *ring, RingOp *ops, std::size_t num_ops);
+  static unsigned reap_completions(IoUring *ring, RingOp *ops);
+  void drain_io_uring(IoUring *ring, RingOp *ops, std::size_t first,
+                      unsigned first_tail, unsigned num_done);
+
+  std::mutex mutex_;  // Only held to take a ring out of idle_rings_ or back
+  std::vector<std::unique_ptr<IoUring>> idle_rings_;
+  std::atomic<bool> ring_failed_{false};
+};
+
+}  // namespace amd::smi
+
+#endif  // ROCM_SMI_ROCM_SMI_BATCH_READER_H_
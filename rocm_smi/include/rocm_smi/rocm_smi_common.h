@@ -29,6 +29,8 @@
 #include <string>
 #include <unordered_set>
 
+#include "rocm_smi/rocm_smi_perf_stats.h"
+
 #define CHECK_DV_IND_RANGE \
     amd::smi::RocmSMI& smi = amd::smi::RocmSMI::getInstance(); \
     if (dv_ind >= smi.devices().size()) { \
@@ -38,7 +40,8 @@
 #define GET_DEV_FROM_INDX  \
   CHECK_DV_IND_RANGE \
   std::shared_ptr<amd::smi::Device> dev = smi.devices()[dv_ind]; \
-  assert(dev != nullptr);
+  assert(dev != nullptr); \
+  amd::smi::PerfScope::setDevice(dv_ind);
 
 
 #define GET_DEV_AND_KFDNODE_FROM_INDX \
@@ -55,15 +58,20 @@
       return RSMI_STATUS_PERMISSION; \
     }
 
-#define DEVICE_MUTEX \
-    amd::smi::pthread_wrap _pw(*amd::smi::GetMutex(dv_ind)); \
+#define DEVICE_MUTEX_MODE(MODE) \
     amd::smi::RocmSMI& smi_ = amd::smi::RocmSMI::getInstance(); \
     bool blocking_ = !(smi_.init_options() & \
                           static_cast<uint64_t>(RSMI_INIT_FLAG_RESRV_TEST1)); \
-    amd::smi::ScopedPthread _lock(_pw, blocking_); \
-    if (!blocking_ && _lock.mutex_not_acquired()) { \
+    amd::smi::ScopedDeviceLock _lock(amd::smi::GetMutex(dv_ind), \
+                                     amd::smi::ScopedDeviceLock::MODE, \
+                                     blocking_); \
+    if (_lock.mutex_not_acquired()) { \
       return RSMI_STATUS_BUSY; \
     }
+// For calls that change the device state (set, reset, partition changes)
+#define DEVICE_MUTEX DEVICE_MUTEX_MODE(kExclusive)
+// For queries, which run concurrently with each other
+#define DEVICE_MUTEX_SHARED DEVICE_MUTEX_MODE(kShared)
 
 /* This group of macros is used to facilitate checking of support for rsmi_dev*
  * "getter" functions. When the return buffer is set to nullptr, the macro will
@@ -152,6 +160,26 @@ struct RocmSMI_env_vars {
     // Otherwise unset values, signify logging is turned off.
     uint32_t logging_on;
 
+    // Env. var. RSMI_GPU_METRICS_MAX_AGE_MS
+    // Max age (in ms) of a cached gpu_metrics snapshot before it is re-read
+    // from sysfs. Unset or 0 re-reads the table on every query.
+    uint32_t gpu_metrics_max_age_ms;
+
+    // Env. var. RSMI_DEVICE_WATCHER_DISABLE
+    // If non-zero, no thread watches for partition, DRM and KFD topology
+    // changes; device generations then never move.
+    uint32_t device_watcher_disabled;
+
+    // Env. var. RSMI_LOCK_STATS_DUMP_SECS
+    // If non-zero, lock wait statistics are collected from initialization
+    // on and printed to stderr every so many seconds.
+    uint32_t lock_stats_dump_secs;
+
+    // Env. var. RSMI_FS_ROOT
+    // Directory under which /sys and /proc are looked up instead of /, e.g.
+    // a tree captured from a machine with GPUs. Unset uses the real ones.
+    const char *path_fs_root;
+
     // Sysfs path overrides
 
     // Env. var. RSMI_DEBUG_DRM_ROOT_OVERRIDE
@@ -25,7 +25,9 @@
 
 #include <pthread.h>
 
+#include <atomic>
 #include <string>
+#include <string_view>
 #include <memory>
 #include <utility>
 #include <cstdint>
@@ -34,6 +36,7 @@
 #include <map>
 #include <type_traits>
 #include <optional>
+#include <mutex>
 
 #include "rocm_smi/rocm_smi_monitor.h"
 #include "rocm_smi/rocm_smi_power_mon.h"
@@ -42,6 +45,7 @@
 #include "rocm_smi/rocm_smi_counters.h"
 #include "rocm_smi/rocm_smi_properties.h"
 #include "rocm_smi/rocm_smi_gpu_metrics.h"
+#include "rocm_smi/rocm_smi_pcie_throughput.h"
 #include "shared_mutex.h"   //NOLINT
 
 namespace amd {
@@ -195,6 +199,24 @@ typedef struct {
     std::vector<DevInfoTypes> variants;
 } dev_depends_t;
 
+// An open sysfs attribute file. Reads hold on to it while they use the fd,
+// so it is only closed once neither they nor the fd cache have it.
+class SysfsFd {
+ public:
+    SysfsFd(int fd, bool is_cached) : fd_(fd), is_cached_(is_cached) {}
+    ~SysfsFd();
+    SysfsFd(const SysfsFd&) = delete;
+    SysfsFd& operator=(const SysfsFd&) = delete;
+
+    int get(void) const { return fd_; }
+    // Whether it counts against the cached fds budget
+    bool is_cached(void) const { return is_cached_; }
+
+ private:
+    int fd_;
+    bool is_cached_;
+};
+using SysfsFdPtr = std::shared_ptr<const SysfsFd>;
 
 class Device {
  public:
@@ -213,6 +235,40 @@ class Device {
     int readDevInfo(DevInfoTypes type, std::vector<std::string> *retVec);
     int readDevInfo(DevInfoTypes type, std::size_t b_size,
                                       void *p_binary_data);
+    // Text attributes can be read into a caller supplied buffer (of
+    // kSysfsTextBufSize, a sysfs page) and parsed in place; *text views the
+    // bytes read.
+    int readDevInfoText(DevInfoTypes type, char *buf, std::size_t b_size,
+                        std::string_view *text);
+    // For attributes whose read blocks in the kernel (pcie_bw counts traffic
+    // for a second): reads the text with a single read() on an fd of its
+    // own, so no device lock is held while it blocks.
+    int readDevInfoTextUnlocked(DevInfoTypes type, char *buf,
+                                std::size_t b_size, std::string_view *text);
+    // Binary tables (gpu_metrics, pm_metrics, reg_state) are read with a
+    // single pread() through a persistent O_RDONLY fd, opened on first use.
+    // *p_read_size gets the number of bytes read, which can be < b_size.
+    int preadDevInfoBinary(DevInfoTypes type, std::size_t b_size,
+                           void *p_binary_data, off_t offset,
+                           std::size_t *p_read_size);
+    // All sysfs attribute reads go through persistent fds, one per
+    // DevInfoTypes, opened with openat() relative to a directory fd of the
+    // device (sysfs, PCI sysfs or debugfs) root; close them when the files
+    // may have been re-created (ie: GPU reset, driver restart, partition
+    // change). They are also dropped on the first access after
+    // generation() moved.
+    void closeSysfsFds(void);
+    // Batched reads (SysfsBatchReader) read the persistent fds directly,
+    // holding on to them until their reads complete. findCachedSysfsFd()
+    // returns nullptr if the attribute has no fd open; the batch then opens
+    // getSysfsPath() itself and hands the fd over to cacheSysfsFd(), along
+    // with the generation() it was opened at. That returns nullptr, and
+    // leaves the fd to the caller, with errno ENOENT if it is not a regular
+    // file, or EMFILE if it can't be kept open.
+    SysfsFdPtr findCachedSysfsFd(DevInfoTypes type);
+    SysfsFdPtr cacheSysfsFd(DevInfoTypes type, int fd,
+                            uint64_t open_generation);
+    int getSysfsPath(DevInfoTypes type, std::string *sysfs_path) const;
     std::string get_sys_file_path_by_type(DevInfoTypes type) const;
     // Get the property from a file which may contain multiple properties.
     int readDevInfo(DevInfoTypes type, const std::string& property,
@@ -227,7 +283,7 @@ class Device {
     static rsmi_dev_perf_level perfLvlStrToEnum(std::string s);
     uint64_t bdfid(void) const {return bdfid_;}
     void set_bdfid(uint64_t val) {bdfid_ = val;}
-    pthread_mutex_t *mutex(void) {return mutex_.ptr;}
+    shared_mutex_t *mutex(void) {return &mutex_;}
     evt::dev_evt_grp_set_t* supported_event_groups(void) {
                                              return &supported_event_groups_;}
     SupportedFuncMap *supported_funcs(void) {return &supported_funcs_;}
@@ -258,15 +314,62 @@ class Device {
     rsmi_status_t setup_gpu_metrics_reading();
     rsmi_status_t dev_read_gpu_metrics_header_data();
     rsmi_status_t dev_read_gpu_metrics_all_data();
-    rsmi_status_t run_internal_gpu_metrics_query(AMDGpuMetricsUnitType_t metric_counter, AMDGpuDynamicMetricTblValues_t& values);
+    rsmi_status_t run_internal_gpu_metrics_query(AMDGpuMetricsUnitType_t metric_counter, AMDGpuMetricFieldValue_t& value);
+    rsmi_status_t run_internal_gpu_metrics_fields_query(const AMDGpuMetricsUnitType_t* metric_counters,
+                                                        uint32_t num_counters,
+                                                        AMDGpuMetricFieldValue_t* metric_values);
     rsmi_status_t dev_log_gpu_metrics(std::ostringstream& outstream_metrics);
     AMGpuMetricsPublicLatestTupl_t dev_copy_internal_to_external_metrics();
 
+    // gpu_metrics snapshot cache
+    //  A snapshot younger than the max age (in ms) is served as is; an older
+    //  snapshot is re-read, but only re-parsed when the firmware timestamp
+    //  moved. A max age of 0 disables time based reuse.
+    void dev_set_gpu_metrics_max_age(uint32_t max_age_ms);
+    uint32_t dev_get_gpu_metrics_max_age() const { return m_gpu_metrics_max_age_ms; }
+    void dev_invalidate_gpu_metrics();
+    rsmi_status_t dev_refresh_gpu_metrics();
+    std::recursive_mutex& dev_gpu_metrics_mutex() { return m_gpu_metrics_mutex; }
+
+    PcieThroughputMonitor& pcie_throughput_monitor(void) {
+      return m_pcie_throughput_monitor;
+    }
+
     static const std::map<DevInfoTypes, const char*> devInfoTypesStrings;
     void set_smi_device_id(uint32_t device_id) { m_device_id = device_id; }
-    void set_smi_partition_id(uint32_t partition_id) { m_partition_id = partition_id; }
+    void set_smi_partition_id(uint32_t partition_id) {
+      if (partition_id != m_partition_id) {
+        dev_invalidate_gpu_metrics();
+        closeSysfsFds();
+      }
+      m_partition_id = partition_id;
+    }
     static const char* get_type_string(DevInfoTypes type);
 
+    // Bumped by the DeviceWatcher whenever the device may have changed
+    // underneath the library (partition reconfiguration, DRM nodes added or
+    // removed, KFD topology update). Data cached at one generation is
+    // stale once generation() returns another.
+    uint64_t generation(void) const {
+      return m_generation.load(std::memory_order_acquire);
+    }
+    void bumpGeneration(void) {
+      m_generation.fetch_add(1, std::memory_order_acq_rel);
+    }
+
+    // Attributes that only change across a driver reload, GPU reset or
+    // partition change (ids, names, serial numbers, VBIOS and firmware
+    // versions) are read from sysfs once and then served from memory until
+    // generation() moves. Nothing is kept while device changes aren't
+    // watched, as the generation can't be trusted then.
+    static bool isImmutableDevInfo(DevInfoTypes type);
+
+    // KFD gpu_id as last read from the topology, kept like the immutable
+    // attributes above. kfd_gpu_id() is the one found at discovery, which
+    // keys kfd_node_map(), and is not refreshed.
+    bool loadKfdGpuId(uint64_t *gpu_id);
+    void storeKfdGpuId(uint64_t gpu_id, uint64_t read_generation);
+
  private:
     std::shared_ptr<Monitor> monitor_;
     std::shared_ptr<PowerMon> power_monitor_;
@@ -275,8 +378,6 @@ class Device {
     uint32_t card_indx_;  // This index corresponds to the drm index (ie, card#)
     uint32_t drm_render_minor_;
     const RocmSMI_env_vars *env_;
-    template <typename T> int openDebugFileStream(DevInfoTypes type, T *fs,
-                                                   const char *str = nullptr);
     template <typename T> int openSysfsFileStream(DevInfoTypes type, T *fs,
                                                    const char *str = nullptr);
     int readDebugInfoStr(DevInfoTypes type, std::string *retStr);
@@ -285,9 +386,23 @@ class Device {
                                             std::vector<std::string> *retVec);
     int readDevInfoBinary(DevInfoTypes type, std::size_t b_size,
                                             void *p_binary_data);
+    int getDirFd(int *dir_fd, const std::string& dir_path);
+    int getSysfsDirFd(DevInfoTypes type);
+    int getDebugfsDirFd(void);
+    void closeDirFds(void);
+    void closeSysfsFdsLocked(void);
+    void dropStaleSysfsFdsLocked(void);
+    bool loadImmutableDevInfo(DevInfoTypes type, std::string *contents);
+    void storeImmutableDevInfo(DevInfoTypes type, std::string_view contents,
+                               uint64_t read_generation);
+    SysfsFdPtr openSysfsFd(DevInfoTypes type);
+    int preadSysfsFd(DevInfoTypes type, void *buf, std::size_t b_size,
+                     off_t offset, std::size_t *p_read_size);
+    int readSysfsText(DevInfoTypes type, std::string *contents);
     int writeDevInfoStr(DevInfoTypes type, std::string valStr,
                         bool returnWriteErr = false);
     rsmi_status_t run_amdgpu_property_reinforcement_query(const AMDGpuPropertyQuery_t& amdgpu_property_query);
+    bool is_gpu_metrics_snapshot_fresh() const;
 
     uint64_t bdfid_;
     uint64_t kfd_gpu_id_;
@@ -304,6 +419,41 @@ class Device {
     uint64_t m_gpu_metrics_updated_timestamp;
     uint32_t m_device_id;
     uint32_t m_partition_id;
+
+    std::atomic<uint64_t> m_generation{0};
+
+    // Sysfs contents of the immutable attributes, read at
+    // m_immutable_generation
+    std::mutex m_immutable_mutex;
+    std::map<DevInfoTypes, std::string> m_immutable_values;
+    uint64_t m_immutable_generation;
+    // KFD gpu_id read at m_kfd_gpu_id_generation, if m_kfd_gpu_id_valid
+    uint64_t m_kfd_gpu_id;
+    uint64_t m_kfd_gpu_id_generation;
+    bool m_kfd_gpu_id_valid;
+
+    // Only held to look up, open or drop fds, never across their reads
+    std::mutex m_sysfs_fds_mutex;
+    std::map<DevInfoTypes, SysfsFdPtr> m_sysfs_fds;
+    // generation() the cached fds were opened at
+    uint64_t m_sysfs_fds_generation;
+    // O_PATH directory fds of <path_>/device, /sys/bus/pci/devices/<bdf>
+    // and /sys/kernel/debug/dri/<index>; opened on first use, -1 until then.
+    // Guarded by m_sysfs_fds_mutex.
+    int m_sysfs_dir_fd;
+    int m_pci_dir_fd;
+    int m_debugfs_dir_fd;
+
+    PcieThroughputMonitor m_pcie_throughput_monitor;
+
+    std::recursive_mutex m_gpu_metrics_mutex;
+    std::vector<uint8_t> m_gpu_metrics_raw_buffer;
+    std::size_t m_gpu_metrics_raw_size;
+    uint64_t m_gpu_metrics_refreshed_at_ms;
+    uint64_t m_gpu_metrics_raw_fw_timestamp;
+    uint64_t m_gpu_metrics_generation;
+    uint32_t m_gpu_metrics_max_age_ms;
+    bool m_gpu_metrics_is_valid;
 };
 
 
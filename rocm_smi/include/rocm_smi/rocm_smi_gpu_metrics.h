@@ -29,9 +29,12 @@
 #include <array>
 #include <algorithm>
 #include <cassert>
+#include <cstddef>
 #include <cstdint>
 #include <cstring>
+#include <functional>
 #include <iostream>
+#include <limits>
 #include <string>
 #include <map>
 #include <memory>
@@ -669,6 +672,14 @@ struct AMDGpuMetrics_v17_t {
 };
 using AMGpuMetricsLatest_t = AMDGpuMetrics_v17_t;
 
+//  Note: Largest supported metrics table; reading this many bytes gets the
+//        whole gpu_metrics file in one go, whatever its version is.
+constexpr size_t kAMDGpuMetricsMaxTableSize =
+  std::max({sizeof(AMDGpuMetrics_v11_t), sizeof(AMDGpuMetrics_v12_t),
+            sizeof(AMDGpuMetrics_v13_t), sizeof(AMDGpuMetrics_v14_t),
+            sizeof(AMDGpuMetrics_v15_t), sizeof(AMDGpuMetrics_v16_t),
+            sizeof(AMDGpuMetrics_v17_t)});
+
 /**
  *  This is GPU Metrics version that gets to public access.
  *  It is a unique/unified version (joined) of the previous
@@ -738,8 +749,9 @@ using GPUMetricCurrDClkTbl_t = GpuMetricU16Tbl_t;
       - AMDGpuMetricsUnitType_t
       - amdgpu_metrics_unit_type_translation_table
       - AMDGpuMetrics_v1X_t structure in question
-      - populate_metrics_dynamic_tbl()
-      - copy_internal_to_external_metrics()
+      - kAMDGpuMetricFields_v1X (field descriptor table for the new version)
+      - populate_metrics_dynamic_tbl() (version specific adjustments)
+      - copy_internal_to_external_metrics() (only if partition specific)
       - init_max_public_gpu_matrics()
 */
 
@@ -899,14 +911,116 @@ enum class AMDGpuMetricsDataType_t : AMDGpuMetricsDataTypeId_t
   kUInt64,
 };
 
-struct AMDGpuDynamicMetricsValue_t {
-  uint64_t m_value;
-  std::string m_info;
+constexpr auto kAMDGpuMetricsUnitTypeCount =
+  (static_cast<size_t>(AMDGpuMetricsUnitType_t::kMetricGfxBelowHostLimitAccumulator) + 1);
+
+/*
+  *
+  * One slot per metric unit; m_num_values == 0 means the unit is not part of
+  * the metrics version in use. Slot values live in the table's contiguous
+  * value buffer, at [m_offset, m_offset + m_num_values).
+  *
+ */
+struct AMDGpuDynamicMetricsSlot_t {
+  const char* m_title;
+  uint16_t m_offset;
+  uint16_t m_num_values;
+  AMDGpuMetricsClassId_t m_class_id;
   AMDGpuMetricsDataType_t m_original_type;
 };
-using AMDGpuDynamicMetricTblValues_t = std::vector<AMDGpuDynamicMetricsValue_t>;
-using AMDGpuDynamicMetricsTbl_t = std::map<AMDGpuMetricsClassId_t,
-  std::map<AMDGpuMetricsUnitType_t, AMDGpuDynamicMetricTblValues_t>>;
+
+/*
+  *
+  * Dense dynamic metrics table, indexed directly by AMDGpuMetricsUnitType_t.
+  *   - Lookups are O(1) and do not allocate.
+  *   - clear() keeps the value buffer capacity, so re-populating the table
+  *     for a new gpu_metrics read does not allocate either.
+  *
+ */
+class AMDGpuDynamicMetricsTbl_t {
+ public:
+    AMDGpuDynamicMetricsTbl_t() { clear(); }
+
+    void clear() {
+      m_slots.fill(AMDGpuDynamicMetricsSlot_t{});
+      m_values.clear();
+    }
+
+    //  Note: Reserves num_values values for a metric unit and returns where
+    //        they go; returns nullptr if the unit already has a row (the
+    //        first row set for a metric unit wins).
+    //        The pointer is only valid until the next add_metric_row().
+    uint64_t* add_metric_row(AMDGpuMetricsClassId_t class_id,
+                             AMDGpuMetricsUnitType_t metric_unit,
+                             AMDGpuMetricsDataType_t data_type,
+                             const char* value_title,
+                             uint16_t num_values) {
+      auto& metric_slot = m_slots[static_cast<size_t>(metric_unit)];
+      if (metric_slot.m_num_values != 0) {
+        return nullptr;
+      }
+
+      metric_slot.m_title = value_title;
+      metric_slot.m_offset = static_cast<uint16_t>(m_values.size());
+      metric_slot.m_num_values = num_values;
+      metric_slot.m_class_id = class_id;
+      metric_slot.m_original_type = data_type;
+      m_values.resize(m_values.size() + num_values);
+      return (m_values.data() + metric_slot.m_offset);
+    }
+
+    bool contains(AMDGpuMetricsUnitType_t metric_unit) const {
+      return (slot(metric_unit).m_num_values != 0);
+    }
+
+    const AMDGpuDynamicMetricsSlot_t& slot(AMDGpuMetricsUnitType_t metric_unit) const {
+      return m_slots[static_cast<size_t>(metric_unit)];
+    }
+
+    const uint64_t* values(AMDGpuMetricsUnitType_t metric_unit) const {
+      return (m_values.data() + slot(metric_unit).m_offset);
+    }
+
+ private:
+    std::array<AMDGpuDynamicMetricsSlot_t, kAMDGpuMetricsUnitTypeCount> m_slots;
+    std::vector<uint64_t> m_values;
+};
+
+//  Note: Largest multi-valued metric unit is xcp_stats->jpeg_busy
+constexpr uint32_t kRSMI_MAX_NUM_METRIC_FIELD_VALUES = RSMI_MAX_NUM_JPEG_ENGS;
+struct AMDGpuMetricFieldValue_t {
+  rsmi_status_t m_status;
+  uint32_t m_num_values;
+  uint64_t m_values[kRSMI_MAX_NUM_METRIC_FIELD_VALUES];
+};
+
+/*
+  *
+  * Describes where a metric lives in a AMDGpuMetrics_v1X_t table (offset,
+  * element width and count), which dynamic table unit it feeds and where it
+  * goes in the public metrics (AMGpuMetricsPublicLatest_t).
+  *   - m_unit_id == kAMDGpuMetricsNoUnit: Public metrics only
+  *   - m_public_offset == kAMDGpuMetricsNoPublicField: Dynamic table only
+  *
+  * Each metrics version has one constexpr table of these; see
+  * GpuMetricsBase_t::decode_metrics_fields().
+  *
+ */
+constexpr auto kAMDGpuMetricsNoUnit =
+  static_cast<AMDGpuMetricsUnitType_t>(kAMDGpuMetricsUnitTypeCount);
+constexpr auto kAMDGpuMetricsNoPublicField = std::numeric_limits<uint16_t>::max();
+
+struct AMDGpuMetricFieldDesc_t {
+  AMDGpuMetricsClassId_t m_class_id;
+  AMDGpuMetricsUnitType_t m_unit_id;
+  const char* m_title;
+  uint16_t m_offset;
+  uint16_t m_width;
+  uint16_t m_num_values;
+  uint16_t m_public_offset;
+  uint16_t m_public_width;
+  uint16_t m_public_num_values;
+};
 
 
 /*
@@ -933,25 +1047,38 @@ class GpuMetricsBase_t {
  public:
     virtual ~GpuMetricsBase_t() = default;
     virtual size_t sizeof_metric_table() = 0;
+    // Offset of the raw (unadjusted) timestamp the firmware bumps on every
+    // table update; used to tell if a re-read table holds new data.
+    virtual size_t offsetof_firmware_timestamp() = 0;
     virtual GpuMetricTypePtr_t get_metrics_table() = 0;
     virtual void dump_internal_metrics_table() = 0;
     virtual AMDGpuMetricVersionFlags_t get_gpu_metrics_version_used() = 0;
     virtual rsmi_status_t populate_metrics_dynamic_tbl() = 0;
-    virtual AMGpuMetricsPublicLatestTupl_t copy_internal_to_external_metrics() = 0;
+    virtual AMGpuMetricsPublicLatestTupl_t copy_internal_to_external_metrics();
     virtual void set_device_id(uint32_t device_id) { m_device_id = device_id; }
     virtual void set_partition_id(uint32_t partition_id) { m_partition_id = partition_id; }
-    virtual AMDGpuDynamicMetricsTbl_t get_metrics_dynamic_tbl() {
+    virtual const AMDGpuDynamicMetricsTbl_t& get_metrics_dynamic_tbl() {
       return m_base_metrics_dynamic_tbl;
     }
 
  protected:
+    //  Note: Fills both the dynamic table and the public metrics from the
+    //        metrics table, following its field descriptor table.
+    template<typename MetricsTbl_t, size_t kNumFields>
+    void decode_metrics_fields(const MetricsTbl_t& metrics_tbl,
+                               const AMDGpuMetricFieldDesc_t (&metric_fields)[kNumFields]);
+
     AMDGpuDynamicMetricsTbl_t m_base_metrics_dynamic_tbl;
+    AMGpuMetricsPublicLatest_t m_base_metrics_public{};
     uint64_t m_metrics_timestamp;
     uint32_t m_device_id;
     uint32_t m_partition_id;
 };
 using GpuMetricsBasePtr = std::shared_ptr<GpuMetricsBase_t>;
-using AMDGpuMetricFactories_t = const std::map<AMDGpuMetricVersionFlags_t, GpuMetricsBasePtr>;
+//  Note: Each device gets its own metrics object; the metrics and dynamic
+//        tables hold that device's last read.
+using AMDGpuMetricFactories_t =
+  const std::map<AMDGpuMetricVersionFlags_t, std::function<GpuMetricsBasePtr()>>;
 
 class GpuMetricsBase_v11_t final : public GpuMetricsBase_t {
  public:
@@ -961,6 +1088,10 @@ class GpuMetricsBase_v11_t final : public GpuMetricsBase_t {
       return sizeof(AMDGpuMetrics_v11_t);
     }
 
+    size_t offsetof_firmware_timestamp() override {
+      return offsetof(AMDGpuMetrics_v11_t, m_system_clock_counter);
+    }
+
     GpuMetricTypePtr_t get_metrics_table() override {
       if (!m_gpu_metric_ptr) {
         m_gpu_metric_ptr.reset(&m_gpu_metrics_tbl, [](AMDGpuMetrics_v11_t*){});
@@ -978,7 +1109,6 @@ class GpuMetricsBase_v11_t final : public GpuMetricsBase_t {
     }
 
     rsmi_status_t populate_metrics_dynamic_tbl() override;
-    AMGpuMetricsPublicLatestTupl_t copy_internal_to_external_metrics() override;
 
 
  private:
@@ -994,6 +1124,10 @@ class GpuMetricsBase_v12_t final : public GpuMetricsBase_t {
       return sizeof(AMDGpuMetrics_v12_t);
     }
 
+    size_t offsetof_firmware_timestamp() override {
+      return offsetof(AMDGpuMetrics_v12_t, m_firmware_timestamp);
+    }
+
     GpuMetricTypePtr_t get_metrics_table() override {
       if (!m_gpu_metric_ptr) {
         m_gpu_metric_ptr.reset(&m_gpu_metrics_tbl, [](AMDGpuMetrics_v12_t*){});
@@ -1011,7 +1145,6 @@ class GpuMetricsBase_v12_t final : public GpuMetricsBase_t {
     }
 
     rsmi_status_t populate_metrics_dynamic_tbl() override;
-    AMGpuMetricsPublicLatestTupl_t copy_internal_to_external_metrics() override;
 
  private:
     AMDGpuMetrics_v12_t m_gpu_metrics_tbl;
@@ -1026,6 +1159,10 @@ class GpuMetricsBase_v13_t final : public GpuMetricsBase_t {
       return sizeof(AMDGpuMetrics_v13_t);
     }
 
+    size_t offsetof_firmware_timestamp() override {
+      return offsetof(AMDGpuMetrics_v13_t, m_firmware_timestamp);
+    }
+
     GpuMetricTypePtr_t get_metrics_table() override {
       if (!m_gpu_metric_ptr) {
         m_gpu_metric_ptr.reset(&m_gpu_metrics_tbl, [](AMDGpuMetrics_v13_t*){});
@@ -1041,7 +1178,6 @@ class GpuMetricsBase_v13_t final : public GpuMetricsBase_t {
     }
 
     rsmi_status_t populate_metrics_dynamic_tbl() override;
-    AMGpuMetricsPublicLatestTupl_t copy_internal_to_external_metrics() override;
 
 
  private:
@@ -1057,6 +1193,10 @@ class GpuMetricsBase_v14_t final : public GpuMetricsBase_t {
       return sizeof(AMDGpuMetrics_v14_t);
     }
 
+    size_t offsetof_firmware_timestamp() override {
+      return offsetof(AMDGpuMetrics_v14_t, m_firmware_timestamp);
+    }
+
     GpuMetricTypePtr_t get_metrics_table() override {
       if (!m_gpu_metric_ptr) {
         m_gpu_metric_ptr.reset(&m_gpu_metrics_tbl, [](AMDGpuMetrics_v14_t*){});
@@ -1072,7 +1212,6 @@ class GpuMetricsBase_v14_t final : public GpuMetricsBase_t {
     }
 
     rsmi_status_t populate_metrics_dynamic_tbl() override;
-    AMGpuMetricsPublicLatestTupl_t copy_internal_to_external_metrics() override;
 
 
  private:
@@ -1088,6 +1227,10 @@ class GpuMetricsBase_v15_t final : public GpuMetricsBase_t {
       return sizeof(AMDGpuMetrics_v15_t);
     }
 
+    size_t offsetof_firmware_timestamp() override {
+      return offsetof(AMDGpuMetrics_v15_t, m_firmware_timestamp);
+    }
+
     GpuMetricTypePtr_t get_metrics_table() override {
       if (!m_gpu_metric_ptr) {
         m_gpu_metric_ptr.reset(&m_gpu_metrics_tbl, [](AMDGpuMetrics_v15_t*){});
@@ -1103,7 +1246,6 @@ class GpuMetricsBase_v15_t final : public GpuMetricsBase_t {
     }
 
     rsmi_status_t populate_metrics_dynamic_tbl() override;
-    AMGpuMetricsPublicLatestTupl_t copy_internal_to_external_metrics() override;
 
 
  private:
@@ -1119,6 +1261,10 @@ class GpuMetricsBase_v16_t final : public GpuMetricsBase_t {
     return sizeof(AMDGpuMetrics_v16_t);
   }
 
+  size_t offsetof_firmware_timestamp() override {
+    return offsetof(AMDGpuMetrics_v16_t, m_firmware_timestamp);
+  }
+
   GpuMetricTypePtr_t get_metrics_table() override {
     if (!m_gpu_metric_ptr) {
       m_gpu_metric_ptr.reset(&m_gpu_metrics_tbl, [](AMDGpuMetrics_v16_t*){});
@@ -1149,6 +1295,10 @@ class GpuMetricsBase_v17_t final : public GpuMetricsBase_t {
     return sizeof(AMDGpuMetrics_v17_t);
   }
 
+  size_t offsetof_firmware_timestamp() override {
+    return offsetof(AMDGpuMetrics_v17_t, m_firmware_timestamp);
+  }
+
   GpuMetricTypePtr_t get_metrics_table() override {
     if (!m_gpu_metric_ptr) {
       m_gpu_metric_ptr.reset(&m_gpu_metrics_tbl, [](AMDGpuMetrics_v17_t*){});
@@ -1175,6 +1325,14 @@ template<typename T>
 rsmi_status_t rsmi_dev_gpu_metrics_info_query(uint32_t dv_ind,
                         AMDGpuMetricsUnitType_t metric_counter, T& metric_value);
 
+//  Resolves all requested metric units from a single gpu_metrics read.
+//  Units not available for the metrics version in use are flagged with
+//  RSMI_STATUS_NOT_SUPPORTED in their own m_status.
+rsmi_status_t rsmi_dev_gpu_metrics_fields_query(uint32_t dv_ind,
+                        const AMDGpuMetricsUnitType_t* metric_counters,
+                        uint32_t num_counters,
+                        AMDGpuMetricFieldValue_t* metric_values);
+
 }  // namespace amd::smi
 
 
@@ -0,0 +1,199 @@
+/*
+ * Copyright (c) Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#ifndef ROCM_SMI_ROCM_SMI_LOCK_STATS_H_
+#define ROCM_SMI_ROCM_SMI_LOCK_STATS_H_
+
+#include <sys/types.h>
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>  // NOLINT
+#include <string>
+#include <thread>  // NOLINT
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/**
+ *  Lock wait instrumentation
+ *
+ *  For each library lock (and GPU, for the per GPU ones) the number of
+ *  acquisitions, how many of them had to wait and for how long, how many
+ *  failed, and who holds the lock now. A lock is first tried without
+ *  blocking; only when that fails is the wait timed, so the wait histogram
+ *  and percentiles are of contended acquisitions.
+ *
+ *  Collection is off until enabled; a disabled lock costs one relaxed
+ *  atomic load.
+ */
+namespace amd::smi {
+
+// Lock of no particular device: a process wide lock, or a device mutex
+// being initialized
+constexpr uint32_t kLockNoDevice = UINT32_MAX;
+
+enum LockKind {
+  kLockDevice = 0,        // DEVICE_MUTEX, within this process
+  kLockDeviceShared,      // DEVICE_MUTEX, across processes (shared memory)
+  kLockDrm,               // AMDSmiDrm ioctls on a render node
+  kLockKfdEvent,          // RocmSMI::kfd_notif_evt_fh_mutex()
+  kLockLogger,            // ROCmLogging::Logger
+
+  kLockKindCount
+};
+
+// Waits are kept in power of 2 buckets of ns; bucket i holds
+// [2^i, 2^(i + 1)) and the last bucket everything above
+constexpr std::size_t kLockWaitBuckets = 40;
+
+struct LockStatsEntry_t {
+  LockKind kind;
+  uint32_t dv_ind;
+  uint64_t acquisitions;
+  uint64_t contended;       // Acquisitions that were not free right away
+  uint64_t failures;        // Not acquired: busy, or timed out
+  uint64_t total_wait_ns;   // Of the contended acquisitions
+  uint64_t max_wait_ns;
+  uint64_t p50_wait_ns;
+  uint64_t p90_wait_ns;
+  uint64_t p99_wait_ns;
+  std::array<uint64_t, kLockWaitBuckets> wait_buckets;
+  uint32_t holders;         // Current holds in this process
+  pid_t holder_tid;         // Last thread to take it, while held
+  pid_t owner_pid;          // Cross process device mutex: last process to
+                            // lock it; 0 otherwise
+  uint64_t held_ns;         // Since when it has been held, 0 if not
+};
+
+class LockStats {
+ public:
+  static LockStats& getInstance();
+
+  static bool enabled(void) {
+    return s_enabled.load(std::memory_order_relaxed);
+  }
+  void setEnabled(bool enable);
+  void reset(void);
+
+  // One entry per (lock, device) taken since the last reset
+  std::vector<LockStatsEntry_t> entries(void);
+
+  // Lock by try_lock(), which returns 0 once locked, and when that fails by
+  // lock(), which blocks or gives up and returns non-zero. The wait is
+  // recorded when collection is on, which *recorded tells; pass it to the
+  // released() of the lock then.
+  template <typename TryLockF, typename LockF>
+  static int lock(LockKind kind, uint32_t dv_ind, TryLockF try_lock,
+                  LockF lock, bool *recorded) {
+    *recorded = enabled();
+    if (!*recorded) {
+      return lock();
+    }
+    if (try_lock() == 0) {
+      getInstance().acquired(kind, dv_ind, 0, false);
+      return 0;
+    }
+    uint64_t start = NowNs();
+    int ret = lock();
+    uint64_t ns = NowNs() - start;
+    if (ret != 0) {
+      getInstance().failed(kind, dv_ind, ns);
+      *recorded = false;
+      return ret;
+    }
+    getInstance().acquired(kind, dv_ind, ns, true);
+    return 0;
+  }
+
+  // Record a lock acquired after waiting ns (contended if it was not free
+  // right away), released, or not acquired after waiting ns
+  void acquired(LockKind kind, uint32_t dv_ind, uint64_t ns, bool contended);
+  void released(LockKind kind, uint32_t dv_ind);
+  void failed(LockKind kind, uint32_t dv_ind, uint64_t ns);
+
+  // Print the entries to stderr every interval_secs, until stopDump()
+  void startDump(uint32_t interval_secs);
+  void stopDump(void);
+  std::string dump(void);
+
+  static const char *kindName(LockKind kind);
+  static uint64_t NowNs(void);
+
+ private:
+  struct Record_t {
+    uint64_t acquisitions;
+    uint64_t contended;
+    uint64_t failures;
+    uint64_t total_wait_ns;
+    uint64_t max_wait_ns;
+    std::array<uint64_t, kLockWaitBuckets> buckets;
+    uint32_t holders;
+    pid_t holder_tid;
+    uint64_t held_since_ns;
+  };
+  using Key = std::pair<LockKind, uint32_t>;
+  struct KeyHash {
+    std::size_t operator()(const Key& key) const {
+      return std::hash<uint32_t>()(key.second) ^
+             (std::hash<int>()(key.first) << 1);
+    }
+  };
+
+  LockStats() = default;
+  ~LockStats();
+  Record_t& recordOf(LockKind kind, uint32_t dv_ind);
+  void dumpLoop(uint32_t interval_secs);
+
+  static std::atomic<bool> s_enabled;
+  std::mutex records_mutex_;
+  std::unordered_map<Key, Record_t, KeyHash> records_;
+
+  std::mutex dump_mutex_;
+  std::condition_variable dump_cv_;
+  bool dump_stop_ = false;
+  std::thread dump_thread_;
+};
+
+// Holds a std::mutex for its scope, like std::lock_guard, recording the wait
+class LockStatsGuard {
+ public:
+  LockStatsGuard(std::mutex& mutex, LockKind kind,
+                 uint32_t dv_ind = kLockNoDevice);
+  ~LockStatsGuard();
+
+  LockStatsGuard(const LockStatsGuard&) = delete;
+  LockStatsGuard& operator=(const LockStatsGuard&) = delete;
+
+ private:
+  std::mutex& mutex_;
+  LockKind kind_;
+  uint32_t dv_ind_;
+  bool recorded_;
+};
+
+}  // namespace amd::smi
+
+#endif  // ROCM_SMI_ROCM_SMI_LOCK_STATS_H_
@@ -194,6 +194,7 @@ class Logger {
   LogType m_LogType;
   std::mutex m_Mutex;
   std::unique_lock<std::mutex> m_Lock{m_Mutex, std::defer_lock};
+  bool m_LockRecorded = false;  // LockStats counts the current hold
 
   void logIntoFile(std::string& data);
   void logOnConsole(std::string& data);
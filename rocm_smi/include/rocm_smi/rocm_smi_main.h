@@ -23,6 +23,7 @@
 #ifndef INCLUDE_ROCM_SMI_ROCM_SMI_MAIN_H_
 #define INCLUDE_ROCM_SMI_ROCM_SMI_MAIN_H_
 
+#include <atomic>
 #include <vector>
 #include <memory>
 #include <functional>
@@ -40,6 +41,7 @@
 #include "rocm_smi/rocm_smi_monitor.h"
 #include "rocm_smi/rocm_smi_power_mon.h"
 #include "rocm_smi/rocm_smi_common.h"
+#include "rocm_smi/rocm_smi_watcher.h"
 
 namespace amd {
 namespace smi {
@@ -99,6 +101,18 @@ class RocmSMI {
     bool isLoggingOn(void);
     uint32_t getLogSetting(void);
 
+    // Whether device generations are kept up to date; when not, nothing
+    // can be cached on the strength of a generation.
+    bool is_watching_devices(void) const {return watcher_.running();}
+    // Bumped whenever devices may have been added, removed or re-indexed
+    // (KFD topology, DRM nodes, partition changes)
+    uint64_t topology_generation(void) const {
+      return topology_generation_.load(std::memory_order_acquire);
+    }
+    // For changes the library makes itself (ie: driver restart), so they
+    // take effect without waiting for the watcher
+    void bumpDeviceGenerations(void);
+
  private:
     std::vector<std::shared_ptr<Device>> devices_;
     std::map<uint64_t, std::shared_ptr<KFDNode>> kfd_node_map_;
@@ -123,6 +137,9 @@ class RocmSMI {
     std::mutex bootstrap_mutex_;
     uint32_t ref_count_;  // Access to this should be protected
                           // by bootstrap_mutex_
+
+    std::atomic<uint64_t> topology_generation_{0};
+    DeviceWatcher watcher_;
 };
 
 }  // namespace smi
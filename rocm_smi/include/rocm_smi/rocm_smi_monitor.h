@@ -115,13 +115,36 @@ const std::map<MonitorTypes, std::string> monitorTypesToString{
     {MonitorTypes::kMonInvalid, "MonitorTypes::kMonInvalid"},
 };
 
+// A sensor value read by Monitor::readAll(); err is 0 or the errno of the
+// read (ENOENT if the sensor does not exist).
+struct MonitorValue_t {
+  int64_t value;
+  int err;
+};
+
+// The input sensors of a hwmon, as read in one pass by Monitor::readAll()
+struct MonitorSnapshot_t {
+  MonitorValue_t temperature[RSMI_TEMP_TYPE_LAST + 1];  // millidegrees C
+  MonitorValue_t voltage[RSMI_VOLT_TYPE_LAST + 1];      // millivolts
+  MonitorValue_t fan_rpms;        // fan1_input
+  MonitorValue_t fan_speed;       // pwm1, 0 to 255
+  MonitorValue_t power_average;   // power1_average, microwatts
+  MonitorValue_t power_input;     // power1_input, microwatts
+};
+
 class Monitor {
  public:
     explicit Monitor(std::string path, RocmSMI_env_vars const *e);
     ~Monitor(void);
+    Monitor(const Monitor&) = delete;
+    Monitor& operator=(const Monitor&) = delete;
     const std::string path(void) const {return path_;}
     int readMonitor(MonitorTypes type, uint32_t sensor_ind, std::string *val);
     int writeMonitor(MonitorTypes type, uint32_t sensor_ind, std::string val);
+    // Read all the temperature, voltage, fan and power inputs. Temperatures
+    // and voltages are read from the files found by setTempSensorLabelMap()
+    // and setVoltSensorLabelMap(). The caller holds the device mutex.
+    void readAll(MonitorSnapshot_t *snapshot);
     int32_t setTempSensorLabelMap(void);
     uint32_t getTempSensorIndex(rsmi_temperature_type_t type);
     rsmi_temperature_type_t getTempSensorEnum(uint64_t ind);
@@ -133,6 +156,9 @@ class Monitor {
  private:
     std::string MakeMonitorPath(MonitorTypes type, uint32_t sensor_id);
     std::string path_;
+    // Monitor files are opened with openat() relative to this O_PATH fd of
+    // path_ (-1 if it could not be opened; then the full path is used)
+    int dir_fd_;
     const RocmSMI_env_vars *env_;
     std::map<rsmi_temperature_type_t, uint32_t> temp_type_index_map_;
     std::map<rsmi_voltage_type_t, uint32_t> volt_type_index_map_;
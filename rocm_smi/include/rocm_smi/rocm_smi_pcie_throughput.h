@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#ifndef ROCM_SMI_ROCM_SMI_PCIE_THROUGHPUT_H_
+#define ROCM_SMI_ROCM_SMI_PCIE_THROUGHPUT_H_
+
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+#include "rocm_smi/rocm_smi.h"
+
+/**
+ *  Background PCIe throughput measurement
+ *
+ *  Reading pcie_bw blocks in the kernel while it counts PCIe traffic for a
+ *  second. A PcieThroughputMonitor does those reads on a thread of its own,
+ *  back to back, and keeps the last completed window, so callers get a
+ *  recent measurement right away instead of waiting for one.
+ *
+ *  The thread is started by the first query and exits once nobody has
+ *  asked for a measurement for kIdleTimeout; the next query starts it
+ *  again. It reads pcie_bw through an fd of its own without holding any
+ *  device lock, so other queries on the device are not held up meanwhile.
+ */
+namespace amd::smi {
+
+class Device;
+
+class PcieThroughputMonitor {
+ public:
+  explicit PcieThroughputMonitor(Device *dev) : dev_(dev) {}
+  ~PcieThroughputMonitor(void);
+
+  PcieThroughputMonitor(const PcieThroughputMonitor&) = delete;
+  PcieThroughputMonitor& operator=(const PcieThroughputMonitor&) = delete;
+
+  // Writes the last completed window to the non-null arguments and its age
+  // (time since the window closed) to *age_ms. Returns RSMI_STATUS_NO_DATA
+  // until the first window completes, or the status of the last window if
+  // it could not be read.
+  rsmi_status_t latest(uint64_t *sent, uint64_t *received,
+                       uint64_t *max_pkt_sz, uint64_t *age_ms);
+  // Waits for the window in flight, if any, and stops measuring
+  void stop(void);
+
+  static constexpr std::chrono::seconds kIdleTimeout{10};
+
+ private:
+  rsmi_status_t measure(uint64_t *sent, uint64_t *received,
+                        uint64_t *max_pkt_sz);
+  void run(void);
+
+  Device *dev_;
+
+  std::mutex mutex_;
+  std::thread thread_;
+  bool running_ = false;
+  bool stopping_ = false;
+  std::chrono::steady_clock::time_point last_query_;
+
+  // Last completed window
+  rsmi_status_t status_ = RSMI_STATUS_NO_DATA;
+  uint64_t sent_ = 0;
+  uint64_t received_ = 0;
+  uint64_t max_pkt_sz_ = 0;
+  std::chrono::steady_clock::time_point completed_at_;
+};
+
+}  // namespace amd::smi
+
+#endif  // ROCM_SMI_ROCM_SMI_PCIE_THROUGHPUT_H_
@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef ROCM_SMI_ROCM_SMI_PERF_STATS_H_
+#define ROCM_SMI_ROCM_SMI_PERF_STATS_H_
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/**
+ *  Library performance counters
+ *
+ *  Per (API, device) call counts, latencies and sysfs/ioctl counts. An API
+ *  call is timed by a PerfScope on its stack; the TRY macro of the rsmi
+ *  functions and AMDSMI_CHECK_INIT of the amdsmi functions declare one.
+ *  I/O is counted against the innermost scope and, when that scope ends,
+ *  added to the scopes around it, so the count of an amdsmi API includes
+ *  the rsmi calls it made.
+ *
+ *  Collection is off until enabled; a disabled scope costs one relaxed
+ *  atomic load.
+ */
+namespace amd::smi {
+
+// Device of a scope that did not (yet) touch a device
+constexpr uint32_t kPerfNoDevice = UINT32_MAX;
+
+enum PerfIoType {
+  kPerfIoOpen = 0,
+  kPerfIoRead,
+  kPerfIoIoctl,
+
+  kPerfIoTypeCount
+};
+
+// Latencies are kept in power of 2 buckets of ns; bucket i holds
+// [2^i, 2^(i + 1)) and the last bucket everything above
+constexpr std::size_t kPerfLatencyBuckets = 40;
+
+// Bucket of N power of 2 buckets that holds ns
+template <std::size_t N>
+inline std::size_t LatencyBucket(uint64_t ns) {
+  std::size_t bucket = 0;
+  while ((ns >>= 1) != 0) {
+    ++bucket;
+  }
+  return std::min(bucket, N - 1);
+}
+
+// Latency below which the given fraction of the calls fall, interpolated
+// within its bucket and kept within the fastest and slowest calls seen
+template <std::size_t N>
+inline uint64_t LatencyPercentile(const std::array<uint64_t, N>& buckets,
+                                  uint64_t calls, uint64_t min_ns,
+                                  uint64_t max_ns, double fraction) {
+  double rank = std::max(fraction * static_cast<double>(calls), 1.0);
+  uint64_t seen = 0;
+  for (std::size_t i = 0; i < N; ++i) {
+    if ((buckets[i] == 0) || (static_cast<double>(seen + buckets[i]) < rank)) {
+      seen += buckets[i];
+      continue;
+    }
+    double lower = (i == 0) ? 0 : static_cast<double>(uint64_t{1} << i);
+    double upper = (i + 1 == N) ? static_cast<double>(max_ns) :
+                                  static_cast<double>(uint64_t{1} << (i + 1));
+    double within = (rank - static_cast<double>(seen)) /
+                    static_cast<double>(buckets[i]);
+    auto ns = static_cast<uint64_t>(lower + (upper - lower) * within);
+    return std::clamp(ns, min_ns, max_ns);
+  }
+  return max_ns;
+}
+
+struct PerfStatsEntry_t {
+  const char *api;
+  uint32_t dv_ind;
+  uint64_t calls;
+  uint64_t total_ns;
+  uint64_t min_ns;
+  uint64_t max_ns;
+  uint64_t p50_ns;
+  uint64_t p90_ns;
+  uint64_t p99_ns;
+  std::array<uint64_t, kPerfIoTypeCount> io;
+};
+
+class PerfScope;
+
+class PerfStats {
+ public:
+  static PerfStats& getInstance();
+
+  static bool enabled(void) {
+    return s_enabled.load(std::memory_order_relaxed);
+  }
+  void setEnabled(bool enable);
+  void reset(void);
+
+  // One entry per (API, device) called since the last reset, percentiles
+  // estimated from the latency buckets
+  std::vector<PerfStatsEntry_t> entries(void);
+
+  // Count an I/O against the current scope of this thread, if any
+  static void countIo(PerfIoType type) {
+    if (enabled()) {
+      countIoSlow(type);
+    }
+  }
+
+ private:
+  friend class PerfScope;
+
+  struct Record_t {
+    uint64_t calls;
+    uint64_t total_ns;
+    uint64_t min_ns;
+    uint64_t max_ns;
+    std::array<uint64_t, kPerfLatencyBuckets> buckets;
+    std::array<uint64_t, kPerfIoTypeCount> io;
+  };
+  using Key = std::pair<const char *, uint32_t>;
+  struct KeyHash {
+    std::size_t operator()(const Key& key) const {
+      return std::hash<const char *>()(key.first) ^
+             (std::hash<uint32_t>()(key.second) << 1);
+    }
+  };
+
+  PerfStats() = default;
+  void record(const PerfScope& scope, uint64_t ns);
+  static void countIoSlow(PerfIoType type);
+
+  static std::atomic<bool> s_enabled;
+  std::mutex records_mutex_;
+  std::unordered_map<Key, Record_t, KeyHash> records_;
+};
+
+// Times the enclosing API call. The api string must outlive the library
+// (ie: __func__).
+class PerfScope {
+ public:
+  explicit PerfScope(const char *api) {
+    if (PerfStats::enabled()) {
+      start(api);
+    }
+  }
+  ~PerfScope() {
+    if (active_) {
+      stop();
+    }
+  }
+
+  PerfScope(const PerfScope&) = delete;
+  PerfScope& operator=(const PerfScope&) = delete;
+
+  // Attribute the current scope of this thread, and the scopes around it
+  // that have no device yet, to device dv_ind
+  static void setDevice(uint32_t dv_ind) {
+    if (PerfStats::enabled()) {
+      setDeviceSlow(dv_ind);
+    }
+  }
+
+ private:
+  friend class PerfStats;
+
+  void start(const char *api);
+  void stop(void);
+  static void setDeviceSlow(uint32_t dv_ind);
+
+  bool active_ = false;
+  const char *api_ = nullptr;
+  uint32_t dv_ind_ = kPerfNoDevice;
+  uint64_t start_ns_ = 0;
+  std::array<uint64_t, kPerfIoTypeCount> io_ = {};
+  PerfScope *parent_ = nullptr;
+};
+
+}  // namespace amd::smi
+
+#endif  // ROCM_SMI_ROCM_SMI_PERF_STATS_H_
@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef ROCM_SMI_ROCM_SMI_TEXT_PARSER_H_
+#define ROCM_SMI_ROCM_SMI_TEXT_PARSER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+/**
+ *  Parsers for sysfs text attributes
+ *
+ *  Attributes are read into a fixed buffer and parsed in place through
+ *  std::string_view and std::from_chars; nothing here allocates or depends
+ *  on the locale.
+ */
+namespace amd::smi {
+
+// sysfs show() output is limited to one page
+constexpr std::size_t kSysfsTextBufSize = 4096;
+
+// Read the whole of a text file into buf; *text views the bytes read.
+// Returns 0 or an errno (ENOBUFS if the file does not fit in buf).
+int ReadSysfsText(const std::string& path, char *buf, std::size_t buf_size,
+                  std::string_view *text);
+// As ReadSysfsText(), for a file name relative to a directory fd (see
+// openat(2)); this skips the lookup of the whole path.
+int ReadSysfsTextAt(int dir_fd, const char *name, char *buf,
+                    std::size_t buf_size, std::string_view *text);
+// As ReadSysfsText(), from the current offset of an open fd
+int ReadTextFd(int fd, char *buf, std::size_t buf_size,
+               std::string_view *text);
+
+std::string_view TrimText(std::string_view text);
+
+// Return the next whitespace separated token and advance *text past it;
+// an empty view means there are no tokens left.
+std::string_view NextTextToken(std::string_view *text);
+
+// Return the next line (without the '\n') and advance *text past it
+std::string_view NextTextLine(std::string_view *text);
+
+// Parse the leading number of token, as std::stoul() would. Base 16 accepts
+// an optional "0x" prefix. *suffix, if given, gets what follows the number.
+bool ParseTextUInt(std::string_view token, uint64_t *val, int base = 10,
+                   std::string_view *suffix = nullptr);
+// Signed counterpart of ParseTextUInt(), base 10 only
+bool ParseTextInt(std::string_view token, int64_t *val,
+                  std::string_view *suffix = nullptr);
+bool ParseTextFloat(std::string_view token, float *val,
+                    std::string_view *suffix = nullptr);
+bool ParseTextFloat(std::string_view token, double *val,
+                    std::string_view *suffix = nullptr);
+
+// Parse the next "<value><units>" (or "<value> <units>") from *text
+bool NextTextValueWithUnits(std::string_view *text, float *val,
+                            std::string_view *units);
+bool NextTextValueWithUnits(std::string_view *text, double *val,
+                            std::string_view *units);
+
+//
+// One level of a DPM table (pp_dpm_*), of the form:
+//    "<index|S>: <value><units> [x<lanes>] [*]"
+//
+struct TextDpmLevel_t {
+  bool is_deep_sleep;       // 'S' index
+  uint64_t index;
+  float value;
+  std::string_view units;   // ie: "Mhz", "GT/s,"
+  std::string_view extra;   // token after units, ie: "x16" or "*"
+  bool is_current;          // line is marked with '*'
+};
+bool ParseDpmLevelLine(std::string_view line, TextDpmLevel_t *level);
+
+//
+// One OD_RANGE line of an OD table (pp_od_clk_voltage), of the form:
+//    "<key>: <lower><units> <upper><units>"
+//
+struct TextOdRange_t {
+  std::string_view key;     // ie: "SCLK:"
+  float lower;
+  std::string_view lower_units;
+  float upper;
+  std::string_view upper_units;
+};
+bool ParseOdRangeLine(std::string_view line, TextOdRange_t *range);
+
+// The key of a "<key>: <data>" line, including the ':'. Empty if none.
+std::string_view TextLineKey(std::string_view line);
+
+// Find the first line whose key is key; *line is trimmed
+bool FindTextKeyLine(std::string_view text, std::string_view key,
+                     std::string_view *line);
+
+// Find the first line containing needle
+bool FindTextLineContaining(std::string_view text, std::string_view needle,
+                            std::string_view *line);
+
+// Find a section of an OD table: the lines between the title line (ie:
+// "OD_SCLK:") and the next title line, that is, the next line ending in ':'.
+bool FindTextSection(std::string_view text, std::string_view title,
+                     std::string_view *body);
+
+}  // namespace amd::smi
+
+#endif  // ROCM_SMI_ROCM_SMI_TEXT_PARSER_H_
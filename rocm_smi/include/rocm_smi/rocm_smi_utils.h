@@ -57,9 +57,12 @@
 namespace amd {
 namespace smi {
 
-pthread_mutex_t *GetMutex(uint32_t dv_ind);
+shared_mutex_t *GetMutex(uint32_t dv_ind);
 int SameFile(const std::string fileA, const std::string fileB);
 bool FileExists(char const *filename);
+// Prefix an absolute sysfs or procfs path with the RSMI_FS_ROOT directory,
+// if set, so the library can run against a captured or synthetic tree
+std::string FsRootPath(const std::string &path);
 std::vector<std::string> globFilesExist(const std::string& filePattern);
 int isRegularFile(std::string fname, bool *is_reg);
 int isReadOnlyForAll(const std::string& fname, bool *is_read_only);
@@ -181,39 +184,33 @@ std::string print_unsigned_hex_and_int(T i, std::string heading="") {
   return ss.str();
 }
 
-struct pthread_wrap {
+// Reader/writer lock of a device (see shared_mutex_lock_shared()), held
+// for the scope of the object. Queries lock it shared, so they run
+// concurrently; anything that changes the device state locks it
+// exclusively.
+//
+// Locks of the same device nest in any order within a thread; only the
+// outermost one locks the mutex. An exclusive lock nested in a shared one
+// drops the shared lock before locking exclusively, and takes it back when
+// done, so two threads doing so can't deadlock each other.
+class ScopedDeviceLock {
  public:
-        explicit pthread_wrap(pthread_mutex_t &p_mut) : mutex_(p_mut) {}
+     enum Mode {kShared, kExclusive};
 
-        void Acquire() {pthread_mutex_lock(&mutex_);}
-        int AcquireNB() {return pthread_mutex_trylock(&mutex_);}
-        void Release() {pthread_mutex_unlock(&mutex_);}
- private:
-        pthread_mutex_t& mutex_;
-};
-struct ScopedPthread {
-     explicit ScopedPthread(pthread_wrap& mutex, bool blocking = true) : //NOLINT
-                               pthrd_ref_(mutex), mutex_not_acquired_(false) {
-       if (blocking) {
-         pthrd_ref_.Acquire();
-       } else {
-         int ret = pthrd_ref_.AcquireNB();
-         if (ret == EBUSY) {
-           mutex_not_acquired_ = true;
-         }
-       }
-     }
-
-     ~ScopedPthread() {
-       pthrd_ref_.Release();
-     }
-
-     bool mutex_not_acquired() {return mutex_not_acquired_;}
+     ScopedDeviceLock(shared_mutex_t *mutex, Mode mode, bool blocking = true);
+     ~ScopedDeviceLock();
+
+     ScopedDeviceLock(const ScopedDeviceLock&) = delete;
+     ScopedDeviceLock& operator=(const ScopedDeviceLock&) = delete;
+
+     bool mutex_not_acquired() const {return mutex_not_acquired_;}
 
  private:
-     ScopedPthread(const ScopedPthread&);
-     pthread_wrap& pthrd_ref_;
-     bool mutex_not_acquired_;  // Use for AcquireNB (not for Aquire())
+     shared_mutex_t *mutex_;
+     bool mutex_not_acquired_;
+     bool upgraded_;  // Went from shared to exclusive
+     bool upgrade_recorded_;  // LockStats counts the exclusive hold
+     uint32_t upgrade_stats_dv_ind_;  // ... under this device
 };
 
 
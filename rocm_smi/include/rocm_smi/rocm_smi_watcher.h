@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#ifndef ROCM_SMI_ROCM_SMI_WATCHER_H_
+#define ROCM_SMI_ROCM_SMI_WATCHER_H_
+
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ *  Device change watcher
+ *
+ *  A background thread that bumps the generation of a Device whenever what
+ *  the library knows about it may have gone stale: its compute or memory
+ *  partition was reconfigured, its DRM nodes came or went, or the KFD
+ *  topology was updated. Anything cached for a device stays valid for as
+ *  long as Device::generation() reads the value it was cached at.
+ *
+ *  Changes are picked up from inotify (KFD topology directory and
+ *  generation_id, /sys/class/drm, the partition attributes of each device)
+ *  and from kernel uevents (NETLINK_KOBJECT_UEVENT). sysfs only raises
+ *  inotify events for writes made through the file system and for
+ *  attributes the driver explicitly notifies, so KFD generation_id is also
+ *  re-read once a second while nothing else happens.
+ */
+namespace amd::smi {
+
+class Device;
+
+class DeviceWatcher {
+ public:
+  DeviceWatcher(void) = default;
+  ~DeviceWatcher(void);
+
+  DeviceWatcher(const DeviceWatcher&) = delete;
+  DeviceWatcher& operator=(const DeviceWatcher&) = delete;
+
+  // Starts watching the devices; changes to the device set or the KFD
+  // topology also bump *topology_generation. Returns false, without
+  // starting a thread, if neither inotify nor uevents are available.
+  bool start(const std::vector<std::shared_ptr<Device>>& devices,
+             std::atomic<uint64_t> *topology_generation);
+  void stop(void);
+  bool running(void) const {return thread_.joinable();}
+
+ private:
+  // What an inotify watch descriptor covers
+  static constexpr int kWatchAllDevices = -1;
+
+  void addWatch(const std::string& path, uint32_t mask, int dv_ind);
+  void run(void);
+  void handleInotify(void);
+  void handleUevent(void);
+  void checkKfdGenerationId(void);
+  void bumpDevice(std::size_t dv_ind, bool topology);
+  void bumpAll(bool topology);
+  void closeFds(void);
+
+  std::vector<std::shared_ptr<Device>> devices_;
+  // Kernel devpath (/devices/pci...) of each device; empty if unknown
+  std::vector<std::string> devpaths_;
+  std::atomic<uint64_t> *topology_generation_ = nullptr;
+  // inotify watch descriptor -> device index, or kWatchAllDevices
+  std::map<int, int> watches_;
+  std::string kfd_generation_id_;
+
+  int inotify_fd_ = -1;
+  int uevent_fd_ = -1;
+  int stop_fd_ = -1;
+  std::thread thread_;
+};
+
+}  // namespace amd::smi
+
+#endif  // ROCM_SMI_ROCM_SMI_WATCHER_H_
@@ -57,8 +57,10 @@
 #include "rocm_smi/rocm_smi_counters.h"
 #include "rocm_smi/rocm_smi_kfd.h"
 #include "rocm_smi/rocm_smi_io_link.h"
+#include "rocm_smi/rocm_smi_text_parser.h"
 #include "rocm_smi/rocm_smi64Config.h"
 #include "rocm_smi/rocm_smi_logger.h"
+#include "rocm_smi/rocm_smi_lock_stats.h"
 
 using amd::smi::monitorTypesToString;
 using amd::smi::getRSMIStatusString;
@@ -86,17 +88,22 @@ static const std::map<rsmi_clk_type_t, amd::smi::DevInfoTypes> kClkTypeMap = {
   { RSMI_CLK_TYPE_SOC, amd::smi::kDevSOCClk },
 };
 
-#define TRY try {
+#define TRY amd::smi::PerfScope perf_scope(__func__); try {
 #define CATCH } catch (...) {return amd::smi::handleException();}
 
 // declare pm metrics and register table function
 namespace amd::smi {
-int present_pmmetrics(const char* sysfs_file_name,
+int present_pmmetrics(uint8_t *buf, int32_t len,
         rsmi_name_value_t **kv, uint32_t *kvnum);
-int present_reg_state(const char* fname, rsmi_reg_type_t reg_type,
+int64_t get_reg_state_offset(rsmi_reg_type_t reg_type);
+int present_reg_state(uint8_t *buf, int32_t len, rsmi_reg_type_t reg_type,
         rsmi_name_value_t **kv, uint32_t *kvnum);
 }
 
+// pm_metrics is read as a whole; each reg_state register space is one page
+static const std::size_t kPmMetricsMaxSize = 65536;
+static const std::size_t kRegStateSpaceSize = 4096;
+
 static uint64_t get_multiplier_from_char(char units_char) {
   uint32_t multiplier = 0;
 
@@ -131,86 +138,55 @@ static uint64_t get_multiplier_from_char(char units_char) {
  * Parse a string of the form:
  *        "<int index>:  <int freq><freq. unit string> <|*>"
  */
-static uint64_t freq_string_to_int(const std::vector<std::string> &freq_lines,
-                                bool *is_curr, uint32_t lanes[], uint32_t i) {
-  assert(i < freq_lines.size());
-  if (i >= freq_lines.size()) {
-    throw amd::smi::rsmi_exception(RSMI_STATUS_INPUT_OUT_OF_BOUNDS,
-                                                                __FUNCTION__);
-  }
-
-  std::istringstream fs(freq_lines[i]);
-
-  char junk_ch;
-  int ind;
-  float freq;
-  std::string junk_str;
-  std::string units_str;
-  std::string star_str;
-
-  if (fs.peek() == 'S') {
-    // Deep Sleep frequency is only supported by some GPUs
-    fs >> junk_ch;
-  } else {
-    // All other frequency indices are numbers
-    fs >> ind;
+static uint64_t freq_string_to_int(std::string_view freq_line, bool *is_curr,
+                                                            uint32_t *lanes) {
+  amd::smi::TextDpmLevel_t level;
+
+  if (!amd::smi::ParseDpmLevelLine(freq_line, &level)) {
+    throw amd::smi::rsmi_exception(RSMI_STATUS_UNEXPECTED_DATA, __FUNCTION__);
   }
-  fs >> junk_str;  // colon
-  fs >> freq;
-  fs >> units_str;
-  fs >> star_str;
 
-  if (freq < 0) {
+  if (level.value < 0) {
     throw amd::smi::rsmi_exception(RSMI_STATUS_UNEXPECTED_SIZE, __FUNCTION__);
   }
 
   if (is_curr != nullptr) {
-    if (freq_lines[i].find('*') != std::string::npos) {
-      *is_curr = true;
-    } else {
-      *is_curr = false;
-    }
+    *is_curr = level.is_current;
   }
-  long double multiplier = get_multiplier_from_char(units_str[0]);
+  long double multiplier = get_multiplier_from_char(level.units[0]);
 
-  if (star_str[0] == 'x') {
+  if (!level.extra.empty() && level.extra[0] == 'x') {
     assert(lanes != nullptr && "Lanes are provided but null lanes pointer");
     if (lanes) {
-      if (star_str.substr(1).empty()) {
+      uint64_t num_lanes = 0;
+      if (!amd::smi::ParseTextUInt(level.extra.substr(1), &num_lanes)) {
         throw amd::smi::rsmi_exception(RSMI_STATUS_NO_DATA, __FUNCTION__);
       }
 
-      lanes[i] =
-                static_cast<uint32_t>(std::stoi(star_str.substr(1), nullptr));
+      *lanes = static_cast<uint32_t>(num_lanes);
     }
   }
-  return static_cast<uint64_t>(freq*multiplier);
+  return static_cast<uint64_t>(level.value*multiplier);
 }
 
-static void od_value_pair_str_to_range(std::string in_line, rsmi_range_t *rg) {
-  std::istringstream fs_rng(in_line);
+static void od_value_pair_str_to_range(std::string_view in_line,
+                                                            rsmi_range_t *rg) {
+  amd::smi::TextOdRange_t range;
 
   assert(rg != nullptr);
   THROW_IF_NULLPTR_DEREF(rg)
 
-  std::string clk;
-  float lo;
-  float hi;
-  std::string lo_units_str;
-  std::string hi_units_str;
-
-  fs_rng >> clk;  // This is clk + colon; e.g., "SCLK:"
-  fs_rng >> lo;
-  fs_rng >> lo_units_str;
-  fs_rng >> hi;
-  fs_rng >> hi_units_str;
+  // ie: "SCLK:     500Mhz       3000Mhz"
+  if (!amd::smi::ParseOdRangeLine(in_line, &range)) {
+    throw amd::smi::rsmi_exception(RSMI_STATUS_UNEXPECTED_DATA, __FUNCTION__);
+  }
 
-  long double multiplier = get_multiplier_from_char(lo_units_str[0]);
+  long double multiplier = get_multiplier_from_char(range.lower_units[0]);
 
-  rg->lower_bound = static_cast<uint64_t>(lo*multiplier);
+  rg->lower_bound = static_cast<uint64_t>(range.lower*multiplier);
 
-  multiplier = get_multiplier_from_char(hi_units_str[0]);
-  rg->upper_bound = static_cast<uint64_t>(hi*multiplier);
+  multiplier = get_multiplier_from_char(range.upper_units[0]);
+  rg->upper_bound = static_cast<uint64_t>(range.upper*multiplier);
 }
 
 /**
@@ -298,6 +274,21 @@ static rsmi_status_t get_dev_value_line(amd::smi::DevInfoTypes type,
   return amd::smi::ErrnoToRsmiStatus(ret);
 }
 
+// *text views buf, which should be kSysfsTextBufSize bytes
+static rsmi_status_t get_dev_value_text(amd::smi::DevInfoTypes type,
+                                      uint32_t dv_ind, char *buf,
+                                      std::size_t b_size,
+                                      std::string_view *text) {
+  assert(buf != nullptr && text != nullptr);
+  if (buf == nullptr || text == nullptr) {
+    return RSMI_STATUS_INVALID_ARGS;
+  }
+  GET_DEV_FROM_INDX
+  int ret = dev->readDevInfoText(type, buf, b_size, text);
+
+  return amd::smi::ErrnoToRsmiStatus(ret);
+}
+
 static rsmi_status_t set_dev_value(amd::smi::DevInfoTypes type,
                                               uint32_t dv_ind, uint64_t val) {
   GET_DEV_FROM_INDX
@@ -460,7 +451,7 @@ rsmi_shut_down(void) {
 #endif
   for (uint32_t i = 0; i < smi.devices().size(); ++i) {
 #if DEBUG
-    ret = pthread_mutex_unlock(smi.devices()[i]->mutex());
+    ret = pthread_mutex_unlock(smi.devices()[i]->mutex()->ptr);
     if (ret != EPERM) {  // We expect to get EPERM if the lock has already
                          // been released
       if (ret == 0) {
@@ -472,7 +463,7 @@ rsmi_shut_down(void) {
       }
     }
 #else
-    (void)pthread_mutex_unlock(smi.devices()[i]->mutex());
+    (void)pthread_mutex_unlock(smi.devices()[i]->mutex()->ptr);
 #endif
   }
 
@@ -494,7 +485,7 @@ rsmi_status_t rsmi_driver_status(rsmi_driver_state_t* state) {
 
   // live, coming, going
   static const char *kDevInitStateID = "/sys/module/amdgpu/initstate";
-  std::ifstream infile(kDevInitStateID);
+  std::ifstream infile(amd::smi::FsRootPath(kDevInitStateID));
   if (!infile) {
     *state = RSMI_DRIVER_NOT_FOUND;
     return RSMI_STATUS_SUCCESS;
@@ -539,7 +530,7 @@ rsmi_status_t rsmi_dev_ecc_enabled_get(uint32_t dv_ind,
 
   CHK_SUPPORT_NAME_ONLY(enabled_blks)
 
-  DEVICE_MUTEX
+  DEVICE_MUTEX_SHARED
 
   ret = get_dev_value_line(amd::smi::kDevErrCntFeatures, dv_ind, &feature_line);
   if (ret != RSMI_STATUS_SUCCESS) {
@@ -604,7 +595,7 @@ rsmi_status_t rsmi_dev_ecc_status_get(uint32_t dv_ind, rsmi_gpu_block_t block,
   rsmi_status_t ret;
   uint64_t features_mask;
 
-  DEVICE_MUTEX
+  DEVICE_MUTEX_SHARED
 
   ret = rsmi_dev_ecc_enabled_get(dv_ind, &features_mask);
 
@@ -684,7 +675,7 @@ rsmi_dev_ecc_count_get(uint32_t dv_ind, rsmi_gpu_block_t block,
       return RSMI_STATUS_NOT_SUPPORTED;
   }
 
-  DEVICE_MUTEX
+  DEVICE_MUTEX_SHARED
 
   ret = GetDevValueVec(type, dv_ind, &val_vec);
   if (val_vec.size() < 2 ) ret = RSMI_STATUS_FILE_ERROR;
@@ -747,7 +738,7 @@ rsmi_dev_pci_id_get(uint32_t dv_ind, uint64_t *bdfid) {
 
   GET_DEV_AND_KFDNODE_FROM_INDX
   CHK_API_SUPPORT_ONLY(bdfid, RSMI_DEFAULT_VARIANT, RSMI_DEFAULT_VARIANT)
-  DEVICE_MUTEX
+  DEVICE_MUTEX_SHARED
 
   *bdfid = dev->bdfid();
 
@@ -794,7 +785,7 @@ rsmi_topo_numa_affinity_get(uint32_t dv_ind, int32_t *numa_node) {
 
   CHK_SUPPORT_NAME_ONLY(numa_node)
 
-  DEVICE_MUTEX
+  DEVICE_MUTEX_SHARED
   std::string str_val;
   ret = get_dev_value_str(amd::smi::kDevNumaNode, dv_ind, &str_val);
   *numa_node = std::stoi(str_val, nullptr);
@@ -814,7 +805,7 @@ get_id(uint32_t dv_ind, amd::smi::DevInfoTypes typ, uint16_t *id) {
     return RSMI_STATUS_INVALID_ARGS;
   }
 
-  DEVICE_MUTEX
+  DEVICE_MUTEX_SHARED
 
   rsmi_status_t ret = get_dev_value_str(typ, dv_ind, &val_str);
 
@@ -849,7 +840,7 @@ rsmi_status_t rsmi_ras_feature_info_get(
 
   CHK_SUPPORT_NAME_ONLY(ras_feature)
 
-  DEVICE_MUTEX
+  DEVICE_MUTEX_SHARED
 
   ret = get_dev_value_line(amd::smi::kDevErrTableVersion,
                 dv_ind, &feature_line);
@@ -992,7 +983,7 @@ rsmi_dev_pcie_slot_type_get(uint32_t dv_ind, rsmi_pcie_slot_type_t* type) {
   ss << __PRETTY_FUNCTION__ << "| ======= start =======";
   LOG_TRACE(ss);
   CHK_SUPPORT_NAME_ONLY(type)
-  DEVICE_MUTEX
+  DEVICE_MUTEX_SHARED
 
   std::string value;
   int ret = dev->readDevInfo(amd::smi::kDevBoardInfo, "type", value);
@@ -1025,7 +1016,7 @@ rsmi_dev_perf_level_get(uint32_t dv_ind, rsmi_dev_perf_level_t *perf) {
   LOG_TRACE(ss);
 
   CHK_SUPPORT_NAME_ONLY(perf)
-  DEVICE_MUTEX
+  DEVICE_MUTEX_SHARED
 
   rsmi_status_t ret = get_dev_value_str(amd::smi::kDevPerfLevel, dv_ind,
                                                                     &val_str);
@@ -1092,7 +1083,7 @@ rsmi_dev_overdrive_level_get(uint32_t dv_ind, uint32_t *od) {
   ss << __PRETTY_FUNCTION__ << "| ======= start =======";
   LOG_TRACE(ss);
   CHK_SUPPORT_NAME_ONLY(od)
-  DEVICE_MUTEX
+  DEVICE_MUTEX_SHARED
 
   // Bare Metal only feature
   if (amd::smi::is_vm_guest()) {
@@ -1127,7 +1118,7 @@ rsmi_dev_mem_overdrive_level_get(uint32_t dv_ind, uint32_t *od) {
   ss << __PRETTY_FUNCTION__ << "| ======= start =======";
   LOG_TRACE(ss);
   CHK_SUPPORT_NAME_ONLY(od)
-  DEVICE_MUTEX
+  DEVICE_MUTEX_SHARED
 
   rsmi_status_t ret = get_dev_value_str(amd::smi::kDevMemOverDriveLevel, dv_ind,
                                                                     &val_str);
@@ -1208,7 +1199,8 @@ rsmi_dev_perf_level_set_v1(uint32_t dv_ind, rsmi_dev_perf_level_t perf_level) {
 static rsmi_status_t get_frequencies(amd::smi::DevInfoTypes type, rsmi_clk_type_t clk_type,
             uint32_t dv_ind, rsmi_frequencies_t *f, uint32_t *lanes = nullptr) {
   TRY
-  std::vector<std::string> val_vec;
+  char buf[amd::smi::kSysfsTextBufSize];
+  std::string_view text;
   rsmi_status_t ret;
 
   if (f == nullptr) {
@@ -1217,27 +1209,33 @@ static rsmi_status_t get_frequencies(amd::smi::DevInfoTypes type, rsmi_clk_type_
   memset(f, 0, sizeof(rsmi_frequencies_t));
   f->current = 0;
 
-  ret = GetDevValueVec(type, dv_ind, &val_vec);
+  ret = get_dev_value_text(type, dv_ind, buf, sizeof(buf), &text);
   if (ret != RSMI_STATUS_SUCCESS) {
     return ret;
   }
-  assert(val_vec.size() <= RSMI_MAX_NUM_FREQUENCIES);
-
-  if (val_vec.empty()) {
-    return RSMI_STATUS_NOT_YET_IMPLEMENTED;
+  // Ignore any trailing empty lines
+  text = text.substr(0, text.find_last_not_of(" \t\n\v\f\r") + 1);
+  if (text.empty()) {
+    return amd::smi::ErrnoToRsmiStatus(ENXIO);
   }
 
-  f->num_supported = static_cast<uint32_t>(val_vec.size());
+  f->num_supported = static_cast<uint32_t>(
+                                std::count(text.begin(), text.end(), '\n') + 1);
+  assert(f->num_supported <= RSMI_MAX_NUM_FREQUENCIES);
+  if (f->num_supported > RSMI_MAX_NUM_FREQUENCIES) {
+    return RSMI_STATUS_UNEXPECTED_SIZE;
+  }
   f->current = RSMI_MAX_NUM_FREQUENCIES + 1;  // init to an invalid value
 
   // Deep Sleep frequency is only supported by some GPUs
   // It is indicated by letter 'S' instead of the index number
-  f->has_deep_sleep = (val_vec[0][0] == 'S');
+  f->has_deep_sleep = (text[0] == 'S');
 
   bool current = false;
 
   for (uint32_t i = 0; i < f->num_supported; ++i) {
-    f->frequency[i] = freq_string_to_int(val_vec, &current, lanes, i);
+    f->frequency[i] = freq_string_to_int(amd::smi::NextTextLine(&text),
+                                 &current, lanes ? &lanes[i] : nullptr);
 
     // Our assumption is that frequencies are read in from lowest to highest.
     // Check that that is true.
@@ -1379,7 +1377,8 @@ constexpr uint32_t kMIN_VALID_LINES = 2;
 static rsmi_status_t get_od_clk_volt_info(uint32_t dv_ind,
                                                   rsmi_od_volt_freq_data_t *p) {
   TRY
-  std::vector<std::string> val_vec;
+  char buf[amd::smi::kSysfsTextBufSize];
+  std::string_view text;
   rsmi_status_t ret;
 
   assert(p != nullptr);
@@ -1387,98 +1386,109 @@ static rsmi_status_t get_od_clk_volt_info(uint32_t dv_ind,
     return RSMI_STATUS_INVALID_ARGS;
   }
 
-  ret = GetDevValueVec(amd::smi::kDevPowerODVoltage, dv_ind, &val_vec);
+  ret = get_dev_value_text(amd::smi::kDevPowerODVoltage, dv_ind, buf,
+                           sizeof(buf), &text);
   if (ret != RSMI_STATUS_SUCCESS) {
     return ret;
   }
 
   // This is a work-around to handle systems where kDevPowerODVoltage is not
   // fully supported yet.
-  if (val_vec.size() < kMIN_VALID_LINES) {
+  text = text.substr(0, text.find_last_not_of(" \t\n\v\f\r") + 1);
+  if (text.empty()) {
+    return amd::smi::ErrnoToRsmiStatus(ENXIO);
+  }
+  if (static_cast<uint32_t>(std::count(text.begin(), text.end(), '\n') + 1) <
+                                                           kMIN_VALID_LINES) {
     return RSMI_STATUS_NOT_YET_IMPLEMENTED;
   }
 
   // Tags expected in this file
-  const std::string kTAG_OD_SCLK{"OD_SCLK:"};
-  const std::string KTAG_OD_MCLK{"OD_MCLK:"};
-  const std::string kTAG_GFXCLK{"GFXCLK:"};
-  const std::string KTAG_MCLK{"MCLK:"};
-  const std::string KTAG_SCLK{"SCLK:"};
-  const std::string KTAG_OD_RANGE{"OD_RANGE:"};
-  const std::string KTAG_OD_VDDGFX_OFFSET{"OD_VDDGFX_OFFSET:"};
-  const std::string KTAG_FIRST_FREQ_IDX{"0:"};
-
-  amd::smi::TextFileTagContents_t txt_power_dev_od_voltage(val_vec);
-  txt_power_dev_od_voltage
-    .set_title_terminator(":", amd::smi::TagSplitterPositional_t::kLAST)
-    .set_key_data_splitter(":", amd::smi::TagSplitterPositional_t::kBETWEEN)
-    .structure_content();
+  constexpr std::string_view kTAG_OD_SCLK{"OD_SCLK:"};
+  constexpr std::string_view KTAG_OD_MCLK{"OD_MCLK:"};
+  constexpr std::string_view kTAG_GFXCLK{"GFXCLK:"};
+  constexpr std::string_view KTAG_MCLK{"MCLK:"};
+  constexpr std::string_view KTAG_SCLK{"SCLK:"};
+  constexpr std::string_view KTAG_OD_RANGE{"OD_RANGE:"};
+  constexpr std::string_view KTAG_FIRST_FREQ_IDX{"0:"};
+
+  // Note: A title (ie: 'OD_SCLK:') only counts if its section has data
+  auto has_title = [&](std::string_view title, std::string_view *body) {
+      return amd::smi::FindTextSection(text, title, body) &&
+             !amd::smi::TrimText(*body).empty();
+  };
+  std::string_view sclk_body;
+  std::string_view mclk_body;
+  std::string_view line;
 
   //
   // Note:  We must have minimum of 'GFXCLK:' && 'MCLK:' OR:
   //        'OD_SCLK:' && 'OD_MCLK:' tags.
-  if (txt_power_dev_od_voltage.get_title_size() < kMIN_VALID_LINES)  {
+  uint32_t num_titles = 0;
+  for (auto lines = text; !lines.empty(); ) {
+    auto title = amd::smi::TrimText(amd::smi::NextTextLine(&lines));
+    if (!title.empty() && title.back() == ':' && has_title(title, &line)) {
+      ++num_titles;
+    }
+  }
+  if (num_titles < kMIN_VALID_LINES)  {
       return rsmi_status_t::RSMI_STATUS_NO_DATA;
   }
 
   // Note:  For debug builds/purposes only.
-  assert(txt_power_dev_od_voltage.contains_title_key(kTAG_GFXCLK) ||
-         txt_power_dev_od_voltage.contains_title_key(kTAG_OD_SCLK));
+  assert(has_title(kTAG_GFXCLK, &sclk_body) ||
+         has_title(kTAG_OD_SCLK, &sclk_body));
   // Note:  For release builds/purposes.
-  if (!txt_power_dev_od_voltage.contains_title_key(kTAG_GFXCLK) &&
-      !txt_power_dev_od_voltage.contains_title_key(kTAG_OD_SCLK)) {
+  if (!has_title(kTAG_GFXCLK, &sclk_body) &&
+      !has_title(kTAG_OD_SCLK, &sclk_body)) {
       return rsmi_status_t::RSMI_STATUS_UNEXPECTED_DATA;
   }
 
-  // Note: Quick helpers for getting 1st and last elements found
-  auto build_lower_bound = [&](const std::string& prim_key) {
-      auto lower_bound_data = txt_power_dev_od_voltage.get_structured_data_subkey_first(prim_key);
-      return std::vector<std::string>{lower_bound_data};
-  };
-
-  auto build_upper_bound = [&](const std::string& prim_key) {
-      auto upper_bound_data = txt_power_dev_od_voltage.get_structured_data_subkey_last(prim_key);
-      return std::vector<std::string>{upper_bound_data};
+  // Note: Lower bound is the first level of a section, upper bound the last
+  auto get_range = [&](std::string_view body, rsmi_range_t *rg) {
+      std::string_view level;
+      amd::smi::FindTextKeyLine(body, KTAG_FIRST_FREQ_IDX, &level);
+      rg->lower_bound = freq_string_to_int(level, nullptr, nullptr);
+      while (!body.empty()) {
+          auto next = amd::smi::TrimText(amd::smi::NextTextLine(&body));
+          if (!amd::smi::TextLineKey(next).empty()) {
+              level = next;
+          }
+      }
+      rg->upper_bound = freq_string_to_int(level, nullptr, nullptr);
   };
 
   // Validates 'OD_SCLK' is in the structure
-  if (txt_power_dev_od_voltage.contains_structured_key(kTAG_OD_SCLK,
-                                                       KTAG_FIRST_FREQ_IDX)) {
-      p->curr_sclk_range.lower_bound = freq_string_to_int(build_lower_bound(kTAG_OD_SCLK), nullptr, nullptr, 0);
-      p->curr_sclk_range.upper_bound = freq_string_to_int(build_upper_bound(kTAG_OD_SCLK), nullptr, nullptr, 0);
+  if (has_title(kTAG_OD_SCLK, &sclk_body) &&
+      amd::smi::FindTextKeyLine(sclk_body, KTAG_FIRST_FREQ_IDX, &line)) {
+      get_range(sclk_body, &p->curr_sclk_range);
 
       // Validates 'OD_MCLK' is in the structure
-      if (txt_power_dev_od_voltage.contains_structured_key(KTAG_OD_MCLK,
-                                                           KTAG_FIRST_FREQ_IDX)) {
-          p->curr_mclk_range.lower_bound = freq_string_to_int(build_lower_bound(KTAG_OD_MCLK), nullptr, nullptr, 0);
-          p->curr_mclk_range.upper_bound = freq_string_to_int(build_upper_bound(KTAG_OD_MCLK), nullptr, nullptr, 0);
+      if (has_title(KTAG_OD_MCLK, &mclk_body) &&
+          amd::smi::FindTextKeyLine(mclk_body, KTAG_FIRST_FREQ_IDX, &line)) {
+          get_range(mclk_body, &p->curr_mclk_range);
       }
 
       // Validates 'OD_RANGE' is in the structure
-      if (txt_power_dev_od_voltage.contains_structured_key(KTAG_OD_RANGE,
-                                                           KTAG_SCLK)) {
-          od_value_pair_str_to_range(txt_power_dev_od_voltage
-                                        .get_structured_value_by_keys(KTAG_OD_RANGE, KTAG_SCLK),
-                                     &p->sclk_freq_limits);
-      }
-      if (txt_power_dev_od_voltage.contains_structured_key(KTAG_OD_RANGE,
-                                                           KTAG_MCLK)) {
-          od_value_pair_str_to_range(txt_power_dev_od_voltage
-                                        .get_structured_value_by_keys(KTAG_OD_RANGE, KTAG_MCLK),
-                                     &p->mclk_freq_limits);
+      std::string_view range_body;
+      if (has_title(KTAG_OD_RANGE, &range_body)) {
+          if (amd::smi::FindTextKeyLine(range_body, KTAG_SCLK, &line)) {
+              od_value_pair_str_to_range(line, &p->sclk_freq_limits);
+          }
+          if (amd::smi::FindTextKeyLine(range_body, KTAG_MCLK, &line)) {
+              od_value_pair_str_to_range(line, &p->mclk_freq_limits);
+          }
       }
   }
   // Validates 'GFXCLK' is in the structure
-  else if (txt_power_dev_od_voltage.contains_structured_key(kTAG_GFXCLK,
-                                                            KTAG_FIRST_FREQ_IDX)) {
-      p->curr_sclk_range.lower_bound = freq_string_to_int(build_lower_bound(kTAG_GFXCLK), nullptr, nullptr, 0);
-      p->curr_sclk_range.upper_bound = freq_string_to_int(build_upper_bound(kTAG_GFXCLK), nullptr, nullptr, 0);
+  else if (has_title(kTAG_GFXCLK, &sclk_body) &&
+           amd::smi::FindTextKeyLine(sclk_body, KTAG_FIRST_FREQ_IDX, &line)) {
+      get_range(sclk_body, &p->curr_sclk_range);
 
       // Validates 'MCLK' is in the structure
-      if (txt_power_dev_od_voltage.contains_structured_key(KTAG_MCLK,
-                                                           KTAG_FIRST_FREQ_IDX)) {
-          p->curr_mclk_range.lower_bound = freq_string_to_int(build_lower_bound(KTAG_MCLK), nullptr, nullptr, 0);
-          p->curr_mclk_range.upper_bound = freq_string_to_int(build_upper_bound(KTAG_MCLK), nullptr, nullptr, 0);
+      if (has_title(KTAG_MCLK, &mclk_body) &&
+          amd::smi::FindTextKeyLine(mclk_body, KTAG_FIRST_FREQ_IDX, &line)) {
+          get_range(mclk_body, &p->curr_mclk_range);
       }
   }
   else {
@@ -1872,7 +1882,7 @@ rsmi_dev_gpu_clk_freq_get(uint32_t dv_ind, rsmi_clk_type_t clk_type,
     return RSMI_STATUS_INVALID_ARGS;
   }
 
-  DEVICE_MUTEX
+  DEVICE_MUTEX_SHARED
 
   return get_frequencies(dev_type, clk_type, dv_ind, f);
 
@@ -1924,7 +1934,7 @@ rsmi_dev_firmware_version_get(uint32_t dv_ind, rsmi_fw_block_t block,
     return RSMI_STATUS_INVALID_ARGS;
   }
 
-  DEVICE_MUTEX
+  DEVICE_MUTEX_SHARED
   return get_dev_value_int(dev_type, dv_ind, fw_version);
   CATCH
 }
@@ -2039,7 +2049,7 @@ rsmi_status_t rsmi_dev_process_isolation_get(uint32_t dv_ind,
   uint32_t partition_id = 0;
   rsmi_dev_partition_id_get(dv_ind, &partition_id);
 
-  DEVICE_MUTEX
+  DEVICE_MUTEX_SHARED
 
   std::string str_val;
   rsmi_status_t ret = get_dev_value_line(amd::smi::kDevProcessIsolation, dv_ind, &str_val);
@@ -2181,7 +2191,7 @@ rsmi_dev_xgmi_plpd_get(uint32_t dv_ind,
   std::ostringstream ss;
   ss << __PRETTY_FUNCTION__ << " | ======= start =======";
   LOG_TRACE(ss);
-  DEVICE_MUTEX
+  DEVICE_MUTEX_SHARED
 
   ret = GetDevValueVec(amd::smi::kDevXgmiPlpd, dv_ind, &val_vec);
   if (ret == RSMI_STATUS_FILE_ERROR) {
@@ -2292,7 +2302,7 @@ rsmi_dev_soc_pstate_get(uint32_t dv_ind,
   std::ostringstream ss;
   ss << __PRETTY_FUNCTION__ << " | ======= start =======";
   LOG_TRACE(ss);
-  DEVICE_MUTEX
+  DEVICE_MUTEX_SHARED
 
   ret = GetDevValueVec(amd::smi::kDevSocPstate, dv_ind, &val_vec);
   if (ret == RSMI_STATUS_FILE_ERROR) {
@@ -2697,7 +2707,7 @@ rsmi_dev_name_get(uint32_t dv_ind, char *name, size_t len) {
     return RSMI_STATUS_INVALID_ARGS;
   }
 
-  DEVICE_MUTEX
+  DEVICE_MUTEX_SHARED
 
   ret = get_dev_name_from_file(dv_ind, name, len);
 
@@ -2723,7 +2733,7 @@ rsmi_dev_pcie_vendor_name_get(uint32_t dv_ind, char *name, size_t len) {
     return RSMI_STATUS_INVALID_ARGS;
   }
 
-  DEVICE_MUTEX
+  DEVICE_MUTEX_SHARED
   uint16_t id = 0;
   ret = get_id(dv_ind, amd::smi::kDevPCieVendorID, &id);
   if (ret != RSMI_STATUS_SUCCESS) return ret;
@@ -2748,7 +2758,7 @@ rsmi_dev_brand_get(uint32_t dv_ind, char *brand, uint32_t len) {
   if (len == 0) {
     return RSMI_STATUS_INVALID_ARGS;
   }
-  DEVICE_MUTEX
+  DEVICE_MUTEX_SHARED
 
   std::map<std::string, std::string> brand_names = {
     {"D05121", "mi25"},
@@ -2799,7 +2809,7 @@ rsmi_dev_vram_vendor_get(uint32_t dv_ind, char *brand, uint32_t len) {
     return RSMI_STATUS_INVALID_ARGS;
   }
   std::string val_str;
-  DEVICE_MUTEX
+  DEVICE_MUTEX_SHARED
   int ret = dev->readDevInfo(amd::smi::kDevVramVendor, &val_str);
 
   if (ret != 0) {
@@ -2832,7 +2842,7 @@ rsmi_dev_subsystem_name_get(uint32_t dv_ind, char *name, size_t len) {
     return RSMI_STATUS_INVALID_ARGS;
   }
 
-  DEVICE_MUTEX
+  DEVICE_MUTEX_SHARED
 
   ret = get_dev_name_from_id(dv_ind, name, len, NAME_STR_SUBSYS);
   return ret;
@@ -2849,7 +2859,7 @@ rsmi_dev_drm_render_minor_get(uint32_t dv_ind, uint32_t *minor) {
   LOG_TRACE(ss);
   CHK_SUPPORT_NAME_ONLY(minor)
 
-  DEVICE_MUTEX
+  DEVICE_MUTEX_SHARED
   ret = get_dev_drm_render_minor(dv_ind, minor);
   return ret;
   CATCH
@@ -2870,7 +2880,7 @@ rsmi_dev_vendor_name_get(uint32_t dv_ind, char *name, size_t len) {
     return RSMI_STATUS_INVALID_ARGS;
   }
 
-  DEVICE_MUTEX
+  DEVICE_MUTEX_SHARED
   ret = get_dev_name_from_id(dv_ind, name, len, NAME_STR_VENDOR);
   return ret;
   CATCH
@@ -2880,13 +2890,16 @@ rsmi_status_t rsmi_dev_pm_metrics_info_get(uint32_t dv_ind,
                       rsmi_name_value_t** pm_metrics,
                       uint32_t *num_of_metrics) {
   TRY
-  DEVICE_MUTEX
+  DEVICE_MUTEX_SHARED
   CHK_SUPPORT_NAME_ONLY(num_of_metrics)
-  std::string file_path = dev->
-          get_sys_file_path_by_type(amd::smi::kDevPmMetrics);
+  std::vector<uint8_t> pm_metrics_buffer(kPmMetricsMaxSize);
+  std::size_t read_size = 0;
+  int ret = dev->preadDevInfoBinary(amd::smi::kDevPmMetrics,
+          pm_metrics_buffer.size(), pm_metrics_buffer.data(), 0, &read_size);
+  if (ret != 0) return RSMI_STATUS_NOT_SUPPORTED;
 
-  int ret = amd::smi::present_pmmetrics(
-          file_path.c_str(), pm_metrics, num_of_metrics);
+  ret = amd::smi::present_pmmetrics(pm_metrics_buffer.data(),
+          static_cast<int32_t>(read_size), pm_metrics, num_of_metrics);
   if (ret == 0) return RSMI_STATUS_SUCCESS;
   return RSMI_STATUS_NOT_SUPPORTED;
 
@@ -2898,13 +2911,20 @@ rsmi_status_t rsmi_dev_reg_table_info_get(uint32_t dv_ind,
                       rsmi_name_value_t** reg_metrics,
                       uint32_t *num_of_metrics) {
   TRY
-  DEVICE_MUTEX
+  DEVICE_MUTEX_SHARED
   CHK_SUPPORT_NAME_ONLY(num_of_metrics)
-  std::string file_path = dev->
-          get_sys_file_path_by_type(amd::smi::kDevRegMetrics);
+  auto reg_state_offset = amd::smi::get_reg_state_offset(reg_type);
+  if (reg_state_offset < 0) return RSMI_STATUS_NOT_SUPPORTED;
+
+  uint8_t reg_state_buffer[kRegStateSpaceSize];
+  std::size_t read_size = 0;
+  int ret = dev->preadDevInfoBinary(amd::smi::kDevRegMetrics,
+          sizeof(reg_state_buffer), reg_state_buffer,
+          static_cast<off_t>(reg_state_offset), &read_size);
+  if (ret != 0) return RSMI_STATUS_NOT_SUPPORTED;
 
-  int ret = amd::smi::present_reg_state(
-          file_path.c_str(), reg_type, reg_metrics, num_of_metrics);
+  ret = amd::smi::present_reg_state(reg_state_buffer,
+          static_cast<int32_t>(read_size), reg_type, reg_metrics, num_of_metrics);
   if (ret == 0) return RSMI_STATUS_SUCCESS;
   return RSMI_STATUS_NOT_SUPPORTED;
 
@@ -2921,7 +2941,7 @@ rsmi_dev_pci_bandwidth_get(uint32_t dv_ind, rsmi_pcie_bandwidth_t *b) {
 
   GET_DEV_AND_KFDNODE_FROM_INDX
   CHK_API_SUPPORT_ONLY((b), RSMI_DEFAULT_VARIANT, RSMI_DEFAULT_VARIANT)
-  DEVICE_MUTEX
+  DEVICE_MUTEX_SHARED
   ret = get_frequencies(amd::smi::kDevPCIEClk, RSMI_CLK_TYPE_PCIE, dv_ind,
                                         &b->transfer_rate, b->lanes);
   if (ret == RSMI_STATUS_SUCCESS) {
@@ -3047,31 +3067,32 @@ rsmi_dev_pci_throughput_get(uint32_t dv_ind, uint64_t *sent,
   ss << __PRETTY_FUNCTION__ << "| ======= start =======";
   LOG_TRACE(ss);
   rsmi_status_t ret;
-  std::string val_str;
+  char buf[amd::smi::kSysfsTextBufSize];
+  std::string_view text;
 
   // We don't do CHK_SUPPORT_NAME_ONLY in this case as the user may
   // choose to have any of the inout parameters as 0. Let the return code from
-  // get_dev_value_line() tell if this function is supported or not.
+  // get_dev_value_text() tell if this function is supported or not.
   // CHK_SUPPORT_NAME_ONLY(...)
 
-  DEVICE_MUTEX
+  DEVICE_MUTEX_SHARED
+  GET_DEV_FROM_INDX
 
-  ret = get_dev_value_line(amd::smi::kDevPCIEThruPut, dv_ind, &val_str);
+  // Blocks for a second; keep the device sysfs fds available to other
+  // queries meanwhile
+  ret = amd::smi::ErrnoToRsmiStatus(dev->readDevInfoTextUnlocked(
+                      amd::smi::kDevPCIEThruPut, buf, sizeof(buf), &text));
 
   if (ret != RSMI_STATUS_SUCCESS) {
     return ret;
   }
 
-  std::istringstream fs_rng(val_str);
-
-  if (sent) {
-    fs_rng >> *sent;
-  }
-  if (received) {
-    fs_rng >> *received;
-  }
-  if (max_pkt_sz) {
-    fs_rng >> *max_pkt_sz;
+  // "<sent> <received> <max packet size>"
+  for (uint64_t *val : {sent, received, max_pkt_sz}) {
+    auto token = amd::smi::NextTextToken(&text);
+    if (val && !amd::smi::ParseTextUInt(token, val)) {
+      return RSMI_STATUS_UNEXPECTED_DATA;
+    }
   }
 
   if ((sent && *sent == UINT64_MAX) || (received && *received == UINT64_MAX)){
@@ -3082,6 +3103,27 @@ rsmi_dev_pci_throughput_get(uint32_t dv_ind, uint64_t *sent,
   CATCH
 }
 
+rsmi_status_t
+rsmi_dev_pci_throughput_latest_get(uint32_t dv_ind, uint64_t *sent,
+                                   uint64_t *received, uint64_t *max_pkt_sz,
+                                   uint64_t *age_ms) {
+  TRY
+  std::ostringstream ss;
+  ss << __PRETTY_FUNCTION__ << "| ======= start =======";
+  LOG_TRACE(ss);
+
+  if (age_ms == nullptr) {
+    return RSMI_STATUS_INVALID_ARGS;
+  }
+
+  // No DEVICE_MUTEX: the monitor thread does the sysfs read, and the last
+  // window is guarded by the monitor itself.
+  GET_DEV_FROM_INDX
+  return dev->pcie_throughput_monitor().latest(sent, received, max_pkt_sz,
+                                               age_ms);
+  CATCH
+}
+
 rsmi_status_t
 rsmi_dev_temp_metric_get(uint32_t dv_ind, uint32_t sensor_type,
                        rsmi_temperature_metric_t metric, int64_t *temperature) {
@@ -3208,7 +3250,7 @@ rsmi_dev_temp_metric_get(uint32_t dv_ind, uint32_t sensor_type,
     return RSMI_STATUS_SUCCESS;
   }  // end HBM temperature
 
-  DEVICE_MUTEX
+  DEVICE_MUTEX_SHARED
 
   GET_DEV_FROM_INDX
 
@@ -3289,7 +3331,7 @@ rsmi_dev_volt_metric_get(uint32_t dv_ind, rsmi_voltage_type_t sensor_type,
       mon_type = amd::smi::kMonInvalid;
   }
 
-  DEVICE_MUTEX
+  DEVICE_MUTEX_SHARED
 
   GET_DEV_FROM_INDX
 
@@ -3328,7 +3370,7 @@ rsmi_dev_fan_speed_get(uint32_t dv_ind, uint32_t sensor_ind, int64_t *speed) {
 
   CHK_SUPPORT_SUBVAR_ONLY(speed, sensor_ind)
 
-  DEVICE_MUTEX
+  DEVICE_MUTEX_SHARED
 
   ret = get_dev_mon_value(amd::smi::kMonFanSpeed, dv_ind, sensor_ind, speed);
 
@@ -3349,7 +3391,7 @@ rsmi_dev_fan_rpms_get(uint32_t dv_ind, uint32_t sensor_ind, int64_t *speed) {
 
   rsmi_status_t ret;
 
-  DEVICE_MUTEX
+  DEVICE_MUTEX_SHARED
 
   ret = get_dev_mon_value(amd::smi::kMonFanRPMs, dv_ind, sensor_ind, speed);
 
@@ -3429,7 +3471,7 @@ rsmi_dev_fan_speed_max_get(uint32_t dv_ind, uint32_t sensor_ind,
   LOG_TRACE(ss);
   ++sensor_ind;  // fan sysfs files have 1-based indices
   CHK_SUPPORT_SUBVAR_ONLY(max_speed, sensor_ind)
-  DEVICE_MUTEX
+  DEVICE_MUTEX_SHARED
 
   ret = get_dev_mon_value(amd::smi::kMonMaxFanSpeed, dv_ind, sensor_ind,
                                       reinterpret_cast<int64_t *>(max_speed));
@@ -3444,7 +3486,7 @@ rsmi_dev_od_volt_info_get(uint32_t dv_ind, rsmi_od_volt_freq_data_t *odv) {
   std::ostringstream ss;
   ss << __PRETTY_FUNCTION__ << "| ======= start =======";
   LOG_TRACE(ss);
-  DEVICE_MUTEX
+  DEVICE_MUTEX_SHARED
   CHK_SUPPORT_NAME_ONLY(odv)
   rsmi_status_t ret = get_od_clk_volt_info(dv_ind, odv);
 
@@ -3467,6 +3509,12 @@ rsmi_dev_gpu_reset(uint32_t dv_ind) {
 
   // Read amdgpu_gpu_recover to reset it
   ret = get_dev_value_int(amd::smi::kDevGpuReset, dv_ind, &status_code);
+
+  GET_DEV_FROM_INDX
+  dev->dev_invalidate_gpu_metrics();
+  dev->closeSysfsFds();
+  // Drop what was cached on the device, ie: its immutable attributes
+  dev->bumpGeneration();
   return ret;
 
   CATCH
@@ -3485,7 +3533,7 @@ rsmi_status_t rsmi_dev_od_volt_curve_regions_get(uint32_t dv_ind,
     return RSMI_STATUS_INVALID_ARGS;
   }
 
-  DEVICE_MUTEX
+  DEVICE_MUTEX_SHARED
   rsmi_status_t ret = get_od_clk_volt_curve_regions(dv_ind, num_regions,
                                                                       buffer);
   if (*num_regions == 0) {
@@ -3511,7 +3559,7 @@ rsmi_dev_power_max_get(uint32_t dv_ind, uint32_t sensor_ind, uint64_t *power) {
 
   rsmi_status_t ret;
 
-  DEVICE_MUTEX
+  DEVICE_MUTEX_SHARED
   ret = get_power_mon_value(amd::smi::kPowerMaxGPUPower, dv_ind, power);
 
   return ret;
@@ -3530,7 +3578,7 @@ rsmi_dev_power_ave_get(uint32_t dv_ind, uint32_t sensor_ind, uint64_t *power) {
   CHK_SUPPORT_SUBVAR_ONLY(power, sensor_ind)
   rsmi_status_t ret;
 
-  DEVICE_MUTEX
+  DEVICE_MUTEX_SHARED
   ret = get_dev_mon_value(amd::smi::kMonPowerAve, dv_ind, sensor_ind, power);
 
   return ret;
@@ -3562,7 +3610,7 @@ rsmi_dev_current_socket_power_get(uint32_t dv_ind, uint64_t *socket_power) {
     return RSMI_STATUS_INVALID_ARGS;
   }
   CHK_SUPPORT_SUBVAR_ONLY(socket_power, sensor_ind)
-  DEVICE_MUTEX
+  DEVICE_MUTEX_SHARED
 
   if (dev->monitor() == nullptr) {
     ss << __PRETTY_FUNCTION__
@@ -3706,7 +3754,7 @@ rsmi_dev_power_cap_default_get(uint32_t dv_ind, uint64_t *default_cap) {
 
   rsmi_status_t ret;
 
-  DEVICE_MUTEX
+  DEVICE_MUTEX_SHARED
   ret = get_dev_mon_value(amd::smi::kMonPowerCapDefault, dv_ind, sensor_ind, default_cap);
 
   return ret;
@@ -3725,7 +3773,7 @@ rsmi_dev_power_cap_get(uint32_t dv_ind, uint32_t sensor_ind, uint64_t *cap) {
 
   rsmi_status_t ret;
 
-  DEVICE_MUTEX
+  DEVICE_MUTEX_SHARED
   ret = get_dev_mon_value(amd::smi::kMonPowerCap, dv_ind, sensor_ind, cap);
 
   return ret;
@@ -3745,7 +3793,7 @@ rsmi_dev_power_cap_range_get(uint32_t dv_ind, uint32_t sensor_ind,
                                                                    sensor_ind)
   rsmi_status_t ret;
 
-  DEVICE_MUTEX
+  DEVICE_MUTEX_SHARED
   ret = get_dev_mon_value(amd::smi::kMonPowerCapMax, dv_ind, sensor_ind, max);
 
   if (ret == RSMI_STATUS_SUCCESS) {
@@ -3805,7 +3853,7 @@ rsmi_dev_power_profile_presets_get(uint32_t dv_ind, uint32_t reserved,
   (void)reserved;
   CHK_SUPPORT_NAME_ONLY(status)
 
-  DEVICE_MUTEX
+  DEVICE_MUTEX_SHARED
   rsmi_status_t ret = get_power_profiles(dv_ind, status, nullptr);
 
   return ret;
@@ -3863,7 +3911,7 @@ rsmi_dev_memory_total_get(uint32_t dv_ind, rsmi_memory_type_t mem_type,
       return RSMI_STATUS_INVALID_ARGS;
   }
 
-  DEVICE_MUTEX
+  DEVICE_MUTEX_SHARED
   ret = get_dev_value_int(mem_type_file, dv_ind, total);
 
   // Fallback to KFD reported memory if VRAM total is 0
@@ -3940,7 +3988,7 @@ rsmi_dev_memory_usage_get(uint32_t dv_ind, rsmi_memory_type_t mem_type,
       return RSMI_STATUS_INVALID_ARGS;
   }
 
-  DEVICE_MUTEX
+  DEVICE_MUTEX_SHARED
   ret = get_dev_value_int(mem_type_file, dv_ind, used);
 
   // Fallback to KFD reported memory if no VRAM
@@ -3995,7 +4043,7 @@ rsmi_dev_memory_busy_percent_get(uint32_t dv_ind, uint32_t *busy_percent) {
 
   uint64_t tmp_util = 0;
 
-  DEVICE_MUTEX
+  DEVICE_MUTEX_SHARED
   ret = get_dev_value_int(amd::smi::kDevMemBusyPercent, dv_ind, &tmp_util);
 
   if (tmp_util > 100) {
@@ -4145,7 +4193,7 @@ rsmi_dev_busy_percent_get(uint32_t dv_ind, uint32_t *busy_percent) {
 
   CHK_SUPPORT_NAME_ONLY(busy_percent)
 
-  DEVICE_MUTEX
+  DEVICE_MUTEX_SHARED
   rsmi_status_t ret = get_dev_value_str(amd::smi::kDevUsage, dv_ind,
                                                                     &val_str);
   if (ret != RSMI_STATUS_SUCCESS) {
@@ -4374,7 +4422,7 @@ rsmi_dev_vbios_version_get(uint32_t dv_ind, char *vbios, uint32_t len) {
 
   std::string val_str;
 
-  DEVICE_MUTEX
+  DEVICE_MUTEX_SHARED
   int ret = dev->readDevInfo(amd::smi::kDevVBiosVer, &val_str);
 
   if (ret != 0) {
@@ -4427,7 +4475,7 @@ rsmi_version_str_get(rsmi_sw_component_t component, char *ver_str,
 
   switch (component) {
     case RSMI_SW_COMP_DRIVER:
-      ver_path = kROCmDriverVersionPath;
+      ver_path = amd::smi::FsRootPath(kROCmDriverVersionPath);
       break;
 
     default:
@@ -4471,7 +4519,7 @@ rsmi_status_t rsmi_dev_serial_number_get(uint32_t dv_ind,
   }
 
   TRY
-  DEVICE_MUTEX
+  DEVICE_MUTEX_SHARED
 
   std::string val_str;
   rsmi_status_t ret = get_dev_value_str(amd::smi::kDevSerialNumber,
@@ -4503,7 +4551,7 @@ rsmi_dev_pci_replay_counter_get(uint32_t dv_ind, uint64_t *counter) {
 
   rsmi_status_t ret;
 
-  DEVICE_MUTEX
+  DEVICE_MUTEX_SHARED
   ret = get_dev_value_int(amd::smi::kDevPCIEReplayCount, dv_ind, counter);
   return ret;
 
@@ -4520,7 +4568,7 @@ rsmi_dev_unique_id_get(uint32_t dv_ind, uint64_t *unique_id) {
 
   CHK_SUPPORT_NAME_ONLY(unique_id)
 
-  DEVICE_MUTEX
+  DEVICE_MUTEX_SHARED
   ret = get_dev_value_int(amd::smi::kDevUniqueId, dv_ind, unique_id);
   return ret;
 
@@ -4582,8 +4630,8 @@ rsmi_counter_control(rsmi_event_handle_t evt_handle,
 
   amd::smi::evt::Event *evt =
                          reinterpret_cast<amd::smi::evt::Event *>(evt_handle);
-  amd::smi::pthread_wrap _pw(*amd::smi::GetMutex(evt->dev_ind()));
-  amd::smi::ScopedPthread _lock(_pw);
+  amd::smi::ScopedDeviceLock _lock(amd::smi::GetMutex(evt->dev_ind()),
+                                   amd::smi::ScopedDeviceLock::kExclusive);
 
   REQUIRE_ROOT_ACCESS
 
@@ -4651,7 +4699,7 @@ rsmi_counter_available_counters_get(uint32_t dv_ind,
 
   TRY
   CHK_SUPPORT_VAR(available, grp)
-  DEVICE_MUTEX
+  DEVICE_MUTEX_SHARED
   uint64_t val = 0;
 
   switch (grp) {
@@ -4679,7 +4727,7 @@ rsmi_dev_counter_group_supported(uint32_t dv_ind, rsmi_event_group_t group) {
   std::ostringstream ss;
   ss << __PRETTY_FUNCTION__ << "| ======= start =======";
   LOG_TRACE(ss);
-  DEVICE_MUTEX
+  DEVICE_MUTEX_SHARED
   GET_DEV_FROM_INDX
 
   amd::smi::evt::dev_evt_grp_set_t *grp = dev->supported_event_groups();
@@ -4916,7 +4964,7 @@ rsmi_dev_xgmi_error_status(uint32_t dv_ind, rsmi_xgmi_status_t *status) {
   rsmi_status_t ret;
   uint64_t status_code;
 
-  DEVICE_MUTEX
+  DEVICE_MUTEX_SHARED
   ret = get_dev_value_int(amd::smi::kDevXGMIError, dv_ind, &status_code);
 
   if (ret != RSMI_STATUS_SUCCESS) {
@@ -4997,7 +5045,7 @@ rsmi_topo_get_link_weight(uint32_t dv_ind_src, uint32_t dv_ind_dst,
 
   uint32_t dv_ind = dv_ind_src;
   GET_DEV_AND_KFDNODE_FROM_INDX
-  DEVICE_MUTEX
+  DEVICE_MUTEX_SHARED
 
   if (weight == nullptr) {
     return RSMI_STATUS_INVALID_ARGS;
@@ -5071,7 +5119,7 @@ rsmi_topo_get_link_weight(uint32_t dv_ind_src, uint32_t dv_ind_dst,
 
   uint32_t dv_ind = dv_ind_src;
   GET_DEV_AND_KFDNODE_FROM_INDX
-  DEVICE_MUTEX
+  DEVICE_MUTEX_SHARED
 
   if (min_bandwidth == nullptr || max_bandwidth == nullptr) {
     return RSMI_STATUS_INVALID_ARGS;
@@ -5260,7 +5308,7 @@ rsmi_topo_get_p2p_status(uint32_t dv_ind_src, uint32_t dv_ind_dst,
 
   uint32_t dv_ind = dv_ind_src;
   GET_DEV_AND_KFDNODE_FROM_INDX
-  DEVICE_MUTEX
+  DEVICE_MUTEX_SHARED
 
   if (type == nullptr || cap == nullptr) {
     return RSMI_STATUS_INVALID_ARGS;
@@ -5355,7 +5403,7 @@ static rsmi_status_t get_compute_partition(uint32_t dv_ind,
   CHK_SUPPORT_NAME_ONLY(compute_partition.c_str())
   std::string compute_partition_str;
 
-  DEVICE_MUTEX
+  DEVICE_MUTEX_SHARED
   rsmi_status_t ret = get_dev_value_str(amd::smi::kDevComputePartition,
                                         dv_ind, &compute_partition_str);
   if (ret != RSMI_STATUS_SUCCESS) {
@@ -5459,7 +5507,7 @@ is_available_compute_partition(uint32_t dv_ind,
   std::ostringstream ss;
   ss << __PRETTY_FUNCTION__ << " | ======= start =======, " << dv_ind;
   LOG_TRACE(ss);
-  DEVICE_MUTEX
+  DEVICE_MUTEX_SHARED
   std::string availableComputePartitions;
   rsmi_status_t ret =
       get_dev_value_line(amd::smi::kDevAvailableComputePartition,
@@ -5608,6 +5656,9 @@ rsmi_dev_compute_partition_set(uint32_t dv_ind,
   int ret = dev->writeDevInfo(amd::smi::kDevComputePartition,
                               newComputePartitionStr);
   rsmi_status_t returnResponse = amd::smi::ErrnoToRsmiStatus(ret);
+  dev->dev_invalidate_gpu_metrics();
+  dev->closeSysfsFds();
+  dev->bumpGeneration();
   ss << __PRETTY_FUNCTION__
      << " | ======= end ======= "
      << " | Success "
@@ -5629,7 +5680,7 @@ rsmi_status_t rsmi_dev_compute_partition_capabilities_get(
   std::ostringstream ss;
   ss << __PRETTY_FUNCTION__ << " | ======= start =======, " << dv_ind;
   LOG_TRACE(ss);
-  DEVICE_MUTEX
+  DEVICE_MUTEX_SHARED
   std::string availableComputePartitions;
   rsmi_status_t ret =
       get_dev_value_line(amd::smi::kDevAvailableComputePartition,
@@ -5684,7 +5735,7 @@ rsmi_status_t rsmi_dev_compute_partition_supported_xcp_configs_get(uint32_t dv_i
   std::ostringstream ss;
   ss << __PRETTY_FUNCTION__ << " | ======= start =======, " << dv_ind;
   LOG_TRACE(ss);
-  DEVICE_MUTEX
+  DEVICE_MUTEX_SHARED
   std::string supported_xcp_configs;
   rsmi_status_t ret =
       get_dev_value_line(amd::smi::kDevSupportedXcpConfigs,
@@ -5739,7 +5790,7 @@ rsmi_status_t rsmi_dev_compute_partition_supported_nps_configs_get(uint32_t dv_i
   std::ostringstream ss;
   ss << __PRETTY_FUNCTION__ << " | ======= start =======, " << dv_ind;
   LOG_TRACE(ss);
-  DEVICE_MUTEX
+  DEVICE_MUTEX_SHARED
   std::string supported_nps_configs;
   rsmi_status_t ret =
       get_dev_value_line(amd::smi::kDevSupportedNpsConfigs,
@@ -5794,7 +5845,7 @@ rsmi_status_t rsmi_dev_current_compute_xcp_config_get(
   std::ostringstream ss;
   ss << __PRETTY_FUNCTION__ << " | ======= start =======, " << dv_ind;
   LOG_TRACE(ss);
-  DEVICE_MUTEX
+  DEVICE_MUTEX_SHARED
   std::string currentXcpConfigStr;
   rsmi_status_t ret =
       get_dev_value_line(amd::smi::kDevXcpConfig,
@@ -5939,6 +5990,7 @@ rsmi_dev_compute_partition_xcp_config_set(uint32_t dv_ind,
   int ret = dev->writeDevInfo(amd::smi::kDevXcpConfig,
                               newXcpConfigStr);
   rsmi_status_t returnResponse = amd::smi::ErrnoToRsmiStatus(ret);
+  dev->bumpGeneration();
   ss << __PRETTY_FUNCTION__
      << " | ======= end ======= "
      << " | Success "
@@ -5978,7 +6030,7 @@ rsmi_status_t rsmi_dev_compute_partition_resource_profile_get(uint32_t dv_ind,
   profile->partition_resource = std::numeric_limits<uint32_t>::max();
   profile->num_partitions_share_resource = std::numeric_limits<uint32_t>::max();
 
-  DEVICE_MUTEX
+  DEVICE_MUTEX_SHARED
   rsmi_status_t ret = RSMI_STATUS_NOT_SUPPORTED;
   // check if user provided supported resource types
   // Note: RSMI_ACCELERATOR_MAX is == largest enum value
@@ -6147,7 +6199,7 @@ static rsmi_status_t get_memory_partition(uint32_t dv_ind,
   CHK_SUPPORT_NAME_ONLY(memory_partition.c_str())
   std::string val_str;
 
-  DEVICE_MUTEX
+  DEVICE_MUTEX_SHARED
   rsmi_status_t ret = get_dev_value_str(amd::smi::kDevMemoryPartition,
                                         dv_ind, &val_str);
 
@@ -6495,7 +6547,7 @@ rsmi_status_t rsmi_dev_memory_partition_capabilities_get(
     return RSMI_STATUS_INVALID_ARGS;
   }
   CHK_SUPPORT_NAME_ONLY(memory_partition_caps)
-  DEVICE_MUTEX
+  DEVICE_MUTEX_SHARED
 
   std::string availableMemoryPartitions;
   rsmi_status_t ret =
@@ -6563,7 +6615,7 @@ rsmi_dev_partition_id_get(uint32_t dv_ind, uint32_t *partition_id) {
     LOG_ERROR(ss);
     return RSMI_STATUS_INVALID_ARGS;
   }
-  DEVICE_MUTEX
+  DEVICE_MUTEX_SHARED
   std::string strCompPartition = "UNKNOWN";
   const uint32_t PARTITION_LEN = 10;
   char compute_partition[PARTITION_LEN];
@@ -6653,7 +6705,15 @@ rsmi_status_t rsmi_dev_guid_get(uint32_t dv_ind, uint64_t *guid) {
     GET_DEV_AND_KFDNODE_FROM_INDX
     uint64_t kgd_gpu_id = 0;
     rsmi_status_t resp = RSMI_STATUS_NOT_SUPPORTED;
-    int ret = kfd_node->KFDNode::get_gpu_id(&kgd_gpu_id);
+    int ret = 0;
+    // gpu_id holds until the device changes
+    uint64_t read_generation = dev->generation();
+    if (!dev->loadKfdGpuId(&kgd_gpu_id)) {
+      ret = kfd_node->KFDNode::get_gpu_id(&kgd_gpu_id);
+      if (ret == 0) {
+        dev->storeKfdGpuId(kgd_gpu_id, read_generation);
+      }
+    }
     resp = amd::smi::ErrnoToRsmiStatus(ret);
 
     if (guid == nullptr) {
@@ -6963,6 +7023,7 @@ rsmi_func_iter_next(rsmi_func_id_iter_handle_t handle) {
 static bool check_evt_notif_support(int kfd_fd) {
   struct kfd_ioctl_get_version_args args = {0, 0};
 
+  amd::smi::PerfStats::countIo(amd::smi::kPerfIoIoctl);
   if (ioctl(kfd_fd, AMDKFD_IOC_GET_VERSION, &args) == -1) {
     return false;
   }
@@ -6981,7 +7042,8 @@ rsmi_event_notification_init(uint32_t dv_ind) {
   GET_DEV_FROM_INDX
   DEVICE_MUTEX
 
-  std::lock_guard<std::mutex> guard(*smi.kfd_notif_evt_fh_mutex());
+  amd::smi::LockStatsGuard guard(*smi.kfd_notif_evt_fh_mutex(),
+                                 amd::smi::kLockKfdEvent);
   if (smi.kfd_notif_evt_fh() == -1) {
     assert(smi.kfd_notif_evt_fh_refcnt() == 0);
     int kfd_fd = open(kPathKFDIoctl, O_RDWR | O_CLOEXEC);
@@ -7003,6 +7065,7 @@ rsmi_event_notification_init(uint32_t dv_ind) {
   assert(dev->kfd_gpu_id() <= UINT32_MAX);
   args.gpuid = static_cast<uint32_t>(dev->kfd_gpu_id());
 
+  amd::smi::PerfStats::countIo(amd::smi::kPerfIoIoctl);
   int ret = ioctl(smi.kfd_notif_evt_fh(), AMDKFD_IOC_SMI_EVENTS, &args);
   if (ret < 0) {
     return amd::smi::ErrnoToRsmiStatus(errno);
@@ -7358,7 +7421,8 @@ rsmi_status_t rsmi_event_notification_stop(uint32_t dv_ind) {
   GET_DEV_FROM_INDX
   DEVICE_MUTEX
 
-  std::lock_guard<std::mutex> guard(*smi.kfd_notif_evt_fh_mutex());
+  amd::smi::LockStatsGuard guard(*smi.kfd_notif_evt_fh_mutex(),
+                                 amd::smi::kLockKfdEvent);
 
   if (dev->evt_notif_anon_fd() == -1) {
     return RSMI_STATUS_INVALID_ARGS;
@@ -7473,6 +7537,82 @@ rsmi_dev_metrics_log_get(uint32_t dv_ind)
   CATCH
 }
 
+rsmi_status_t
+rsmi_dev_gpu_metrics_cache_max_age_set(uint32_t dv_ind, uint32_t max_age_ms)
+{
+  TRY
+  std::ostringstream ostrstream;
+  ostrstream << __PRETTY_FUNCTION__ << "| ======= start =======";
+  LOG_TRACE(ostrstream);
+
+  GET_DEV_FROM_INDX
+  dev->dev_set_gpu_metrics_max_age(max_age_ms);
+  ostrstream << __PRETTY_FUNCTION__
+             << " | ======= end ======= "
+             << " | Device #:  " << dv_ind
+             << " | Max Age (ms): " << max_age_ms
+             << " |";
+  LOG_INFO(ostrstream);
+
+  return RSMI_STATUS_SUCCESS;
+  CATCH
+}
+
+rsmi_status_t
+rsmi_dev_gpu_metrics_cache_max_age_get(uint32_t dv_ind, uint32_t* max_age_ms)
+{
+  TRY
+  std::ostringstream ostrstream;
+  ostrstream << __PRETTY_FUNCTION__ << "| ======= start =======";
+  LOG_TRACE(ostrstream);
+
+  if (max_age_ms == nullptr) {
+    return rsmi_status_t::RSMI_STATUS_INVALID_ARGS;
+  }
+
+  GET_DEV_FROM_INDX
+  *max_age_ms = dev->dev_get_gpu_metrics_max_age();
+
+  return RSMI_STATUS_SUCCESS;
+  CATCH
+}
+
+rsmi_status_t
+rsmi_dev_gpu_metrics_cache_invalidate(uint32_t dv_ind)
+{
+  TRY
+  std::ostringstream ostrstream;
+  ostrstream << __PRETTY_FUNCTION__ << "| ======= start =======";
+  LOG_TRACE(ostrstream);
+
+  GET_DEV_FROM_INDX
+  dev->dev_invalidate_gpu_metrics();
+
+  return RSMI_STATUS_SUCCESS;
+  CATCH
+}
+
+rsmi_status_t
+rsmi_dev_gpu_metrics_cache_refresh(uint32_t dv_ind)
+{
+  TRY
+  DEVICE_MUTEX_SHARED
+  std::ostringstream ostrstream;
+  ostrstream << __PRETTY_FUNCTION__ << "| ======= start =======";
+  LOG_TRACE(ostrstream);
+
+  GET_DEV_FROM_INDX
+  auto status_code = dev->dev_refresh_gpu_metrics();
+  ostrstream << __PRETTY_FUNCTION__
+             << " | ======= end ======= "
+             << " | Device #:  " << dv_ind
+             << " | Returning = " << status_code << " " << getRSMIStatusString(status_code) << " |";
+  LOG_INFO(ostrstream);
+
+  return status_code;
+  CATCH
+}
+
 
 // UNDOCUMENTED FUNCTIONS
 // This functions are not declared in rocm_smi.h. They are either not fully
@@ -7482,11 +7622,12 @@ rsmi_dev_metrics_log_get(uint32_t dv_ind)
 rsmi_status_t
 rsmi_test_sleep(uint32_t dv_ind, uint32_t seconds) {
 //  DEVICE_MUTEX
-  amd::smi::pthread_wrap _pw(*amd::smi::GetMutex(dv_ind));
   amd::smi::RocmSMI& smi_ = amd::smi::RocmSMI::getInstance();
   bool blocking_ = !(smi_.init_options() &
                       static_cast<uint64_t>(RSMI_INIT_FLAG_RESRV_TEST1));
-  amd::smi::ScopedPthread _lock(_pw, blocking_);
+  amd::smi::ScopedDeviceLock _lock(amd::smi::GetMutex(dv_ind),
+                                   amd::smi::ScopedDeviceLock::kExclusive,
+                                   blocking_);
   if (!blocking_ && _lock.mutex_not_acquired()) {
     return RSMI_STATUS_BUSY;
   }
@@ -0,0 +1,538 @@
+/*
+ * Copyright (c) Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "rocm_smi/rocm_smi_batch_reader.h"
+
+#include <fcntl.h>
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "rocm_smi/rocm_smi_logger.h"
+#include "rocm_smi/rocm_smi_perf_stats.h"
+
+namespace amd::smi {
+
+namespace {
+
+// Also the most reads in flight at once; larger batches go in chunks
+constexpr unsigned kRingEntries = 256;
+
+int sys_io_uring_setup(unsigned entries, struct io_uring_params *params) {
+#ifdef __NR_io_uring_setup
+  return static_cast<int>(syscall(__NR_io_uring_setup, entries, params));
+#else
+  (void)entries;
+  (void)params;
+  errno = ENOSYS;
+  return -1;
+#endif
+}
+
+int sys_io_uring_enter(int fd, unsigned to_submit, unsigned min_complete,
+                       unsigned flags) {
+#ifdef __NR_io_uring_enter
+  return static_cast<int>(syscall(__NR_io_uring_enter, fd, to_submit,
+                                  min_complete, flags, nullptr, 0));
+#else
+  (void)fd;
+  (void)to_submit;
+  (void)min_complete;
+  (void)flags;
+  errno = ENOSYS;
+  return -1;
+#endif
+}
+
+int sys_io_uring_register(int fd, unsigned opcode, void *arg,
+                          unsigned nr_args) {
+#ifdef __NR_io_uring_register
+  return static_cast<int>(syscall(__NR_io_uring_register, fd, opcode, arg,
+                                  nr_args));
+#else
+  (void)fd;
+  (void)opcode;
+  (void)arg;
+  (void)nr_args;
+  errno = ENOSYS;
+  return -1;
+#endif
+}
+
+// Tells the completions of cancel requests apart from those of the ops
+constexpr uint64_t kCancelUserData = 1ULL << 63;
+
+// IORING_OP_OPENAT, IORING_OP_CLOSE and IORING_OP_READ (and the opcode
+// probe itself) need Linux 5.6
+bool is_io_uring_supported(int ring_fd) {
+  constexpr unsigned kNumProbeOps = IORING_OP_READ + 1;
+  alignas(struct io_uring_probe) unsigned char
+      probe_buf[sizeof(struct io_uring_probe) +
+                kNumProbeOps * sizeof(struct io_uring_probe_op)] = {};
+  auto probe = reinterpret_cast<struct io_uring_probe *>(probe_buf);
+
+  if (sys_io_uring_register(ring_fd, IORING_REGISTER_PROBE, probe,
+                            kNumProbeOps) < 0) {
+    return false;
+  }
+  if (probe->last_op < IORING_OP_READ) {
+    return false;
+  }
+  for (auto op : {IORING_OP_ASYNC_CANCEL, IORING_OP_OPENAT, IORING_OP_CLOSE,
+                  IORING_OP_READ}) {
+    if ((probe->ops[op].flags & IO_URING_OP_SUPPORTED) == 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// A cached fd goes stale if the device goes away (ie: driver reload)
+bool is_stale_fd_error(int err) {
+  return (err == ENODEV) || (err == EBADF) || (err == ENOENT) ||
+         (err == ESTALE);
+}
+
+}  // namespace
+
+// One open, read or close of a batch
+struct SysfsBatchReader::RingOp {
+  uint8_t opcode;            // IORING_OP_OPENAT, _READ or _CLOSE
+  int fd = -1;               // What to read or close
+  const char *path = nullptr;  // What to open
+  char *buf = nullptr;       // Where to read to
+  std::size_t buf_size = 0;
+  int res = 0;               // [out] The fd opened or bytes read, or -errno
+  bool is_done = false;      // [out]
+};
+
+struct SysfsBatchReader::IoUring {
+  int fd = -1;
+  void *sq_ring = MAP_FAILED;
+  std::size_t sq_ring_size = 0;
+  void *cq_ring = MAP_FAILED;
+  std::size_t cq_ring_size = 0;
+  void *sqes = MAP_FAILED;
+  std::size_t sqes_size = 0;
+  unsigned num_entries = 0;
+
+  unsigned *sq_head = nullptr;
+  unsigned *sq_tail = nullptr;
+  unsigned *sq_mask = nullptr;
+  unsigned *sq_array = nullptr;
+  unsigned *cq_head = nullptr;
+  unsigned *cq_tail = nullptr;
+  unsigned *cq_mask = nullptr;
+  struct io_uring_cqe *cqes = nullptr;
+
+  ~IoUring() {
+    if (sqes != MAP_FAILED) {
+      munmap(sqes, sqes_size);
+    }
+    if ((cq_ring != MAP_FAILED) && (cq_ring != sq_ring)) {
+      munmap(cq_ring, cq_ring_size);
+    }
+    if (sq_ring != MAP_FAILED) {
+      munmap(sq_ring, sq_ring_size);
+    }
+    if (fd >= 0) {
+      close(fd);
+    }
+  }
+};
+
+SysfsBatchReader& SysfsBatchReader::getInstance() {
+  static SysfsBatchReader instance;
+  return instance;
+}
+
+SysfsBatchReader::~SysfsBatchReader() = default;
+
+std::unique_ptr<SysfsBatchReader::IoUring> SysfsBatchReader::acquire_ring() {
+  if (ring_failed_.load(std::memory_order_relaxed)) {
+    return nullptr;
+  }
+  {
+    std::lock_guard<std::mutex> guard(mutex_);
+    if (!idle_rings_.empty()) {
+      auto ring = std::move(idle_rings_.back());
+      idle_rings_.pop_back();
+      return ring;
+    }
+  }
+  return setup_io_uring();
+}
+
+void SysfsBatchReader::release_ring(std::unique_ptr<IoUring> ring) {
+  if ((ring == nullptr) || ring_failed_.load(std::memory_order_relaxed)) {
+    return;
+  }
+  std::lock_guard<std::mutex> guard(mutex_);
+  idle_rings_.push_back(std::move(ring));
+}
+
+std::unique_ptr<SysfsBatchReader::IoUring> SysfsBatchReader::setup_io_uring() {
+  std::ostringstream ss;
+  struct io_uring_params params;
+  memset(&params, 0, sizeof(params));
+
+  auto ring = std::make_unique<IoUring>();
+  ring->fd = sys_io_uring_setup(kRingEntries, &params);
+  if (ring->fd < 0) {
+    ss << __PRETTY_FUNCTION__ << " | io_uring is not available ("
+       << strerror(errno) << "), batched sysfs reads fall back to pread()";
+    LOG_INFO(ss);
+    ring_failed_ = true;
+    return nullptr;
+  }
+
+  if (!is_io_uring_supported(ring->fd)) {
+    ss << __PRETTY_FUNCTION__ << " | io_uring can't open and read files on "
+       << "this kernel, batched sysfs reads fall back to pread()";
+    LOG_INFO(ss);
+    ring_failed_ = true;
+    return nullptr;
+  }
+  ring->num_entries = params.sq_entries;
+  ring->sq_ring_size = params.sq_off.array +
+                       params.sq_entries * sizeof(unsigned);
+  ring->cq_ring_size = params.cq_off.cqes +
+                       params.cq_entries * sizeof(struct io_uring_cqe);
+  bool is_single_mmap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+  if (is_single_mmap) {
+    ring->sq_ring_size = std::max(ring->sq_ring_size, ring->cq_ring_size);
+    ring->cq_ring_size = ring->sq_ring_size;
+  }
+
+  ring->sq_ring = mmap(nullptr, ring->sq_ring_size, PROT_READ | PROT_WRITE,
+                       MAP_SHARED | MAP_POPULATE, ring->fd,
+                       IORING_OFF_SQ_RING);
+  if (ring->sq_ring != MAP_FAILED) {
+    ring->cq_ring = is_single_mmap ? ring->sq_ring :
+                    mmap(nullptr, ring->cq_ring_size, PROT_READ | PROT_WRITE,
+                         MAP_SHARED | MAP_POPULATE, ring->fd,
+                         IORING_OFF_CQ_RING);
+  }
+  if (ring->cq_ring != MAP_FAILED) {
+    ring->sqes_size = params.sq_entries * sizeof(struct io_uring_sqe);
+    ring->sqes = mmap(nullptr, ring->sqes_size, PROT_READ | PROT_WRITE,
+                      MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_SQES);
+  }
+  if (ring->sqes == MAP_FAILED) {
+    ss << __PRETTY_FUNCTION__ << " | could not map the io_uring rings ("
+       << strerror(errno) << "), batched sysfs reads fall back to pread()";
+    LOG_ERROR(ss);
+    ring_failed_ = true;
+    return nullptr;
+  }
+
+  auto sq = static_cast<char *>(ring->sq_ring);
+  auto cq = static_cast<char *>(ring->cq_ring);
+  ring->sq_head = reinterpret_cast<unsigned *>(sq + params.sq_off.head);
+  ring->sq_tail = reinterpret_cast<unsigned *>(sq + params.sq_off.tail);
+  ring->sq_mask = reinterpret_cast<unsigned *>(sq + params.sq_off.ring_mask);
+  ring->sq_array = reinterpret_cast<unsigned *>(sq + params.sq_off.array);
+  ring->cq_head = reinterpret_cast<unsigned *>(cq + params.cq_off.head);
+  ring->cq_tail = reinterpret_cast<unsigned *>(cq + params.cq_off.tail);
+  ring->cq_mask = reinterpret_cast<unsigned *>(cq + params.cq_off.ring_mask);
+  ring->cqes = reinterpret_cast<struct io_uring_cqe *>(cq +
+                                                       params.cq_off.cqes);
+
+  return ring;
+}
+
+// Reap the completions posted so far; returns how many of them were ops'.
+// A cancelled op is left undone, to be run without the ring.
+unsigned SysfsBatchReader::reap_completions(IoUring *ring, RingOp *ops) {
+  unsigned num_done = 0;
+  auto head = *ring->cq_head;
+  auto tail = __atomic_load_n(ring->cq_tail, __ATOMIC_ACQUIRE);
+  for (; head != tail; ++head) {
+    auto cqe = &ring->cqes[head & *ring->cq_mask];
+    if ((cqe->user_data & kCancelUserData) != 0) {
+      continue;
+    }
+    ++num_done;
+    if (cqe->res != -ECANCELED) {
+      auto& op = ops[cqe->user_data];
+      op.res = cqe->res;
+      op.is_done = true;
+    }
+  }
+  __atomic_store_n(ring->cq_head, head, __ATOMIC_RELEASE);
+  return num_done;
+}
+
+bool SysfsBatchReader::io_uring_run(IoUring *ring, RingOp *ops,
+                                    std::size_t num_ops) {
+  for (std::size_t first = 0; first < num_ops; first += ring->num_entries) {
+    auto num = static_cast<unsigned>(
+                  std::min<std::size_t>(ring->num_entries, num_ops - first));
+
+    // Queue the whole chunk, then make it visible to the kernel at once
+    const auto first_tail = *ring->sq_tail;
+    auto tail = first_tail;
+    for (unsigned i = 0; i < num; ++i, ++tail) {
+      auto& op = ops[first + i];
+      auto idx = tail & *ring->sq_mask;
+      auto sqe = static_cast<struct io_uring_sqe *>(ring->sqes) + idx;
+      memset(sqe, 0, sizeof(*sqe));
+      sqe->opcode = op.opcode;
+      if (op.opcode == IORING_OP_OPENAT) {
+        sqe->fd = AT_FDCWD;
+        sqe->addr = reinterpret_cast<uint64_t>(op.path);
+        sqe->open_flags = O_RDONLY | O_CLOEXEC;
+      } else {
+        sqe->fd = op.fd;
+      }
+      if (op.opcode == IORING_OP_READ) {
+        sqe->addr = reinterpret_cast<uint64_t>(op.buf);
+        sqe->len = static_cast<uint32_t>(op.buf_size);
+        sqe->off = 0;
+      }
+      sqe->user_data = first + i;
+      ring->sq_array[idx] = idx;
+    }
+    __atomic_store_n(ring->sq_tail, tail, __ATOMIC_RELEASE);
+
+    // One io_uring_enter() submits the chunk and waits for all of it;
+    // more are only needed if a signal interrupts the wait.
+    unsigned num_done = 0;
+    while (num_done < num) {
+      auto to_submit = tail - __atomic_load_n(ring->sq_head,
+                                              __ATOMIC_ACQUIRE);
+      auto ret = sys_io_uring_enter(ring->fd, to_submit, num - num_done,
+                                    IORING_ENTER_GETEVENTS);
+      bool is_failed = (ret < 0) && (errno != EINTR) && (errno != EAGAIN) &&
+                       (errno != EBUSY);
+      num_done += reap_completions(ring, ops);
+      if (is_failed) {
+        ring_failed_ = true;
+        drain_io_uring(ring, ops, first, first_tail, num_done);
+        return false;
+      }
+    }
+  }
+
+  return true;
+}
+
+void SysfsBatchReader::drain_io_uring(IoUring *ring, RingOp *ops,
+                                      std::size_t first, unsigned first_tail,
+                                      unsigned num_done) {
+  // The ring can not be waited on any more, but what went out may still
+  // write to the buffers and open fds. What the kernel did not take yet
+  // never goes out: take it back. Ask for the rest to be cancelled, and
+  // reap it all before the ring (and the buffers) can go away.
+  auto sq_head = __atomic_load_n(ring->sq_head, __ATOMIC_ACQUIRE);
+  __atomic_store_n(ring->sq_tail, sq_head, __ATOMIC_RELEASE);
+  auto num_pending = (sq_head - first_tail) - num_done;
+  if (num_pending == 0) {
+    return;
+  }
+
+  // The kernel copied the entries it took, so the whole ring is free
+  auto cancel_tail = sq_head;
+  for (auto i = first; i < first + (sq_head - first_tail); ++i) {
+    if (ops[i].is_done) {
+      continue;
+    }
+    auto idx = cancel_tail & *ring->sq_mask;
+    auto sqe = static_cast<struct io_uring_sqe *>(ring->sqes) + idx;
+    memset(sqe, 0, sizeof(*sqe));
+    sqe->opcode = IORING_OP_ASYNC_CANCEL;
+    sqe->fd = -1;
+    sqe->addr = i;
+    sqe->user_data = kCancelUserData | i;
+    ring->sq_array[idx] = idx;
+    ++cancel_tail;
+  }
+  __atomic_store_n(ring->sq_tail, cancel_tail, __ATOMIC_RELEASE);
+  if (sys_io_uring_enter(ring->fd, cancel_tail - sq_head, 0, 0) < 0) {
+    __atomic_store_n(ring->sq_tail, sq_head, __ATOMIC_RELEASE);
+  }
+
+  // Completions are posted to the ring whether it is entered or not
+  const struct timespec delay = {0, 1000000};
+  while ((num_pending -= reap_completions(ring, ops)) != 0) {
+    if (sys_io_uring_enter(ring->fd, 0, 1, IORING_ENTER_GETEVENTS) < 0) {
+      nanosleep(&delay, nullptr);
+    }
+  }
+}
+
+void SysfsBatchReader::run(std::unique_ptr<IoUring> *ring, RingOp *ops,
+                           std::size_t num_ops) {
+  if (num_ops == 0) {
+    return;
+  }
+  if (*ring != nullptr) {
+    if (io_uring_run(ring->get(), ops, num_ops)) {
+      return;
+    }
+    ring->reset();
+  }
+  for (std::size_t i = 0; i < num_ops; ++i) {
+    auto& op = ops[i];
+    if (op.is_done) {
+      continue;
+    }
+    int ret;
+    switch (op.opcode) {
+      case IORING_OP_OPENAT:
+        ret = open(op.path, O_RDONLY | O_CLOEXEC);
+        break;
+      case IORING_OP_READ:
+        do {
+          ret = static_cast<int>(pread(op.fd, op.buf, op.buf_size, 0));
+        } while ((ret < 0) && (errno == EINTR));
+        break;
+      default:
+        ret = close(op.fd);
+        break;
+    }
+    op.res = (ret < 0) ? -errno : ret;
+    op.is_done = true;
+  }
+}
+
+void SysfsBatchReader::read(SysfsReadRequest_t *reqs, std::size_t num_reqs) {
+  // The fds are held on to until the reads complete, so they stay open
+  // even if their device drops them meanwhile. Those a device can't keep
+  // are only opened for this batch, and closed in the end.
+  std::vector<SysfsFdPtr> sysfs_fds(num_reqs);
+  std::vector<int> fds(num_reqs, -1);
+  std::vector<std::string> paths(num_reqs);
+  std::vector<uint64_t> open_generations(num_reqs, 0);
+  std::vector<int> batch_only_fds;
+  std::vector<RingOp> ops;
+  std::vector<std::size_t> op_reqs;
+
+  for (std::size_t i = 0; i < num_reqs; ++i) {
+    auto& req = reqs[i];
+    req.text = {};
+    req.err = 0;
+    sysfs_fds[i] = req.device->findCachedSysfsFd(req.type);
+    if (sysfs_fds[i] != nullptr) {
+      fds[i] = sysfs_fds[i]->get();
+      continue;
+    }
+    open_generations[i] = req.device->generation();
+    if (req.device->getSysfsPath(req.type, &paths[i]) != 0) {
+      req.err = ENOENT;
+      continue;
+    }
+    RingOp op{IORING_OP_OPENAT};
+    op.path = paths[i].c_str();
+    ops.push_back(op);
+    op_reqs.push_back(i);
+    PerfStats::countIo(kPerfIoOpen);
+  }
+
+  auto ring = acquire_ring();
+  run(&ring, ops.data(), ops.size());
+  for (std::size_t k = 0; k < ops.size(); ++k) {
+    auto i = op_reqs[k];
+    auto& req = reqs[i];
+    if (ops[k].res < 0) {
+      req.err = -ops[k].res;
+      continue;
+    }
+    auto fd = ops[k].res;
+    sysfs_fds[i] = req.device->cacheSysfsFd(req.type, fd,
+                                            open_generations[i]);
+    if (sysfs_fds[i] != nullptr) {
+      fds[i] = sysfs_fds[i]->get();
+      continue;
+    }
+    if (errno == ENOENT) {
+      req.err = ENOENT;
+    } else {
+      fds[i] = fd;
+    }
+    batch_only_fds.push_back(fd);
+  }
+
+  ops.clear();
+  op_reqs.clear();
+  for (std::size_t i = 0; i < num_reqs; ++i) {
+    if (fds[i] < 0) {
+      continue;
+    }
+    RingOp op{IORING_OP_READ};
+    op.fd = fds[i];
+    op.buf = reqs[i].buf;
+    op.buf_size = reqs[i].buf_size;
+    ops.push_back(op);
+    op_reqs.push_back(i);
+    PerfStats::countIo(kPerfIoRead);
+  }
+  run(&ring, ops.data(), ops.size());
+  std::vector<bool> is_read(num_reqs, false);
+  for (std::size_t k = 0; k < ops.size(); ++k) {
+    auto& req = reqs[op_reqs[k]];
+    is_read[op_reqs[k]] = true;
+    if (ops[k].res >= 0) {
+      req.text = std::string_view(req.buf,
+                                  static_cast<std::size_t>(ops[k].res));
+    } else {
+      req.err = -ops[k].res;
+    }
+  }
+
+  ops.clear();
+  for (auto fd : batch_only_fds) {
+    RingOp op{IORING_OP_CLOSE};
+    op.fd = fd;
+    ops.push_back(op);
+  }
+  run(&ring, ops.data(), ops.size());
+  release_ring(std::move(ring));
+  sysfs_fds.clear();
+
+  // Anything the batch could not read (stale fds, or a read that may have
+  // been cut short) takes the single attribute read path.
+  for (std::size_t i = 0; i < num_reqs; ++i) {
+    auto& req = reqs[i];
+    bool is_retry = is_read[i] &&
+                    ((req.err != 0) ? is_stale_fd_error(req.err) :
+                                      (req.text.size() == req.buf_size));
+    if (is_retry) {
+      req.text = {};
+      req.err = req.device->readDevInfoText(req.type, req.buf, req.buf_size,
+                                            &req.text);
+    }
+  }
+}
+
+}  // namespace amd::smi
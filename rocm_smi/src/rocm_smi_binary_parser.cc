@@ -109,35 +109,24 @@ static int parse_pmmetric_table(uint8_t *buf, struct metric_field *table,
 
 /** present the PM metrics data
  *
- * @dri_instance: which card to pick under /sys/class/drm/card${instance}/device/
+ * @buf: pm_metrics file content, read by the caller
+ * @len: number of bytes in @buf
  * @kv: pointer to pointer of rsmi_name_value pairs
  * @kvnum: pointer to number of used rsmi_name_value pairs
  */
-int present_pmmetrics(const char* fname,
+int present_pmmetrics(uint8_t *buf, int32_t len,
                     rsmi_name_value_t **kv, uint32_t *kvnum)
 {
-    uint8_t *buf1;
-    FILE *infile;
     uint32_t pmmetrics_version;
     metric_field *table;
-    int r;
-    int32_t len;
 
-    infile = fopen(fname, "rb");
-    if (!infile) {
-        fprintf(stderr, "[ERROR]: pm_metrics file not found \n");
-        return -1;
-    }
-
-    buf1 = reinterpret_cast<uint8_t *>(calloc(1, 65536));
-    if (!buf1) {
+    if (len < 16) {
+        fprintf(stderr, "[ERROR]: pm_metrics file is too short\n");
         return -1;
     }
 
     table = NULL;
-    len = static_cast<int32_t>(fread(buf1, 1, 65536, infile));
-    fseek(infile, 0, SEEK_SET);
-    memcpy(&pmmetrics_version, &buf1[12], 4);
+    memcpy(&pmmetrics_version, &buf[12], 4);
 
     switch (pmmetrics_version) {
         case 4:   // ??? why 4?
@@ -148,10 +137,7 @@ int present_pmmetrics(const char* fname,
                 , pmmetrics_version);
             return -1;
     }
-    r = parse_pmmetric_table(buf1, table, len, kv, kvnum);
-    fclose(infile);
-    free(buf1);
-    return r;
+    return parse_pmmetric_table(buf, table, len, kv, kvnum);
 }
 
 static int parse_reg_state_table(uint8_t *buf, int32_t buflen,
@@ -244,55 +230,61 @@ top:
     return 0;
 }
 
+/** get_reg_state_offset: offset of a register space in the reg_state file
+ *
+ * @reg_type: Register space {"xgmi', "wafl", "pcie", "usr", "usr_1"}
+ *
+ * Returns -1 for an invalid register space.
+ */
+int64_t get_reg_state_offset(rsmi_reg_type_t reg_type) {
+    switch (reg_type) {
+        case RSMI_REG_XGMI:
+            return AMDGPU_SYS_REG_STATE_XGMI;
+        case RSMI_REG_WAFL:
+            return AMDGPU_SYS_REG_STATE_WAFL;
+        case RSMI_REG_PCIE:
+            return AMDGPU_SYS_REG_STATE_PCIE;
+        case RSMI_REG_USR:
+            return AMDGPU_SYS_REG_STATE_USR;
+        case RSMI_REG_USR1:
+            return AMDGPU_SYS_REG_STATE_USR_1;
+        default:
+            fprintf(stderr, "[ERROR]: Invalid register space named <%d>\n", reg_type);
+            return -1;
+    }
+}
+
 /** present_reg_state: present register state data
  *
- * @dri_instance: The DRI instance to select under /sys/class/drm/card${instance}/device
- * @table: Name of the table to read {"xgmi', "wafl", "pcie", "usr", "usr_1"}
+ * @buf: reg_state file content at get_reg_state_offset(@reg_type),
+ *       read by the caller
+ * @len: number of bytes in @buf
+ * @reg_type: Register space {"xgmi', "wafl", "pcie", "usr", "usr_1"}
  * @kv: pointer to pointer of rsmi_name_value pairs
  * @kvnum: pointer to number of used rsmi_name_value pairs
  */
-int present_reg_state(const char* fname,
+int present_reg_state(uint8_t *buf, int32_t len,
       rsmi_reg_type_t reg_type, rsmi_name_value_t **kv, uint32_t *kvnum) {
-    uint8_t buf[4096];
-    FILE *infile;
     struct metric_field *tab;
-    int32_t len;
-
-    infile = fopen(fname, "rb");
-    if (!infile) {
-        fprintf(stderr, "[ERROR]: reg_state file not found\n");
-        return -1;
-    }
 
     tab = NULL;
     if (reg_type == RSMI_REG_XGMI) {
-        fseek(infile, AMDGPU_SYS_REG_STATE_XGMI, SEEK_SET);
         tab = &xgmi_regs[0];
     }
     if (reg_type == RSMI_REG_WAFL) {
-        fseek(infile, AMDGPU_SYS_REG_STATE_WAFL, SEEK_SET);
         tab = &wafl_regs[0];
     }
     if (reg_type == RSMI_REG_PCIE) {
-        fseek(infile, AMDGPU_SYS_REG_STATE_PCIE, SEEK_SET);
         tab = &pcie_regs[0];
     }
-    if (reg_type == RSMI_REG_USR) {
-        fseek(infile, AMDGPU_SYS_REG_STATE_USR, SEEK_SET);
-         tab = &usr_regs[0];
-    }
-    if (reg_type == RSMI_REG_USR1) {
-        fseek(infile, AMDGPU_SYS_REG_STATE_USR_1, SEEK_SET);
+    if ((reg_type == RSMI_REG_USR) || (reg_type == RSMI_REG_USR1)) {
         tab = &usr_regs[0];
     }
     if (!tab) {
         fprintf(stderr, "[ERROR]: Invalid register space named <%d>\n", reg_type);
-        fclose(infile);
         return -2;
     }
 
-    len = static_cast<int32_t>(fread(buf, 1, sizeof buf, infile));
-    fclose(infile);
     return parse_reg_state_table(buf, len, tab, kv, kvnum);
 }
 
@@ -119,7 +119,7 @@ GetSupportedEventGroups(uint32_t dev_num, dev_evt_grp_set_t *supported_grps) {
   std::string grp_path;
   int32_t ret;
 
-  grp_path_base = kPathDeviceEventRoot;
+  grp_path_base = FsRootPath(kPathDeviceEventRoot);
   grp_path_base += '/';
   struct stat file_stat;
 
@@ -147,7 +147,7 @@ Event::Event(rsmi_event_type_t event, uint32_t dev_ind)  :
   rsmi_event_group_t grp = EvtGrpFromEvtID(event);
   assert(grp != RSMI_EVNT_GRP_INVALID);  // This should have failed before now
 
-  evt_path_root_ = kPathDeviceEventRoot;
+  evt_path_root_ = FsRootPath(kPathDeviceEventRoot);
   evt_path_root_ += '/';
   evt_path_root_ += kEvtGrpFNameMap.at(grp);
 
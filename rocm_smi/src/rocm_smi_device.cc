@@ -20,12 +20,14 @@
  * THE SOFTWARE.
  */
 
+#include <fcntl.h>
 #include <pthread.h>
 #include <unistd.h>
 #include <sys/stat.h>
 #include <sys/types.h>
 
 #include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <cstdint>
 #include <cstring>
@@ -43,7 +45,9 @@
 #include "rocm_smi/rocm_smi_device.h"
 #include "rocm_smi/rocm_smi.h"
 #include "rocm_smi/rocm_smi_exception.h"
+#include "rocm_smi/rocm_smi_perf_stats.h"
 #include "rocm_smi/rocm_smi_utils.h"
+#include "rocm_smi/rocm_smi_text_parser.h"
 #include "rocm_smi/rocm_smi_logger.h"
 #include "shared_mutex.h"  // NOLINT
 
@@ -537,6 +541,7 @@ static const std::map<const char *, dev_depends_t> kDevFuncDependsMap = {
   {"rsmi_dev_pci_bandwidth_get",         {{kDevPCIEClkFName}, {}}},
   {"rsmi_dev_pci_id_get",                {{}, {}}},
   {"rsmi_dev_pci_throughput_get",        {{kDevPCIEThruPutFName}, {}}},
+  {"rsmi_dev_pci_throughput_latest_get", {{kDevPCIEThruPutFName}, {}}},
   {"rsmi_dev_pci_replay_counter_get",    {{kDevPCIEReplayCountFName}, {}}},
   {"rsmi_dev_pci_bandwidth_set",         {{kDevPerfLevelFName,
                                            kDevPCIEClkFName}, {}}},
@@ -677,7 +682,30 @@ static const std::map<const char *, dev_depends_t> kDevFuncDependsMap = {
 
 Device::Device(std::string p, RocmSMI_env_vars const *e) :
             monitor_(nullptr), path_(p), env_(e), evt_notif_anon_fd_(-1),
-                                                   m_gpu_metrics_header{0, 0, 0} {
+                                                   m_gpu_metrics_header{0, 0, 0},
+                                                   m_gpu_metrics_updated_timestamp(0),
+                                                   m_device_id(0),
+                                                   m_partition_id(0),
+                                                   m_immutable_generation(0),
+                                                   m_kfd_gpu_id(0),
+                                                   m_kfd_gpu_id_generation(0),
+                                                   m_kfd_gpu_id_valid(false),
+                                                   m_sysfs_fds_generation(0),
+                                                   m_sysfs_dir_fd(-1),
+                                                   m_pci_dir_fd(-1),
+                                                   m_debugfs_dir_fd(-1),
+                                                   m_pcie_throughput_monitor(this),
+                                                   m_gpu_metrics_raw_buffer(kAMDGpuMetricsMaxTableSize),
+                                                   m_gpu_metrics_raw_size(0),
+                                                   m_gpu_metrics_refreshed_at_ms(0),
+                                                   m_gpu_metrics_raw_fw_timestamp(0),
+                                                   m_gpu_metrics_generation(0),
+                                                   m_gpu_metrics_max_age_ms(0),
+                                                   m_gpu_metrics_is_valid(false) {
+  // env_ is only kept for debug builds; pick up release settings here
+  if (e != nullptr) {
+    m_gpu_metrics_max_age_ms = e->gpu_metrics_max_age_ms;
+  }
 #ifndef DEBUG
     env_ = nullptr;
 #endif
@@ -698,36 +726,11 @@ Device::Device(std::string p, RocmSMI_env_vars const *e) :
 }
 
 Device:: ~Device() {
+  m_pcie_throughput_monitor.stop();
+  closeSysfsFds();
   shared_mutex_close(mutex_);
 }
 
-template <typename T>
-int Device::openDebugFileStream(DevInfoTypes type, T *fs, const char *str) {
-  std::string debugfs_path;
-
-  debugfs_path = kPathDebugRootFName;
-  debugfs_path += std::to_string(index());
-  debugfs_path += "/";
-  debugfs_path += kDevAttribNameMap.at(type);
-
-  DBG_FILE_ERROR(debugfs_path, str);
-  bool reg_file;
-  int ret = isRegularFile(debugfs_path, &reg_file);
-
-  if (ret != 0) {
-    return ret;
-  }
-  if (!reg_file) {
-    return ENOENT;
-  }
-
-  fs->open(debugfs_path);
-  if (!fs->is_open()) {
-      return errno;
-  }
-  return 0;
-}
-
 std::string Device::get_sys_file_path_by_type(DevInfoTypes type) const {
   auto sysfs_path = path_;
   sysfs_path += "/device/";
@@ -736,33 +739,43 @@ std::string Device::get_sys_file_path_by_type(DevInfoTypes type) const {
   return sysfs_path;
 }
 
-template <typename T>
-int Device::openSysfsFileStream(DevInfoTypes type, T *fs, const char *str) {
-  auto sysfs_path = path_;
+int Device::getSysfsPath(DevInfoTypes type, std::string *sysfs_path) const {
   std::ostringstream ss;
+  *sysfs_path = path_;
 
 #ifdef DEBUG
   if (env_->path_DRM_root_override
       && (env_->enum_overrides.find(type) != env_->enum_overrides.end())) {
-    sysfs_path = env_->path_DRM_root_override;
+    *sysfs_path = env_->path_DRM_root_override;
   }
 #endif
 
-  sysfs_path += "/device/";
-  sysfs_path += kDevAttribNameMap.at(type);
+  *sysfs_path += "/device/";
+  *sysfs_path += kDevAttribNameMap.at(type);
 
   // For the file under PCI sysfs
   if (type >= kDevPCieTypeStart && type <= kDevPCieTypeEND) {
-    sysfs_path = "/sys/bus/pci/devices/";
+    *sysfs_path = FsRootPath("/sys/bus/pci/devices/");
     std::string bdf_str;
     if (getBDFWithDomain(bdfid_, bdf_str) != RSMI_STATUS_SUCCESS) {
       ss << "Fail to craft the bdf string";
       LOG_ERROR(ss);
       return 1;
     }
-    sysfs_path += bdf_str;
-    sysfs_path += "/";
-    sysfs_path += kDevAttribNameMap.at(type);
+    *sysfs_path += bdf_str;
+    *sysfs_path += "/";
+    *sysfs_path += kDevAttribNameMap.at(type);
+  }
+  return 0;
+}
+
+template <typename T>
+int Device::openSysfsFileStream(DevInfoTypes type, T *fs, const char *str) {
+  std::string sysfs_path;
+  std::ostringstream ss;
+
+  if (getSysfsPath(type, &sysfs_path) != 0) {
+    return 1;
   }
 
   DBG_FILE_ERROR(sysfs_path, str);
@@ -808,14 +821,32 @@ int Device::openSysfsFileStream(DevInfoTypes type, T *fs, const char *str) {
 }
 
 int Device::readDebugInfoStr(DevInfoTypes type, std::string *retStr) {
-  std::ifstream fs;
-  std::string line;
+  char buf[kSysfsTextBufSize];
+  std::string_view text;
   int ret = 0;
   std::ostringstream ss;
 
   assert(retStr != nullptr);
 
-  ret = openDebugFileStream(type, &fs);
+  // Only the open needs the directory fd; the read (ie: amdgpu_gpu_recover)
+  // may take long, so don't hold up the other attributes meanwhile.
+  int fd = -1;
+  {
+    std::lock_guard<std::mutex> fds_guard(m_sysfs_fds_mutex);
+    auto dir_fd = getDebugfsDirFd();
+    if (dir_fd >= 0) {
+      DBG_FILE_ERROR(kDevAttribNameMap.at(type),
+                     static_cast<const char *>(nullptr));
+      PerfStats::countIo(kPerfIoOpen);
+      fd = openat(dir_fd, kDevAttribNameMap.at(type), O_RDONLY | O_CLOEXEC);
+    }
+  }
+  if (fd < 0) {
+    ret = errno;
+  } else {
+    ret = ReadTextFd(fd, buf, sizeof(buf), &text);
+    close(fd);
+  }
   if (ret != 0) {
     ss << "Could not read debugInfoStr for DevInfoType ("
      << get_type_string(type)<< "), returning "
@@ -824,13 +855,10 @@ int Device::readDebugInfoStr(DevInfoTypes type, std::string *retStr) {
     return ret;
   }
 
-  if (!(fs.peek() == std::ifstream::traits_type::eof())) {
-    getline(fs, line);
-    *retStr = line;
+  if (!text.empty()) {
+    *retStr = std::string(NextTextLine(&text));
   }
 
-  fs.close();
-
   ss << "Successfully read debugInfoStr for DevInfoType ("
      << get_type_string(type)<< "), retString= " << *retStr;
   LOG_INFO(ss);
@@ -839,13 +867,13 @@ int Device::readDebugInfoStr(DevInfoTypes type, std::string *retStr) {
 }
 
 int Device::readDevInfoStr(DevInfoTypes type, std::string *retStr) {
-  std::ifstream fs;
+  std::string contents;
   int ret = 0;
   std::ostringstream ss;
 
   assert(retStr != nullptr);
 
-  ret = openSysfsFileStream(type, &fs);
+  ret = readSysfsText(type, &contents);
   if (ret != 0) {
     ss << "Could not read device info string for DevInfoType ("
      << get_type_string(type) << "), returning "
@@ -854,22 +882,19 @@ int Device::readDevInfoStr(DevInfoTypes type, std::string *retStr) {
     return ret;
   }
 
-  fs >> *retStr;
-  fs.close();
-  ss << __PRETTY_FUNCTION__
-     << "Successfully read device info string for DevInfoType (" <<
-            get_type_string(type) << "): " + *retStr
-     << " | "
-     << (fs.is_open() ? " File stream is opened" : " File stream is closed")
-     << " | " << (fs.bad() ? "[ERROR] Bad read operation" :
-     "[GOOD] No bad bit read, successful read operation")
-     << " | " << (fs.fail() ? "[ERROR] Failed read - format error" :
-     "[GOOD] No fail - Successful read operation")
-     << " | " << (fs.eof() ? "[ERROR] Failed read - EOF error" :
-     "[GOOD] No eof - Successful read operation")
-     << " | " << (fs.good() ? "[GOOD] read good - Successful read operation" :
-     "[ERROR] Failed read - good error");
-  LOG_INFO(ss);
+  // First whitespace separated word, as "fs >> *retStr" would read it
+  const char* kWhiteSpace = " \t\n\v\f\r";
+  auto word_start = contents.find_first_not_of(kWhiteSpace);
+  if (word_start != std::string::npos) {
+    auto word_end = contents.find_first_of(kWhiteSpace, word_start);
+    *retStr = contents.substr(word_start, word_end - word_start);
+  }
+  if (ROCmLogging::Logger::getInstance()->isLoggerEnabled()) {
+    ss << __PRETTY_FUNCTION__
+       << "Successfully read device info string for DevInfoType ("
+       << get_type_string(type) << "): " + *retStr;
+    LOG_INFO(ss);
+  }
   return 0;
 }
 
@@ -879,9 +904,6 @@ int Device::writeDevInfoStr(DevInfoTypes type, std::string valStr,
   // returnWriteErr = true, improvement - allows us to detect errors
   // when writing to file
   // (such as EBUSY)
-  auto sysfs_path = path_;
-  sysfs_path += "/device/";
-  sysfs_path += kDevAttribNameMap.at(type);
   std::ofstream fs;
   int ret;
   std::ostringstream ss;
@@ -972,9 +994,6 @@ int Device::writeDevInfo(DevInfoTypes type, uint64_t val) {
 }
 
 int Device::writeDevInfo(DevInfoTypes type, std::string val) {
-  auto sysfs_path = path_;
-  sysfs_path += "/device/";
-  sysfs_path += kDevAttribNameMap.at(type);
   switch (type) {
     case kDevGPUMClk:
     case kDevSocPstate:
@@ -1002,12 +1021,12 @@ int Device::writeDevInfo(DevInfoTypes type, std::string val) {
 
 int Device::readDevInfoLine(DevInfoTypes type, std::string *line) {
   int ret;
-  std::ifstream fs;
+  std::string contents;
   std::ostringstream ss;
 
   assert(line != nullptr);
 
-  ret = openSysfsFileStream(type, &fs);
+  ret = readSysfsText(type, &contents);
   if (ret != 0) {
     ss << "Could not read DevInfoLine for DevInfoType ("
        << get_type_string(type) << ")";
@@ -1015,11 +1034,13 @@ int Device::readDevInfoLine(DevInfoTypes type, std::string *line) {
     return ret;
   }
 
-  std::getline(fs, *line);
-  ss << "Successfully read DevInfoLine for DevInfoType ("
-     << get_type_string(type) << "), returning *line = "
-     << *line;
-  LOG_INFO(ss);
+  *line = contents.substr(0, contents.find('\n'));
+  if (ROCmLogging::Logger::getInstance()->isLoggerEnabled()) {
+    ss << "Successfully read DevInfoLine for DevInfoType ("
+       << get_type_string(type) << "), returning *line = "
+       << *line;
+    LOG_INFO(ss);
+  }
 
   return 0;
 }
@@ -1034,74 +1055,524 @@ const char* Device::get_type_string(DevInfoTypes type) {
 
 }
 
-int Device::readDevInfoBinary(DevInfoTypes type, std::size_t b_size,
-                                void *p_binary_data) {
-  auto sysfs_path = path_;
+// The directory fds below are all guarded by m_sysfs_fds_mutex
+int Device::getDirFd(int *dir_fd, const std::string& dir_path) {
+  if (*dir_fd < 0) {
+    *dir_fd = open(dir_path.c_str(), O_PATH | O_DIRECTORY | O_CLOEXEC);
+  }
+  return *dir_fd;
+}
+
+int Device::getSysfsDirFd(DevInfoTypes type) {
+  // For the file under PCI sysfs
+  if (type >= kDevPCieTypeStart && type <= kDevPCieTypeEND) {
+    if (m_pci_dir_fd >= 0) {
+      return m_pci_dir_fd;
+    }
+    std::string bdf_str;
+    if (getBDFWithDomain(bdfid_, bdf_str) != RSMI_STATUS_SUCCESS) {
+      std::ostringstream ss;
+      ss << "Fail to craft the bdf string";
+      LOG_ERROR(ss);
+      errno = ENOENT;
+      return -1;
+    }
+    return getDirFd(&m_pci_dir_fd,
+                    FsRootPath("/sys/bus/pci/devices/") + bdf_str);
+  }
+
+  if (m_sysfs_dir_fd >= 0) {
+    return m_sysfs_dir_fd;
+  }
+  return getDirFd(&m_sysfs_dir_fd, path_ + "/device");
+}
+
+int Device::getDebugfsDirFd(void) {
+  if (m_debugfs_dir_fd >= 0) {
+    return m_debugfs_dir_fd;
+  }
+  return getDirFd(&m_debugfs_dir_fd,
+                  FsRootPath(kPathDebugRootFName) + std::to_string(index()));
+}
+
+void Device::closeDirFds(void) {
+  for (auto dir_fd : {&m_sysfs_dir_fd, &m_pci_dir_fd, &m_debugfs_dir_fd}) {
+    if (*dir_fd >= 0) {
+      close(*dir_fd);
+      *dir_fd = -1;
+    }
+  }
+}
+
+// Cached fds are shared by all devices (and partitions); stay well below
+// the usual 1024 open files limit. Files are still read with pread() once
+// the budget is used up, just through an fd opened for that read.
+static const int kMaxCachedSysfsFds = 256;
+static std::atomic<int> num_cached_sysfs_fds{0};
+
+SysfsFd::~SysfsFd() {
+  auto err = errno;
+  close(fd_);
+  if (is_cached_) {
+    num_cached_sysfs_fds.fetch_sub(1);
+  }
+  errno = err;
+}
+
+SysfsFdPtr Device::openSysfsFd(DevInfoTypes type) {
+  // m_sysfs_fds_mutex is held by the caller
+  auto fd_it = m_sysfs_fds.find(type);
+  if (fd_it != m_sysfs_fds.end()) {
+    return fd_it->second;
+  }
+
+  int fd = -1;
+  bool is_path_overridden = false;
+#ifdef DEBUG
+  is_path_overridden = (env_->path_DRM_root_override &&
+      (env_->enum_overrides.find(type) != env_->enum_overrides.end()));
+#endif
+  if (is_path_overridden) {
+    std::string sysfs_path;
+    if (getSysfsPath(type, &sysfs_path) != 0) {
+      errno = ENOENT;
+      return nullptr;
+    }
+    DBG_FILE_ERROR(sysfs_path, static_cast<const char *>(nullptr));
+    PerfStats::countIo(kPerfIoOpen);
+    fd = open(sysfs_path.c_str(), O_RDONLY | O_CLOEXEC);
+  } else {
+    auto dir_fd = getSysfsDirFd(type);
+    if (dir_fd < 0) {
+      return nullptr;
+    }
+    DBG_FILE_ERROR(kDevAttribNameMap.at(type),
+                   static_cast<const char *>(nullptr));
+    PerfStats::countIo(kPerfIoOpen);
+    fd = openat(dir_fd, kDevAttribNameMap.at(type), O_RDONLY | O_CLOEXEC);
+  }
+  if (fd < 0) {
+    return nullptr;
+  }
+  struct stat file_stat;
+  if ((fstat(fd, &file_stat) != 0) || !S_ISREG(file_stat.st_mode)) {
+    close(fd);
+    errno = ENOENT;
+    return nullptr;
+  }
+
+  bool is_cached = (num_cached_sysfs_fds.fetch_add(1) < kMaxCachedSysfsFds);
+  if (!is_cached) {
+    num_cached_sysfs_fds.fetch_sub(1);
+  }
+  auto sysfs_fd = std::make_shared<const SysfsFd>(fd, is_cached);
+  if (is_cached) {
+    m_sysfs_fds.emplace(type, sysfs_fd);
+  }
+  return sysfs_fd;
+}
+
+void Device::closeSysfsFds(void) {
+  std::lock_guard<std::mutex> fds_guard(m_sysfs_fds_mutex);
+  closeSysfsFdsLocked();
+}
+
+void Device::closeSysfsFdsLocked(void) {
+  // m_sysfs_fds_mutex is held by the caller. Fds still being read are
+  // closed once their reads are done.
+  m_sysfs_fds.clear();
+  closeDirFds();
+}
+
+void Device::dropStaleSysfsFdsLocked(void) {
+  // m_sysfs_fds_mutex is held by the caller
+  const auto current_generation = generation();
+  if (current_generation != m_sysfs_fds_generation) {
+    closeSysfsFdsLocked();
+    m_sysfs_fds_generation = current_generation;
+  }
+}
+
+SysfsFdPtr Device::findCachedSysfsFd(DevInfoTypes type) {
+  std::lock_guard<std::mutex> fds_guard(m_sysfs_fds_mutex);
+  dropStaleSysfsFdsLocked();
+  auto fd_it = m_sysfs_fds.find(type);
+  if (fd_it == m_sysfs_fds.end()) {
+    return nullptr;
+  }
+  return fd_it->second;
+}
+
+SysfsFdPtr Device::cacheSysfsFd(DevInfoTypes type, int fd,
+                                uint64_t open_generation) {
+  struct stat file_stat;
+  if ((fstat(fd, &file_stat) != 0) || !S_ISREG(file_stat.st_mode)) {
+    errno = ENOENT;
+    return nullptr;
+  }
+
+  std::lock_guard<std::mutex> fds_guard(m_sysfs_fds_mutex);
+  dropStaleSysfsFdsLocked();
+  // Not if it was opened before the files were re-created, or if another
+  // read opened it meanwhile
+  if ((open_generation != m_sysfs_fds_generation) ||
+      (m_sysfs_fds.find(type) != m_sysfs_fds.end())) {
+    errno = EMFILE;
+    return nullptr;
+  }
+  if (num_cached_sysfs_fds.fetch_add(1) >= kMaxCachedSysfsFds) {
+    num_cached_sysfs_fds.fetch_sub(1);
+    errno = EMFILE;
+    return nullptr;
+  }
+  auto sysfs_fd = std::make_shared<const SysfsFd>(fd, true);
+  m_sysfs_fds.emplace(type, sysfs_fd);
+  return sysfs_fd;
+}
+
+int Device::preadSysfsFd(DevInfoTypes type, void *buf, std::size_t b_size,
+                         off_t offset, std::size_t *p_read_size) {
+  *p_read_size = 0;
+
+  ssize_t num = -1;
+  int err = 0;
+  //  A cached fd goes stale if the device goes away (ie: driver reload);
+  //  in that case, reopen the file and try once more.
+  for (auto attempt = 0; attempt < 2; ++attempt) {
+    // Only the lookup (or open) is done under the lock; the read is not,
+    // so reads of other attributes of the device don't wait for it.
+    SysfsFdPtr sysfs_fd;
+    {
+      std::lock_guard<std::mutex> fds_guard(m_sysfs_fds_mutex);
+      dropStaleSysfsFdsLocked();
+      sysfs_fd = openSysfsFd(type);
+    }
+    if (sysfs_fd == nullptr) {
+      err = errno;
+      break;
+    }
+    do {
+      PerfStats::countIo(kPerfIoRead);
+      num = pread(sysfs_fd->get(), buf, b_size, offset);
+    } while ((num < 0) && (errno == EINTR));
+    err = (num < 0) ? errno : 0;
+    if (!sysfs_fd->is_cached() || (num >= 0) ||
+        ((err != ENODEV) && (err != EBADF) && (err != ENOENT) &&
+         (err != ESTALE))) {
+      break;
+    }
+    std::lock_guard<std::mutex> fds_guard(m_sysfs_fds_mutex);
+    auto fd_it = m_sysfs_fds.find(type);
+    if ((fd_it != m_sysfs_fds.end()) && (fd_it->second == sysfs_fd)) {
+      m_sysfs_fds.erase(fd_it);
+      // The directory the file was opened from is likely gone as well
+      closeDirFds();
+    }
+  }
+
+  if (num < 0) {
+    return err;
+  }
+  *p_read_size = static_cast<std::size_t>(num);
+  return 0;
+}
+
+bool Device::isImmutableDevInfo(DevInfoTypes type) {
+  switch (type) {
+    case kDevDevID:
+    case kDevDevRevID:
+    case kDevSubSysDevID:
+    case kDevSubSysVendorID:
+    case kDevVendorID:
+    case kDevPCieVendorID:
+    case kDevDevProdName:
+    case kDevDevProdNum:
+    case kDevBoardInfo:
+    case kDevSerialNumber:
+    case kDevUniqueId:
+    case kDevVBiosVer:
+    case kDevVramVendor:
+    case kDevMemTotVRAM:
+    case kDevXGMIPhysicalID:
+    case kDevFwVersionAsd:
+    case kDevFwVersionCe:
+    case kDevFwVersionDmcu:
+    case kDevFwVersionMc:
+    case kDevFwVersionMe:
+    case kDevFwVersionMec:
+    case kDevFwVersionMec2:
+    case kDevFwVersionMes:
+    case kDevFwVersionMesKiq:
+    case kDevFwVersionPfp:
+    case kDevFwVersionRlc:
+    case kDevFwVersionRlcSrlc:
+    case kDevFwVersionRlcSrlg:
+    case kDevFwVersionRlcSrls:
+    case kDevFwVersionSdma:
+    case kDevFwVersionSdma2:
+    case kDevFwVersionSmc:
+    case kDevFwVersionSos:
+    case kDevFwVersionTaRas:
+    case kDevFwVersionTaXgmi:
+    case kDevFwVersionUvd:
+    case kDevFwVersionVce:
+    case kDevFwVersionVcn:
+      return true;
+
+    default:
+      return false;
+  }
+}
+
+bool Device::loadImmutableDevInfo(DevInfoTypes type, std::string *contents) {
+  if (!isImmutableDevInfo(type) ||
+      !RocmSMI::getInstance().is_watching_devices()) {
+    return false;
+  }
+  std::lock_guard<std::mutex> immutable_guard(m_immutable_mutex);
+  if (m_immutable_generation != generation()) {
+    m_immutable_values.clear();
+    m_immutable_generation = generation();
+    return false;
+  }
+  auto it = m_immutable_values.find(type);
+  if (it == m_immutable_values.end()) {
+    return false;
+  }
+  *contents = it->second;
+  return true;
+}
+
+void Device::storeImmutableDevInfo(DevInfoTypes type,
+                                   std::string_view contents,
+                                   uint64_t read_generation) {
+  if (!isImmutableDevInfo(type) ||
+      !RocmSMI::getInstance().is_watching_devices()) {
+    return;
+  }
+  std::lock_guard<std::mutex> immutable_guard(m_immutable_mutex);
+  // The device changed while the value was read; it may be a stale one
+  if (read_generation != generation()) {
+    return;
+  }
+  if (m_immutable_generation != read_generation) {
+    m_immutable_values.clear();
+    m_immutable_generation = read_generation;
+  }
+  m_immutable_values[type] = std::string(contents);
+}
+
+bool Device::loadKfdGpuId(uint64_t *gpu_id) {
+  if (!RocmSMI::getInstance().is_watching_devices()) {
+    return false;
+  }
+  std::lock_guard<std::mutex> immutable_guard(m_immutable_mutex);
+  if (!m_kfd_gpu_id_valid || (m_kfd_gpu_id_generation != generation())) {
+    m_kfd_gpu_id_valid = false;
+    return false;
+  }
+  *gpu_id = m_kfd_gpu_id;
+  return true;
+}
+
+void Device::storeKfdGpuId(uint64_t gpu_id, uint64_t read_generation) {
+  if (!RocmSMI::getInstance().is_watching_devices()) {
+    return;
+  }
+  std::lock_guard<std::mutex> immutable_guard(m_immutable_mutex);
+  // The device changed while the value was read; it may be a stale one
+  if (read_generation != generation()) {
+    return;
+  }
+  m_kfd_gpu_id = gpu_id;
+  m_kfd_gpu_id_generation = read_generation;
+  m_kfd_gpu_id_valid = true;
+}
+
+int Device::readSysfsText(DevInfoTypes type, std::string *contents) {
+  if (loadImmutableDevInfo(type, contents)) {
+    return 0;
+  }
+  const auto read_generation = generation();
+
+  // A sysfs attribute is at most a page, so one pread() is usually enough
+  char buf[4096];
+  off_t offset = 0;
+
+  contents->clear();
+  while (true) {
+    std::size_t read_size = 0;
+    auto ret = preadSysfsFd(type, buf, sizeof(buf), offset, &read_size);
+    if (ret != 0) {
+      return ret;
+    }
+    contents->append(buf, read_size);
+    if (read_size < sizeof(buf)) {
+      storeImmutableDevInfo(type, *contents, read_generation);
+      return 0;
+    }
+    offset += static_cast<off_t>(read_size);
+  }
+}
+
+int Device::readDevInfoTextUnlocked(DevInfoTypes type, char *buf,
+                                    std::size_t b_size,
+                                    std::string_view *text) {
+  assert(buf != nullptr);
+  assert(text != nullptr);
+
+  std::string sysfs_path;
+  if (getSysfsPath(type, &sysfs_path) != 0) {
+    return ENOENT;
+  }
+  DBG_FILE_ERROR(sysfs_path, static_cast<const char *>(nullptr));
+  PerfStats::countIo(kPerfIoOpen);
+  int fd = open(sysfs_path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    return errno;
+  }
+  // sysfs hands out the whole attribute (at most a page) in one read
+  ssize_t num;
+  do {
+    PerfStats::countIo(kPerfIoRead);
+    num = read(fd, buf, b_size);
+  } while ((num < 0) && (errno == EINTR));
+  auto err = errno;
+  close(fd);
+  if (num < 0) {
+    return err;
+  }
+  *text = std::string_view(buf, static_cast<std::size_t>(num));
+  return 0;
+}
+
+int Device::readDevInfoText(DevInfoTypes type, char *buf, std::size_t b_size,
+                            std::string_view *text) {
   std::ostringstream ss;
+  assert(buf != nullptr);
+  assert(text != nullptr);
+
+  std::string immutable_contents;
+  if (loadImmutableDevInfo(type, &immutable_contents) &&
+      (immutable_contents.size() <= b_size)) {
+    std::memcpy(buf, immutable_contents.data(), immutable_contents.size());
+    *text = std::string_view(buf, immutable_contents.size());
+    return 0;
+  }
+  const auto read_generation = generation();
 
-  FILE *ptr;
-  sysfs_path += "/device/";
-  sysfs_path += kDevAttribNameMap.at(type);
+  std::size_t len = 0;
+  int ret = 0;
+  while (len < b_size) {
+    std::size_t read_size = 0;
+    ret = preadSysfsFd(type, buf + len, b_size - len,
+                       static_cast<off_t>(len), &read_size);
+    if ((ret != 0) || (read_size == 0)) {
+      break;
+    }
+    len += read_size;
+  }
+  if ((ret == 0) && (len == b_size)) {
+    char extra;
+    std::size_t read_size = 0;
+    ret = preadSysfsFd(type, &extra, 1, static_cast<off_t>(len), &read_size);
+    if ((ret == 0) && (read_size != 0)) {
+      ret = ENOBUFS;
+    }
+  }
+  if (ret != 0) {
+    ss << "Could not read device info text for DevInfoType ("
+       << get_type_string(type) << "), returning "
+       << std::to_string(ret);
+    LOG_ERROR(ss);
+    return ret;
+  }
 
-  ptr = fopen(sysfs_path.c_str(), "rb");
-  if (!ptr) {
+  *text = std::string_view(buf, len);
+  storeImmutableDevInfo(type, *text, read_generation);
+  return 0;
+}
+
+int Device::preadDevInfoBinary(DevInfoTypes type, std::size_t b_size,
+                               void *p_binary_data, off_t offset,
+                               std::size_t *p_read_size) {
+  std::ostringstream ss;
+  assert(p_binary_data != nullptr);
+  assert(p_read_size != nullptr);
+
+  auto err = preadSysfsFd(type, p_binary_data, b_size, offset, p_read_size);
+  if (err != 0) {
     ss << "Could not read DevInfoBinary for DevInfoType ("
        << get_type_string(type) << ")"
-       << " - SYSFS (" << sysfs_path << ")"
-       << ", returning " << std::to_string(errno) << " ("
-       << std::strerror(errno) << ")";
+       << " - SYSFS (" << path_ << "/device/" << kDevAttribNameMap.at(type) << ")"
+       << ", returning " << std::to_string(err) << " ("
+       << std::strerror(err) << ")";
     LOG_ERROR(ss);
-    return errno;
+    return err;
   }
 
-  size_t num = fread(p_binary_data, b_size, 1, ptr);
-  fclose(ptr);
-  if ((num*b_size) != b_size) {
-    ss << "Could not read DevInfoBinary for DevInfoType ("
+  if (ROCmLogging::Logger::getInstance()->isLoggerEnabled()) {
+    std::string sysfs_path = path_ + "/device/" + kDevAttribNameMap.at(type);
+    ss << "Successfully read DevInfoBinary for DevInfoType ("
        << get_type_string(type) << ") - SYSFS ("
-       << sysfs_path << "), binary size error; "
+       << sysfs_path << "), returning binaryData = " << p_binary_data
+       << "; byte_size = " << std::dec << *p_read_size;
+
+    std::string metricDescription = "AMD SMI GPU METRICS (16-byte width), "
+                                  + sysfs_path;
+    logHexDump(metricDescription.c_str(), p_binary_data, *p_read_size, 16);
+    LOG_INFO(ss);
+  }
+  return 0;
+}
+
+int Device::readDevInfoBinary(DevInfoTypes type, std::size_t b_size,
+                                void *p_binary_data) {
+  std::ostringstream ss;
+  std::size_t read_size = 0;
+
+  auto ret = preadDevInfoBinary(type, b_size, p_binary_data, 0, &read_size);
+  if (ret != 0) {
+    return ret;
+  }
+  if (read_size != b_size) {
+    ss << "Could not read DevInfoBinary for DevInfoType ("
+       << get_type_string(type) << "), binary size error; "
        << "[buff: "
        << p_binary_data
        << " size: "
        << b_size
        << " read: "
-       << num
+       << read_size
        << "]"
        << ", returning ENOENT (" << std::strerror(ENOENT) << ")";
     LOG_ERROR(ss);
     return ENOENT;
   }
-  if (ROCmLogging::Logger::getInstance()->isLoggerEnabled()) {
-    ss << "Successfully read DevInfoBinary for DevInfoType ("
-       << get_type_string(type) << ") - SYSFS ("
-       << sysfs_path << "), returning binaryData = " << p_binary_data
-       << "; byte_size = " << std::dec << static_cast<int>(b_size);
-
-    std::string metricDescription = "AMD SMI GPU METRICS (16-byte width), "
-                                  + sysfs_path;
-    logHexDump(metricDescription.c_str(), p_binary_data, b_size, 16);
-    LOG_INFO(ss);
-  }
   return 0;
 }
 
 int Device::readDevInfoMultiLineStr(DevInfoTypes type,
                                            std::vector<std::string> *retVec) {
-  std::string line;
   int ret;
-  std::ifstream fs;
+  std::string contents;
   std::string allLines;
   std::ostringstream ss;
 
   assert(retVec != nullptr);
 
-  ret = openSysfsFileStream(type, &fs);
+  ret = readSysfsText(type, &contents);
   if (ret != 0) {
     return ret;
   }
 
-  while (std::getline(fs, line)) {
-    retVec->push_back(line);
+  for (std::size_t line_start = 0; line_start < contents.size(); ) {
+    auto line_end = contents.find('\n', line_start);
+    if (line_end == std::string::npos) {
+      line_end = contents.size();
+    }
+    retVec->emplace_back(contents, line_start, line_end - line_start);
+    line_start = line_end + 1;
   }
 
   if (retVec->empty()) {
@@ -1117,22 +1588,23 @@ int Device::readDevInfoMultiLineStr(DevInfoTypes type,
     retVec->pop_back();
   }
 
-  // allow logging output of multiline strings
-  for (const auto& l: *retVec) {
-    allLines += "\n" + l;
+  if (retVec->empty()) {
+    ss << "Read devInfoMultiLineStr for DevInfoType ("
+       << get_type_string(type) << ")"
+       << ", but lines were empty";
+    LOG_INFO(ss);
+    return ENXIO;
   }
 
-  if (!allLines.empty()) {
+  // allow logging output of multiline strings
+  if (ROCmLogging::Logger::getInstance()->isLoggerEnabled()) {
+    for (const auto& l : *retVec) {
+      allLines += "\n" + l;
+    }
     ss << "Successfully read devInfoMultiLineStr for DevInfoType ("
        << get_type_string(type) << ") "
        << ", returning lines read = " << allLines;
     LOG_INFO(ss);
-  } else {
-    ss << "Read devInfoMultiLineStr for DevInfoType ("
-       << get_type_string(type) << ")"
-       << ", but lines were empty";
-    LOG_INFO(ss);
-    return ENXIO;
   }
   return 0;
 }
@@ -1141,9 +1613,10 @@ int Device::readDevInfo(DevInfoTypes type, uint64_t *val) {
   assert(val != nullptr);
 
   std::string tempStr;
+  char buf[kSysfsTextBufSize];
+  std::string_view text;
+  int base = 10;
   int ret;
-  int tmp_val;
-  std::ostringstream ss;
 
   switch (type) {
     case kDevDevID:
@@ -1156,18 +1629,9 @@ int Device::readDevInfo(DevInfoTypes type, uint64_t *val) {
     case kDevXGMIPhysicalID:
     case kDevErrRASSchema:
     case kDevErrTableVersion:
-      ret = readDevInfoStr(type, &tempStr);
-      RET_IF_NONZERO(ret);
-
-      if (tempStr.empty()) {
-        return EINVAL;
-      }
-      tmp_val = std::stoi(tempStr, nullptr, 16);
-      if (tmp_val < 0) {
-        return EINVAL;
-      }
-      *val = static_cast<uint64_t>(tmp_val);
-      break;
+      // "0x..." ids
+      base = 16;
+      [[fallthrough]];
 
     case kDevUsage:
     case kDevOverDriveLevel:
@@ -1182,12 +1646,11 @@ int Device::readDevInfo(DevInfoTypes type, uint64_t *val) {
     case kDevDFCountersAvailable:
     case kDevMemBusyPercent:
     case kDevXGMIError:
-      ret = readDevInfoStr(type, &tempStr);
+      ret = readDevInfoText(type, buf, sizeof(buf), &text);
       RET_IF_NONZERO(ret);
-      if (tempStr.empty()) {
+      if (!ParseTextUInt(NextTextToken(&text), val, base)) {
         return EINVAL;
       }
-      *val = std::stoul(tempStr, nullptr);
       break;
 
     case kDevUniqueId:
@@ -1214,12 +1677,11 @@ int Device::readDevInfo(DevInfoTypes type, uint64_t *val) {
     case kDevFwVersionUvd:
     case kDevFwVersionVce:
     case kDevFwVersionVcn:
-      ret = readDevInfoStr(type, &tempStr);
+      ret = readDevInfoText(type, buf, sizeof(buf), &text);
       RET_IF_NONZERO(ret);
-      if (tempStr.empty()) {
+      if (!ParseTextUInt(NextTextToken(&text), val, 16)) {
         return EINVAL;
       }
-      *val = std::stoul(tempStr, nullptr, 16);
       break;
 
     case kDevGpuReset:
@@ -1409,7 +1871,15 @@ void Device::fillSupportedFuncs(void) {
   }
   std::map<const char *, dev_depends_t>::const_iterator it =
                                                    kDevFuncDependsMap.begin();
-  std::string dev_rt = path_ + "/device";
+  // Look the files up relative to the device directories rather than
+  // walking the whole path for each of them
+  std::lock_guard<std::mutex> fds_guard(m_sysfs_fds_mutex);
+  auto dev_rt_fd = getDirFd(&m_sysfs_dir_fd, path_ + "/device");
+  auto debugfs_rt_fd = getDebugfsDirFd();
+  auto file_exists = [](int dir_fd, const char *name) {
+    struct stat file_stat;
+    return (dir_fd >= 0) && (fstatat(dir_fd, name, &file_stat, 0) == 0);
+  };
   bool mand_depends_met;
   std::shared_ptr<VariantMap> supported_variants;
 
@@ -1420,13 +1890,7 @@ void Device::fillSupportedFuncs(void) {
 
     mand_depends_met = true;
     for (; dep != it->second.mandatory_depends.end(); dep++) {
-      std::string dep_path = dev_rt + "/" + *dep;
-      std::string debugfs_path;
-      debugfs_path = kPathDebugRootFName;
-      debugfs_path += std::to_string(index());
-      debugfs_path += "/";
-      debugfs_path += *dep;
-      if (!FileExists(dep_path.c_str()) && !FileExists(debugfs_path.c_str())) {
+      if (!file_exists(dev_rt_fd, *dep) && !file_exists(debugfs_rt_fd, *dep)) {
         mand_depends_met = false;
         break;
       }
@@ -1448,8 +1912,7 @@ void Device::fillSupportedFuncs(void) {
     supported_variants = std::make_shared<VariantMap>();
 
     for (; var != it->second.variants.end(); var++) {
-      std::string variant_path = dev_rt + "/" + kDevAttribNameMap.at(*var);
-      if (!FileExists(variant_path.c_str())) {
+      if (!file_exists(dev_rt_fd, kDevAttribNameMap.at(*var))) {
         continue;
       }
       // At this point we assume no monitors, so map to nullptr
@@ -1538,6 +2001,11 @@ rsmi_status_t Device::restartAMDGpuDriver(void) {
   std::string captureRestartErr;
   const int kTimeToWaitForDriverMSec = 1000;
 
+  // Any cached gpu_metrics snapshot and sysfs fd is stale once the driver
+  // reloads
+  dev_invalidate_gpu_metrics();
+  closeSysfsFds();
+
   // sudo systemctl is-active gdm
   // we do not care about the success of checking if gdm is active
   std::tie(success, out) = executeCommand("systemctl is-active gdm", true);
@@ -1569,6 +2037,9 @@ rsmi_status_t Device::restartAMDGpuDriver(void) {
   // sudo modprobe amdgpu
   std::tie(success, out) = executeCommand(
     "modprobe -r -v amdgpu >/dev/null 2>&1 && modprobe -v amdgpu >/dev/null 2>&1", true);
+  // Whatever was cached for any device is stale, whether or not the reload
+  // completed
+  RocmSMI::getInstance().bumpDeviceGenerations();
   restartSuccessful &= success;
   captureRestartErr = out;
   ss << __PRETTY_FUNCTION__ << " | modprobe -r -v amdgpu && modprobe -v amdgpu: out = "
@@ -1607,6 +2078,8 @@ rsmi_status_t Device::restartAMDGpuDriver(void) {
     status = Device::isRestartInProgress(&isRestartInProgress,
                                          &isAMDGPUModuleLive);
   }
+  // Again, for anything read while the driver was coming back up
+  RocmSMI::getInstance().bumpDeviceGenerations();
 
   return ((restartSuccessful && (!isRestartInProgress && isAMDGPUModuleLive)) ?
           RSMI_STATUS_SUCCESS :
@@ -54,7 +54,7 @@
 
 using namespace amd::smi;
 
-#define TRY try {
+#define TRY amd::smi::PerfScope perf_scope(__func__); try {
 #define CATCH } catch (...) {return amd::smi::handleException();}
 
 
@@ -87,6 +87,13 @@ uint64_t actual_timestamp_in_secs()
   return duration_cast<seconds>(system_clock::now().time_since_epoch()).count();
 }
 
+uint64_t actual_timestamp_in_ms()
+{
+  using namespace std::chrono;
+  return static_cast<uint64_t>(
+    duration_cast<milliseconds>(steady_clock::now().time_since_epoch()).count());
+}
+
 auto timestamp_to_time_point(uint64_t timestamp_in_secs)
 {
   using namespace std::chrono;
@@ -354,13 +361,13 @@ rsmi_status_t is_gpu_metrics_version_supported(const AMDGpuMetricsHeader_v1_t& m
 
 AMDGpuMetricFactories_t amd_gpu_metrics_factory_table
 {
-  {AMDGpuMetricVersionFlags_t::kGpuMetricV11, std::make_shared<GpuMetricsBase_v11_t>(GpuMetricsBase_v11_t{})},
-  {AMDGpuMetricVersionFlags_t::kGpuMetricV12, std::make_shared<GpuMetricsBase_v12_t>(GpuMetricsBase_v12_t{})},
-  {AMDGpuMetricVersionFlags_t::kGpuMetricV13, std::make_shared<GpuMetricsBase_v13_t>(GpuMetricsBase_v13_t{})},
-  {AMDGpuMetricVersionFlags_t::kGpuMetricV14, std::make_shared<GpuMetricsBase_v14_t>(GpuMetricsBase_v14_t{})},
-  {AMDGpuMetricVersionFlags_t::kGpuMetricV15, std::make_shared<GpuMetricsBase_v15_t>(GpuMetricsBase_v15_t{})},
-  {AMDGpuMetricVersionFlags_t::kGpuMetricV16, std::make_shared<GpuMetricsBase_v16_t>(GpuMetricsBase_v16_t{})},
-  {AMDGpuMetricVersionFlags_t::kGpuMetricV17, std::make_shared<GpuMetricsBase_v17_t>(GpuMetricsBase_v17_t{})},
+  {AMDGpuMetricVersionFlags_t::kGpuMetricV11, []() { return std::make_shared<GpuMetricsBase_v11_t>(); }},
+  {AMDGpuMetricVersionFlags_t::kGpuMetricV12, []() { return std::make_shared<GpuMetricsBase_v12_t>(); }},
+  {AMDGpuMetricVersionFlags_t::kGpuMetricV13, []() { return std::make_shared<GpuMetricsBase_v13_t>(); }},
+  {AMDGpuMetricVersionFlags_t::kGpuMetricV14, []() { return std::make_shared<GpuMetricsBase_v14_t>(); }},
+  {AMDGpuMetricVersionFlags_t::kGpuMetricV15, []() { return std::make_shared<GpuMetricsBase_v15_t>(); }},
+  {AMDGpuMetricVersionFlags_t::kGpuMetricV16, []() { return std::make_shared<GpuMetricsBase_v16_t>(); }},
+  {AMDGpuMetricVersionFlags_t::kGpuMetricV17, []() { return std::make_shared<GpuMetricsBase_v17_t>(); }},
 };
 
 GpuMetricsBasePtr amdgpu_metrics_factory(AMDGpuMetricVersionFlags_t gpu_metric_version)
@@ -381,7 +388,7 @@ GpuMetricsBasePtr amdgpu_metrics_factory(AMDGpuMetricVersionFlags_t gpu_metric_v
                 << " |";
     LOG_TRACE(ss);
 
-    return (amd_gpu_metrics_factory_table.at(gpu_metric_version));
+    return (amd_gpu_metrics_factory_table.at(gpu_metric_version)());
   }
 
   ss << __PRETTY_FUNCTION__
@@ -413,70 +420,967 @@ constexpr T init_max_uint_types()
   }
 }
 
+rsmi_status_t init_max_public_gpu_matrics(AMGpuMetricsPublicLatest_t& rsmi_gpu_metrics);
+
 template<typename T>
-AMDGpuDynamicMetricTblValues_t format_metric_row(const T& metric, const std::string& value_title)
+constexpr uint16_t metric_field_width()
 {
-  auto multi_values = AMDGpuDynamicMetricTblValues_t{};
-
-  auto get_data_type_info = [&]() {
-    auto data_type(AMDGpuMetricsDataType_t::kUInt64);
-    if constexpr (std::is_array_v<T>) {
-      const uint8_t  kCheckUint8[]={1};
-      const uint16_t kCheckUint16[]={2};
-      const uint32_t kCheckUint32[]={3};
-      const uint64_t kCheckUint64[]={4};
-      if constexpr (std::is_same_v<decltype(metric[0]), decltype(kCheckUint8[0])>) {
-        data_type = AMDGpuMetricsDataType_t::kUInt8;
-      }
-      if constexpr (std::is_same_v<decltype(metric[0]), decltype(kCheckUint16[0])>) {
-        data_type = AMDGpuMetricsDataType_t::kUInt16;
-      }
-      if constexpr (std::is_same_v<decltype(metric[0]), decltype(kCheckUint32[0])>) {
-        data_type = AMDGpuMetricsDataType_t::kUInt32;
-      }
-      if constexpr (std::is_same_v<decltype(metric[0]), decltype(kCheckUint64[0])>) {
-        data_type = AMDGpuMetricsDataType_t::kUInt64;
+  return static_cast<uint16_t>(sizeof(std::remove_all_extents_t<T>));
+}
+
+template<typename T>
+constexpr uint16_t metric_field_num_values()
+{
+  return static_cast<uint16_t>(sizeof(T) / sizeof(std::remove_all_extents_t<T>));
+}
+
+#define AMDGPU_METRIC_FIELD_TYPE(struct_t, member) \
+  std::remove_reference_t<decltype(std::declval<struct_t&>().member)>
+
+#define AMDGPU_METRIC_FIELD_INFO(struct_t, member)                       \
+  static_cast<uint16_t>(offsetof(struct_t, member)),                     \
+  metric_field_width<AMDGPU_METRIC_FIELD_TYPE(struct_t, member)>(),      \
+  metric_field_num_values<AMDGPU_METRIC_FIELD_TYPE(struct_t, member)>()
+
+#define AMDGPU_METRIC_NO_FIELD_INFO kAMDGpuMetricsNoPublicField, 0, 0
+
+//  Metric going to both, dynamic table and public metrics
+#define AMDGPU_METRIC_FIELD(metrics_tbl_t, class_id, unit_id, title, metric, public_metric) \
+  AMDGpuMetricFieldDesc_t{AMDGpuMetricsClassId_t::class_id,                                  \
+                          AMDGpuMetricsUnitType_t::unit_id, title,                           \
+                          AMDGPU_METRIC_FIELD_INFO(metrics_tbl_t, metric),                   \
+                          AMDGPU_METRIC_FIELD_INFO(AMGpuMetricsPublicLatest_t, public_metric)}
+
+//  Metric going to the dynamic table only
+#define AMDGPU_METRIC_DYNAMIC_FIELD(metrics_tbl_t, class_id, unit_id, title, metric) \
+  AMDGpuMetricFieldDesc_t{AMDGpuMetricsClassId_t::class_id,                          \
+                          AMDGpuMetricsUnitType_t::unit_id, title,                   \
+                          AMDGPU_METRIC_FIELD_INFO(metrics_tbl_t, metric),           \
+                          AMDGPU_METRIC_NO_FIELD_INFO}
+
+//  Metric going to the public metrics only
+#define AMDGPU_METRIC_PUBLIC_FIELD(metrics_tbl_t, metric, public_metric)               \
+  AMDGpuMetricFieldDesc_t{AMDGpuMetricsClassId_t::kGpuMetricHeader,                    \
+                          kAMDGpuMetricsNoUnit, nullptr,                               \
+                          AMDGPU_METRIC_FIELD_INFO(metrics_tbl_t, metric),             \
+                          AMDGPU_METRIC_FIELD_INFO(AMGpuMetricsPublicLatest_t, public_metric)}
+
+#define AMDGPU_METRIC_XCP_STATS_FIELDS(metrics_tbl_t, xcp)                                  \
+  AMDGPU_METRIC_PUBLIC_FIELD(metrics_tbl_t, m_xcp_stats[xcp].gfx_busy_inst,                 \
+                             xcp_stats[xcp].gfx_busy_inst),                                 \
+  AMDGPU_METRIC_PUBLIC_FIELD(metrics_tbl_t, m_xcp_stats[xcp].jpeg_busy,                     \
+                             xcp_stats[xcp].jpeg_busy),                                     \
+  AMDGPU_METRIC_PUBLIC_FIELD(metrics_tbl_t, m_xcp_stats[xcp].vcn_busy,                      \
+                             xcp_stats[xcp].vcn_busy),                                      \
+  AMDGPU_METRIC_PUBLIC_FIELD(metrics_tbl_t, m_xcp_stats[xcp].gfx_busy_acc,                  \
+                             xcp_stats[xcp].gfx_busy_acc)
+
+#define AMDGPU_METRIC_XCP_STATS_V1_1_FIELDS(metrics_tbl_t, xcp)                             \
+  AMDGPU_METRIC_XCP_STATS_FIELDS(metrics_tbl_t, xcp),                                       \
+  AMDGPU_METRIC_PUBLIC_FIELD(metrics_tbl_t, m_xcp_stats[xcp].gfx_below_host_limit_acc,      \
+                             xcp_stats[xcp].gfx_below_host_limit_acc)
+
+//
+//  Note: Backwards compatibility -> Handling extra/exception cases
+//        related to earlier versions (1.3/1.4/1.5)
+#define AMDGPU_METRIC_LEGACY_CLOCK_FIELDS(metrics_tbl_t)                                    \
+  AMDGPU_METRIC_PUBLIC_FIELD(metrics_tbl_t, m_current_gfxclk[0], current_gfxclk),           \
+  AMDGPU_METRIC_PUBLIC_FIELD(metrics_tbl_t, m_current_socclk[0], current_socclk),           \
+  AMDGPU_METRIC_PUBLIC_FIELD(metrics_tbl_t, m_current_vclk0[0], current_vclk0),             \
+  AMDGPU_METRIC_PUBLIC_FIELD(metrics_tbl_t, m_current_vclk0[1], current_vclk1),             \
+  AMDGPU_METRIC_PUBLIC_FIELD(metrics_tbl_t, m_current_dclk0[0], current_dclk0),             \
+  AMDGPU_METRIC_PUBLIC_FIELD(metrics_tbl_t, m_current_dclk0[1], current_dclk1)
+
+static_assert(sizeof(AMGpuMetricsPublicLatest_t) < kAMDGpuMetricsNoPublicField,
+              "Error: Public metrics do not fit the field descriptor offsets...");
+
+//
+//  Note: One field descriptor table per metrics version. Fields are decoded
+//        in order; the first field set for a metric unit wins.
+//
+constexpr AMDGpuMetricFieldDesc_t kAMDGpuMetricFields_v11[] = {
+  // Temperature Info
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v11_t, kGpuMetricTemperature, kMetricTempEdge,
+                      "temperature_edge", m_temperature_edge, temperature_edge),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v11_t, kGpuMetricTemperature, kMetricTempHotspot,
+                      "temperature_hotspot", m_temperature_hotspot, temperature_hotspot),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v11_t, kGpuMetricTemperature, kMetricTempMem,
+                      "temperature_mem", m_temperature_mem, temperature_mem),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v11_t, kGpuMetricTemperature, kMetricTempVrGfx,
+                      "temperature_vrgfx", m_temperature_vrgfx, temperature_vrgfx),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v11_t, kGpuMetricTemperature, kMetricTempVrSoc,
+                      "temperature_vrsoc", m_temperature_vrsoc, temperature_vrsoc),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v11_t, kGpuMetricTemperature, kMetricTempVrMem,
+                      "temperature_vrmem", m_temperature_vrmem, temperature_vrmem),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v11_t, kGpuMetricTemperature, kMetricTempHbm,
+                      "[temperature_hbm]", m_temperature_hbm, temperature_hbm),
+
+  // Power/Energy Info
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v11_t, kGpuMetricPowerEnergy, kMetricAvgSocketPower,
+                      "average_socket_power", m_average_socket_power, average_socket_power),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v11_t, kGpuMetricPowerEnergy, kMetricEnergyAccumulator,
+                      "energy_acc", m_energy_accumulator, energy_accumulator),
+
+  // Utilization Info
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v11_t, kGpuMetricUtilization, kMetricAvgGfxActivity,
+                      "average_gfx_activity", m_average_gfx_activity, average_gfx_activity),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v11_t, kGpuMetricUtilization, kMetricAvgUmcActivity,
+                      "average_umc_activity", m_average_umc_activity, average_umc_activity),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v11_t, kGpuMetricUtilization, kMetricAvgMmActivity,
+                      "average_mm_activity", m_average_mm_activity, average_mm_activity),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v11_t, kGpuMetricUtilization, kMetricGfxActivityAccumulator,
+                      "gfx_activity_acc", m_gfx_activity_acc, gfx_activity_acc),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v11_t, kGpuMetricUtilization, kMetricMemActivityAccumulator,
+                      "mem_activity_acc", m_mem_activity_acc, mem_activity_acc),
+
+  // Timestamp Info
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v11_t, kGpuMetricTimestamp, kMetricTSClockCounter,
+                      "system_clock_counter", m_system_clock_counter, system_clock_counter),
+
+  // Fan Info
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v11_t, kGpuMetricCurrentFanSpeed, kMetricCurrFanSpeed,
+                      "current_fan_speed", m_current_fan_speed, current_fan_speed),
+
+  // Throttle Info
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v11_t, kGpuMetricThrottleStatus, kMetricThrottleStatus,
+                      "throttle_status", m_throttle_status, throttle_status),
+
+  // Average Info
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v11_t, kGpuMetricAverageClock, kMetricAvgGfxClockFrequency,
+                      "average_gfxclk_frequency", m_average_gfxclk_frequency, average_gfxclk_frequency),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v11_t, kGpuMetricAverageClock, kMetricAvgSocClockFrequency,
+                      "average_socclk_frequency", m_average_socclk_frequency, average_socclk_frequency),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v11_t, kGpuMetricAverageClock, kMetricAvgUClockFrequency,
+                      "average_uclk_frequency", m_average_uclk_frequency, average_uclk_frequency),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v11_t, kGpuMetricAverageClock, kMetricAvgVClock0Frequency,
+                      "average_vclk0_frequency", m_average_vclk0_frequency, average_vclk0_frequency),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v11_t, kGpuMetricAverageClock, kMetricAvgDClock0Frequency,
+                      "average_dclk0_frequency", m_average_dclk0_frequency, average_dclk0_frequency),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v11_t, kGpuMetricAverageClock, kMetricAvgVClock1Frequency,
+                      "average_vclk1_frequency", m_average_vclk1_frequency, average_vclk1_frequency),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v11_t, kGpuMetricAverageClock, kMetricAvgDClock1Frequency,
+                      "average_dclk1_frequency", m_average_dclk1_frequency, average_dclk1_frequency),
+
+  // CurrentClock Info
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v11_t, kGpuMetricCurrentClock, kMetricCurrGfxClock,
+                      "current_gfxclk", m_current_gfxclk, current_gfxclk),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v11_t, kGpuMetricCurrentClock, kMetricCurrSocClock,
+                      "current_socclk", m_current_socclk, current_socclk),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v11_t, kGpuMetricCurrentClock, kMetricCurrUClock,
+                      "current_uclk", m_current_uclk, current_uclk),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v11_t, kGpuMetricCurrentClock, kMetricCurrVClock0,
+                      "current_vclk0", m_current_vclk0, current_vclk0),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v11_t, kGpuMetricCurrentClock, kMetricCurrDClock0,
+                      "current_dclk0", m_current_dclk0, current_dclk0),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v11_t, kGpuMetricCurrentClock, kMetricCurrVClock1,
+                      "current_vclk1", m_current_vclk1, current_vclk1),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v11_t, kGpuMetricCurrentClock, kMetricCurrDClock1,
+                      "current_dclk1", m_current_dclk1, current_dclk1),
+
+  // Link/Width/Speed Info
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v11_t, kGpuMetricLinkWidthSpeed, kMetricPcieLinkWidth,
+                      "pcie_link_width", m_pcie_link_width, pcie_link_width),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v11_t, kGpuMetricLinkWidthSpeed, kMetricPcieLinkSpeed,
+                      "pcie_link_speed", m_pcie_link_speed, pcie_link_speed),
+};
+
+constexpr AMDGpuMetricFieldDesc_t kAMDGpuMetricFields_v12[] = {
+  // Temperature Info
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v12_t, kGpuMetricTemperature, kMetricTempEdge,
+                      "temperature_edge", m_temperature_edge, temperature_edge),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v12_t, kGpuMetricTemperature, kMetricTempHotspot,
+                      "temperature_hotspot", m_temperature_hotspot, temperature_hotspot),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v12_t, kGpuMetricTemperature, kMetricTempMem,
+                      "temperature_mem", m_temperature_mem, temperature_mem),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v12_t, kGpuMetricTemperature, kMetricTempVrGfx,
+                      "temperature_vrgfx", m_temperature_vrgfx, temperature_vrgfx),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v12_t, kGpuMetricTemperature, kMetricTempVrSoc,
+                      "temperature_vrsoc", m_temperature_vrsoc, temperature_vrsoc),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v12_t, kGpuMetricTemperature, kMetricTempVrMem,
+                      "temperature_vrmem", m_temperature_vrmem, temperature_vrmem),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v12_t, kGpuMetricTemperature, kMetricTempHbm,
+                      "[temperature_hbm]", m_temperature_hbm, temperature_hbm),
+
+  // Power/Energy Info
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v12_t, kGpuMetricPowerEnergy, kMetricAvgSocketPower,
+                      "average_socket_power", m_average_socket_power, average_socket_power),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v12_t, kGpuMetricPowerEnergy, kMetricEnergyAccumulator,
+                      "energy_acc", m_energy_accumulator, energy_accumulator),
+
+  // Utilization Info
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v12_t, kGpuMetricUtilization, kMetricAvgGfxActivity,
+                      "average_gfx_activity", m_average_gfx_activity, average_gfx_activity),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v12_t, kGpuMetricUtilization, kMetricAvgUmcActivity,
+                      "average_umc_activity", m_average_umc_activity, average_umc_activity),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v12_t, kGpuMetricUtilization, kMetricAvgMmActivity,
+                      "average_mm_activity", m_average_mm_activity, average_mm_activity),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v12_t, kGpuMetricUtilization, kMetricGfxActivityAccumulator,
+                      "gfx_activity_acc", m_gfx_activity_acc, gfx_activity_acc),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v12_t, kGpuMetricUtilization, kMetricMemActivityAccumulator,
+                      "mem_activity_acc", m_mem_activity_acc, mem_activity_acc),
+
+  // Timestamp Info
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v12_t, kGpuMetricTimestamp, kMetricTSFirmware,
+                      "firmware_timestamp", m_firmware_timestamp, firmware_timestamp),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v12_t, kGpuMetricTimestamp, kMetricTSClockCounter,
+                      "system_clock_counter", m_system_clock_counter, system_clock_counter),
+
+  // Fan Info
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v12_t, kGpuMetricCurrentFanSpeed, kMetricCurrFanSpeed,
+                      "current_fan_speed", m_current_fan_speed, current_fan_speed),
+
+  // Throttle Info
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v12_t, kGpuMetricThrottleStatus, kMetricThrottleStatus,
+                      "throttle_status", m_throttle_status, throttle_status),
+
+  // Average Info
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v12_t, kGpuMetricAverageClock, kMetricAvgGfxClockFrequency,
+                      "average_gfxclk_frequency", m_average_gfxclk_frequency, average_gfxclk_frequency),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v12_t, kGpuMetricAverageClock, kMetricAvgSocClockFrequency,
+                      "average_socclk_frequency", m_average_socclk_frequency, average_socclk_frequency),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v12_t, kGpuMetricAverageClock, kMetricAvgUClockFrequency,
+                      "average_uclk_frequency", m_average_uclk_frequency, average_uclk_frequency),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v12_t, kGpuMetricAverageClock, kMetricAvgVClock0Frequency,
+                      "average_vclk0_frequency", m_average_vclk0_frequency, average_vclk0_frequency),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v12_t, kGpuMetricAverageClock, kMetricAvgDClock0Frequency,
+                      "average_dclk0_frequency", m_average_dclk0_frequency, average_dclk0_frequency),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v12_t, kGpuMetricAverageClock, kMetricAvgVClock1Frequency,
+                      "average_vclk1_frequency", m_average_vclk1_frequency, average_vclk1_frequency),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v12_t, kGpuMetricAverageClock, kMetricAvgDClock1Frequency,
+                      "average_dclk1_frequency", m_average_dclk1_frequency, average_dclk1_frequency),
+
+  // CurrentClock Info
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v12_t, kGpuMetricCurrentClock, kMetricCurrGfxClock,
+                      "current_gfxclk", m_current_gfxclk, current_gfxclk),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v12_t, kGpuMetricCurrentClock, kMetricCurrSocClock,
+                      "current_socclk", m_current_socclk, current_socclk),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v12_t, kGpuMetricCurrentClock, kMetricCurrUClock,
+                      "current_uclk", m_current_uclk, current_uclk),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v12_t, kGpuMetricCurrentClock, kMetricCurrVClock0,
+                      "current_vclk0", m_current_vclk0, current_vclk0),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v12_t, kGpuMetricCurrentClock, kMetricCurrDClock0,
+                      "current_dclk0", m_current_dclk0, current_dclk0),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v12_t, kGpuMetricCurrentClock, kMetricCurrVClock1,
+                      "current_vclk1", m_current_vclk1, current_vclk1),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v12_t, kGpuMetricCurrentClock, kMetricCurrDClock1,
+                      "current_dclk1", m_current_dclk1, current_dclk1),
+
+  // Link/Width/Speed Info
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v12_t, kGpuMetricLinkWidthSpeed, kMetricPcieLinkWidth,
+                      "pcie_link_width", m_pcie_link_width, pcie_link_width),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v12_t, kGpuMetricLinkWidthSpeed, kMetricPcieLinkSpeed,
+                      "pcie_link_speed", m_pcie_link_speed, pcie_link_speed),
+};
+
+constexpr AMDGpuMetricFieldDesc_t kAMDGpuMetricFields_v13[] = {
+  // Temperature Info
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v13_t, kGpuMetricTemperature, kMetricTempEdge,
+                      "temperature_edge", m_temperature_edge, temperature_edge),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v13_t, kGpuMetricTemperature, kMetricTempHotspot,
+                      "temperature_hotspot", m_temperature_hotspot, temperature_hotspot),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v13_t, kGpuMetricTemperature, kMetricTempMem,
+                      "temperature_mem", m_temperature_mem, temperature_mem),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v13_t, kGpuMetricTemperature, kMetricTempVrGfx,
+                      "temperature_vrgfx", m_temperature_vrgfx, temperature_vrgfx),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v13_t, kGpuMetricTemperature, kMetricTempVrSoc,
+                      "temperature_vrsoc", m_temperature_vrsoc, temperature_vrsoc),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v13_t, kGpuMetricTemperature, kMetricTempVrMem,
+                      "temperature_vrmem", m_temperature_vrmem, temperature_vrmem),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v13_t, kGpuMetricTemperature, kMetricTempHbm,
+                      "[temperature_hbm]", m_temperature_hbm, temperature_hbm),
+
+  // Power/Energy Info
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v13_t, kGpuMetricPowerEnergy, kMetricAvgSocketPower,
+                      "average_socket_power", m_average_socket_power, average_socket_power),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v13_t, kGpuMetricPowerEnergy, kMetricEnergyAccumulator,
+                      "energy_acc", m_energy_accumulator, energy_accumulator),
+
+  // Utilization Info
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v13_t, kGpuMetricUtilization, kMetricAvgGfxActivity,
+                      "average_gfx_activity", m_average_gfx_activity, average_gfx_activity),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v13_t, kGpuMetricUtilization, kMetricAvgUmcActivity,
+                      "average_umc_activity", m_average_umc_activity, average_umc_activity),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v13_t, kGpuMetricUtilization, kMetricAvgMmActivity,
+                      "average_mm_activity", m_average_mm_activity, average_mm_activity),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v13_t, kGpuMetricUtilization, kMetricGfxActivityAccumulator,
+                      "gfx_activity_acc", m_gfx_activity_acc, gfx_activity_acc),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v13_t, kGpuMetricUtilization, kMetricMemActivityAccumulator,
+                      "mem_activity_acc", m_mem_activity_acc, mem_activity_acc),
+
+  // Timestamp Info
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v13_t, kGpuMetricTimestamp, kMetricTSFirmware,
+                      "firmware_timestamp", m_firmware_timestamp, firmware_timestamp),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v13_t, kGpuMetricTimestamp, kMetricTSClockCounter,
+                      "system_clock_counter", m_system_clock_counter, system_clock_counter),
+
+  // Fan Info
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v13_t, kGpuMetricCurrentFanSpeed, kMetricCurrFanSpeed,
+                      "current_fan_speed", m_current_fan_speed, current_fan_speed),
+
+  // Throttle Info
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v13_t, kGpuMetricThrottleStatus, kMetricThrottleStatus,
+                      "throttle_status", m_throttle_status, throttle_status),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v13_t, kGpuMetricThrottleStatus, kMetricIndepThrottleStatus,
+                      "indep_throttle_status", m_indep_throttle_status, indep_throttle_status),
+
+  // Average Info
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v13_t, kGpuMetricAverageClock, kMetricAvgGfxClockFrequency,
+                      "average_gfxclk_frequency", m_average_gfxclk_frequency, average_gfxclk_frequency),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v13_t, kGpuMetricAverageClock, kMetricAvgSocClockFrequency,
+                      "average_socclk_frequency", m_average_socclk_frequency, average_socclk_frequency),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v13_t, kGpuMetricAverageClock, kMetricAvgUClockFrequency,
+                      "average_uclk_frequency", m_average_uclk_frequency, average_uclk_frequency),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v13_t, kGpuMetricAverageClock, kMetricAvgVClock0Frequency,
+                      "average_vclk0_frequency", m_average_vclk0_frequency, average_vclk0_frequency),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v13_t, kGpuMetricAverageClock, kMetricAvgDClock0Frequency,
+                      "average_dclk0_frequency", m_average_dclk0_frequency, average_dclk0_frequency),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v13_t, kGpuMetricAverageClock, kMetricAvgVClock1Frequency,
+                      "average_vclk1_frequency", m_average_vclk1_frequency, average_vclk1_frequency),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v13_t, kGpuMetricAverageClock, kMetricAvgDClock1Frequency,
+                      "average_dclk1_frequency", m_average_dclk1_frequency, average_dclk1_frequency),
+
+  // CurrentClock Info
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v13_t, kGpuMetricCurrentClock, kMetricCurrGfxClock,
+                      "current_gfxclk", m_current_gfxclk, current_gfxclk),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v13_t, kGpuMetricCurrentClock, kMetricCurrSocClock,
+                      "current_socclk", m_current_socclk, current_socclk),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v13_t, kGpuMetricCurrentClock, kMetricCurrUClock,
+                      "current_uclk", m_current_uclk, current_uclk),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v13_t, kGpuMetricCurrentClock, kMetricCurrVClock0,
+                      "current_vclk0", m_current_vclk0, current_vclk0),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v13_t, kGpuMetricCurrentClock, kMetricCurrDClock0,
+                      "current_dclk0", m_current_dclk0, current_dclk0),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v13_t, kGpuMetricCurrentClock, kMetricCurrVClock1,
+                      "current_vclk1", m_current_vclk1, current_vclk1),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v13_t, kGpuMetricCurrentClock, kMetricCurrDClock1,
+                      "current_dclk1", m_current_dclk1, current_dclk1),
+
+  // Link/Width/Speed Info
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v13_t, kGpuMetricLinkWidthSpeed, kMetricPcieLinkWidth,
+                      "pcie_link_width", m_pcie_link_width, pcie_link_width),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v13_t, kGpuMetricLinkWidthSpeed, kMetricPcieLinkSpeed,
+                      "pcie_link_speed", m_pcie_link_speed, pcie_link_speed),
+
+  // Voltage Info
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v13_t, kGpuMetricVoltage, kMetricVoltageSoc,
+                      "voltage_soc", m_voltage_soc, voltage_soc),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v13_t, kGpuMetricVoltage, kMetricVoltageGfx,
+                      "voltage_gfx", m_voltage_gfx, voltage_gfx),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v13_t, kGpuMetricVoltage, kMetricVoltageMem,
+                      "voltage_mem", m_voltage_mem, voltage_mem),
+
+  // CurrentClock Info (first clock of each domain)
+  AMDGPU_METRIC_PUBLIC_FIELD(AMDGpuMetrics_v13_t, m_current_gfxclk, current_gfxclks[0]),
+  AMDGPU_METRIC_PUBLIC_FIELD(AMDGpuMetrics_v13_t, m_current_socclk, current_socclks[0]),
+  AMDGPU_METRIC_PUBLIC_FIELD(AMDGpuMetrics_v13_t, m_current_vclk0, current_vclk0s[0]),
+  AMDGPU_METRIC_PUBLIC_FIELD(AMDGpuMetrics_v13_t, m_current_dclk0, current_dclk0s[0]),
+
+  //  Note: average_mm_activity is also reported as vcn activity
+  AMDGPU_METRIC_PUBLIC_FIELD(AMDGpuMetrics_v13_t, m_average_mm_activity, vcn_activity[0]),
+  AMDGPU_METRIC_PUBLIC_FIELD(AMDGpuMetrics_v13_t, m_average_mm_activity, xcp_stats[0].vcn_busy[0]),
+};
+
+constexpr AMDGpuMetricFieldDesc_t kAMDGpuMetricFields_v14[] = {
+  // Temperature Info
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v14_t, kGpuMetricTemperature, kMetricTempHotspot,
+                      "temperature_hotspot", m_temperature_hotspot, temperature_hotspot),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v14_t, kGpuMetricTemperature, kMetricTempMem,
+                      "temperature_mem", m_temperature_mem, temperature_mem),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v14_t, kGpuMetricTemperature, kMetricTempVrSoc,
+                      "temperature_vrsoc", m_temperature_vrsoc, temperature_vrsoc),
+
+  // Power/Energy Info
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v14_t, kGpuMetricPowerEnergy, kMetricCurrSocketPower,
+                      "curr_socket_power", m_current_socket_power, current_socket_power),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v14_t, kGpuMetricPowerEnergy, kMetricEnergyAccumulator,
+                      "energy_acc", m_energy_accumulator, energy_accumulator),
+
+  // Utilization Info
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v14_t, kGpuMetricUtilization, kMetricAvgGfxActivity,
+                      "average_gfx_activity", m_average_gfx_activity, average_gfx_activity),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v14_t, kGpuMetricUtilization, kMetricAvgUmcActivity,
+                      "average_umc_activity", m_average_umc_activity, average_umc_activity),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v14_t, kGpuMetricUtilization, kMetricVcnActivity,
+                      "[average_vcn_activity]", m_vcn_activity, vcn_activity),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v14_t, kGpuMetricUtilization, kMetricGfxActivityAccumulator,
+                      "gfx_activity_acc", m_gfx_activity_acc, gfx_activity_acc),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v14_t, kGpuMetricUtilization, kMetricMemActivityAccumulator,
+                      "mem_activity_acc", m_mem_activity_acc, mem_activity_acc),
+
+  // Timestamp Info
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v14_t, kGpuMetricTimestamp, kMetricTSFirmware,
+                      "firmware_timestamp", m_firmware_timestamp, firmware_timestamp),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v14_t, kGpuMetricTimestamp, kMetricTSClockCounter,
+                      "system_clock_counter", m_system_clock_counter, system_clock_counter),
+
+  // Throttle Info
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v14_t, kGpuMetricThrottleStatus, kMetricThrottleStatus,
+                      "throttle_status", m_throttle_status, throttle_status),
+
+  // GfxLock Info
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v14_t, kGpuMetricGfxClkLockStatus, kMetricGfxClkLockStatus,
+                      "gfxclk_lock_status", m_gfxclk_lock_status, gfxclk_lock_status),
+
+  // Link/Width/Speed Info
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v14_t, kGpuMetricLinkWidthSpeed, kMetricPcieLinkWidth,
+                      "pcie_link_width", m_pcie_link_width, pcie_link_width),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v14_t, kGpuMetricLinkWidthSpeed, kMetricPcieLinkSpeed,
+                      "pcie_link_speed", m_pcie_link_speed, pcie_link_speed),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v14_t, kGpuMetricLinkWidthSpeed, kMetricXgmiLinkWidth,
+                      "xgmi_link_width", m_xgmi_link_width, xgmi_link_width),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v14_t, kGpuMetricLinkWidthSpeed, kMetricXgmiLinkSpeed,
+                      "xgmi_link_speed", m_xgmi_link_speed, xgmi_link_speed),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v14_t, kGpuMetricLinkWidthSpeed, kMetricPcieBandwidthAccumulator,
+                      "pcie_bandwidth_acc", m_pcie_bandwidth_acc, pcie_bandwidth_acc),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v14_t, kGpuMetricLinkWidthSpeed, kMetricPcieBandwidthInst,
+                      "pcie_bandwidth_inst", m_pcie_bandwidth_inst, pcie_bandwidth_inst),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v14_t, kGpuMetricLinkWidthSpeed, kMetricPcieL0RecovCountAccumulator,
+                      "pcie_l0_recov_count_acc", m_pcie_l0_to_recov_count_acc, pcie_l0_to_recov_count_acc),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v14_t, kGpuMetricLinkWidthSpeed, kMetricPcieReplayCountAccumulator,
+                      "pcie_replay_count_acc", m_pcie_replay_count_acc, pcie_replay_count_acc),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v14_t, kGpuMetricLinkWidthSpeed, kMetricPcieReplayRollOverCountAccumulator,
+                      "pcie_replay_rollover_count_acc", m_pcie_replay_rover_count_acc, pcie_replay_rover_count_acc),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v14_t, kGpuMetricLinkWidthSpeed, kMetricXgmiReadDataAccumulator,
+                      "[xgmi_read_data_acc]", m_xgmi_read_data_acc, xgmi_read_data_acc),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v14_t, kGpuMetricLinkWidthSpeed, kMetricXgmiWriteDataAccumulator,
+                      "[xgmi_write_data_acc]", m_xgmi_write_data_acc, xgmi_write_data_acc),
+
+  // CurrentClock Info
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v14_t, kGpuMetricCurrentClock, kMetricCurrGfxClock,
+                      "[current_gfxclk]", m_current_gfxclk, current_gfxclks),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v14_t, kGpuMetricCurrentClock, kMetricCurrSocClock,
+                      "[current_socclk]", m_current_socclk, current_socclks),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v14_t, kGpuMetricCurrentClock, kMetricCurrVClock0,
+                      "[current_vclk0]", m_current_vclk0, current_vclk0s),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v14_t, kGpuMetricCurrentClock, kMetricCurrDClock0,
+                      "[current_dclk0]", m_current_dclk0, current_dclk0s),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v14_t, kGpuMetricCurrentClock, kMetricCurrUClock,
+                      "current_uclk", m_current_uclk, current_uclk),
+
+  AMDGPU_METRIC_LEGACY_CLOCK_FIELDS(AMDGpuMetrics_v14_t),
+};
+
+constexpr AMDGpuMetricFieldDesc_t kAMDGpuMetricFields_v15[] = {
+  // Temperature Info
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v15_t, kGpuMetricTemperature, kMetricTempHotspot,
+                      "temperature_hotspot", m_temperature_hotspot, temperature_hotspot),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v15_t, kGpuMetricTemperature, kMetricTempMem,
+                      "temperature_mem", m_temperature_mem, temperature_mem),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v15_t, kGpuMetricTemperature, kMetricTempVrSoc,
+                      "temperature_vrsoc", m_temperature_vrsoc, temperature_vrsoc),
+
+  // Power/Energy Info
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v15_t, kGpuMetricPowerEnergy, kMetricCurrSocketPower,
+                      "curr_socket_power", m_current_socket_power, current_socket_power),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v15_t, kGpuMetricPowerEnergy, kMetricEnergyAccumulator,
+                      "energy_acc", m_energy_accumulator, energy_accumulator),
+
+  // Utilization Info
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v15_t, kGpuMetricUtilization, kMetricAvgGfxActivity,
+                      "average_gfx_activity", m_average_gfx_activity, average_gfx_activity),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v15_t, kGpuMetricUtilization, kMetricAvgUmcActivity,
+                      "average_umc_activity", m_average_umc_activity, average_umc_activity),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v15_t, kGpuMetricUtilization, kMetricVcnActivity,
+                      "[average_vcn_activity]", m_vcn_activity, vcn_activity),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v15_t, kGpuMetricUtilization, kMetricJpegActivity,
+                      "[average_jpeg_activity]", m_jpeg_activity, jpeg_activity),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v15_t, kGpuMetricUtilization, kMetricGfxActivityAccumulator,
+                      "gfx_activity_acc", m_gfx_activity_acc, gfx_activity_acc),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v15_t, kGpuMetricUtilization, kMetricMemActivityAccumulator,
+                      "mem_activity_acc", m_mem_activity_acc, mem_activity_acc),
+
+  // Timestamp Info
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v15_t, kGpuMetricTimestamp, kMetricTSFirmware,
+                      "firmware_timestamp", m_firmware_timestamp, firmware_timestamp),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v15_t, kGpuMetricTimestamp, kMetricTSClockCounter,
+                      "system_clock_counter", m_system_clock_counter, system_clock_counter),
+
+  // Throttle Info
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v15_t, kGpuMetricThrottleStatus, kMetricThrottleStatus,
+                      "throttle_status", m_throttle_status, throttle_status),
+
+  // GfxLock Info
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v15_t, kGpuMetricGfxClkLockStatus, kMetricGfxClkLockStatus,
+                      "gfxclk_lock_status", m_gfxclk_lock_status, gfxclk_lock_status),
+
+  // Link/Width/Speed Info
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v15_t, kGpuMetricLinkWidthSpeed, kMetricPcieLinkWidth,
+                      "pcie_link_width", m_pcie_link_width, pcie_link_width),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v15_t, kGpuMetricLinkWidthSpeed, kMetricPcieLinkSpeed,
+                      "pcie_link_speed", m_pcie_link_speed, pcie_link_speed),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v15_t, kGpuMetricLinkWidthSpeed, kMetricXgmiLinkWidth,
+                      "xgmi_link_width", m_xgmi_link_width, xgmi_link_width),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v15_t, kGpuMetricLinkWidthSpeed, kMetricXgmiLinkSpeed,
+                      "xgmi_link_speed", m_xgmi_link_speed, xgmi_link_speed),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v15_t, kGpuMetricLinkWidthSpeed, kMetricPcieBandwidthAccumulator,
+                      "pcie_bandwidth_acc", m_pcie_bandwidth_acc, pcie_bandwidth_acc),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v15_t, kGpuMetricLinkWidthSpeed, kMetricPcieBandwidthInst,
+                      "pcie_bandwidth_inst", m_pcie_bandwidth_inst, pcie_bandwidth_inst),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v15_t, kGpuMetricLinkWidthSpeed, kMetricPcieL0RecovCountAccumulator,
+                      "pcie_l0_recov_count_acc", m_pcie_l0_to_recov_count_acc, pcie_l0_to_recov_count_acc),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v15_t, kGpuMetricLinkWidthSpeed, kMetricPcieReplayCountAccumulator,
+                      "pcie_replay_count_acc", m_pcie_replay_count_acc, pcie_replay_count_acc),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v15_t, kGpuMetricLinkWidthSpeed, kMetricPcieReplayRollOverCountAccumulator,
+                      "pcie_replay_rollover_count_acc", m_pcie_replay_rover_count_acc, pcie_replay_rover_count_acc),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v15_t, kGpuMetricLinkWidthSpeed, kMetricPcieNakSentCountAccumulator,
+                      "pcie_nak_sent_count_acc", m_pcie_nak_sent_count_acc, pcie_nak_sent_count_acc),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v15_t, kGpuMetricLinkWidthSpeed, kMetricPcieNakReceivedCountAccumulator,
+                      "pcie_nak_rcvd_count_acc", m_pcie_nak_rcvd_count_acc, pcie_nak_rcvd_count_acc),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v15_t, kGpuMetricLinkWidthSpeed, kMetricXgmiReadDataAccumulator,
+                      "[xgmi_read_data_acc]", m_xgmi_read_data_acc, xgmi_read_data_acc),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v15_t, kGpuMetricLinkWidthSpeed, kMetricXgmiWriteDataAccumulator,
+                      "[xgmi_write_data_acc]", m_xgmi_write_data_acc, xgmi_write_data_acc),
+
+  // CurrentClock Info
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v15_t, kGpuMetricCurrentClock, kMetricCurrGfxClock,
+                      "[current_gfxclk]", m_current_gfxclk, current_gfxclks),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v15_t, kGpuMetricCurrentClock, kMetricCurrSocClock,
+                      "[current_socclk]", m_current_socclk, current_socclks),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v15_t, kGpuMetricCurrentClock, kMetricCurrVClock0,
+                      "[current_vclk0]", m_current_vclk0, current_vclk0s),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v15_t, kGpuMetricCurrentClock, kMetricCurrDClock0,
+                      "[current_dclk0]", m_current_dclk0, current_dclk0s),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v15_t, kGpuMetricCurrentClock, kMetricCurrUClock,
+                      "current_uclk", m_current_uclk, current_uclk),
+
+  AMDGPU_METRIC_LEGACY_CLOCK_FIELDS(AMDGpuMetrics_v15_t),
+};
+
+constexpr AMDGpuMetricFieldDesc_t kAMDGpuMetricFields_v16[] = {
+  // Temperature Info
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v16_t, kGpuMetricTemperature, kMetricTempHotspot,
+                      "temperature_hotspot", m_temperature_hotspot, temperature_hotspot),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v16_t, kGpuMetricTemperature, kMetricTempMem,
+                      "temperature_mem", m_temperature_mem, temperature_mem),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v16_t, kGpuMetricTemperature, kMetricTempVrSoc,
+                      "temperature_vrsoc", m_temperature_vrsoc, temperature_vrsoc),
+
+  // Power/Energy Info
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v16_t, kGpuMetricPowerEnergy, kMetricCurrSocketPower,
+                      "curr_socket_power", m_current_socket_power, current_socket_power),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v16_t, kGpuMetricPowerEnergy, kMetricEnergyAccumulator,
+                      "energy_acc", m_energy_accumulator, energy_accumulator),
+
+  // Utilization Info
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v16_t, kGpuMetricUtilization, kMetricAvgGfxActivity,
+                      "average_gfx_activity", m_average_gfx_activity, average_gfx_activity),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v16_t, kGpuMetricUtilization, kMetricAvgUmcActivity,
+                      "average_umc_activity", m_average_umc_activity, average_umc_activity),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v16_t, kGpuMetricUtilization, kMetricGfxActivityAccumulator,
+                      "gfx_activity_acc", m_gfx_activity_acc, gfx_activity_acc),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v16_t, kGpuMetricUtilization, kMetricMemActivityAccumulator,
+                      "mem_activity_acc", m_mem_activity_acc, mem_activity_acc),
+
+  // Timestamp Info
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v16_t, kGpuMetricTimestamp, kMetricTSFirmware,
+                      "firmware_timestamp", m_firmware_timestamp, firmware_timestamp),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v16_t, kGpuMetricTimestamp, kMetricTSClockCounter,
+                      "system_clock_counter", m_system_clock_counter, system_clock_counter),
+
+  // GfxLock Info
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v16_t, kGpuMetricGfxClkLockStatus, kMetricGfxClkLockStatus,
+                      "gfxclk_lock_status", m_gfxclk_lock_status, gfxclk_lock_status),
+
+  // Link/Width/Speed Info
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v16_t, kGpuMetricLinkWidthSpeed, kMetricPcieLinkWidth,
+                      "pcie_link_width", m_pcie_link_width, pcie_link_width),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v16_t, kGpuMetricLinkWidthSpeed, kMetricPcieLinkSpeed,
+                      "pcie_link_speed", m_pcie_link_speed, pcie_link_speed),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v16_t, kGpuMetricLinkWidthSpeed, kMetricXgmiLinkWidth,
+                      "xgmi_link_width", m_xgmi_link_width, xgmi_link_width),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v16_t, kGpuMetricLinkWidthSpeed, kMetricXgmiLinkSpeed,
+                      "xgmi_link_speed", m_xgmi_link_speed, xgmi_link_speed),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v16_t, kGpuMetricLinkWidthSpeed, kMetricPcieBandwidthAccumulator,
+                      "pcie_bandwidth_acc", m_pcie_bandwidth_acc, pcie_bandwidth_acc),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v16_t, kGpuMetricLinkWidthSpeed, kMetricPcieBandwidthInst,
+                      "pcie_bandwidth_inst", m_pcie_bandwidth_inst, pcie_bandwidth_inst),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v16_t, kGpuMetricLinkWidthSpeed, kMetricPcieL0RecovCountAccumulator,
+                      "pcie_l0_recov_count_acc", m_pcie_l0_to_recov_count_acc, pcie_l0_to_recov_count_acc),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v16_t, kGpuMetricLinkWidthSpeed, kMetricPcieReplayCountAccumulator,
+                      "pcie_replay_count_acc", m_pcie_replay_count_acc, pcie_replay_count_acc),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v16_t, kGpuMetricLinkWidthSpeed, kMetricPcieReplayRollOverCountAccumulator,
+                      "pcie_replay_rollover_count_acc", m_pcie_replay_rover_count_acc, pcie_replay_rover_count_acc),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v16_t, kGpuMetricLinkWidthSpeed, kMetricPcieNakSentCountAccumulator,
+                      "pcie_nak_sent_count_acc", m_pcie_nak_sent_count_acc, pcie_nak_sent_count_acc),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v16_t, kGpuMetricLinkWidthSpeed, kMetricPcieNakReceivedCountAccumulator,
+                      "pcie_nak_rcvd_count_acc", m_pcie_nak_rcvd_count_acc, pcie_nak_rcvd_count_acc),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v16_t, kGpuMetricLinkWidthSpeed, kMetricXgmiReadDataAccumulator,
+                      "[xgmi_read_data_acc]", m_xgmi_read_data_acc, xgmi_read_data_acc),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v16_t, kGpuMetricLinkWidthSpeed, kMetricXgmiWriteDataAccumulator,
+                      "[xgmi_write_data_acc]", m_xgmi_write_data_acc, xgmi_write_data_acc),
+
+  // CurrentClock Info
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v16_t, kGpuMetricCurrentClock, kMetricCurrGfxClock,
+                      "[current_gfxclk]", m_current_gfxclk, current_gfxclks),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v16_t, kGpuMetricCurrentClock, kMetricCurrSocClock,
+                      "[current_socclk]", m_current_socclk, current_socclks),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v16_t, kGpuMetricCurrentClock, kMetricCurrVClock0,
+                      "[current_vclk0]", m_current_vclk0, current_vclk0s),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v16_t, kGpuMetricCurrentClock, kMetricCurrDClock0,
+                      "[current_dclk0]", m_current_dclk0, current_dclk0s),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v16_t, kGpuMetricCurrentClock, kMetricCurrUClock,
+                      "current_uclk", m_current_uclk, current_uclk),
+
+  /* Accumulation cycle counter */
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v16_t, kGpuMetricThrottleResidency, kMetricAccumulationCounter,
+                      "accumulation_counter", m_accumulation_counter, accumulation_counter),
+
+  /* Accumulated throttler residencies */
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v16_t, kGpuMetricThrottleResidency, kMetricProchotResidencyAccumulator,
+                      "prochot_residency_acc", m_prochot_residency_acc, prochot_residency_acc),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v16_t, kGpuMetricThrottleResidency, kMetricPPTResidencyAccumulator,
+                      "ppt_residency_acc", m_ppt_residency_acc, ppt_residency_acc),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v16_t, kGpuMetricThrottleResidency, kMetricSocketThmResidencyAccumulator,
+                      "socket_thm_residency_acc", m_socket_thm_residency_acc, socket_thm_residency_acc),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v16_t, kGpuMetricThrottleResidency, kMetricVRThmResidencyAccumulator,
+                      "vr_thm_residency_acc", m_vr_thm_residency_acc, vr_thm_residency_acc),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v16_t, kGpuMetricThrottleResidency, kMetricHBMThmResidencyAccumulator,
+                      "hbm_thm_residency_acc", m_hbm_thm_residency_acc, hbm_thm_residency_acc),
+
+  /* Partition info */
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v16_t, kGpuMetricPartition, kGpuMetricNumPartition,
+                      "num_partition", m_num_partition, num_partition),
+
+  /* xcp_stats info */
+  AMDGPU_METRIC_DYNAMIC_FIELD(AMDGpuMetrics_v16_t, kGpuMetricXcpStats, kMetricGfxBusyInst,
+                              "xcp_stats->gfx_busy_inst", m_xcp_stats[0].gfx_busy_inst),
+  AMDGPU_METRIC_DYNAMIC_FIELD(AMDGpuMetrics_v16_t, kGpuMetricXcpStats, kMetricVcnBusy,
+                              "xcp_stats->vcn_busy", m_xcp_stats[0].vcn_busy),
+  AMDGPU_METRIC_DYNAMIC_FIELD(AMDGpuMetrics_v16_t, kGpuMetricXcpStats, kMetricJpegBusy,
+                              "xcp_stats->jpeg_busy", m_xcp_stats[0].jpeg_busy),
+  AMDGPU_METRIC_DYNAMIC_FIELD(AMDGpuMetrics_v16_t, kGpuMetricXcpStats, kMetricGfxBusyAcc,
+                              "xcp_stats->gfx_busy_acc", m_xcp_stats[0].gfx_busy_acc),
+
+  /* PCIE other end recovery counter info */
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v16_t, kGpuMetricLinkWidthSpeed, kMetricPcieLCPerfOtherEndRecov,
+                      "pcie_lc_perf_other_end_recovery", m_pcie_lc_perf_other_end_recovery, pcie_lc_perf_other_end_recovery),
+
+  // XCP Stats (all partitions)
+  AMDGPU_METRIC_XCP_STATS_FIELDS(AMDGpuMetrics_v16_t, 0),
+  AMDGPU_METRIC_XCP_STATS_FIELDS(AMDGpuMetrics_v16_t, 1),
+  AMDGPU_METRIC_XCP_STATS_FIELDS(AMDGpuMetrics_v16_t, 2),
+  AMDGPU_METRIC_XCP_STATS_FIELDS(AMDGpuMetrics_v16_t, 3),
+  AMDGPU_METRIC_XCP_STATS_FIELDS(AMDGpuMetrics_v16_t, 4),
+  AMDGPU_METRIC_XCP_STATS_FIELDS(AMDGpuMetrics_v16_t, 5),
+  AMDGPU_METRIC_XCP_STATS_FIELDS(AMDGpuMetrics_v16_t, 6),
+  AMDGPU_METRIC_XCP_STATS_FIELDS(AMDGpuMetrics_v16_t, 7),
+
+  AMDGPU_METRIC_LEGACY_CLOCK_FIELDS(AMDGpuMetrics_v16_t),
+};
+
+constexpr AMDGpuMetricFieldDesc_t kAMDGpuMetricFields_v17[] = {
+  // Temperature Info
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v17_t, kGpuMetricTemperature, kMetricTempHotspot,
+                      "temperature_hotspot", m_temperature_hotspot, temperature_hotspot),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v17_t, kGpuMetricTemperature, kMetricTempMem,
+                      "temperature_mem", m_temperature_mem, temperature_mem),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v17_t, kGpuMetricTemperature, kMetricTempVrSoc,
+                      "temperature_vrsoc", m_temperature_vrsoc, temperature_vrsoc),
+
+  // Power/Energy Info
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v17_t, kGpuMetricPowerEnergy, kMetricCurrSocketPower,
+                      "curr_socket_power", m_current_socket_power, current_socket_power),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v17_t, kGpuMetricPowerEnergy, kMetricEnergyAccumulator,
+                      "energy_acc", m_energy_accumulator, energy_accumulator),
+
+  // Utilization Info
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v17_t, kGpuMetricUtilization, kMetricAvgGfxActivity,
+                      "average_gfx_activity", m_average_gfx_activity, average_gfx_activity),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v17_t, kGpuMetricUtilization, kMetricAvgUmcActivity,
+                      "average_umc_activity", m_average_umc_activity, average_umc_activity),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v17_t, kGpuMetricUtilization, kMetricGfxActivityAccumulator,
+                      "gfx_activity_acc", m_gfx_activity_acc, gfx_activity_acc),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v17_t, kGpuMetricUtilization, kMetricMemActivityAccumulator,
+                      "mem_activity_acc", m_mem_activity_acc, mem_activity_acc),
+
+  // Timestamp Info
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v17_t, kGpuMetricTimestamp, kMetricTSFirmware,
+                      "firmware_timestamp", m_firmware_timestamp, firmware_timestamp),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v17_t, kGpuMetricTimestamp, kMetricTSClockCounter,
+                      "system_clock_counter", m_system_clock_counter, system_clock_counter),
+
+  // GfxLock Info
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v17_t, kGpuMetricGfxClkLockStatus, kMetricGfxClkLockStatus,
+                      "gfxclk_lock_status", m_gfxclk_lock_status, gfxclk_lock_status),
+
+  // Link/Width/Speed Info
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v17_t, kGpuMetricLinkWidthSpeed, kMetricPcieLinkWidth,
+                      "pcie_link_width", m_pcie_link_width, pcie_link_width),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v17_t, kGpuMetricLinkWidthSpeed, kMetricPcieLinkSpeed,
+                      "pcie_link_speed", m_pcie_link_speed, pcie_link_speed),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v17_t, kGpuMetricLinkWidthSpeed, kMetricXgmiLinkWidth,
+                      "xgmi_link_width", m_xgmi_link_width, xgmi_link_width),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v17_t, kGpuMetricLinkWidthSpeed, kMetricXgmiLinkSpeed,
+                      "xgmi_link_speed", m_xgmi_link_speed, xgmi_link_speed),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v17_t, kGpuMetricLinkWidthSpeed, kMetricPcieBandwidthAccumulator,
+                      "pcie_bandwidth_acc", m_pcie_bandwidth_acc, pcie_bandwidth_acc),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v17_t, kGpuMetricLinkWidthSpeed, kMetricPcieBandwidthInst,
+                      "pcie_bandwidth_inst", m_pcie_bandwidth_inst, pcie_bandwidth_inst),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v17_t, kGpuMetricLinkWidthSpeed, kMetricPcieL0RecovCountAccumulator,
+                      "pcie_l0_recov_count_acc", m_pcie_l0_to_recov_count_acc, pcie_l0_to_recov_count_acc),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v17_t, kGpuMetricLinkWidthSpeed, kMetricPcieReplayCountAccumulator,
+                      "pcie_replay_count_acc", m_pcie_replay_count_acc, pcie_replay_count_acc),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v17_t, kGpuMetricLinkWidthSpeed, kMetricPcieReplayRollOverCountAccumulator,
+                      "pcie_replay_rollover_count_acc", m_pcie_replay_rover_count_acc, pcie_replay_rover_count_acc),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v17_t, kGpuMetricLinkWidthSpeed, kMetricPcieNakSentCountAccumulator,
+                      "pcie_nak_sent_count_acc", m_pcie_nak_sent_count_acc, pcie_nak_sent_count_acc),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v17_t, kGpuMetricLinkWidthSpeed, kMetricPcieNakReceivedCountAccumulator,
+                      "pcie_nak_rcvd_count_acc", m_pcie_nak_rcvd_count_acc, pcie_nak_rcvd_count_acc),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v17_t, kGpuMetricLinkWidthSpeed, kMetricXgmiReadDataAccumulator,
+                      "[xgmi_read_data_acc]", m_xgmi_read_data_acc, xgmi_read_data_acc),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v17_t, kGpuMetricLinkWidthSpeed, kMetricXgmiWriteDataAccumulator,
+                      "[xgmi_write_data_acc]", m_xgmi_write_data_acc, xgmi_write_data_acc),
+  // new for v1.7
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v17_t, kGpuMetricLinkWidthSpeed, kMetricXgmiLinkStatus,
+                      "[xgmi_link_status]", m_xgmi_link_status, xgmi_link_status),
+  // CurrentClock Info
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v17_t, kGpuMetricCurrentClock, kMetricCurrGfxClock,
+                      "[current_gfxclk]", m_current_gfxclk, current_gfxclks),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v17_t, kGpuMetricCurrentClock, kMetricCurrSocClock,
+                      "[current_socclk]", m_current_socclk, current_socclks),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v17_t, kGpuMetricCurrentClock, kMetricCurrVClock0,
+                      "[current_vclk0]", m_current_vclk0, current_vclk0s),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v17_t, kGpuMetricCurrentClock, kMetricCurrDClock0,
+                      "[current_dclk0]", m_current_dclk0, current_dclk0s),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v17_t, kGpuMetricCurrentClock, kMetricCurrUClock,
+                      "current_uclk", m_current_uclk, current_uclk),
+
+  /* Accumulation cycle counter */
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v17_t, kGpuMetricThrottleResidency, kMetricAccumulationCounter,
+                      "accumulation_counter", m_accumulation_counter, accumulation_counter),
+
+  /* Accumulated throttler residencies */
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v17_t, kGpuMetricThrottleResidency, kMetricProchotResidencyAccumulator,
+                      "prochot_residency_acc", m_prochot_residency_acc, prochot_residency_acc),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v17_t, kGpuMetricThrottleResidency, kMetricPPTResidencyAccumulator,
+                      "ppt_residency_acc", m_ppt_residency_acc, ppt_residency_acc),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v17_t, kGpuMetricThrottleResidency, kMetricSocketThmResidencyAccumulator,
+                      "socket_thm_residency_acc", m_socket_thm_residency_acc, socket_thm_residency_acc),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v17_t, kGpuMetricThrottleResidency, kMetricVRThmResidencyAccumulator,
+                      "vr_thm_residency_acc", m_vr_thm_residency_acc, vr_thm_residency_acc),
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v17_t, kGpuMetricThrottleResidency, kMetricHBMThmResidencyAccumulator,
+                      "hbm_thm_residency_acc", m_hbm_thm_residency_acc, hbm_thm_residency_acc),
+
+  /* Partition info */
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v17_t, kGpuMetricPartition, kGpuMetricNumPartition,
+                      "num_partition", m_num_partition, num_partition),
+
+  /* xcp_stats info */
+  AMDGPU_METRIC_DYNAMIC_FIELD(AMDGpuMetrics_v17_t, kGpuMetricXcpStats, kMetricGfxBusyInst,
+                              "xcp_stats->gfx_busy_inst", m_xcp_stats[0].gfx_busy_inst),
+  AMDGPU_METRIC_DYNAMIC_FIELD(AMDGpuMetrics_v17_t, kGpuMetricXcpStats, kMetricVcnBusy,
+                              "xcp_stats->vcn_busy", m_xcp_stats[0].vcn_busy),
+  AMDGPU_METRIC_DYNAMIC_FIELD(AMDGpuMetrics_v17_t, kGpuMetricXcpStats, kMetricJpegBusy,
+                              "xcp_stats->jpeg_busy", m_xcp_stats[0].jpeg_busy),
+  AMDGPU_METRIC_DYNAMIC_FIELD(AMDGpuMetrics_v17_t, kGpuMetricXcpStats, kMetricGfxBusyAcc,
+                              "xcp_stats->gfx_busy_acc", m_xcp_stats[0].gfx_busy_acc),
+
+  /* PCIE other end recovery counter info */
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v17_t, kGpuMetricLinkWidthSpeed, kMetricPcieLCPerfOtherEndRecov,
+                      "pcie_lc_perf_other_end_recovery", m_pcie_lc_perf_other_end_recovery, pcie_lc_perf_other_end_recovery),
+
+  /* VRAM max bandwidth at max memory clock */
+  AMDGPU_METRIC_FIELD(AMDGpuMetrics_v17_t, kGpuMetricLinkWidthSpeed, kMetricVramMaxBandwidth,
+                      "vram_max_bandwidth", m_vram_max_bandwidth, vram_max_bandwidth),
+
+  /* Total App Clock Counter Accumulated */
+  AMDGPU_METRIC_DYNAMIC_FIELD(AMDGpuMetrics_v17_t, kGpuMetricThrottleResidency, kMetricGfxBelowHostLimitAccumulator,
+                              "gfx_below_host_limit_acc", m_xcp_stats[0].gfx_below_host_limit_acc),
+
+  // XCP Stats (all partitions)
+  AMDGPU_METRIC_XCP_STATS_V1_1_FIELDS(AMDGpuMetrics_v17_t, 0),
+  AMDGPU_METRIC_XCP_STATS_V1_1_FIELDS(AMDGpuMetrics_v17_t, 1),
+  AMDGPU_METRIC_XCP_STATS_V1_1_FIELDS(AMDGpuMetrics_v17_t, 2),
+  AMDGPU_METRIC_XCP_STATS_V1_1_FIELDS(AMDGpuMetrics_v17_t, 3),
+  AMDGPU_METRIC_XCP_STATS_V1_1_FIELDS(AMDGpuMetrics_v17_t, 4),
+  AMDGPU_METRIC_XCP_STATS_V1_1_FIELDS(AMDGpuMetrics_v17_t, 5),
+  AMDGPU_METRIC_XCP_STATS_V1_1_FIELDS(AMDGpuMetrics_v17_t, 6),
+  AMDGPU_METRIC_XCP_STATS_V1_1_FIELDS(AMDGpuMetrics_v17_t, 7),
+
+  AMDGPU_METRIC_LEGACY_CLOCK_FIELDS(AMDGpuMetrics_v17_t),
+};
+
+template<typename SrcT, typename DstT>
+void copy_metric_values(const SrcT* src, DstT* dst, uint16_t num_values)
+{
+  for (auto idx = uint16_t(0); idx < num_values; ++idx) {
+    dst[idx] = static_cast<DstT>(src[idx]);
+  }
+}
+
+template<typename SrcT>
+void copy_metric_values(const SrcT* src, void* dst, uint16_t dst_width, uint16_t num_values)
+{
+  switch (dst_width) {
+    case sizeof(uint8_t):
+      copy_metric_values(src, static_cast<uint8_t*>(dst), num_values);
+      break;
+    case sizeof(uint16_t):
+      copy_metric_values(src, static_cast<uint16_t*>(dst), num_values);
+      break;
+    case sizeof(uint32_t):
+      copy_metric_values(src, static_cast<uint32_t*>(dst), num_values);
+      break;
+    case sizeof(uint64_t):
+      copy_metric_values(src, static_cast<uint64_t*>(dst), num_values);
+      break;
+    default:
+      assert(false);
+  }
+}
+
+void copy_metric_values(const void* src, uint16_t src_width,
+                        void* dst, uint16_t dst_width, uint16_t num_values)
+{
+  switch (src_width) {
+    case sizeof(uint8_t):
+      copy_metric_values(static_cast<const uint8_t*>(src), dst, dst_width, num_values);
+      break;
+    case sizeof(uint16_t):
+      copy_metric_values(static_cast<const uint16_t*>(src), dst, dst_width, num_values);
+      break;
+    case sizeof(uint32_t):
+      copy_metric_values(static_cast<const uint32_t*>(src), dst, dst_width, num_values);
+      break;
+    case sizeof(uint64_t):
+      copy_metric_values(static_cast<const uint64_t*>(src), dst, dst_width, num_values);
+      break;
+    default:
+      assert(false);
+  }
+}
+
+AMDGpuMetricsDataType_t metric_field_data_type(uint16_t width)
+{
+  switch (width) {
+    case sizeof(uint8_t):
+      return AMDGpuMetricsDataType_t::kUInt8;
+    case sizeof(uint16_t):
+      return AMDGpuMetricsDataType_t::kUInt16;
+    case sizeof(uint32_t):
+      return AMDGpuMetricsDataType_t::kUInt32;
+    default:
+      return AMDGpuMetricsDataType_t::kUInt64;
+  }
+}
+
+template<typename MetricsTbl_t, size_t kNumFields>
+void GpuMetricsBase_t::decode_metrics_fields(const MetricsTbl_t& metrics_tbl,
+                                             const AMDGpuMetricFieldDesc_t (&metric_fields)[kNumFields])
+{
+  m_base_metrics_dynamic_tbl.clear();
+
+  //
+  //  Note: Initializing data members with their max. If field is max,
+  //        no data was assigned to it.
+  init_max_public_gpu_matrics(m_base_metrics_public);
+
+  // Header
+  m_base_metrics_public.common_header.structure_size = metrics_tbl.m_common_header.m_structure_size;
+  m_base_metrics_public.common_header.format_revision = metrics_tbl.m_common_header.m_format_revision;
+  m_base_metrics_public.common_header.content_revision = metrics_tbl.m_common_header.m_content_revision;
+
+  const auto metrics_bytes = reinterpret_cast<const uint8_t*>(&metrics_tbl);
+  auto public_bytes = reinterpret_cast<uint8_t*>(&m_base_metrics_public);
+  for (const auto& metric_field : metric_fields) {
+    const auto metric_values = (metrics_bytes + metric_field.m_offset);
+    if (metric_field.m_unit_id != kAMDGpuMetricsNoUnit) {
+      auto dynamic_values =
+        m_base_metrics_dynamic_tbl.add_metric_row(metric_field.m_class_id,
+                                                  metric_field.m_unit_id,
+                                                  metric_field_data_type(metric_field.m_width),
+                                                  metric_field.m_title,
+                                                  metric_field.m_num_values);
+      if (dynamic_values != nullptr) {
+        copy_metric_values(metric_values, metric_field.m_width,
+                           dynamic_values, sizeof(uint64_t), metric_field.m_num_values);
       }
-      return std::make_tuple(data_type, static_cast<uint16_t>(std::end(metric) - std::begin(metric)));
     }
 
-    const uint16_t kSingleValue(1);
-    if constexpr (std::is_same_v<T, std::uint8_t>) {
-      data_type = AMDGpuMetricsDataType_t::kUInt8;
-    }
-    if constexpr (std::is_same_v<T, std::uint16_t>) {
-      data_type = AMDGpuMetricsDataType_t::kUInt16;
-    }
-    if constexpr (std::is_same_v<T, std::uint32_t>) {
-      data_type = AMDGpuMetricsDataType_t::kUInt32;
-    }
-    if constexpr (std::is_same_v<T, std::uint64_t>) {
-      data_type = AMDGpuMetricsDataType_t::kUInt64;
+    if (metric_field.m_public_offset != kAMDGpuMetricsNoPublicField) {
+      copy_metric_values(metric_values, metric_field.m_width,
+                         (public_bytes + metric_field.m_public_offset),
+                         metric_field.m_public_width,
+                         std::min(metric_field.m_num_values, metric_field.m_public_num_values));
     }
-    return std::make_tuple(data_type, kSingleValue);
-  };
+  }
+}
 
-  const auto [data_type, num_values] = get_data_type_info();
-  for (auto idx = uint16_t(0); idx < num_values; ++idx) {
-    auto value = uint64_t(0);
-    if constexpr (std::is_array_v<T>) {
-      value = (metric[idx]);
-    } else {
-      value = (metric);
-    }
+AMGpuMetricsPublicLatestTupl_t GpuMetricsBase_t::copy_internal_to_external_metrics()
+{
+  std::ostringstream ss;
+  auto status_code(rsmi_status_t::RSMI_STATUS_SUCCESS);
+  ss << __PRETTY_FUNCTION__
+     << " | ======= end ======= "
+     << " | Success "
+     << " | Returning = " << getRSMIStatusString(status_code)
+     << " |";
+  LOG_TRACE(ss);
+
+  return std::make_tuple(status_code, m_base_metrics_public);
+}
+
+//
+//  Note: vcn/jpeg activity of the partition in use, when the partition
+//        reports them.
+template<typename XcpStats_t>
+void copy_partition_activity(const XcpStats_t& xcp_stats,
+                             AMGpuMetricsPublicLatest_t& metrics_public)
+{
+  if (xcp_stats.vcn_busy[0] != UINT16_MAX) {
+    std::copy(std::begin(xcp_stats.vcn_busy), std::end(xcp_stats.vcn_busy),
+              std::begin(metrics_public.vcn_activity));
+  }
+  if (xcp_stats.jpeg_busy[0] != UINT16_MAX) {
+    std::copy(std::begin(xcp_stats.jpeg_busy), std::end(xcp_stats.jpeg_busy),
+              std::begin(metrics_public.jpeg_activity));
+  }
+}
 
-    auto amdgpu_dynamic_metric_value = [&]() {
-      AMDGpuDynamicMetricsValue_t amdgpu_dynamic_metric_value_init{};
-      amdgpu_dynamic_metric_value_init.m_value = value;
-      amdgpu_dynamic_metric_value_init.m_info  = (value_title + " : " + std::to_string(idx));
-      amdgpu_dynamic_metric_value_init.m_original_type = data_type;
-      return amdgpu_dynamic_metric_value_init;
-    }();
+AMGpuMetricsPublicLatestTupl_t GpuMetricsBase_v17_t::copy_internal_to_external_metrics()
+{
+  std::ostringstream ss;
+  auto status_code(rsmi_status_t::RSMI_STATUS_SUCCESS);
+  ss << __PRETTY_FUNCTION__ << " | ======= start =======";
+  LOG_TRACE(ss);
 
-    multi_values.emplace_back(amdgpu_dynamic_metric_value);
+  auto metrics_public = m_base_metrics_public;
+  // separate by XCP
+  if (this->m_partition_id < kRSMI_MAX_NUM_XCP) {
+    copy_partition_activity(m_gpu_metrics_tbl.m_xcp_stats[this->m_partition_id], metrics_public);
   }
 
-  return multi_values;
+  ss << __PRETTY_FUNCTION__
+     << " | ======= end ======= "
+     << " | Success "
+     << " | Returning = " << getRSMIStatusString(status_code)
+     << " |";
+  LOG_TRACE(ss);
+
+  return std::make_tuple(status_code, metrics_public);
+}
+
+AMGpuMetricsPublicLatestTupl_t GpuMetricsBase_v16_t::copy_internal_to_external_metrics()
+{
+  std::ostringstream ss;
+  auto status_code(rsmi_status_t::RSMI_STATUS_SUCCESS);
+  ss << __PRETTY_FUNCTION__ << " | ======= start =======";
+  LOG_TRACE(ss);
+
+  auto metrics_public = m_base_metrics_public;
+  // separate by XCP
+  if (this->m_partition_id < kRSMI_MAX_NUM_XCP) {
+    copy_partition_activity(m_gpu_metrics_tbl.m_xcp_stats[this->m_partition_id], metrics_public);
+  }
+
+  ss << __PRETTY_FUNCTION__
+     << " | ======= end ======= "
+     << " | Success "
+     << " | Returning = " << getRSMIStatusString(status_code)
+     << " |";
+  LOG_TRACE(ss);
+
+  return std::make_tuple(status_code, metrics_public);
 }
 
 void GpuMetricsBase_v17_t::dump_internal_metrics_table()
@@ -869,7 +1773,6 @@ rsmi_status_t GpuMetricsBase_v17_t::populate_metrics_dynamic_tbl() {
   ss << __PRETTY_FUNCTION__ << " | ======= start =======";
   LOG_TRACE(ss);
 
-  auto m_metrics_dynamic_tbl = AMDGpuDynamicMetricsTbl_t{};
   //
   //  Note: Any metric treatment/changes (if any) should happen before they
   //        get written to internal/external tables.
@@ -898,214 +1801,7 @@ rsmi_status_t GpuMetricsBase_v17_t::populate_metrics_dynamic_tbl() {
   //  Adjustments/Changes specific to this version
   run_metric_adjustments_v17();
 
-  // Temperature Info
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricTemperature]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricTempHotspot,
-              format_metric_row(m_gpu_metrics_tbl.m_temperature_hotspot,
-                               "temperature_hotspot")));
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricTemperature]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricTempMem,
-              format_metric_row(m_gpu_metrics_tbl.m_temperature_mem,
-                                "temperature_mem")));
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricTemperature]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricTempVrSoc,
-              format_metric_row(m_gpu_metrics_tbl.m_temperature_vrsoc,
-                                "temperature_vrsoc")));
-
-  // Power/Energy Info
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricPowerEnergy]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricCurrSocketPower,
-              format_metric_row(m_gpu_metrics_tbl.m_current_socket_power,
-                                "curr_socket_power")));
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricPowerEnergy]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricEnergyAccumulator,
-              format_metric_row(m_gpu_metrics_tbl.m_energy_accumulator,
-                                "energy_acc")));
-
-  // Utilization Info
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricUtilization]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricAvgGfxActivity,
-              format_metric_row(m_gpu_metrics_tbl.m_average_gfx_activity,
-                                "average_gfx_activity")));
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricUtilization]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricAvgUmcActivity,
-              format_metric_row(m_gpu_metrics_tbl.m_average_umc_activity,
-                                "average_umc_activity")));
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricUtilization]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricGfxActivityAccumulator,
-              format_metric_row(m_gpu_metrics_tbl.m_gfx_activity_acc,
-                                "gfx_activity_acc")));
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricUtilization]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricMemActivityAccumulator,
-              format_metric_row(m_gpu_metrics_tbl.m_mem_activity_acc,
-                                "mem_activity_acc")));
-
-  // Timestamp Info
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricTimestamp]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricTSFirmware,
-              format_metric_row(m_gpu_metrics_tbl.m_firmware_timestamp,
-                                "firmware_timestamp")));
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricTimestamp]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricTSClockCounter,
-              format_metric_row(m_gpu_metrics_tbl.m_system_clock_counter,
-                                "system_clock_counter")));
-
-
-  // GfxLock Info
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricGfxClkLockStatus]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricGfxClkLockStatus,
-              format_metric_row(m_gpu_metrics_tbl.m_gfxclk_lock_status,
-                                "gfxclk_lock_status")));
-
-  // Link/Width/Speed Info
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricLinkWidthSpeed]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricPcieLinkWidth,
-              format_metric_row(m_gpu_metrics_tbl.m_pcie_link_width,
-                                "pcie_link_width")));
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricLinkWidthSpeed]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricPcieLinkSpeed,
-              format_metric_row(m_gpu_metrics_tbl.m_pcie_link_speed,
-                                "pcie_link_speed")));
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricLinkWidthSpeed]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricXgmiLinkWidth,
-              format_metric_row(m_gpu_metrics_tbl.m_xgmi_link_width,
-                                "xgmi_link_width")));
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricLinkWidthSpeed]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricXgmiLinkSpeed,
-              format_metric_row(m_gpu_metrics_tbl.m_xgmi_link_speed,
-                                "xgmi_link_speed")));
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricLinkWidthSpeed]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricPcieBandwidthAccumulator,
-              format_metric_row(m_gpu_metrics_tbl.m_pcie_bandwidth_acc,
-                                "pcie_bandwidth_acc")));
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricLinkWidthSpeed]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricPcieBandwidthInst,
-              format_metric_row(m_gpu_metrics_tbl.m_pcie_bandwidth_inst,
-                                "pcie_bandwidth_inst")));
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricLinkWidthSpeed]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricPcieL0RecovCountAccumulator,
-              format_metric_row(m_gpu_metrics_tbl.m_pcie_l0_to_recov_count_acc,
-                                "pcie_l0_recov_count_acc")));
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricLinkWidthSpeed]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricPcieReplayCountAccumulator,
-              format_metric_row(m_gpu_metrics_tbl.m_pcie_replay_count_acc,
-                                "pcie_replay_count_acc")));
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricLinkWidthSpeed]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricPcieReplayRollOverCountAccumulator,
-              format_metric_row(m_gpu_metrics_tbl.m_pcie_replay_rover_count_acc,
-                                "pcie_replay_rollover_count_acc")));
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricLinkWidthSpeed]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricPcieNakSentCountAccumulator,
-              format_metric_row(m_gpu_metrics_tbl.m_pcie_nak_sent_count_acc,
-                                "pcie_nak_sent_count_acc")));
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricLinkWidthSpeed]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricPcieNakReceivedCountAccumulator,
-              format_metric_row(m_gpu_metrics_tbl.m_pcie_nak_rcvd_count_acc,
-                                "pcie_nak_rcvd_count_acc")));
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricLinkWidthSpeed]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricXgmiReadDataAccumulator,
-              format_metric_row(m_gpu_metrics_tbl.m_xgmi_read_data_acc,
-                                "[xgmi_read_data_acc]")));
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricLinkWidthSpeed]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricXgmiWriteDataAccumulator,
-              format_metric_row(m_gpu_metrics_tbl.m_xgmi_write_data_acc,
-                                "[xgmi_write_data_acc]")));
-  // new for v1.7
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricLinkWidthSpeed]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricXgmiLinkStatus,
-              format_metric_row(m_gpu_metrics_tbl.m_xgmi_link_status,
-                                "[xgmi_link_status]")));
-  // CurrentClock Info
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricCurrentClock]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricCurrGfxClock,
-              format_metric_row(m_gpu_metrics_tbl.m_current_gfxclk,
-                                "[current_gfxclk]")));
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricCurrentClock]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricCurrSocClock,
-              format_metric_row(m_gpu_metrics_tbl.m_current_socclk,
-                                "[current_socclk]")));
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricCurrentClock]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricCurrVClock0,
-              format_metric_row(m_gpu_metrics_tbl.m_current_vclk0,
-                                "[current_vclk0]")));
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricCurrentClock]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricCurrDClock0,
-              format_metric_row(m_gpu_metrics_tbl.m_current_dclk0,
-                                "[current_dclk0]")));
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricCurrentClock]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricCurrUClock,
-              format_metric_row(m_gpu_metrics_tbl.m_current_uclk,
-                                "current_uclk")));
-
-  /* Accumulation cycle counter */
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricThrottleResidency]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricAccumulationCounter,
-              format_metric_row(m_gpu_metrics_tbl.m_accumulation_counter,
-                                "accumulation_counter")));
-
-  /* Accumulated throttler residencies */
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricThrottleResidency]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricProchotResidencyAccumulator,
-              format_metric_row(m_gpu_metrics_tbl.m_prochot_residency_acc,
-                                "prochot_residency_acc")));
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricThrottleResidency]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricPPTResidencyAccumulator,
-              format_metric_row(m_gpu_metrics_tbl.m_ppt_residency_acc,
-                                "ppt_residency_acc")));
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricThrottleResidency]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricSocketThmResidencyAccumulator,
-              format_metric_row(m_gpu_metrics_tbl.m_socket_thm_residency_acc,
-                                "socket_thm_residency_acc")));
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricThrottleResidency]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricVRThmResidencyAccumulator,
-              format_metric_row(m_gpu_metrics_tbl.m_vr_thm_residency_acc,
-                                "vr_thm_residency_acc")));
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricThrottleResidency]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricHBMThmResidencyAccumulator,
-              format_metric_row(m_gpu_metrics_tbl.m_hbm_thm_residency_acc,
-                                "hbm_thm_residency_acc")));
-
-  /* Partition info */
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricPartition]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kGpuMetricNumPartition,
-              format_metric_row(m_gpu_metrics_tbl.m_num_partition,
-                                "num_partition")));
-
-  /* xcp_stats info */
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricXcpStats]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricGfxBusyInst,
-              format_metric_row(m_gpu_metrics_tbl.m_xcp_stats->gfx_busy_inst,
-                                "xcp_stats->gfx_busy_inst")));
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricXcpStats]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricVcnBusy,
-              format_metric_row(m_gpu_metrics_tbl.m_xcp_stats->vcn_busy,
-                                "xcp_stats->vcn_busy")));
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricXcpStats]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricJpegBusy,
-              format_metric_row(m_gpu_metrics_tbl.m_xcp_stats->jpeg_busy,
-                                "xcp_stats->jpeg_busy")));
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricXcpStats]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricGfxBusyAcc,
-              format_metric_row(m_gpu_metrics_tbl.m_xcp_stats->gfx_busy_acc,
-                                "xcp_stats->gfx_busy_acc")));
-
-  /* PCIE other end recovery counter info */
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricLinkWidthSpeed]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricPcieLCPerfOtherEndRecov,
-           format_metric_row(m_gpu_metrics_tbl.m_pcie_lc_perf_other_end_recovery,
-                                "pcie_lc_perf_other_end_recovery")));
-
-  /* VRAM max bandwidth at max memory clock */
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricLinkWidthSpeed]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricVramMaxBandwidth,
-              format_metric_row(m_gpu_metrics_tbl.m_vram_max_bandwidth,
-                                "vram_max_bandwidth")));
-
-  /* Total App Clock Counter Accumulated */
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricThrottleResidency]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricGfxBelowHostLimitAccumulator,
-              format_metric_row(m_gpu_metrics_tbl.m_xcp_stats->gfx_below_host_limit_acc,
-                                "gfx_below_host_limit_acc")));
+  decode_metrics_fields(m_gpu_metrics_tbl, kAMDGpuMetricFields_v17);
 
   ss << __PRETTY_FUNCTION__
               << " | ======= end ======= "
@@ -1114,12 +1810,6 @@ rsmi_status_t GpuMetricsBase_v17_t::populate_metrics_dynamic_tbl() {
               << " |";
   LOG_TRACE(ss);
 
-  // Copy to base class
-  std::copy(m_metrics_dynamic_tbl.begin(),
-            m_metrics_dynamic_tbl.end(),
-            std::inserter(GpuMetricsBase_t::m_base_metrics_dynamic_tbl,
-                          GpuMetricsBase_t::m_base_metrics_dynamic_tbl.end()));
-
   return status_code;
 }
 
@@ -1129,7 +1819,6 @@ rsmi_status_t GpuMetricsBase_v16_t::populate_metrics_dynamic_tbl() {
   ss << __PRETTY_FUNCTION__ << " | ======= start =======";
   LOG_TRACE(ss);
 
-  auto m_metrics_dynamic_tbl = AMDGpuDynamicMetricsTbl_t{};
   //
   //  Note: Any metric treatment/changes (if any) should happen before they
   //        get written to internal/external tables.
@@ -1157,198 +1846,8 @@ rsmi_status_t GpuMetricsBase_v16_t::populate_metrics_dynamic_tbl() {
 
   //  Adjustments/Changes specific to this version
   run_metric_adjustments_v16();
-  // Temperature Info
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricTemperature]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricTempHotspot,
-              format_metric_row(m_gpu_metrics_tbl.m_temperature_hotspot,
-                               "temperature_hotspot")));
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricTemperature]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricTempMem,
-              format_metric_row(m_gpu_metrics_tbl.m_temperature_mem,
-                                "temperature_mem")));
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricTemperature]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricTempVrSoc,
-              format_metric_row(m_gpu_metrics_tbl.m_temperature_vrsoc,
-                                "temperature_vrsoc")));
-
-  // Power/Energy Info
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricPowerEnergy]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricCurrSocketPower,
-              format_metric_row(m_gpu_metrics_tbl.m_current_socket_power,
-                                "curr_socket_power")));
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricPowerEnergy]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricEnergyAccumulator,
-              format_metric_row(m_gpu_metrics_tbl.m_energy_accumulator,
-                                "energy_acc")));
-
-  // Utilization Info
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricUtilization]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricAvgGfxActivity,
-              format_metric_row(m_gpu_metrics_tbl.m_average_gfx_activity,
-                                "average_gfx_activity")));
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricUtilization]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricAvgUmcActivity,
-              format_metric_row(m_gpu_metrics_tbl.m_average_umc_activity,
-                                "average_umc_activity")));
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricUtilization]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricGfxActivityAccumulator,
-              format_metric_row(m_gpu_metrics_tbl.m_gfx_activity_acc,
-              "gfx_activity_acc")));
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricUtilization]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricMemActivityAccumulator,
-              format_metric_row(m_gpu_metrics_tbl.m_mem_activity_acc,
-                                "mem_activity_acc")));
-
-  // Timestamp Info
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricTimestamp]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricTSFirmware,
-              format_metric_row(m_gpu_metrics_tbl.m_firmware_timestamp,
-                                "firmware_timestamp")));
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricTimestamp]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricTSClockCounter,
-              format_metric_row(m_gpu_metrics_tbl.m_system_clock_counter,
-                                "system_clock_counter")));
 
-
-  // GfxLock Info
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricGfxClkLockStatus]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricGfxClkLockStatus,
-              format_metric_row(m_gpu_metrics_tbl.m_gfxclk_lock_status,
-                                "gfxclk_lock_status")));
-
-  // Link/Width/Speed Info
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricLinkWidthSpeed]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricPcieLinkWidth,
-              format_metric_row(m_gpu_metrics_tbl.m_pcie_link_width,
-                                "pcie_link_width")));
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricLinkWidthSpeed]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricPcieLinkSpeed,
-              format_metric_row(m_gpu_metrics_tbl.m_pcie_link_speed,
-                                "pcie_link_speed")));
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricLinkWidthSpeed]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricXgmiLinkWidth,
-              format_metric_row(m_gpu_metrics_tbl.m_xgmi_link_width,
-                                "xgmi_link_width")));
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricLinkWidthSpeed]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricXgmiLinkSpeed,
-              format_metric_row(m_gpu_metrics_tbl.m_xgmi_link_speed,
-                                "xgmi_link_speed")));
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricLinkWidthSpeed]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricPcieBandwidthAccumulator,
-              format_metric_row(m_gpu_metrics_tbl.m_pcie_bandwidth_acc,
-                                "pcie_bandwidth_acc")));
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricLinkWidthSpeed]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricPcieBandwidthInst,
-              format_metric_row(m_gpu_metrics_tbl.m_pcie_bandwidth_inst,
-                                "pcie_bandwidth_inst")));
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricLinkWidthSpeed]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricPcieL0RecovCountAccumulator,
-              format_metric_row(m_gpu_metrics_tbl.m_pcie_l0_to_recov_count_acc,
-                                "pcie_l0_recov_count_acc")));
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricLinkWidthSpeed]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricPcieReplayCountAccumulator,
-              format_metric_row(m_gpu_metrics_tbl.m_pcie_replay_count_acc,
-                                "pcie_replay_count_acc")));
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricLinkWidthSpeed]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricPcieReplayRollOverCountAccumulator,
-              format_metric_row(m_gpu_metrics_tbl.m_pcie_replay_rover_count_acc,
-                                "pcie_replay_rollover_count_acc")));
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricLinkWidthSpeed]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricPcieNakSentCountAccumulator,
-              format_metric_row(m_gpu_metrics_tbl.m_pcie_nak_sent_count_acc,
-                                "pcie_nak_sent_count_acc")));
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricLinkWidthSpeed]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricPcieNakReceivedCountAccumulator,
-              format_metric_row(m_gpu_metrics_tbl.m_pcie_nak_rcvd_count_acc,
-                                "pcie_nak_rcvd_count_acc")));
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricLinkWidthSpeed]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricXgmiReadDataAccumulator,
-              format_metric_row(m_gpu_metrics_tbl.m_xgmi_read_data_acc,
-                                "[xgmi_read_data_acc]")));
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricLinkWidthSpeed]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricXgmiWriteDataAccumulator,
-              format_metric_row(m_gpu_metrics_tbl.m_xgmi_write_data_acc,
-                                "[xgmi_write_data_acc]")));
-
-  // CurrentClock Info
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricCurrentClock]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricCurrGfxClock,
-              format_metric_row(m_gpu_metrics_tbl.m_current_gfxclk,
-                                "[current_gfxclk]")));
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricCurrentClock]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricCurrSocClock,
-              format_metric_row(m_gpu_metrics_tbl.m_current_socclk,
-                                "[current_socclk]")));
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricCurrentClock]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricCurrVClock0,
-              format_metric_row(m_gpu_metrics_tbl.m_current_vclk0,
-                                "[current_vclk0]")));
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricCurrentClock]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricCurrDClock0,
-              format_metric_row(m_gpu_metrics_tbl.m_current_dclk0,
-                                "[current_dclk0]")));
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricCurrentClock]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricCurrUClock,
-              format_metric_row(m_gpu_metrics_tbl.m_current_uclk,
-                                "current_uclk")));
-
-  /* Accumulation cycle counter */
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricThrottleResidency]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricAccumulationCounter,
-              format_metric_row(m_gpu_metrics_tbl.m_accumulation_counter,
-                                "accumulation_counter")));
-
-  /* Accumulated throttler residencies */
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricThrottleResidency]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricProchotResidencyAccumulator,
-              format_metric_row(m_gpu_metrics_tbl.m_prochot_residency_acc,
-                                "prochot_residency_acc")));
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricThrottleResidency]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricPPTResidencyAccumulator,
-              format_metric_row(m_gpu_metrics_tbl.m_ppt_residency_acc,
-                                "ppt_residency_acc")));
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricThrottleResidency]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricSocketThmResidencyAccumulator,
-              format_metric_row(m_gpu_metrics_tbl.m_socket_thm_residency_acc,
-                                "socket_thm_residency_acc")));
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricThrottleResidency]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricVRThmResidencyAccumulator,
-              format_metric_row(m_gpu_metrics_tbl.m_vr_thm_residency_acc,
-                                "vr_thm_residency_acc")));
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricThrottleResidency]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricHBMThmResidencyAccumulator,
-              format_metric_row(m_gpu_metrics_tbl.m_hbm_thm_residency_acc,
-                                "hbm_thm_residency_acc")));
-
-  /* Partition info */
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricPartition]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kGpuMetricNumPartition,
-              format_metric_row(m_gpu_metrics_tbl.m_num_partition,
-                                "num_partition")));
-
-  /* xcp_stats info */
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricXcpStats]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricGfxBusyInst,
-              format_metric_row(m_gpu_metrics_tbl.m_xcp_stats->gfx_busy_inst,
-                                "xcp_stats->gfx_busy_inst")));
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricXcpStats]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricVcnBusy,
-              format_metric_row(m_gpu_metrics_tbl.m_xcp_stats->vcn_busy,
-                                "xcp_stats->vcn_busy")));
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricXcpStats]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricJpegBusy,
-              format_metric_row(m_gpu_metrics_tbl.m_xcp_stats->jpeg_busy,
-                                "xcp_stats->jpeg_busy")));
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricXcpStats]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricGfxBusyAcc,
-              format_metric_row(m_gpu_metrics_tbl.m_xcp_stats->gfx_busy_acc,
-              "xcp_stats->gfx_busy_acc")));
-
-  /* PCIE other end recovery counter info */
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricLinkWidthSpeed]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricPcieLCPerfOtherEndRecov,
-           format_metric_row(m_gpu_metrics_tbl.m_pcie_lc_perf_other_end_recovery,
-          "pcie_lc_perf_other_end_recovery")));
+  decode_metrics_fields(m_gpu_metrics_tbl, kAMDGpuMetricFields_v16);
 
   ss << __PRETTY_FUNCTION__
               << " | ======= end ======= "
@@ -1357,12 +1856,6 @@ rsmi_status_t GpuMetricsBase_v16_t::populate_metrics_dynamic_tbl() {
               << " |";
   LOG_TRACE(ss);
 
-  // Copy to base class
-  std::copy(m_metrics_dynamic_tbl.begin(),
-            m_metrics_dynamic_tbl.end(),
-            std::inserter(GpuMetricsBase_t::m_base_metrics_dynamic_tbl,
-                          GpuMetricsBase_t::m_base_metrics_dynamic_tbl.end()));
-
   return status_code;
 }
 
@@ -1480,7 +1973,6 @@ rsmi_status_t GpuMetricsBase_v15_t::populate_metrics_dynamic_tbl() {
   ss << __PRETTY_FUNCTION__ << " | ======= start =======";
   LOG_TRACE(ss);
 
-  auto m_metrics_dynamic_tbl = AMDGpuDynamicMetricsTbl_t{};
   //
   //  Note: Any metric treatment/changes (if any) should happen before they
   //        get written to internal/external tables.
@@ -1509,186 +2001,7 @@ rsmi_status_t GpuMetricsBase_v15_t::populate_metrics_dynamic_tbl() {
   //  Adjustments/Changes specific to this version
   run_metric_adjustments_v15();
 
-  // Temperature Info
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricTemperature]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricTempHotspot,
-              format_metric_row(m_gpu_metrics_tbl.m_temperature_hotspot,
-                               "temperature_hotspot"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricTemperature]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricTempMem,
-              format_metric_row(m_gpu_metrics_tbl.m_temperature_mem,
-                                "temperature_mem"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricTemperature]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricTempVrSoc,
-              format_metric_row(m_gpu_metrics_tbl.m_temperature_vrsoc,
-                                "temperature_vrsoc"))
-           );
-
-  // Power/Energy Info
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricPowerEnergy]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricCurrSocketPower,
-              format_metric_row(m_gpu_metrics_tbl.m_current_socket_power,
-                                "curr_socket_power"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricPowerEnergy]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricEnergyAccumulator,
-              format_metric_row(m_gpu_metrics_tbl.m_energy_accumulator,
-                                "energy_acc"))
-           );
-
-  // Utilization Info
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricUtilization]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricAvgGfxActivity,
-              format_metric_row(m_gpu_metrics_tbl.m_average_gfx_activity,
-                                "average_gfx_activity"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricUtilization]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricAvgUmcActivity,
-              format_metric_row(m_gpu_metrics_tbl.m_average_umc_activity,
-                                "average_umc_activity"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricUtilization]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricVcnActivity,
-              format_metric_row(m_gpu_metrics_tbl.m_vcn_activity,
-                                "[average_vcn_activity]"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricUtilization]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricJpegActivity,
-              format_metric_row(m_gpu_metrics_tbl.m_jpeg_activity,
-                                "[average_jpeg_activity]"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricUtilization]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricGfxActivityAccumulator,
-              format_metric_row(m_gpu_metrics_tbl.m_gfx_activity_acc,
-              "gfx_activity_acc"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricUtilization]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricMemActivityAccumulator,
-              format_metric_row(m_gpu_metrics_tbl.m_mem_activity_acc,
-                                "mem_activity_acc"))
-           );
-
-  // Timestamp Info
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricTimestamp]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricTSFirmware,
-              format_metric_row(m_gpu_metrics_tbl.m_firmware_timestamp,
-                                "firmware_timestamp"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricTimestamp]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricTSClockCounter,
-              format_metric_row(m_gpu_metrics_tbl.m_system_clock_counter,
-                                "system_clock_counter"))
-           );
-
-  // Throttle Info
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricThrottleStatus]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricThrottleStatus,
-              format_metric_row(m_gpu_metrics_tbl.m_throttle_status,
-                                "throttle_status"))
-           );
-
-  // GfxLock Info
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricGfxClkLockStatus]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricGfxClkLockStatus,
-              format_metric_row(m_gpu_metrics_tbl.m_gfxclk_lock_status,
-                                "gfxclk_lock_status"))
-           );
-
-  // Link/Width/Speed Info
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricLinkWidthSpeed]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricPcieLinkWidth,
-              format_metric_row(m_gpu_metrics_tbl.m_pcie_link_width,
-                                "pcie_link_width"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricLinkWidthSpeed]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricPcieLinkSpeed,
-              format_metric_row(m_gpu_metrics_tbl.m_pcie_link_speed,
-                                "pcie_link_speed"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricLinkWidthSpeed]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricXgmiLinkWidth,
-              format_metric_row(m_gpu_metrics_tbl.m_xgmi_link_width,
-                                "xgmi_link_width"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricLinkWidthSpeed]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricXgmiLinkSpeed,
-              format_metric_row(m_gpu_metrics_tbl.m_xgmi_link_speed,
-                                "xgmi_link_speed"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricLinkWidthSpeed]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricPcieBandwidthAccumulator,
-              format_metric_row(m_gpu_metrics_tbl.m_pcie_bandwidth_acc,
-                                "pcie_bandwidth_acc"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricLinkWidthSpeed]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricPcieBandwidthInst,
-              format_metric_row(m_gpu_metrics_tbl.m_pcie_bandwidth_inst,
-                                "pcie_bandwidth_inst"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricLinkWidthSpeed]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricPcieL0RecovCountAccumulator,
-              format_metric_row(m_gpu_metrics_tbl.m_pcie_l0_to_recov_count_acc,
-                                "pcie_l0_recov_count_acc"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricLinkWidthSpeed]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricPcieReplayCountAccumulator,
-              format_metric_row(m_gpu_metrics_tbl.m_pcie_replay_count_acc,
-                                "pcie_replay_count_acc"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricLinkWidthSpeed]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricPcieReplayRollOverCountAccumulator,
-              format_metric_row(m_gpu_metrics_tbl.m_pcie_replay_rover_count_acc,
-                                "pcie_replay_rollover_count_acc"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricLinkWidthSpeed]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricPcieNakSentCountAccumulator,
-              format_metric_row(m_gpu_metrics_tbl.m_pcie_nak_sent_count_acc,
-                                "pcie_nak_sent_count_acc"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricLinkWidthSpeed]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricPcieNakReceivedCountAccumulator,
-              format_metric_row(m_gpu_metrics_tbl.m_pcie_nak_rcvd_count_acc,
-                                "pcie_nak_rcvd_count_acc"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricLinkWidthSpeed]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricXgmiReadDataAccumulator,
-              format_metric_row(m_gpu_metrics_tbl.m_xgmi_read_data_acc,
-                                "[xgmi_read_data_acc]"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricLinkWidthSpeed]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricXgmiWriteDataAccumulator,
-              format_metric_row(m_gpu_metrics_tbl.m_xgmi_write_data_acc,
-                                "[xgmi_write_data_acc]"))
-           );
-
-  // CurrentClock Info
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricCurrentClock]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricCurrGfxClock,
-              format_metric_row(m_gpu_metrics_tbl.m_current_gfxclk,
-                                "[current_gfxclk]"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricCurrentClock]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricCurrSocClock,
-              format_metric_row(m_gpu_metrics_tbl.m_current_socclk,
-                                "[current_socclk]"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricCurrentClock]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricCurrVClock0,
-              format_metric_row(m_gpu_metrics_tbl.m_current_vclk0,
-                                "[current_vclk0]"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricCurrentClock]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricCurrDClock0,
-              format_metric_row(m_gpu_metrics_tbl.m_current_dclk0,
-                                "[current_dclk0]"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricCurrentClock]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricCurrUClock,
-              format_metric_row(m_gpu_metrics_tbl.m_current_uclk,
-                                "current_uclk"))
-           );
+  decode_metrics_fields(m_gpu_metrics_tbl, kAMDGpuMetricFields_v15);
 
   ss << __PRETTY_FUNCTION__
               << " | ======= end ======= "
@@ -1697,12 +2010,6 @@ rsmi_status_t GpuMetricsBase_v15_t::populate_metrics_dynamic_tbl() {
               << " |";
   LOG_TRACE(ss);
 
-  // Copy to base class
-  std::copy(m_metrics_dynamic_tbl.begin(),
-            m_metrics_dynamic_tbl.end(),
-            std::inserter(GpuMetricsBase_t::m_base_metrics_dynamic_tbl,
-                          GpuMetricsBase_t::m_base_metrics_dynamic_tbl.end()));
-
   return status_code;
 }
 
@@ -1812,7 +2119,6 @@ rsmi_status_t GpuMetricsBase_v14_t::populate_metrics_dynamic_tbl() {
   ss << __PRETTY_FUNCTION__ << " | ======= start =======";
   LOG_TRACE(ss);
 
-  auto m_metrics_dynamic_tbl = AMDGpuDynamicMetricsTbl_t{};
   //
   //  Note: Any metric treatment/changes (if any) should happen before they
   //        get written to internal/external tables.
@@ -1841,171 +2147,7 @@ rsmi_status_t GpuMetricsBase_v14_t::populate_metrics_dynamic_tbl() {
   //  Adjustments/Changes specific to this version
   run_metric_adjustments_v14();
 
-  // Temperature Info
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricTemperature]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricTempHotspot,
-              format_metric_row(m_gpu_metrics_tbl.m_temperature_hotspot,
-                               "temperature_hotspot"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricTemperature]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricTempMem,
-              format_metric_row(m_gpu_metrics_tbl.m_temperature_mem,
-                                "temperature_mem"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricTemperature]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricTempVrSoc,
-              format_metric_row(m_gpu_metrics_tbl.m_temperature_vrsoc,
-                                "temperature_vrsoc"))
-           );
-
-  // Power/Energy Info
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricPowerEnergy]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricCurrSocketPower,
-              format_metric_row(m_gpu_metrics_tbl.m_current_socket_power,
-                                "curr_socket_power"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricPowerEnergy]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricEnergyAccumulator,
-              format_metric_row(m_gpu_metrics_tbl.m_energy_accumulator,
-                                "energy_acc"))
-           );
-
-  // Utilization Info
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricUtilization]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricAvgGfxActivity,
-              format_metric_row(m_gpu_metrics_tbl.m_average_gfx_activity,
-                                "average_gfx_activity"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricUtilization]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricAvgUmcActivity,
-              format_metric_row(m_gpu_metrics_tbl.m_average_umc_activity,
-                                "average_umc_activity"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricUtilization]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricVcnActivity,
-              format_metric_row(m_gpu_metrics_tbl.m_vcn_activity,
-                                "[average_vcn_activity]"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricUtilization]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricGfxActivityAccumulator,
-              format_metric_row(m_gpu_metrics_tbl.m_gfx_activity_acc,
-              "gfx_activity_acc"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricUtilization]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricMemActivityAccumulator,
-              format_metric_row(m_gpu_metrics_tbl.m_mem_activity_acc,
-                                "mem_activity_acc"))
-           );
-
-  // Timestamp Info
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricTimestamp]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricTSFirmware,
-              format_metric_row(m_gpu_metrics_tbl.m_firmware_timestamp,
-                                "firmware_timestamp"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricTimestamp]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricTSClockCounter,
-              format_metric_row(m_gpu_metrics_tbl.m_system_clock_counter,
-                                "system_clock_counter"))
-           );
-
-  // Throttle Info
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricThrottleStatus]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricThrottleStatus,
-              format_metric_row(m_gpu_metrics_tbl.m_throttle_status,
-                                "throttle_status"))
-           );
-
-  // GfxLock Info
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricGfxClkLockStatus]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricGfxClkLockStatus,
-              format_metric_row(m_gpu_metrics_tbl.m_gfxclk_lock_status,
-                                "gfxclk_lock_status"))
-           );
-
-  // Link/Width/Speed Info
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricLinkWidthSpeed]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricPcieLinkWidth,
-              format_metric_row(m_gpu_metrics_tbl.m_pcie_link_width,
-                                "pcie_link_width"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricLinkWidthSpeed]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricPcieLinkSpeed,
-              format_metric_row(m_gpu_metrics_tbl.m_pcie_link_speed,
-                                "pcie_link_speed"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricLinkWidthSpeed]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricXgmiLinkWidth,
-              format_metric_row(m_gpu_metrics_tbl.m_xgmi_link_width,
-                                "xgmi_link_width"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricLinkWidthSpeed]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricXgmiLinkSpeed,
-              format_metric_row(m_gpu_metrics_tbl.m_xgmi_link_speed,
-                                "xgmi_link_speed"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricLinkWidthSpeed]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricPcieBandwidthAccumulator,
-              format_metric_row(m_gpu_metrics_tbl.m_pcie_bandwidth_acc,
-                                "pcie_bandwidth_acc"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricLinkWidthSpeed]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricPcieBandwidthInst,
-              format_metric_row(m_gpu_metrics_tbl.m_pcie_bandwidth_inst,
-                                "pcie_bandwidth_inst"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricLinkWidthSpeed]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricPcieL0RecovCountAccumulator,
-              format_metric_row(m_gpu_metrics_tbl.m_pcie_l0_to_recov_count_acc,
-                                "pcie_l0_recov_count_acc"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricLinkWidthSpeed]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricPcieReplayCountAccumulator,
-              format_metric_row(m_gpu_metrics_tbl.m_pcie_replay_count_acc,
-                                "pcie_replay_count_acc"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricLinkWidthSpeed]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricPcieReplayRollOverCountAccumulator,
-              format_metric_row(m_gpu_metrics_tbl.m_pcie_replay_rover_count_acc,
-                                "pcie_replay_rollover_count_acc"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricLinkWidthSpeed]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricXgmiReadDataAccumulator,
-              format_metric_row(m_gpu_metrics_tbl.m_xgmi_read_data_acc,
-                                "[xgmi_read_data_acc]"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricLinkWidthSpeed]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricXgmiWriteDataAccumulator,
-              format_metric_row(m_gpu_metrics_tbl.m_xgmi_write_data_acc,
-                                "[xgmi_write_data_acc]"))
-           );
-
-  // CurrentClock Info
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricCurrentClock]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricCurrGfxClock,
-              format_metric_row(m_gpu_metrics_tbl.m_current_gfxclk,
-                                "[current_gfxclk]"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricCurrentClock]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricCurrSocClock,
-              format_metric_row(m_gpu_metrics_tbl.m_current_socclk,
-                                "[current_socclk]"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricCurrentClock]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricCurrVClock0,
-              format_metric_row(m_gpu_metrics_tbl.m_current_vclk0,
-                                "[current_vclk0]"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricCurrentClock]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricCurrDClock0,
-              format_metric_row(m_gpu_metrics_tbl.m_current_dclk0,
-                                "[current_dclk0]"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricCurrentClock]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricCurrUClock,
-              format_metric_row(m_gpu_metrics_tbl.m_current_uclk,
-                                "current_uclk"))
-           );
+  decode_metrics_fields(m_gpu_metrics_tbl, kAMDGpuMetricFields_v14);
 
   ss << __PRETTY_FUNCTION__
      << " | ======= end ======= "
@@ -2014,12 +2156,6 @@ rsmi_status_t GpuMetricsBase_v14_t::populate_metrics_dynamic_tbl() {
      << " |";
   LOG_TRACE(ss);
 
-  // Copy to base class
-  std::copy(m_metrics_dynamic_tbl.begin(),
-            m_metrics_dynamic_tbl.end(),
-            std::inserter(GpuMetricsBase_t::m_base_metrics_dynamic_tbl,
-                          GpuMetricsBase_t::m_base_metrics_dynamic_tbl.end()));
-
   return status_code;
 }
 
@@ -2147,805 +2283,16 @@ rsmi_status_t init_max_public_gpu_matrics(AMGpuMetricsPublicLatest_t& rsmi_gpu_m
               init_max_uint_types<std::uint64_t>());
     std::fill(std::begin(row.gfx_below_host_limit_acc), std::end(row.gfx_below_host_limit_acc),
               init_max_uint_types<std::uint64_t>());
-  }
-
-  ss << __PRETTY_FUNCTION__
-     << " | ======= end ======= "
-     << " | Success "
-     << " | Returning = " << getRSMIStatusString(status_code)
-     << " |";
-  LOG_TRACE(ss);
-
-  return status_code;
-}
-
-AMGpuMetricsPublicLatestTupl_t GpuMetricsBase_v17_t::copy_internal_to_external_metrics()
-{
-  std::ostringstream ss;
-  auto status_code(rsmi_status_t::RSMI_STATUS_SUCCESS);
-  ss << __PRETTY_FUNCTION__ << " | ======= start =======";
-  LOG_TRACE(ss);
-
-  auto copy_data_from_internal_metrics_tbl = [&]() {
-    AMGpuMetricsPublicLatest_t metrics_public_init{};
-
-    //
-    //  Note: Initializing data members with their max. If field is max,
-    //        no data was assigned to it.
-    init_max_public_gpu_matrics(metrics_public_init);
-
-    // Header
-    metrics_public_init.common_header.structure_size = m_gpu_metrics_tbl.m_common_header.m_structure_size;
-    metrics_public_init.common_header.format_revision = m_gpu_metrics_tbl.m_common_header.m_format_revision;
-    metrics_public_init.common_header.content_revision = m_gpu_metrics_tbl.m_common_header.m_content_revision;
-
-
-    // Temperature
-    metrics_public_init.temperature_hotspot = m_gpu_metrics_tbl.m_temperature_hotspot;
-    metrics_public_init.temperature_mem = m_gpu_metrics_tbl.m_temperature_mem;
-    metrics_public_init.temperature_vrsoc = m_gpu_metrics_tbl.m_temperature_vrsoc;
-
-    // Power
-    metrics_public_init.current_socket_power = m_gpu_metrics_tbl.m_current_socket_power;
-
-    // Utilization
-    metrics_public_init.average_gfx_activity = m_gpu_metrics_tbl.m_average_gfx_activity;
-    metrics_public_init.average_umc_activity = m_gpu_metrics_tbl.m_average_umc_activity;
-
-    // Power/Energy
-    metrics_public_init.energy_accumulator = m_gpu_metrics_tbl.m_energy_accumulator;
-
-    // Driver attached timestamp (in ns)
-    metrics_public_init.system_clock_counter = m_gpu_metrics_tbl.m_system_clock_counter;
-
-    // Clock Lock Status. Each bit corresponds to clock instance
-    metrics_public_init.gfxclk_lock_status = m_gpu_metrics_tbl.m_gfxclk_lock_status;
-
-    // Link width (number of lanes) and speed
-    metrics_public_init.pcie_link_width = m_gpu_metrics_tbl.m_pcie_link_width;
-    metrics_public_init.pcie_link_speed = m_gpu_metrics_tbl.m_pcie_link_speed;
-
-    // XGMI bus width and bitrate
-    metrics_public_init.xgmi_link_width = m_gpu_metrics_tbl.m_xgmi_link_width;
-    metrics_public_init.xgmi_link_speed = m_gpu_metrics_tbl.m_xgmi_link_speed;
-
-    // Utilization Accumulated
-    metrics_public_init.gfx_activity_acc = m_gpu_metrics_tbl.m_gfx_activity_acc;
-    metrics_public_init.mem_activity_acc = m_gpu_metrics_tbl.m_mem_activity_acc;
-
-    // PCIE accumulated bandwidth
-    metrics_public_init.pcie_bandwidth_acc = m_gpu_metrics_tbl.m_pcie_bandwidth_acc;
-
-    // PCIE instantaneous bandwidth
-    metrics_public_init.pcie_bandwidth_inst = m_gpu_metrics_tbl.m_pcie_bandwidth_inst;
-
-    // PCIE L0 to recovery state transition accumulated count
-    metrics_public_init.pcie_l0_to_recov_count_acc = m_gpu_metrics_tbl.m_pcie_l0_to_recov_count_acc;
-
-    // PCIE replay accumulated count
-    metrics_public_init.pcie_replay_count_acc = m_gpu_metrics_tbl.m_pcie_replay_count_acc;
-
-    // PCIE replay rollover accumulated count
-    metrics_public_init.pcie_replay_rover_count_acc = m_gpu_metrics_tbl.m_pcie_replay_rover_count_acc;
-
-    // PCIE NAK sent accumulated count
-    metrics_public_init.pcie_nak_sent_count_acc = m_gpu_metrics_tbl.m_pcie_nak_sent_count_acc;
-
-    // PCIE NAK received accumulated count
-    metrics_public_init.pcie_nak_rcvd_count_acc = m_gpu_metrics_tbl.m_pcie_nak_rcvd_count_acc;
-
-    // Accumulated throttler residencies
-    // bumped up public to uint64_t due to planned size increase for newer ASICs
-    metrics_public_init.accumulation_counter = m_gpu_metrics_tbl.m_accumulation_counter;
-    metrics_public_init.prochot_residency_acc = m_gpu_metrics_tbl.m_prochot_residency_acc;
-    metrics_public_init.ppt_residency_acc = m_gpu_metrics_tbl.m_ppt_residency_acc;
-    metrics_public_init.socket_thm_residency_acc = m_gpu_metrics_tbl.m_socket_thm_residency_acc;
-    metrics_public_init.vr_thm_residency_acc = m_gpu_metrics_tbl.m_vr_thm_residency_acc;
-    metrics_public_init.hbm_thm_residency_acc = m_gpu_metrics_tbl.m_hbm_thm_residency_acc;
-
-    /* VRAM max bandwidth at max memory clock */
-    metrics_public_init.vram_max_bandwidth = m_gpu_metrics_tbl.m_vram_max_bandwidth;
-
-    // XGMI accumulated data transfer size
-    // xgmi_read_data
-    const auto xgmi_read_data_num_elems =
-      static_cast<uint16_t>(
-        std::end(m_gpu_metrics_tbl.m_xgmi_read_data_acc) -
-        std::begin(m_gpu_metrics_tbl.m_xgmi_read_data_acc));
-    std::copy_n(std::begin(m_gpu_metrics_tbl.m_xgmi_read_data_acc),
-                xgmi_read_data_num_elems,
-                metrics_public_init.xgmi_read_data_acc);
-    // xgmi_write_data
-    const auto xgmi_write_data_num_elems =
-      static_cast<uint16_t>(
-        std::end(m_gpu_metrics_tbl.m_xgmi_write_data_acc) -
-        std::begin(m_gpu_metrics_tbl.m_xgmi_write_data_acc));
-    std::copy_n(std::begin(m_gpu_metrics_tbl.m_xgmi_write_data_acc),
-                xgmi_write_data_num_elems,
-                metrics_public_init.xgmi_write_data_acc);
-
-    // xgmi_link_status // new for 1.7
-    const auto xgmi_link_status_num_elems = static_cast<uint16_t>(
-        std::end(m_gpu_metrics_tbl.m_xgmi_link_status) -
-        std::begin(m_gpu_metrics_tbl.m_xgmi_link_status));
-    std::copy_n(std::begin(m_gpu_metrics_tbl.m_xgmi_link_status),
-                xgmi_link_status_num_elems,
-                metrics_public_init.xgmi_link_status);
-
-    // PMFW attached timestamp (10ns resolution)
-    metrics_public_init.firmware_timestamp = m_gpu_metrics_tbl.m_firmware_timestamp;
-
-    // Current clocks
-    // current_gfxclk
-    const auto curr_gfxclk_num_elems =
-      static_cast<uint16_t>(
-        std::end(m_gpu_metrics_tbl.m_current_gfxclk) -
-        std::begin(m_gpu_metrics_tbl.m_current_gfxclk));
-    std::copy_n(std::begin(m_gpu_metrics_tbl.m_current_gfxclk),
-                curr_gfxclk_num_elems,
-                metrics_public_init.current_gfxclks);
-
-    // current_socclk
-    const auto curr_socclk_num_elems =
-      static_cast<uint16_t>(
-        std::end(m_gpu_metrics_tbl.m_current_socclk) -
-        std::begin(m_gpu_metrics_tbl.m_current_socclk));
-    std::copy_n(std::begin(m_gpu_metrics_tbl.m_current_socclk),
-                curr_socclk_num_elems,
-                metrics_public_init.current_socclks);
-
-    // current_vclk0
-    const auto curr_vclk0_num_elems =
-      static_cast<uint16_t>(
-        std::end(m_gpu_metrics_tbl.m_current_vclk0) -
-        std::begin(m_gpu_metrics_tbl.m_current_vclk0));
-    std::copy_n(std::begin(m_gpu_metrics_tbl.m_current_vclk0),
-                curr_vclk0_num_elems,
-                metrics_public_init.current_vclk0s);
-
-    // current_dclk0
-    const auto curr_dclk0_num_elems =
-      static_cast<uint16_t>(
-        std::end(m_gpu_metrics_tbl.m_current_dclk0) -
-        std::begin(m_gpu_metrics_tbl.m_current_dclk0));
-    std::copy_n(std::begin(m_gpu_metrics_tbl.m_current_dclk0),
-                curr_dclk0_num_elems,
-                metrics_public_init.current_dclk0s);
-
-    metrics_public_init.current_uclk = m_gpu_metrics_tbl.m_current_uclk;
-
-    metrics_public_init.num_partition = m_gpu_metrics_tbl.m_num_partition;
-
-    metrics_public_init.pcie_lc_perf_other_end_recovery =
-      m_gpu_metrics_tbl.m_pcie_lc_perf_other_end_recovery;
-
-    auto priv_it = std::begin(m_gpu_metrics_tbl.m_xcp_stats);
-    for (auto pub_it = std::begin(metrics_public_init.xcp_stats);
-         pub_it != std::end(metrics_public_init.xcp_stats);
-         ++pub_it, ++priv_it) {
-      std::copy_n(std::begin(priv_it->gfx_busy_inst), RSMI_MAX_NUM_XCC,
-                  pub_it->gfx_busy_inst);
-      std::copy_n(std::begin(priv_it->jpeg_busy), RSMI_MAX_NUM_JPEG_ENGS,
-                  pub_it->jpeg_busy);
-      std::copy_n(std::begin(priv_it->vcn_busy), RSMI_MAX_NUM_VCNS,
-                  pub_it->vcn_busy);
-      std::copy_n(std::begin(priv_it->gfx_busy_acc), RSMI_MAX_NUM_XCC,
-                  pub_it->gfx_busy_acc);
-      std::copy_n(std::begin(priv_it->gfx_below_host_limit_acc), RSMI_MAX_NUM_XCC,
-                  pub_it->gfx_below_host_limit_acc);
-    }
-
-    //
-    // Note:  Backwards compatibility -> Handling extra/exception cases
-    //        related to earlier versions (1.3/1.4/1.5)
-    metrics_public_init.current_gfxclk = metrics_public_init.current_gfxclks[0];
-
-    metrics_public_init.current_socclk = metrics_public_init.current_socclks[0];
-
-    metrics_public_init.current_vclk0 = metrics_public_init.current_vclk0s[0];
-
-    metrics_public_init.current_vclk1 = metrics_public_init.current_vclk0s[1];
-
-    metrics_public_init.current_dclk0 = metrics_public_init.current_dclk0s[0];
-
-    metrics_public_init.current_dclk1 = metrics_public_init.current_dclk0s[1];
-
-    // separate by XCP
-    if (this->m_partition_id < kRSMI_MAX_NUM_XCP
-        && m_gpu_metrics_tbl.m_xcp_stats[this->m_partition_id].vcn_busy[0] != UINT16_MAX) {
-       std::copy(std::begin(m_gpu_metrics_tbl.m_xcp_stats[this->m_partition_id].vcn_busy),
-              std::end(m_gpu_metrics_tbl.m_xcp_stats[this->m_partition_id].vcn_busy),
-              std::begin(metrics_public_init.vcn_activity));
-    }
-    if (this->m_partition_id < kRSMI_MAX_NUM_XCP
-        && m_gpu_metrics_tbl.m_xcp_stats[this->m_partition_id].jpeg_busy[0] != UINT16_MAX) {
-      std::copy(std::begin(m_gpu_metrics_tbl.m_xcp_stats[this->m_partition_id].jpeg_busy),
-              std::end(m_gpu_metrics_tbl.m_xcp_stats[this->m_partition_id].jpeg_busy),
-              std::begin(metrics_public_init.jpeg_activity));
-    }
-
-    return metrics_public_init;
-  }();
-
-  ss << __PRETTY_FUNCTION__
-     << " | ======= end ======= "
-     << " | Success "
-     << " | Returning = " << getRSMIStatusString(status_code)
-     << " |";
-  LOG_TRACE(ss);
-
-  return std::make_tuple(status_code, copy_data_from_internal_metrics_tbl);
-
-}
-
-AMGpuMetricsPublicLatestTupl_t GpuMetricsBase_v16_t::copy_internal_to_external_metrics()
-{
-  std::ostringstream ss;
-  auto status_code(rsmi_status_t::RSMI_STATUS_SUCCESS);
-  ss << __PRETTY_FUNCTION__ << " | ======= start =======";
-  LOG_TRACE(ss);
-
-  auto copy_data_from_internal_metrics_tbl = [&]() {
-    AMGpuMetricsPublicLatest_t metrics_public_init{};
-
-    //
-    //  Note: Initializing data members with their max. If field is max,
-    //        no data was assigned to it.
-    init_max_public_gpu_matrics(metrics_public_init);
-
-    // Header
-    metrics_public_init.common_header.structure_size = m_gpu_metrics_tbl.m_common_header.m_structure_size;
-    metrics_public_init.common_header.format_revision = m_gpu_metrics_tbl.m_common_header.m_format_revision;
-    metrics_public_init.common_header.content_revision = m_gpu_metrics_tbl.m_common_header.m_content_revision;
-
-
-    // Temperature
-    metrics_public_init.temperature_hotspot = m_gpu_metrics_tbl.m_temperature_hotspot;
-    metrics_public_init.temperature_mem = m_gpu_metrics_tbl.m_temperature_mem;
-    metrics_public_init.temperature_vrsoc = m_gpu_metrics_tbl.m_temperature_vrsoc;
-
-    // Power
-    metrics_public_init.current_socket_power = m_gpu_metrics_tbl.m_current_socket_power;
-
-    // Utilization
-    metrics_public_init.average_gfx_activity = m_gpu_metrics_tbl.m_average_gfx_activity;
-    metrics_public_init.average_umc_activity = m_gpu_metrics_tbl.m_average_umc_activity;
-
-    // Power/Energy
-    metrics_public_init.energy_accumulator = m_gpu_metrics_tbl.m_energy_accumulator;
-
-    // Driver attached timestamp (in ns)
-    metrics_public_init.system_clock_counter = m_gpu_metrics_tbl.m_system_clock_counter;
-
-    // Clock Lock Status. Each bit corresponds to clock instance
-    metrics_public_init.gfxclk_lock_status = m_gpu_metrics_tbl.m_gfxclk_lock_status;
-
-    // Link width (number of lanes) and speed
-    metrics_public_init.pcie_link_width = m_gpu_metrics_tbl.m_pcie_link_width;
-    metrics_public_init.pcie_link_speed = m_gpu_metrics_tbl.m_pcie_link_speed;
-
-    // XGMI bus width and bitrate
-    metrics_public_init.xgmi_link_width = m_gpu_metrics_tbl.m_xgmi_link_width;
-    metrics_public_init.xgmi_link_speed = m_gpu_metrics_tbl.m_xgmi_link_speed;
-
-    // Utilization Accumulated
-    metrics_public_init.gfx_activity_acc = m_gpu_metrics_tbl.m_gfx_activity_acc;
-    metrics_public_init.mem_activity_acc = m_gpu_metrics_tbl.m_mem_activity_acc;
-
-    // PCIE accumulated bandwidth
-    metrics_public_init.pcie_bandwidth_acc = m_gpu_metrics_tbl.m_pcie_bandwidth_acc;
-
-    // PCIE instantaneous bandwidth
-    metrics_public_init.pcie_bandwidth_inst = m_gpu_metrics_tbl.m_pcie_bandwidth_inst;
-
-    // PCIE L0 to recovery state transition accumulated count
-    metrics_public_init.pcie_l0_to_recov_count_acc = m_gpu_metrics_tbl.m_pcie_l0_to_recov_count_acc;
-
-    // PCIE replay accumulated count
-    metrics_public_init.pcie_replay_count_acc = m_gpu_metrics_tbl.m_pcie_replay_count_acc;
-
-    // PCIE replay rollover accumulated count
-    metrics_public_init.pcie_replay_rover_count_acc = m_gpu_metrics_tbl.m_pcie_replay_rover_count_acc;
-
-    // PCIE NAK sent accumulated count
-    metrics_public_init.pcie_nak_sent_count_acc = m_gpu_metrics_tbl.m_pcie_nak_sent_count_acc;
-
-    // PCIE NAK received accumulated count
-    metrics_public_init.pcie_nak_rcvd_count_acc = m_gpu_metrics_tbl.m_pcie_nak_rcvd_count_acc;
-
-    // Accumulated throttler residencies
-    // bumped up public to uint64_t due to planned size increase for newer ASICs
-    metrics_public_init.accumulation_counter = m_gpu_metrics_tbl.m_accumulation_counter;
-    metrics_public_init.prochot_residency_acc = m_gpu_metrics_tbl.m_prochot_residency_acc;
-    metrics_public_init.ppt_residency_acc = m_gpu_metrics_tbl.m_ppt_residency_acc;
-    metrics_public_init.socket_thm_residency_acc = m_gpu_metrics_tbl.m_socket_thm_residency_acc;
-    metrics_public_init.vr_thm_residency_acc = m_gpu_metrics_tbl.m_vr_thm_residency_acc;
-    metrics_public_init.hbm_thm_residency_acc = m_gpu_metrics_tbl.m_hbm_thm_residency_acc;
-
-    // XGMI accumulated data transfer size
-    // xgmi_read_data
-    const auto xgmi_read_data_num_elems =
-      static_cast<uint16_t>(
-        std::end(m_gpu_metrics_tbl.m_xgmi_read_data_acc) -
-        std::begin(m_gpu_metrics_tbl.m_xgmi_read_data_acc));
-    std::copy_n(std::begin(m_gpu_metrics_tbl.m_xgmi_read_data_acc),
-                xgmi_read_data_num_elems,
-                metrics_public_init.xgmi_read_data_acc);
-    // xgmi_write_data
-    const auto xgmi_write_data_num_elems =
-      static_cast<uint16_t>(
-        std::end(m_gpu_metrics_tbl.m_xgmi_write_data_acc) -
-        std::begin(m_gpu_metrics_tbl.m_xgmi_write_data_acc));
-    std::copy_n(std::begin(m_gpu_metrics_tbl.m_xgmi_write_data_acc),
-                xgmi_write_data_num_elems,
-                metrics_public_init.xgmi_write_data_acc);
-
-    // PMFW attached timestamp (10ns resolution)
-    metrics_public_init.firmware_timestamp = m_gpu_metrics_tbl.m_firmware_timestamp;
-
-    // Current clocks
-    // current_gfxclk
-    const auto curr_gfxclk_num_elems =
-      static_cast<uint16_t>(
-        std::end(m_gpu_metrics_tbl.m_current_gfxclk) -
-        std::begin(m_gpu_metrics_tbl.m_current_gfxclk));
-    std::copy_n(std::begin(m_gpu_metrics_tbl.m_current_gfxclk),
-                curr_gfxclk_num_elems,
-                metrics_public_init.current_gfxclks);
-
-    // current_socclk
-    const auto curr_socclk_num_elems =
-      static_cast<uint16_t>(
-        std::end(m_gpu_metrics_tbl.m_current_socclk) -
-        std::begin(m_gpu_metrics_tbl.m_current_socclk));
-    std::copy_n(std::begin(m_gpu_metrics_tbl.m_current_socclk),
-                curr_socclk_num_elems,
-                metrics_public_init.current_socclks);
-
-    // current_vclk0
-    const auto curr_vclk0_num_elems =
-      static_cast<uint16_t>(
-        std::end(m_gpu_metrics_tbl.m_current_vclk0) -
-        std::begin(m_gpu_metrics_tbl.m_current_vclk0));
-    std::copy_n(std::begin(m_gpu_metrics_tbl.m_current_vclk0),
-                curr_vclk0_num_elems,
-                metrics_public_init.current_vclk0s);
-
-    // current_dclk0
-    const auto curr_dclk0_num_elems =
-      static_cast<uint16_t>(
-        std::end(m_gpu_metrics_tbl.m_current_dclk0) -
-        std::begin(m_gpu_metrics_tbl.m_current_dclk0));
-    std::copy_n(std::begin(m_gpu_metrics_tbl.m_current_dclk0),
-                curr_dclk0_num_elems,
-                metrics_public_init.current_dclk0s);
-
-    metrics_public_init.current_uclk = m_gpu_metrics_tbl.m_current_uclk;
-
-    metrics_public_init.num_partition = m_gpu_metrics_tbl.m_num_partition;
-
-    metrics_public_init.pcie_lc_perf_other_end_recovery =
-      m_gpu_metrics_tbl.m_pcie_lc_perf_other_end_recovery;
-
-    auto priv_it = std::begin(m_gpu_metrics_tbl.m_xcp_stats);
-    for (auto pub_it = std::begin(metrics_public_init.xcp_stats);
-         pub_it != std::end(metrics_public_init.xcp_stats);
-         ++pub_it, ++priv_it) {
-      std::copy_n(std::begin(priv_it->gfx_busy_inst), RSMI_MAX_NUM_XCC,
-                  pub_it->gfx_busy_inst);
-      std::copy_n(std::begin(priv_it->jpeg_busy), RSMI_MAX_NUM_JPEG_ENGS,
-                  pub_it->jpeg_busy);
-      std::copy_n(std::begin(priv_it->vcn_busy), RSMI_MAX_NUM_VCNS,
-                  pub_it->vcn_busy);
-      std::copy_n(std::begin(priv_it->gfx_busy_acc), RSMI_MAX_NUM_XCC,
-                  pub_it->gfx_busy_acc);
-    }
-
-    //
-    // Note:  Backwards compatibility -> Handling extra/exception cases
-    //        related to earlier versions (1.3/1.4/1.5)
-    metrics_public_init.current_gfxclk = metrics_public_init.current_gfxclks[0];
-
-    metrics_public_init.current_socclk = metrics_public_init.current_socclks[0];
-
-    metrics_public_init.current_vclk0 = metrics_public_init.current_vclk0s[0];
-
-    metrics_public_init.current_vclk1 = metrics_public_init.current_vclk0s[1];
-
-    metrics_public_init.current_dclk0 = metrics_public_init.current_dclk0s[0];
-
-    metrics_public_init.current_dclk1 = metrics_public_init.current_dclk0s[1];
-
-    // separate by XCP
-    if (this->m_partition_id < kRSMI_MAX_NUM_XCP
-        && m_gpu_metrics_tbl.m_xcp_stats[this->m_partition_id].vcn_busy[0] != UINT16_MAX) {
-       std::copy(std::begin(m_gpu_metrics_tbl.m_xcp_stats[this->m_partition_id].vcn_busy),
-              std::end(m_gpu_metrics_tbl.m_xcp_stats[this->m_partition_id].vcn_busy),
-              std::begin(metrics_public_init.vcn_activity));
-    }
-    if (this->m_partition_id < kRSMI_MAX_NUM_XCP
-        && m_gpu_metrics_tbl.m_xcp_stats[this->m_partition_id].jpeg_busy[0] != UINT16_MAX) {
-      std::copy(std::begin(m_gpu_metrics_tbl.m_xcp_stats[this->m_partition_id].jpeg_busy),
-              std::end(m_gpu_metrics_tbl.m_xcp_stats[this->m_partition_id].jpeg_busy),
-              std::begin(metrics_public_init.jpeg_activity));
-    }
-
-    return metrics_public_init;
-  }();
-
-  ss << __PRETTY_FUNCTION__
-     << " | ======= end ======= "
-     << " | Success "
-     << " | Returning = " << getRSMIStatusString(status_code)
-     << " |";
-  LOG_TRACE(ss);
-
-  return std::make_tuple(status_code, copy_data_from_internal_metrics_tbl);
-}
-
-AMGpuMetricsPublicLatestTupl_t GpuMetricsBase_v15_t::copy_internal_to_external_metrics()
-{
-  std::ostringstream ss;
-  auto status_code(rsmi_status_t::RSMI_STATUS_SUCCESS);
-  ss << __PRETTY_FUNCTION__ << " | ======= start =======";
-  LOG_TRACE(ss);
-
-  auto copy_data_from_internal_metrics_tbl = [&]() {
-    AMGpuMetricsPublicLatest_t metrics_public_init{};
-
-    //
-    //  Note: Initializing data members with their max. If field is max,
-    //        no data was assigned to it.
-    init_max_public_gpu_matrics(metrics_public_init);
-
-    // Header
-    metrics_public_init.common_header.structure_size = m_gpu_metrics_tbl.m_common_header.m_structure_size;
-    metrics_public_init.common_header.format_revision = m_gpu_metrics_tbl.m_common_header.m_format_revision;
-    metrics_public_init.common_header.content_revision = m_gpu_metrics_tbl.m_common_header.m_content_revision;
-
-
-    // Temperature
-    metrics_public_init.temperature_hotspot = m_gpu_metrics_tbl.m_temperature_hotspot;
-    metrics_public_init.temperature_mem = m_gpu_metrics_tbl.m_temperature_mem;
-    metrics_public_init.temperature_vrsoc = m_gpu_metrics_tbl.m_temperature_vrsoc;
-
-    // Power
-    metrics_public_init.current_socket_power = m_gpu_metrics_tbl.m_current_socket_power;
-
-    // Utilization
-    metrics_public_init.average_gfx_activity = m_gpu_metrics_tbl.m_average_gfx_activity;
-    metrics_public_init.average_umc_activity = m_gpu_metrics_tbl.m_average_umc_activity;
-
-    // vcn_activity
-    const auto vcn_activity_num_elems =
-      static_cast<uint16_t>(
-        std::end(m_gpu_metrics_tbl.m_vcn_activity) -
-        std::begin(m_gpu_metrics_tbl.m_vcn_activity));
-    std::copy_n(std::begin(m_gpu_metrics_tbl.m_vcn_activity),
-                vcn_activity_num_elems,
-                metrics_public_init.vcn_activity);
-
-    // jpeg_activity
-    const auto jpeg_activity_num_elems =
-      static_cast<uint16_t>(
-        std::end(m_gpu_metrics_tbl.m_jpeg_activity) -
-        std::begin(m_gpu_metrics_tbl.m_jpeg_activity));
-    std::copy_n(std::begin(m_gpu_metrics_tbl.m_jpeg_activity),
-                jpeg_activity_num_elems,
-                metrics_public_init.jpeg_activity);
-
-    // Power/Energy
-    metrics_public_init.energy_accumulator = m_gpu_metrics_tbl.m_energy_accumulator;
-
-    // Driver attached timestamp (in ns)
-    metrics_public_init.system_clock_counter = m_gpu_metrics_tbl.m_system_clock_counter;
-
-    // Throttle status
-    metrics_public_init.throttle_status = m_gpu_metrics_tbl.m_throttle_status;
-
-    // Clock Lock Status. Each bit corresponds to clock instance
-    metrics_public_init.gfxclk_lock_status = m_gpu_metrics_tbl.m_gfxclk_lock_status;
-
-    // Link width (number of lanes) and speed
-    metrics_public_init.pcie_link_width = m_gpu_metrics_tbl.m_pcie_link_width;
-    metrics_public_init.pcie_link_speed = m_gpu_metrics_tbl.m_pcie_link_speed;
-
-    // XGMI bus width and bitrate
-    metrics_public_init.xgmi_link_width = m_gpu_metrics_tbl.m_xgmi_link_width;
-    metrics_public_init.xgmi_link_speed = m_gpu_metrics_tbl.m_xgmi_link_speed;
-
-    // Utilization Accumulated
-    metrics_public_init.gfx_activity_acc = m_gpu_metrics_tbl.m_gfx_activity_acc;
-    metrics_public_init.mem_activity_acc = m_gpu_metrics_tbl.m_mem_activity_acc;
-
-    // PCIE accumulated bandwidth
-    metrics_public_init.pcie_bandwidth_acc = m_gpu_metrics_tbl.m_pcie_bandwidth_acc;
-
-    // PCIE instantaneous bandwidth
-    metrics_public_init.pcie_bandwidth_inst = m_gpu_metrics_tbl.m_pcie_bandwidth_inst;
-
-    // PCIE L0 to recovery state transition accumulated count
-    metrics_public_init.pcie_l0_to_recov_count_acc = m_gpu_metrics_tbl.m_pcie_l0_to_recov_count_acc;
-
-    // PCIE replay accumulated count
-    metrics_public_init.pcie_replay_count_acc = m_gpu_metrics_tbl.m_pcie_replay_count_acc;
-
-    // PCIE replay rollover accumulated count
-    metrics_public_init.pcie_replay_rover_count_acc = m_gpu_metrics_tbl.m_pcie_replay_rover_count_acc;
-
-    // PCIE NAK sent accumulated count
-    metrics_public_init.pcie_nak_sent_count_acc = m_gpu_metrics_tbl.m_pcie_nak_sent_count_acc;
-
-    // PCIE NAK received accumulated count
-    metrics_public_init.pcie_nak_rcvd_count_acc = m_gpu_metrics_tbl.m_pcie_nak_rcvd_count_acc;
-
-    // XGMI accumulated data transfer size
-    // xgmi_read_data
-    const auto xgmi_read_data_num_elems =
-      static_cast<uint16_t>(
-        std::end(m_gpu_metrics_tbl.m_xgmi_read_data_acc) -
-        std::begin(m_gpu_metrics_tbl.m_xgmi_read_data_acc));
-    std::copy_n(std::begin(m_gpu_metrics_tbl.m_xgmi_read_data_acc),
-                xgmi_read_data_num_elems,
-                metrics_public_init.xgmi_read_data_acc);
-    // xgmi_write_data
-    const auto xgmi_write_data_num_elems =
-      static_cast<uint16_t>(
-        std::end(m_gpu_metrics_tbl.m_xgmi_write_data_acc) -
-        std::begin(m_gpu_metrics_tbl.m_xgmi_write_data_acc));
-    std::copy_n(std::begin(m_gpu_metrics_tbl.m_xgmi_write_data_acc),
-                xgmi_write_data_num_elems,
-                metrics_public_init.xgmi_write_data_acc);
-
-    // PMFW attached timestamp (10ns resolution)
-    metrics_public_init.firmware_timestamp = m_gpu_metrics_tbl.m_firmware_timestamp;
-
-    // Current clocks
-    // current_gfxclk
-    const auto curr_gfxclk_num_elems =
-      static_cast<uint16_t>(
-        std::end(m_gpu_metrics_tbl.m_current_gfxclk) -
-        std::begin(m_gpu_metrics_tbl.m_current_gfxclk));
-    std::copy_n(std::begin(m_gpu_metrics_tbl.m_current_gfxclk),
-                curr_gfxclk_num_elems,
-                metrics_public_init.current_gfxclks);
-
-    // current_socclk
-    const auto curr_socclk_num_elems =
-      static_cast<uint16_t>(
-        std::end(m_gpu_metrics_tbl.m_current_socclk) -
-        std::begin(m_gpu_metrics_tbl.m_current_socclk));
-    std::copy_n(std::begin(m_gpu_metrics_tbl.m_current_socclk),
-                curr_socclk_num_elems,
-                metrics_public_init.current_socclks);
-
-    // current_vclk0
-    const auto curr_vclk0_num_elems =
-      static_cast<uint16_t>(
-        std::end(m_gpu_metrics_tbl.m_current_vclk0) -
-        std::begin(m_gpu_metrics_tbl.m_current_vclk0));
-    std::copy_n(std::begin(m_gpu_metrics_tbl.m_current_vclk0),
-                curr_vclk0_num_elems,
-                metrics_public_init.current_vclk0s);
-
-    // current_dclk0
-    const auto curr_dclk0_num_elems =
-      static_cast<uint16_t>(
-        std::end(m_gpu_metrics_tbl.m_current_dclk0) -
-        std::begin(m_gpu_metrics_tbl.m_current_dclk0));
-    std::copy_n(std::begin(m_gpu_metrics_tbl.m_current_dclk0),
-                curr_dclk0_num_elems,
-                metrics_public_init.current_dclk0s);
-
-    metrics_public_init.current_uclk = m_gpu_metrics_tbl.m_current_uclk;
-
-    //
-    // Note:  Backwards compatibility -> Handling extra/exception cases
-    //        related to earlier versions (1.3)
-    metrics_public_init.current_gfxclk = metrics_public_init.current_gfxclks[0];
-    // metrics_public_init.average_gfxclk_frequency = metrics_public_init.current_gfxclks[0];
-
-    metrics_public_init.current_socclk = metrics_public_init.current_socclks[0];
-    // metrics_public_init.average_socclk_frequency = metrics_public_init.current_socclks[0];
-
-    metrics_public_init.current_vclk0 = metrics_public_init.current_vclk0s[0];
-    // metrics_public_init.average_vclk0_frequency = metrics_public_init.current_vclk0s[0];
-
-    metrics_public_init.current_vclk1 = metrics_public_init.current_vclk0s[1];
-    // metrics_public_init.average_vclk1_frequency = metrics_public_init.current_vclk0s[1];
-
-    metrics_public_init.current_dclk0 = metrics_public_init.current_dclk0s[0];
-    // metrics_public_init.average_dclk0_frequency = metrics_public_init.current_dclk0s[0];
-
-    metrics_public_init.current_dclk1 = metrics_public_init.current_dclk0s[1];
-    // metrics_public_init.average_dclk1_frequency = metrics_public_init.current_dclk0s[1];
-
-    return metrics_public_init;
-  }();
-
-  ss << __PRETTY_FUNCTION__
-              << " | ======= end ======= "
-              << " | Success "
-              << " | Returning = " << getRSMIStatusString(status_code)
-              << " |";
-  LOG_TRACE(ss);
-
-  return std::make_tuple(status_code, copy_data_from_internal_metrics_tbl);
-}
-
-AMGpuMetricsPublicLatestTupl_t GpuMetricsBase_v14_t::copy_internal_to_external_metrics()
-{
-  std::ostringstream ss;
-  auto status_code(rsmi_status_t::RSMI_STATUS_SUCCESS);
-  ss << __PRETTY_FUNCTION__ << " | ======= start =======";
-  LOG_TRACE(ss);
-
-  auto copy_data_from_internal_metrics_tbl = [&]() {
-    AMGpuMetricsPublicLatest_t metrics_public_init{};
-
-    //
-    //  Note: Initializing data members with their max. If field is max,
-    //        no data was assigned to it.
-    init_max_public_gpu_matrics(metrics_public_init);
-
-    // Header
-    metrics_public_init.common_header.structure_size = m_gpu_metrics_tbl.m_common_header.m_structure_size;
-    metrics_public_init.common_header.format_revision = m_gpu_metrics_tbl.m_common_header.m_format_revision;
-    metrics_public_init.common_header.content_revision = m_gpu_metrics_tbl.m_common_header.m_content_revision;
-
-
-    // Temperature
-    metrics_public_init.temperature_hotspot = m_gpu_metrics_tbl.m_temperature_hotspot;
-    metrics_public_init.temperature_mem = m_gpu_metrics_tbl.m_temperature_mem;
-    metrics_public_init.temperature_vrsoc = m_gpu_metrics_tbl.m_temperature_vrsoc;
-
-    // Power
-    metrics_public_init.current_socket_power = m_gpu_metrics_tbl.m_current_socket_power;
-
-    // Utilization
-    metrics_public_init.average_gfx_activity = m_gpu_metrics_tbl.m_average_gfx_activity;
-    metrics_public_init.average_umc_activity = m_gpu_metrics_tbl.m_average_umc_activity;
-
-    // vcn_activity
-    const auto vcn_activity_num_elems =
-      static_cast<uint16_t>(
-        std::end(m_gpu_metrics_tbl.m_vcn_activity) -
-        std::begin(m_gpu_metrics_tbl.m_vcn_activity));
-    std::copy_n(std::begin(m_gpu_metrics_tbl.m_vcn_activity),
-                vcn_activity_num_elems,
-                metrics_public_init.vcn_activity);
-
-    // Power/Energy
-    metrics_public_init.energy_accumulator = m_gpu_metrics_tbl.m_energy_accumulator;
-
-    // Driver attached timestamp (in ns)
-    metrics_public_init.system_clock_counter = m_gpu_metrics_tbl.m_system_clock_counter;
-
-    // Throttle status
-    metrics_public_init.throttle_status = m_gpu_metrics_tbl.m_throttle_status;
-
-    // Clock Lock Status. Each bit corresponds to clock instance
-    metrics_public_init.gfxclk_lock_status = m_gpu_metrics_tbl.m_gfxclk_lock_status;
-
-    // Link width (number of lanes) and speed
-    metrics_public_init.pcie_link_width = m_gpu_metrics_tbl.m_pcie_link_width;
-    metrics_public_init.pcie_link_speed = m_gpu_metrics_tbl.m_pcie_link_speed;
-
-    // XGMI bus width and bitrate
-    metrics_public_init.xgmi_link_width = m_gpu_metrics_tbl.m_xgmi_link_width;
-    metrics_public_init.xgmi_link_speed = m_gpu_metrics_tbl.m_xgmi_link_speed;
-
-    // Utilization Accumulated
-    metrics_public_init.gfx_activity_acc = m_gpu_metrics_tbl.m_gfx_activity_acc;
-    metrics_public_init.mem_activity_acc = m_gpu_metrics_tbl.m_mem_activity_acc;
-
-    // PCIE accumulated bandwidth
-    metrics_public_init.pcie_bandwidth_acc = m_gpu_metrics_tbl.m_pcie_bandwidth_acc;
-
-    // PCIE instantaneous bandwidth
-    metrics_public_init.pcie_bandwidth_inst = m_gpu_metrics_tbl.m_pcie_bandwidth_inst;
-
-    // PCIE L0 to recovery state transition accumulated count
-    metrics_public_init.pcie_l0_to_recov_count_acc = m_gpu_metrics_tbl.m_pcie_l0_to_recov_count_acc;
-
-    // PCIE replay accumulated count
-    metrics_public_init.pcie_replay_count_acc = m_gpu_metrics_tbl.m_pcie_replay_count_acc;
-
-    // PCIE replay rollover accumulated count
-    metrics_public_init.pcie_replay_rover_count_acc = m_gpu_metrics_tbl.m_pcie_replay_rover_count_acc;
-
-    // XGMI accumulated data transfer size
-    // xgmi_read_data
-    const auto xgmi_read_data_num_elems =
-      static_cast<uint16_t>(
-        std::end(m_gpu_metrics_tbl.m_xgmi_read_data_acc) -
-        std::begin(m_gpu_metrics_tbl.m_xgmi_read_data_acc));
-    std::copy_n(std::begin(m_gpu_metrics_tbl.m_xgmi_read_data_acc),
-                xgmi_read_data_num_elems,
-                metrics_public_init.xgmi_read_data_acc);
-    // xgmi_write_data
-    const auto xgmi_write_data_num_elems =
-      static_cast<uint16_t>(
-        std::end(m_gpu_metrics_tbl.m_xgmi_write_data_acc) -
-        std::begin(m_gpu_metrics_tbl.m_xgmi_write_data_acc));
-    std::copy_n(std::begin(m_gpu_metrics_tbl.m_xgmi_write_data_acc),
-                xgmi_write_data_num_elems,
-                metrics_public_init.xgmi_write_data_acc);
-
-    // PMFW attached timestamp (10ns resolution)
-    metrics_public_init.firmware_timestamp = m_gpu_metrics_tbl.m_firmware_timestamp;
-
-    // Current clocks
-    // current_gfxclk
-    const auto curr_gfxclk_num_elems =
-      static_cast<uint16_t>(
-        std::end(m_gpu_metrics_tbl.m_current_gfxclk) -
-        std::begin(m_gpu_metrics_tbl.m_current_gfxclk));
-    std::copy_n(std::begin(m_gpu_metrics_tbl.m_current_gfxclk),
-                curr_gfxclk_num_elems,
-                metrics_public_init.current_gfxclks);
-
-    // current_socclk
-    const auto curr_socclk_num_elems =
-      static_cast<uint16_t>(
-        std::end(m_gpu_metrics_tbl.m_current_socclk) -
-        std::begin(m_gpu_metrics_tbl.m_current_socclk));
-    std::copy_n(std::begin(m_gpu_metrics_tbl.m_current_socclk),
-                curr_socclk_num_elems,
-                metrics_public_init.current_socclks);
-
-    // current_vclk0
-    const auto curr_vclk0_num_elems =
-      static_cast<uint16_t>(
-        std::end(m_gpu_metrics_tbl.m_current_vclk0) -
-        std::begin(m_gpu_metrics_tbl.m_current_vclk0));
-    std::copy_n(std::begin(m_gpu_metrics_tbl.m_current_vclk0),
-                curr_vclk0_num_elems,
-                metrics_public_init.current_vclk0s);
-
-    // current_dclk0
-    const auto curr_dclk0_num_elems =
-      static_cast<uint16_t>(
-        std::end(m_gpu_metrics_tbl.m_current_dclk0) -
-        std::begin(m_gpu_metrics_tbl.m_current_dclk0));
-    std::copy_n(std::begin(m_gpu_metrics_tbl.m_current_dclk0),
-                curr_dclk0_num_elems,
-                metrics_public_init.current_dclk0s);
-
-    metrics_public_init.current_uclk = m_gpu_metrics_tbl.m_current_uclk;
-
-    //
-    // Note:  Backwards compatibility -> Handling extra/exception cases
-    //        related to earlier versions (1.3)
-    metrics_public_init.current_gfxclk = metrics_public_init.current_gfxclks[0];
-    // metrics_public_init.average_gfxclk_frequency = metrics_public_init.current_gfxclks[0];
-
-    metrics_public_init.current_socclk = metrics_public_init.current_socclks[0];
-    // metrics_public_init.average_socclk_frequency = metrics_public_init.current_socclks[0];
-
-    metrics_public_init.current_vclk0 = metrics_public_init.current_vclk0s[0];
-    // metrics_public_init.average_vclk0_frequency = metrics_public_init.current_vclk0s[0];
-
-    metrics_public_init.current_vclk1 = metrics_public_init.current_vclk0s[1];
-    // metrics_public_init.average_vclk1_frequency = metrics_public_init.current_vclk0s[1];
-
-    metrics_public_init.current_dclk0 = metrics_public_init.current_dclk0s[0];
-    // metrics_public_init.average_dclk0_frequency = metrics_public_init.current_dclk0s[0];
-
-    metrics_public_init.current_dclk1 = metrics_public_init.current_dclk0s[1];
-    // metrics_public_init.average_dclk1_frequency = metrics_public_init.current_dclk0s[1];
-
-    return metrics_public_init;
-  }();
+  }
 
   ss << __PRETTY_FUNCTION__
-              << " | ======= end ======= "
-              << " | Success "
-              << " | Returning = " << getRSMIStatusString(status_code)
-              << " |";
+     << " | ======= end ======= "
+     << " | Success "
+     << " | Returning = " << getRSMIStatusString(status_code)
+     << " |";
   LOG_TRACE(ss);
 
-  return std::make_tuple(status_code, copy_data_from_internal_metrics_tbl);
+  return status_code;
 }
 
 void GpuMetricsBase_v13_t::dump_internal_metrics_table()
@@ -3026,7 +2373,6 @@ rsmi_status_t GpuMetricsBase_v13_t::populate_metrics_dynamic_tbl() {
   ss << __PRETTY_FUNCTION__ << " | ======= start =======";
   LOG_TRACE(ss);
 
-  auto m_metrics_dynamic_tbl = AMDGpuDynamicMetricsTbl_t{};
   //
   //  Note: Any metric treatment/changes (if any) should happen before they
   //        get written to internal/external tables.
@@ -3055,215 +2401,7 @@ rsmi_status_t GpuMetricsBase_v13_t::populate_metrics_dynamic_tbl() {
   //  Adjustments/Changes specific to this version
   run_metric_adjustments_v13();
 
-  // Temperature Info
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricTemperature]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricTempEdge,
-              format_metric_row(m_gpu_metrics_tbl.m_temperature_edge,
-                                "temperature_edge"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricTemperature]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricTempHotspot,
-              format_metric_row(m_gpu_metrics_tbl.m_temperature_hotspot,
-                                "temperature_hotspot"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricTemperature]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricTempMem,
-              format_metric_row(m_gpu_metrics_tbl.m_temperature_mem,
-                                "temperature_mem"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricTemperature]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricTempVrGfx,
-              format_metric_row(m_gpu_metrics_tbl.m_temperature_vrgfx,
-                                "temperature_vrgfx"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricTemperature]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricTempVrSoc,
-              format_metric_row(m_gpu_metrics_tbl.m_temperature_vrsoc,
-                                "temperature_vrsoc"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricTemperature]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricTempVrMem,
-              format_metric_row(m_gpu_metrics_tbl.m_temperature_vrmem,
-                                "temperature_vrmem"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricTemperature]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricTempHbm,
-              format_metric_row(m_gpu_metrics_tbl.m_temperature_hbm,
-                                "[temperature_hbm]"))
-           );
-
-  // Power/Energy Info
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricPowerEnergy]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricAvgSocketPower,
-              format_metric_row(m_gpu_metrics_tbl.m_average_socket_power,
-                                "average_socket_power"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricPowerEnergy]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricEnergyAccumulator,
-              format_metric_row(m_gpu_metrics_tbl.m_energy_accumulator,
-                                "energy_acc"))
-           );
-
-  // Utilization Info
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricUtilization]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricAvgGfxActivity,
-              format_metric_row(m_gpu_metrics_tbl.m_average_gfx_activity,
-                                "average_gfx_activity"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricUtilization]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricAvgUmcActivity,
-              format_metric_row(m_gpu_metrics_tbl.m_average_umc_activity,
-                                "average_umc_activity"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricUtilization]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricAvgMmActivity,
-              format_metric_row(m_gpu_metrics_tbl.m_average_mm_activity,
-                                "average_mm_activity"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricUtilization]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricGfxActivityAccumulator,
-              format_metric_row(m_gpu_metrics_tbl.m_gfx_activity_acc,
-                                "gfx_activity_acc"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricUtilization]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricMemActivityAccumulator,
-              format_metric_row(m_gpu_metrics_tbl.m_mem_activity_acc,
-                                "mem_activity_acc"))
-           );
-
-  // Timestamp Info
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricTimestamp]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricTSFirmware,
-              format_metric_row(m_gpu_metrics_tbl.m_firmware_timestamp,
-                                "firmware_timestamp"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricTimestamp]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricTSClockCounter,
-              format_metric_row(m_gpu_metrics_tbl.m_system_clock_counter,
-                                "system_clock_counter"))
-           );
-
-  // Fan Info
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricCurrentFanSpeed]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricCurrFanSpeed,
-              format_metric_row(m_gpu_metrics_tbl.m_current_fan_speed,
-                                "current_fan_speed"))
-           );
-
-  // Throttle Info
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricThrottleStatus]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricThrottleStatus,
-              format_metric_row(m_gpu_metrics_tbl.m_throttle_status,
-                                "throttle_status"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricThrottleStatus]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricIndepThrottleStatus,
-              format_metric_row(m_gpu_metrics_tbl.m_indep_throttle_status,
-                                "indep_throttle_status"))
-           );
-
-  // Average Info
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricAverageClock]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricAvgGfxClockFrequency,
-              format_metric_row(m_gpu_metrics_tbl.m_average_gfxclk_frequency,
-                                "average_gfxclk_frequency"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricAverageClock]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricAvgSocClockFrequency,
-              format_metric_row(m_gpu_metrics_tbl.m_average_socclk_frequency,
-                                "average_socclk_frequency"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricAverageClock]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricAvgUClockFrequency,
-              format_metric_row(m_gpu_metrics_tbl.m_average_uclk_frequency,
-                                "average_uclk_frequency"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricAverageClock]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricAvgVClock0Frequency,
-              format_metric_row(m_gpu_metrics_tbl.m_average_vclk0_frequency,
-                                "average_vclk0_frequency"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricAverageClock]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricAvgDClock0Frequency,
-              format_metric_row(m_gpu_metrics_tbl.m_average_dclk0_frequency,
-                                "average_dclk0_frequency"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricAverageClock]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricAvgVClock1Frequency,
-              format_metric_row(m_gpu_metrics_tbl.m_average_vclk1_frequency,
-                                "average_vclk1_frequency"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricAverageClock]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricAvgDClock1Frequency,
-              format_metric_row(m_gpu_metrics_tbl.m_average_dclk1_frequency,
-                                "average_dclk1_frequency"))
-           );
-
-  // CurrentClock Info
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricCurrentClock]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricCurrGfxClock,
-              format_metric_row(m_gpu_metrics_tbl.m_current_gfxclk,
-                                "current_gfxclk"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricCurrentClock]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricCurrSocClock,
-              format_metric_row(m_gpu_metrics_tbl.m_current_socclk,
-                                "current_socclk"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricCurrentClock]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricCurrUClock,
-              format_metric_row(m_gpu_metrics_tbl.m_current_uclk,
-                                "current_uclk"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricCurrentClock]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricCurrVClock0,
-              format_metric_row(m_gpu_metrics_tbl.m_current_vclk0,
-                                "current_vclk0"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricCurrentClock]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricCurrDClock0,
-              format_metric_row(m_gpu_metrics_tbl.m_current_dclk0,
-                                "current_dclk0"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricCurrentClock]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricCurrVClock1,
-              format_metric_row(m_gpu_metrics_tbl.m_current_vclk1,
-                                "current_vclk1"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricCurrentClock]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricCurrDClock1,
-              format_metric_row(m_gpu_metrics_tbl.m_current_dclk1,
-                                "current_dclk1"))
-           );
-
-  // Link/Width/Speed Info
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricLinkWidthSpeed]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricPcieLinkWidth,
-              format_metric_row(m_gpu_metrics_tbl.m_pcie_link_width,
-                                "pcie_link_width"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricLinkWidthSpeed]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricPcieLinkSpeed,
-              format_metric_row(m_gpu_metrics_tbl.m_pcie_link_speed,
-                                "pcie_link_speed"))
-           );
-
-  // Voltage Info
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricVoltage]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricVoltageSoc,
-              format_metric_row(m_gpu_metrics_tbl.m_voltage_soc,
-                                "voltage_soc"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricVoltage]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricVoltageGfx,
-              format_metric_row(m_gpu_metrics_tbl.m_voltage_gfx,
-                                "voltage_gfx"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricVoltage]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricVoltageMem,
-              format_metric_row(m_gpu_metrics_tbl.m_voltage_mem,
-                                "voltage_mem"))
-           );
+  decode_metrics_fields(m_gpu_metrics_tbl, kAMDGpuMetricFields_v13);
 
   ss << __PRETTY_FUNCTION__
               << " | ======= end ======= "
@@ -3272,147 +2410,15 @@ rsmi_status_t GpuMetricsBase_v13_t::populate_metrics_dynamic_tbl() {
               << " |";
   LOG_TRACE(ss);
 
-  // Copy to base class
-  std::copy(m_metrics_dynamic_tbl.begin(),
-            m_metrics_dynamic_tbl.end(),
-            std::inserter(GpuMetricsBase_t::m_base_metrics_dynamic_tbl,
-                          GpuMetricsBase_t::m_base_metrics_dynamic_tbl.end()));
-
   return status_code;
 }
 
-AMGpuMetricsPublicLatestTupl_t GpuMetricsBase_v13_t::copy_internal_to_external_metrics()
-{
-  std::ostringstream ss;
-  auto status_code(rsmi_status_t::RSMI_STATUS_SUCCESS);
-  ss << __PRETTY_FUNCTION__ << " | ======= start =======";
-  LOG_TRACE(ss);
-
-  auto copy_data_from_internal_metrics_tbl = [&]() {
-    AMGpuMetricsPublicLatest_t metrics_public_init{};
-
-    //
-    //  Note: Initializing data members with their max. If field is max,
-    //        no data was assigned to it.
-    init_max_public_gpu_matrics(metrics_public_init);
-
-    // Header
-    metrics_public_init.common_header.structure_size = m_gpu_metrics_tbl.m_common_header.m_structure_size;
-    metrics_public_init.common_header.format_revision = m_gpu_metrics_tbl.m_common_header.m_format_revision;
-    metrics_public_init.common_header.content_revision = m_gpu_metrics_tbl.m_common_header.m_content_revision;
-
-    // Temperature
-    metrics_public_init.temperature_edge = m_gpu_metrics_tbl.m_temperature_edge;
-    metrics_public_init.temperature_hotspot = m_gpu_metrics_tbl.m_temperature_hotspot;
-    metrics_public_init.temperature_mem = m_gpu_metrics_tbl.m_temperature_mem;
-    metrics_public_init.temperature_vrgfx = m_gpu_metrics_tbl.m_temperature_vrgfx;
-    metrics_public_init.temperature_vrsoc = m_gpu_metrics_tbl.m_temperature_vrsoc;
-    metrics_public_init.temperature_vrmem = m_gpu_metrics_tbl.m_temperature_vrmem;
-
-    // Utilization
-    metrics_public_init.average_gfx_activity = m_gpu_metrics_tbl.m_average_gfx_activity;
-    metrics_public_init.average_umc_activity = m_gpu_metrics_tbl.m_average_umc_activity;
-    metrics_public_init.average_mm_activity = m_gpu_metrics_tbl.m_average_mm_activity;
-
-    // Power/Energy
-    metrics_public_init.average_socket_power = m_gpu_metrics_tbl.m_average_socket_power;  // 1.3 and 1.4 have the same value
-    metrics_public_init.energy_accumulator = m_gpu_metrics_tbl.m_energy_accumulator;
-
-    // Driver attached timestamp (in ns)
-    metrics_public_init.system_clock_counter = m_gpu_metrics_tbl.m_system_clock_counter;
-
-    // Average clocks
-    metrics_public_init.average_gfxclk_frequency = m_gpu_metrics_tbl.m_average_gfxclk_frequency;
-    metrics_public_init.average_socclk_frequency = m_gpu_metrics_tbl.m_average_socclk_frequency;
-    metrics_public_init.average_uclk_frequency = m_gpu_metrics_tbl.m_average_uclk_frequency;
-    metrics_public_init.average_vclk0_frequency = m_gpu_metrics_tbl.m_average_vclk0_frequency;
-    metrics_public_init.average_dclk0_frequency = m_gpu_metrics_tbl.m_average_dclk0_frequency;
-    metrics_public_init.average_vclk1_frequency = m_gpu_metrics_tbl.m_average_vclk1_frequency;
-    metrics_public_init.average_dclk1_frequency = m_gpu_metrics_tbl.m_average_dclk1_frequency;
-
-    // Current clocks
-    metrics_public_init.current_gfxclk = m_gpu_metrics_tbl.m_current_gfxclk;
-    metrics_public_init.current_gfxclks[0] = m_gpu_metrics_tbl.m_current_gfxclk;
-    metrics_public_init.current_socclk = m_gpu_metrics_tbl.m_current_socclk;
-    metrics_public_init.current_socclks[0] = m_gpu_metrics_tbl.m_current_socclk;
-    metrics_public_init.current_vclk0 = m_gpu_metrics_tbl.m_current_vclk0;
-    metrics_public_init.current_vclk0s[0] = m_gpu_metrics_tbl.m_current_vclk0;
-    metrics_public_init.current_dclk0 = m_gpu_metrics_tbl.m_current_dclk0;
-    metrics_public_init.current_dclk0s[0] = m_gpu_metrics_tbl.m_current_dclk0;
-    metrics_public_init.current_uclk = m_gpu_metrics_tbl.m_current_uclk;
-    metrics_public_init.current_vclk1 = m_gpu_metrics_tbl.m_current_vclk1;
-    metrics_public_init.current_dclk1 = m_gpu_metrics_tbl.m_current_dclk1;
-
-    // Throttle status
-    metrics_public_init.throttle_status = m_gpu_metrics_tbl.m_throttle_status;
-
-    // Fans
-    metrics_public_init.current_fan_speed = m_gpu_metrics_tbl.m_current_fan_speed;
-
-    // Link width/speed
-    metrics_public_init.pcie_link_width = m_gpu_metrics_tbl.m_pcie_link_width;
-    metrics_public_init.pcie_link_speed = m_gpu_metrics_tbl.m_pcie_link_speed;
-
-    metrics_public_init.gfx_activity_acc = m_gpu_metrics_tbl.m_gfx_activity_acc;
-    metrics_public_init.mem_activity_acc = m_gpu_metrics_tbl.m_mem_activity_acc;
-
-    // temperature_hbm
-    const auto temp_hbm_num_elems =
-      static_cast<uint16_t>(
-        std::end(m_gpu_metrics_tbl.m_temperature_hbm) -
-        std::begin(m_gpu_metrics_tbl.m_temperature_hbm));
-    std::copy_n(std::begin(m_gpu_metrics_tbl.m_temperature_hbm),
-                temp_hbm_num_elems,
-                metrics_public_init.temperature_hbm);
-
-    // PMFW attached timestamp (10ns resolution)
-    metrics_public_init.firmware_timestamp = m_gpu_metrics_tbl.m_firmware_timestamp;
-
-    // Voltage (mV)
-    metrics_public_init.voltage_soc = m_gpu_metrics_tbl.m_voltage_soc;
-    metrics_public_init.voltage_gfx = m_gpu_metrics_tbl.m_voltage_gfx;
-    metrics_public_init.voltage_mem = m_gpu_metrics_tbl.m_voltage_mem;
-
-    // Throttle status
-    metrics_public_init.indep_throttle_status = m_gpu_metrics_tbl.m_indep_throttle_status;
-
-    //
-    // Note:  Backwards compatibility -> Handling extra/exception cases
-    //        related to earlier versions (1.2)
-    // metrics_public_init.current_socket_power = metrics_public_init.average_socket_power;
-    // average_mm_activity needs to not be UIN16_MAX and
-    // metrics_public_init.vcn_activity[0] should also be UIN16_MAX
-    if (metrics_public_init.average_mm_activity != UINT16_MAX
-        && metrics_public_init.vcn_activity[0] == UINT16_MAX) {
-      metrics_public_init.vcn_activity[0] = metrics_public_init.average_mm_activity;
-    }
-    // average_mm_activity needs to not be UIN16_MAX and
-    // metrics_public_init.xcp_stats->vcn_busy[0] should also be UIN16_MAX
-    if (metrics_public_init.average_mm_activity != UINT16_MAX
-        && metrics_public_init.xcp_stats->vcn_busy[0] == UINT16_MAX) {
-      metrics_public_init.xcp_stats->vcn_busy[0] = metrics_public_init.average_mm_activity;
-    }
-
-    return metrics_public_init;
-  }();
-
-  ss << __PRETTY_FUNCTION__
-              << " | ======= end ======= "
-              << " | Success "
-              << " | Returning = " << getRSMIStatusString(status_code)
-              << " |";
-  LOG_TRACE(ss);
-
-  return std::make_tuple(status_code, copy_data_from_internal_metrics_tbl);
-}
-
 rsmi_status_t GpuMetricsBase_v12_t::populate_metrics_dynamic_tbl() {
   std::ostringstream ss;
   auto status_code(rsmi_status_t::RSMI_STATUS_SUCCESS);
   ss << __PRETTY_FUNCTION__ << " | ======= start =======";
   LOG_TRACE(ss);
 
-  auto m_metrics_dynamic_tbl = AMDGpuDynamicMetricsTbl_t{};
   //
   //  Note: Any metric treatment/changes (if any) should happen before they
   //        get written to internal/external tables.
@@ -3441,193 +2447,7 @@ rsmi_status_t GpuMetricsBase_v12_t::populate_metrics_dynamic_tbl() {
   //  Adjustments/Changes specific to this version
   run_metric_adjustments_v12();
 
-  // Temperature Info
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricTemperature]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricTempEdge,
-              format_metric_row(m_gpu_metrics_tbl.m_temperature_edge,
-                                "temperature_edge"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricTemperature]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricTempHotspot,
-              format_metric_row(m_gpu_metrics_tbl.m_temperature_hotspot,
-                                "temperature_hotspot"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricTemperature]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricTempMem,
-              format_metric_row(m_gpu_metrics_tbl.m_temperature_mem,
-                                "temperature_mem"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricTemperature]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricTempVrGfx,
-              format_metric_row(m_gpu_metrics_tbl.m_temperature_vrgfx,
-                                "temperature_vrgfx"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricTemperature]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricTempVrSoc,
-              format_metric_row(m_gpu_metrics_tbl.m_temperature_vrsoc,
-                                "temperature_vrsoc"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricTemperature]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricTempVrMem,
-              format_metric_row(m_gpu_metrics_tbl.m_temperature_vrmem,
-                                "temperature_vrmem"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricTemperature]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricTempHbm,
-              format_metric_row(m_gpu_metrics_tbl.m_temperature_hbm,
-                                "[temperature_hbm]"))
-           );
-
-  // Power/Energy Info
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricPowerEnergy]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricAvgSocketPower,
-              format_metric_row(m_gpu_metrics_tbl.m_average_socket_power,
-                                "average_socket_power"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricPowerEnergy]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricEnergyAccumulator,
-              format_metric_row(m_gpu_metrics_tbl.m_energy_accumulator,
-                                "energy_acc"))
-           );
-
-  // Utilization Info
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricUtilization]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricAvgGfxActivity,
-              format_metric_row(m_gpu_metrics_tbl.m_average_gfx_activity,
-                                "average_gfx_activity"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricUtilization]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricAvgUmcActivity,
-              format_metric_row(m_gpu_metrics_tbl.m_average_umc_activity,
-                                "average_umc_activity"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricUtilization]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricAvgMmActivity,
-              format_metric_row(m_gpu_metrics_tbl.m_average_mm_activity,
-                                "average_mm_activity"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricUtilization]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricGfxActivityAccumulator,
-              format_metric_row(m_gpu_metrics_tbl.m_gfx_activity_acc,
-                                "gfx_activity_acc"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricUtilization]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricMemActivityAccumulator,
-              format_metric_row(m_gpu_metrics_tbl.m_mem_activity_acc,
-                                "mem_activity_acc"))
-           );
-
-  // Timestamp Info
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricTimestamp]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricTSFirmware,
-              format_metric_row(m_gpu_metrics_tbl.m_firmware_timestamp,
-                                "firmware_timestamp"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricTimestamp]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricTSClockCounter,
-              format_metric_row(m_gpu_metrics_tbl.m_system_clock_counter,
-                                "system_clock_counter"))
-           );
-
-  // Fan Info
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricCurrentFanSpeed]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricCurrFanSpeed,
-              format_metric_row(m_gpu_metrics_tbl.m_current_fan_speed,
-                                "current_fan_speed"))
-           );
-
-  // Throttle Info
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricThrottleStatus]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricThrottleStatus,
-              format_metric_row(m_gpu_metrics_tbl.m_throttle_status,
-                                "throttle_status"))
-           );
-
-  // Average Info
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricAverageClock]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricAvgGfxClockFrequency,
-              format_metric_row(m_gpu_metrics_tbl.m_average_gfxclk_frequency,
-                                "average_gfxclk_frequency"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricAverageClock]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricAvgSocClockFrequency,
-              format_metric_row(m_gpu_metrics_tbl.m_average_socclk_frequency,
-                                "average_socclk_frequency"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricAverageClock]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricAvgUClockFrequency,
-              format_metric_row(m_gpu_metrics_tbl.m_average_uclk_frequency,
-                                "average_uclk_frequency"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricAverageClock]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricAvgVClock0Frequency,
-              format_metric_row(m_gpu_metrics_tbl.m_average_vclk0_frequency,
-                                "average_vclk0_frequency"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricAverageClock]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricAvgDClock0Frequency,
-              format_metric_row(m_gpu_metrics_tbl.m_average_dclk0_frequency,
-                                "average_dclk0_frequency"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricAverageClock]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricAvgVClock1Frequency,
-              format_metric_row(m_gpu_metrics_tbl.m_average_vclk1_frequency,
-                                "average_vclk1_frequency"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricAverageClock]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricAvgDClock1Frequency,
-              format_metric_row(m_gpu_metrics_tbl.m_average_dclk1_frequency,
-                                "average_dclk1_frequency"))
-           );
-
-  // CurrentClock Info
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricCurrentClock]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricCurrGfxClock,
-              format_metric_row(m_gpu_metrics_tbl.m_current_gfxclk,
-                                "current_gfxclk"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricCurrentClock]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricCurrSocClock,
-              format_metric_row(m_gpu_metrics_tbl.m_current_socclk,
-                                "current_socclk"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricCurrentClock]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricCurrUClock,
-              format_metric_row(m_gpu_metrics_tbl.m_current_uclk,
-                                "current_uclk"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricCurrentClock]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricCurrVClock0,
-              format_metric_row(m_gpu_metrics_tbl.m_current_vclk0,
-                                "current_vclk0"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricCurrentClock]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricCurrDClock0,
-              format_metric_row(m_gpu_metrics_tbl.m_current_dclk0,
-                                "current_dclk0"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricCurrentClock]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricCurrVClock1,
-              format_metric_row(m_gpu_metrics_tbl.m_current_vclk1,
-                                "current_vclk1"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricCurrentClock]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricCurrDClock1,
-              format_metric_row(m_gpu_metrics_tbl.m_current_dclk1,
-                                "current_dclk1"))
-           );
-
-  // Link/Width/Speed Info
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricLinkWidthSpeed]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricPcieLinkWidth,
-              format_metric_row(m_gpu_metrics_tbl.m_pcie_link_width,
-                                "pcie_link_width"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricLinkWidthSpeed]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricPcieLinkSpeed,
-              format_metric_row(m_gpu_metrics_tbl.m_pcie_link_speed,
-                                "pcie_link_speed"))
-           );
+  decode_metrics_fields(m_gpu_metrics_tbl, kAMDGpuMetricFields_v12);
 
   ss << __PRETTY_FUNCTION__
               << " | ======= end ======= "
@@ -3636,123 +2456,15 @@ rsmi_status_t GpuMetricsBase_v12_t::populate_metrics_dynamic_tbl() {
               << " |";
   LOG_TRACE(ss);
 
-  // Copy to base class
-  std::copy(m_metrics_dynamic_tbl.begin(),
-            m_metrics_dynamic_tbl.end(),
-            std::inserter(GpuMetricsBase_t::m_base_metrics_dynamic_tbl,
-                          GpuMetricsBase_t::m_base_metrics_dynamic_tbl.end()));
-
   return status_code;
 }
 
-AMGpuMetricsPublicLatestTupl_t GpuMetricsBase_v12_t::copy_internal_to_external_metrics()
-{
-  std::ostringstream ss;
-  auto status_code(rsmi_status_t::RSMI_STATUS_SUCCESS);
-  ss << __PRETTY_FUNCTION__ << " | ======= start =======";
-  LOG_TRACE(ss);
-
-  auto copy_data_from_internal_metrics_tbl = [&]() {
-    AMGpuMetricsPublicLatest_t metrics_public_init{};
-
-    //
-    //  Note: Initializing data members with their max. If field is max,
-    //        no data was assigned to it.
-    init_max_public_gpu_matrics(metrics_public_init);
-
-    // Header
-    metrics_public_init.common_header.structure_size = m_gpu_metrics_tbl.m_common_header.m_structure_size;
-    metrics_public_init.common_header.format_revision = m_gpu_metrics_tbl.m_common_header.m_format_revision;
-    metrics_public_init.common_header.content_revision = m_gpu_metrics_tbl.m_common_header.m_content_revision;
-
-    // Temperature
-    metrics_public_init.temperature_edge = m_gpu_metrics_tbl.m_temperature_edge;
-    metrics_public_init.temperature_hotspot = m_gpu_metrics_tbl.m_temperature_hotspot;
-    metrics_public_init.temperature_mem = m_gpu_metrics_tbl.m_temperature_mem;
-    metrics_public_init.temperature_vrgfx = m_gpu_metrics_tbl.m_temperature_vrgfx;
-    metrics_public_init.temperature_vrsoc = m_gpu_metrics_tbl.m_temperature_vrsoc;
-    metrics_public_init.temperature_vrmem = m_gpu_metrics_tbl.m_temperature_vrmem;
-
-    // Utilization
-    metrics_public_init.average_gfx_activity = m_gpu_metrics_tbl.m_average_gfx_activity;
-    metrics_public_init.average_umc_activity = m_gpu_metrics_tbl.m_average_umc_activity;
-    metrics_public_init.average_mm_activity = m_gpu_metrics_tbl.m_average_mm_activity;
-
-    // Power/Energy
-    metrics_public_init.average_socket_power = m_gpu_metrics_tbl.m_average_socket_power;
-    metrics_public_init.energy_accumulator = m_gpu_metrics_tbl.m_energy_accumulator;
-
-    // Driver attached timestamp (in ns)
-    metrics_public_init.system_clock_counter = m_gpu_metrics_tbl.m_system_clock_counter;
-
-    // Average clocks
-    metrics_public_init.average_gfxclk_frequency = m_gpu_metrics_tbl.m_average_gfxclk_frequency;
-    metrics_public_init.average_socclk_frequency = m_gpu_metrics_tbl.m_average_socclk_frequency;
-    metrics_public_init.average_uclk_frequency = m_gpu_metrics_tbl.m_average_uclk_frequency;
-    metrics_public_init.average_vclk0_frequency = m_gpu_metrics_tbl.m_average_vclk0_frequency;
-    metrics_public_init.average_dclk0_frequency = m_gpu_metrics_tbl.m_average_dclk0_frequency;
-    metrics_public_init.average_vclk1_frequency = m_gpu_metrics_tbl.m_average_vclk1_frequency;
-    metrics_public_init.average_dclk1_frequency = m_gpu_metrics_tbl.m_average_dclk1_frequency;
-
-    // Current clocks
-    metrics_public_init.current_gfxclk = m_gpu_metrics_tbl.m_current_gfxclk;
-    metrics_public_init.current_socclk = m_gpu_metrics_tbl.m_current_socclk;
-    metrics_public_init.current_vclk0 = m_gpu_metrics_tbl.m_current_vclk0;
-    metrics_public_init.current_dclk0 = m_gpu_metrics_tbl.m_current_dclk0;
-    metrics_public_init.current_uclk = m_gpu_metrics_tbl.m_current_uclk;
-    metrics_public_init.current_vclk1 = m_gpu_metrics_tbl.m_current_vclk1;
-    metrics_public_init.current_dclk1 = m_gpu_metrics_tbl.m_current_dclk1;
-
-    // Throttle status
-    metrics_public_init.throttle_status = m_gpu_metrics_tbl.m_throttle_status;
-
-    // Fans
-    metrics_public_init.current_fan_speed = m_gpu_metrics_tbl.m_current_fan_speed;
-
-    // Link width/speed
-    metrics_public_init.pcie_link_width = m_gpu_metrics_tbl.m_pcie_link_width;
-    metrics_public_init.pcie_link_speed = m_gpu_metrics_tbl.m_pcie_link_speed;
-
-    metrics_public_init.gfx_activity_acc = m_gpu_metrics_tbl.m_gfx_activity_acc;
-    metrics_public_init.mem_activity_acc = m_gpu_metrics_tbl.m_mem_activity_acc;
-
-    // temperature_hbm
-    const auto temp_hbm_num_elems =
-      static_cast<uint16_t>(
-        std::end(m_gpu_metrics_tbl.m_temperature_hbm) -
-        std::begin(m_gpu_metrics_tbl.m_temperature_hbm));
-    std::copy_n(std::begin(m_gpu_metrics_tbl.m_temperature_hbm),
-                temp_hbm_num_elems,
-                metrics_public_init.temperature_hbm);
-
-    // PMFW attached timestamp (10ns resolution)
-    metrics_public_init.firmware_timestamp = m_gpu_metrics_tbl.m_firmware_timestamp;
-
-    //
-    // Note:  Backwards compatibility -> Handling extra/exception cases
-    //        related to earlier versions (1.1)
-
-
-    return metrics_public_init;
-  }();
-
-  ss << __PRETTY_FUNCTION__
-              << " | ======= end ======= "
-              << " | Success "
-              << " | Returning = " << getRSMIStatusString(status_code)
-              << " |";
-  LOG_TRACE(ss);
-
-  return std::make_tuple(status_code, copy_data_from_internal_metrics_tbl);
-}
-
 rsmi_status_t GpuMetricsBase_v11_t::populate_metrics_dynamic_tbl() {
   std::ostringstream ss;
   auto status_code(rsmi_status_t::RSMI_STATUS_SUCCESS);
   ss << __PRETTY_FUNCTION__ << " | ======= start =======";
   LOG_TRACE(ss);
 
-  auto m_metrics_dynamic_tbl = AMDGpuDynamicMetricsTbl_t{};
   //
   //  Note: Any metric treatment/changes (if any) should happen before they
   //        get written to internal/external tables.
@@ -3773,188 +2485,7 @@ rsmi_status_t GpuMetricsBase_v11_t::populate_metrics_dynamic_tbl() {
   //  Adjustments/Changes specific to this version
   run_metric_adjustments_v11();
 
-  // Temperature Info
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricTemperature]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricTempEdge,
-              format_metric_row(m_gpu_metrics_tbl.m_temperature_edge,
-                                "temperature_edge"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricTemperature]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricTempHotspot,
-              format_metric_row(m_gpu_metrics_tbl.m_temperature_hotspot,
-                                "temperature_hotspot"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricTemperature]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricTempMem,
-              format_metric_row(m_gpu_metrics_tbl.m_temperature_mem,
-                                "temperature_mem"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricTemperature]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricTempVrGfx,
-              format_metric_row(m_gpu_metrics_tbl.m_temperature_vrgfx,
-                                "temperature_vrgfx"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricTemperature]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricTempVrSoc,
-              format_metric_row(m_gpu_metrics_tbl.m_temperature_vrsoc,
-                                "temperature_vrsoc"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricTemperature]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricTempVrMem,
-              format_metric_row(m_gpu_metrics_tbl.m_temperature_vrmem,
-                                "temperature_vrmem"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricTemperature]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricTempHbm,
-              format_metric_row(m_gpu_metrics_tbl.m_temperature_hbm,
-                                "[temperature_hbm]"))
-           );
-
-  // Power/Energy Info
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricPowerEnergy]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricAvgSocketPower,
-              format_metric_row(m_gpu_metrics_tbl.m_average_socket_power,
-                                "average_socket_power"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricPowerEnergy]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricEnergyAccumulator,
-              format_metric_row(m_gpu_metrics_tbl.m_energy_accumulator,
-                                "energy_acc"))
-           );
-
-  // Utilization Info
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricUtilization]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricAvgGfxActivity,
-              format_metric_row(m_gpu_metrics_tbl.m_average_gfx_activity,
-                                "average_gfx_activity"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricUtilization]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricAvgUmcActivity,
-              format_metric_row(m_gpu_metrics_tbl.m_average_umc_activity,
-                                "average_umc_activity"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricUtilization]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricAvgMmActivity,
-              format_metric_row(m_gpu_metrics_tbl.m_average_mm_activity,
-                                "average_mm_activity"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricUtilization]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricGfxActivityAccumulator,
-              format_metric_row(m_gpu_metrics_tbl.m_gfx_activity_acc,
-                                "gfx_activity_acc"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricUtilization]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricMemActivityAccumulator,
-              format_metric_row(m_gpu_metrics_tbl.m_mem_activity_acc,
-                                "mem_activity_acc"))
-           );
-
-  // Timestamp Info
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricTimestamp]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricTSClockCounter,
-              format_metric_row(m_gpu_metrics_tbl.m_system_clock_counter,
-                                "system_clock_counter"))
-           );
-
-  // Fan Info
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricCurrentFanSpeed]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricCurrFanSpeed,
-              format_metric_row(m_gpu_metrics_tbl.m_current_fan_speed,
-                                "current_fan_speed"))
-           );
-
-  // Throttle Info
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricThrottleStatus]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricThrottleStatus,
-              format_metric_row(m_gpu_metrics_tbl.m_throttle_status,
-                                "throttle_status"))
-           );
-
-  // Average Info
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricAverageClock]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricAvgGfxClockFrequency,
-              format_metric_row(m_gpu_metrics_tbl.m_average_gfxclk_frequency,
-                                "average_gfxclk_frequency"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricAverageClock]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricAvgSocClockFrequency,
-              format_metric_row(m_gpu_metrics_tbl.m_average_socclk_frequency,
-                                "average_socclk_frequency"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricAverageClock]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricAvgUClockFrequency,
-              format_metric_row(m_gpu_metrics_tbl.m_average_uclk_frequency,
-                                "average_uclk_frequency"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricAverageClock]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricAvgVClock0Frequency,
-              format_metric_row(m_gpu_metrics_tbl.m_average_vclk0_frequency,
-                                "average_vclk0_frequency"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricAverageClock]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricAvgDClock0Frequency,
-              format_metric_row(m_gpu_metrics_tbl.m_average_dclk0_frequency,
-                                "average_dclk0_frequency"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricAverageClock]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricAvgVClock1Frequency,
-              format_metric_row(m_gpu_metrics_tbl.m_average_vclk1_frequency,
-                                "average_vclk1_frequency"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricAverageClock]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricAvgDClock1Frequency,
-              format_metric_row(m_gpu_metrics_tbl.m_average_dclk1_frequency,
-                                "average_dclk1_frequency"))
-           );
-
-  // CurrentClock Info
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricCurrentClock]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricCurrGfxClock,
-              format_metric_row(m_gpu_metrics_tbl.m_current_gfxclk,
-                                "current_gfxclk"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricCurrentClock]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricCurrSocClock,
-              format_metric_row(m_gpu_metrics_tbl.m_current_socclk,
-                                "current_socclk"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricCurrentClock]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricCurrUClock,
-              format_metric_row(m_gpu_metrics_tbl.m_current_uclk,
-                                "current_uclk"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricCurrentClock]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricCurrVClock0,
-              format_metric_row(m_gpu_metrics_tbl.m_current_vclk0,
-                                "current_vclk0"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricCurrentClock]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricCurrDClock0,
-              format_metric_row(m_gpu_metrics_tbl.m_current_dclk0,
-                                "current_dclk0"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricCurrentClock]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricCurrVClock1,
-              format_metric_row(m_gpu_metrics_tbl.m_current_vclk1,
-                                "current_vclk1"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricCurrentClock]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricCurrDClock1,
-              format_metric_row(m_gpu_metrics_tbl.m_current_dclk1,
-                                "current_dclk1"))
-           );
-
-  // Link/Width/Speed Info
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricLinkWidthSpeed]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricPcieLinkWidth,
-              format_metric_row(m_gpu_metrics_tbl.m_pcie_link_width,
-                                "pcie_link_width"))
-           );
-  m_metrics_dynamic_tbl[AMDGpuMetricsClassId_t::kGpuMetricLinkWidthSpeed]
-    .insert(std::make_pair(AMDGpuMetricsUnitType_t::kMetricPcieLinkSpeed,
-              format_metric_row(m_gpu_metrics_tbl.m_pcie_link_speed,
-                                "pcie_link_speed"))
-           );
+  decode_metrics_fields(m_gpu_metrics_tbl, kAMDGpuMetricFields_v11);
 
   ss << __PRETTY_FUNCTION__
               << " | ======= end ======= "
@@ -3963,114 +2494,9 @@ rsmi_status_t GpuMetricsBase_v11_t::populate_metrics_dynamic_tbl() {
               << " |";
   LOG_TRACE(ss);
 
-  // Copy to base class
-  std::copy(m_metrics_dynamic_tbl.begin(),
-            m_metrics_dynamic_tbl.end(),
-            std::inserter(GpuMetricsBase_t::m_base_metrics_dynamic_tbl,
-                          GpuMetricsBase_t::m_base_metrics_dynamic_tbl.end()));
-
   return status_code;
 }
 
-AMGpuMetricsPublicLatestTupl_t GpuMetricsBase_v11_t::copy_internal_to_external_metrics()
-{
-  std::ostringstream ss;
-  auto status_code(rsmi_status_t::RSMI_STATUS_SUCCESS);
-  ss << __PRETTY_FUNCTION__ << " | ======= start =======";
-  LOG_TRACE(ss);
-
-  auto copy_data_from_internal_metrics_tbl = [&]() {
-    AMGpuMetricsPublicLatest_t metrics_public_init{};
-
-    //
-    //  Note: Initializing data members with their max. If field is max,
-    //        no data was assigned to it.
-    init_max_public_gpu_matrics(metrics_public_init);
-
-    // Header
-    metrics_public_init.common_header.structure_size = m_gpu_metrics_tbl.m_common_header.m_structure_size;
-    metrics_public_init.common_header.format_revision = m_gpu_metrics_tbl.m_common_header.m_format_revision;
-    metrics_public_init.common_header.content_revision = m_gpu_metrics_tbl.m_common_header.m_content_revision;
-
-    // Temperature
-    metrics_public_init.temperature_edge = m_gpu_metrics_tbl.m_temperature_edge;
-    metrics_public_init.temperature_hotspot = m_gpu_metrics_tbl.m_temperature_hotspot;
-    metrics_public_init.temperature_mem = m_gpu_metrics_tbl.m_temperature_mem;
-    metrics_public_init.temperature_vrgfx = m_gpu_metrics_tbl.m_temperature_vrgfx;
-    metrics_public_init.temperature_vrsoc = m_gpu_metrics_tbl.m_temperature_vrsoc;
-    metrics_public_init.temperature_vrmem = m_gpu_metrics_tbl.m_temperature_vrmem;
-
-    // Utilization
-    metrics_public_init.average_gfx_activity = m_gpu_metrics_tbl.m_average_gfx_activity;
-    metrics_public_init.average_umc_activity = m_gpu_metrics_tbl.m_average_umc_activity;
-    metrics_public_init.average_mm_activity = m_gpu_metrics_tbl.m_average_mm_activity;
-
-    // Power/Energy
-    metrics_public_init.average_socket_power = m_gpu_metrics_tbl.m_average_socket_power;
-    metrics_public_init.energy_accumulator = m_gpu_metrics_tbl.m_energy_accumulator;
-
-    // Driver attached timestamp (in ns)
-    metrics_public_init.system_clock_counter = m_gpu_metrics_tbl.m_system_clock_counter;
-
-    // Average clocks
-    metrics_public_init.average_gfxclk_frequency = m_gpu_metrics_tbl.m_average_gfxclk_frequency;
-    metrics_public_init.average_socclk_frequency = m_gpu_metrics_tbl.m_average_socclk_frequency;
-    metrics_public_init.average_uclk_frequency = m_gpu_metrics_tbl.m_average_uclk_frequency;
-    metrics_public_init.average_vclk0_frequency = m_gpu_metrics_tbl.m_average_vclk0_frequency;
-    metrics_public_init.average_dclk0_frequency = m_gpu_metrics_tbl.m_average_dclk0_frequency;
-    metrics_public_init.average_vclk1_frequency = m_gpu_metrics_tbl.m_average_vclk1_frequency;
-    metrics_public_init.average_dclk1_frequency = m_gpu_metrics_tbl.m_average_dclk1_frequency;
-
-    // Current clocks
-    metrics_public_init.current_gfxclk = m_gpu_metrics_tbl.m_current_gfxclk;
-    metrics_public_init.current_socclk = m_gpu_metrics_tbl.m_current_socclk;
-    metrics_public_init.current_vclk0 = m_gpu_metrics_tbl.m_current_vclk0;
-    metrics_public_init.current_dclk0 = m_gpu_metrics_tbl.m_current_dclk0;
-    metrics_public_init.current_uclk = m_gpu_metrics_tbl.m_current_uclk;
-    metrics_public_init.current_vclk1 = m_gpu_metrics_tbl.m_current_vclk1;
-    metrics_public_init.current_dclk1 = m_gpu_metrics_tbl.m_current_dclk1;
-
-    // Throttle status
-    metrics_public_init.throttle_status = m_gpu_metrics_tbl.m_throttle_status;
-
-    // Fans
-    metrics_public_init.current_fan_speed = m_gpu_metrics_tbl.m_current_fan_speed;
-
-    // Link width/speed
-    metrics_public_init.pcie_link_width = m_gpu_metrics_tbl.m_pcie_link_width;
-    metrics_public_init.pcie_link_speed = m_gpu_metrics_tbl.m_pcie_link_speed;
-
-    metrics_public_init.gfx_activity_acc = m_gpu_metrics_tbl.m_gfx_activity_acc;
-    metrics_public_init.mem_activity_acc = m_gpu_metrics_tbl.m_mem_activity_acc;
-
-    // temperature_hbm
-    const auto temp_hbm_num_elems =
-      static_cast<uint16_t>(
-        std::end(m_gpu_metrics_tbl.m_temperature_hbm) -
-        std::begin(m_gpu_metrics_tbl.m_temperature_hbm));
-    std::copy_n(std::begin(m_gpu_metrics_tbl.m_temperature_hbm),
-                temp_hbm_num_elems,
-                metrics_public_init.temperature_hbm);
-
-    //
-    // Note:  Backwards compatibility -> Handling extra/exception cases
-    //        related to earlier versions (1.0)
-
-
-    return metrics_public_init;
-  }();
-
-  ss << __PRETTY_FUNCTION__
-              << " | ======= end ======= "
-              << " | Success "
-              << " | Returning = " << getRSMIStatusString(status_code)
-              << " |";
-  LOG_TRACE(ss);
-
-  return std::make_tuple(status_code, copy_data_from_internal_metrics_tbl);
-}
-
-
 rsmi_status_t Device::dev_read_gpu_metrics_header_data()
 {
   std::ostringstream ss;
@@ -4078,10 +2504,19 @@ rsmi_status_t Device::dev_read_gpu_metrics_header_data()
   ss << __PRETTY_FUNCTION__ << " | ======= start =======";
   LOG_TRACE(ss);
 
-  // Check if/when metrics table needs to be refreshed.
-  auto op_result = readDevInfo(DevInfoTypes::kDevGpuMetrics,
-                                sizeof(AMDGpuMetricsHeader_v1_t),
-                                &m_gpu_metrics_header);
+  std::lock_guard<std::recursive_mutex> metrics_guard(m_gpu_metrics_mutex);
+
+  //  The whole table is read at once (single pread() into the preallocated
+  //  buffer); the header is parsed from it here, and the rest is used by
+  //  dev_read_gpu_metrics_all_data().
+  m_gpu_metrics_raw_size = 0;
+  auto op_result = preadDevInfoBinary(DevInfoTypes::kDevGpuMetrics,
+                                      m_gpu_metrics_raw_buffer.size(),
+                                      m_gpu_metrics_raw_buffer.data(), 0,
+                                      &m_gpu_metrics_raw_size);
+  if ((op_result == 0) && (m_gpu_metrics_raw_size < sizeof(AMDGpuMetricsHeader_v1_t))) {
+    op_result = ENOENT;
+  }
   if ((status_code = ErrnoToRsmiStatus(op_result)) !=
       rsmi_status_t::RSMI_STATUS_SUCCESS) {
     ss << __PRETTY_FUNCTION__
@@ -4089,7 +2524,7 @@ rsmi_status_t Device::dev_read_gpu_metrics_header_data()
                 << " | Fail "
                 << " | Device #: " << index()
                 << " | Metric Version: " << stringfy_metrics_header(m_gpu_metrics_header)
-                << " | Cause: readDevInfo(kDevGpuMetrics)"
+                << " | Cause: preadDevInfoBinary(kDevGpuMetrics)"
                 << " | Returning = "
                 << getRSMIStatusString(status_code)
                 << " Could not read Metrics Header: "
@@ -4098,6 +2533,8 @@ rsmi_status_t Device::dev_read_gpu_metrics_header_data()
     LOG_ERROR(ss);
     return status_code;
   }
+  std::memcpy(&m_gpu_metrics_header, m_gpu_metrics_raw_buffer.data(),
+              sizeof(m_gpu_metrics_header));
   if ((status_code = is_gpu_metrics_version_supported(m_gpu_metrics_header)) ==
       rsmi_status_t::RSMI_STATUS_NOT_SUPPORTED) {
     ss << __PRETTY_FUNCTION__
@@ -4135,6 +2572,8 @@ rsmi_status_t Device::dev_read_gpu_metrics_all_data()
   auto status_code(rsmi_status_t::RSMI_STATUS_SUCCESS);
   ss << __PRETTY_FUNCTION__ << " | ======= start =======";
   LOG_TRACE(ss);
+  //  Taken before the read, so a change during the read isn't missed
+  const auto read_generation = generation();
 
   //  At this point we should have a valid gpu_metrics pointer, and
   //  we already read the header; setup_gpu_metrics_reading()
@@ -4156,17 +2595,22 @@ rsmi_status_t Device::dev_read_gpu_metrics_all_data()
     return status_code;
   }
 
-  auto op_result = readDevInfo(DevInfoTypes::kDevGpuMetrics,
-                          m_gpu_metrics_header.m_structure_size,
-                          m_gpu_metrics_ptr->get_metrics_table().get());
-  if ((status_code = ErrnoToRsmiStatus(op_result)) !=
-      rsmi_status_t::RSMI_STATUS_SUCCESS) {
+  //  The table was read into a staging buffer along with its header, by
+  //  dev_read_gpu_metrics_header_data(); populating the dynamic table applies
+  //  adjustments to the raw table in place, so the raw table is only
+  //  overwritten when the firmware published new data.
+  const auto read_size = std::min<size_t>(m_gpu_metrics_header.m_structure_size,
+                                          m_gpu_metrics_ptr->sizeof_metric_table());
+  if (m_gpu_metrics_raw_size < read_size) {
+    m_gpu_metrics_is_valid = false;
+    status_code = ErrnoToRsmiStatus(ENOENT);
     ss << __PRETTY_FUNCTION__
                 << " | ======= end ======= "
                 << " | Fail "
                 << " | Device #: " << index()
                 << " | Metric Version: " << stringfy_metrics_header(m_gpu_metrics_header)
-                << " | Cause: readDevInfo(kDevGpuMetrics)"
+                << " | Cause: gpu_metrics read is shorter than the table: "
+                << m_gpu_metrics_raw_size
                 << " | Returning = "
                 << getRSMIStatusString(status_code)
                 << " Could not read Metrics Header: "
@@ -4176,8 +2620,37 @@ rsmi_status_t Device::dev_read_gpu_metrics_all_data()
     return status_code;
   }
 
+  uint64_t raw_fw_timestamp = 0;
+  const auto fw_timestamp_offset = m_gpu_metrics_ptr->offsetof_firmware_timestamp();
+  if ((fw_timestamp_offset + sizeof(raw_fw_timestamp)) <= read_size) {
+    std::memcpy(&raw_fw_timestamp,
+                (m_gpu_metrics_raw_buffer.data() + fw_timestamp_offset),
+                sizeof(raw_fw_timestamp));
+  }
+
+  m_gpu_metrics_refreshed_at_ms = actual_timestamp_in_ms();
+  m_gpu_metrics_generation = read_generation;
+  if (m_gpu_metrics_is_valid && (raw_fw_timestamp != 0) &&
+      (raw_fw_timestamp == m_gpu_metrics_raw_fw_timestamp)) {
+    ss << __PRETTY_FUNCTION__
+               << " | ======= end ======= "
+               << " | Success "
+               << " | Device #: " << index()
+               << " | Metric Version: " << stringfy_metrics_header(m_gpu_metrics_header)
+               << " | Firmware Timestamp: " << raw_fw_timestamp
+               << " | Table unchanged, reusing parsed snapshot"
+               << " |";
+    LOG_TRACE(ss);
+    return status_code;
+  }
+
+  std::memcpy(m_gpu_metrics_ptr->get_metrics_table().get(),
+              m_gpu_metrics_raw_buffer.data(), read_size);
+  m_gpu_metrics_raw_fw_timestamp = raw_fw_timestamp;
+
   //  All metric units are pushed in.
   status_code = m_gpu_metrics_ptr->populate_metrics_dynamic_tbl();
+  m_gpu_metrics_is_valid = (status_code == rsmi_status_t::RSMI_STATUS_SUCCESS);
   if (status_code != rsmi_status_t::RSMI_STATUS_SUCCESS) {
     ss << __PRETTY_FUNCTION__
               << " | ======= end ======= "
@@ -4205,6 +2678,40 @@ rsmi_status_t Device::dev_read_gpu_metrics_all_data()
   return status_code;
 }
 
+bool Device::is_gpu_metrics_snapshot_fresh() const
+{
+  if (!m_gpu_metrics_is_valid || !m_gpu_metrics_ptr || (m_gpu_metrics_max_age_ms == 0)) {
+    return false;
+  }
+  //  The device changed (ie: partition) since the snapshot was taken
+  if (m_gpu_metrics_generation != generation()) {
+    return false;
+  }
+  return ((actual_timestamp_in_ms() - m_gpu_metrics_refreshed_at_ms) <
+          m_gpu_metrics_max_age_ms);
+}
+
+void Device::dev_set_gpu_metrics_max_age(uint32_t max_age_ms)
+{
+  std::lock_guard<std::recursive_mutex> metrics_guard(m_gpu_metrics_mutex);
+  m_gpu_metrics_max_age_ms = max_age_ms;
+}
+
+void Device::dev_invalidate_gpu_metrics()
+{
+  std::lock_guard<std::recursive_mutex> metrics_guard(m_gpu_metrics_mutex);
+  m_gpu_metrics_is_valid = false;
+  m_gpu_metrics_raw_fw_timestamp = 0;
+  m_gpu_metrics_refreshed_at_ms = 0;
+}
+
+rsmi_status_t Device::dev_refresh_gpu_metrics()
+{
+  std::lock_guard<std::recursive_mutex> metrics_guard(m_gpu_metrics_mutex);
+  dev_invalidate_gpu_metrics();
+  return setup_gpu_metrics_reading();
+}
+
 rsmi_status_t Device::setup_gpu_metrics_reading()
 {
   std::ostringstream ss;
@@ -4212,6 +2719,20 @@ rsmi_status_t Device::setup_gpu_metrics_reading()
   ss << __PRETTY_FUNCTION__ << " | ======= start =======";
   LOG_TRACE(ss);
 
+  std::lock_guard<std::recursive_mutex> metrics_guard(m_gpu_metrics_mutex);
+  if (is_gpu_metrics_snapshot_fresh()) {
+    ss << __PRETTY_FUNCTION__
+                << " | ======= end ======= "
+                << " | Success "
+                << " | Device #: " << index()
+                << " | Metric Version: " << stringfy_metrics_header(dev_get_metrics_header())
+                << " | Cached snapshot is within max age: "
+                << m_gpu_metrics_max_age_ms << " ms"
+                << " |";
+    LOG_TRACE(ss);
+    return status_code;
+  }
+
   status_code = dev_read_gpu_metrics_header_data();
   if (status_code != rsmi_status_t::RSMI_STATUS_SUCCESS) {
     return status_code;
@@ -4235,9 +2756,15 @@ rsmi_status_t Device::setup_gpu_metrics_reading()
     return status_code;
   }
 
-  //
-  m_gpu_metrics_ptr.reset();
-  m_gpu_metrics_ptr = amdgpu_metrics_factory(gpu_metrics_flag_version);
+  //  Only build a new metric object if the table version changed
+  if (m_gpu_metrics_ptr &&
+      (m_gpu_metrics_ptr->get_gpu_metrics_version_used() != gpu_metrics_flag_version)) {
+    m_gpu_metrics_ptr.reset();
+  }
+  if (!m_gpu_metrics_ptr) {
+    dev_invalidate_gpu_metrics();
+    m_gpu_metrics_ptr = amdgpu_metrics_factory(gpu_metrics_flag_version);
+  }
   if (!m_gpu_metrics_ptr) {
     status_code = rsmi_status_t::RSMI_STATUS_UNEXPECTED_DATA;
     ss << __PRETTY_FUNCTION__
@@ -4313,10 +2840,10 @@ struct MetricValueCast_t<AMDGpuMetricsDataType_t::kUInt64>
 };
 
 template<AMDGpuMetricsDataType_t dt>
-auto get_casted_value(const AMDGpuDynamicMetricsValue_t& metrics_value)
+auto get_casted_value(uint64_t metrics_value)
 {
     using ValueType_t = typename MetricValueCast_t<dt>::value_type;
-    return static_cast<ValueType_t>(metrics_value.m_value);
+    return static_cast<ValueType_t>(metrics_value);
 }
 
 
@@ -4327,6 +2854,8 @@ rsmi_status_t Device::dev_log_gpu_metrics(std::ostringstream& outstream_metrics)
   ss << __PRETTY_FUNCTION__ << " | ======= start =======";
   LOG_TRACE(ss);
 
+  std::lock_guard<std::recursive_mutex> metrics_guard(m_gpu_metrics_mutex);
+
   //  If we still don't have a valid gpu_metrics pointer;
   //  meaning, we didn't run any queries, and just want to
   //  print all the gpu metrics content, we need to setup
@@ -4380,45 +2909,58 @@ rsmi_status_t Device::dev_log_gpu_metrics(std::ostringstream& outstream_metrics)
 
   //  Metrics info
   auto table_content_output = [&]() {
-    const auto gpu_metrics_tbl = m_gpu_metrics_ptr->get_metrics_dynamic_tbl();
+    const auto& gpu_metrics_tbl = m_gpu_metrics_ptr->get_metrics_dynamic_tbl();
     tmp_outstream_metrics << "\n";
     tmp_outstream_metrics << "*** GPU Metrics Data: *** \n";
-    for (const auto& [metric_class, metric_data] : gpu_metrics_tbl) {
-      tmp_outstream_metrics << "\n";
-      tmp_outstream_metrics << "[ " << amdgpu_metrics_class_id_translation_table.at(metric_class) << " ]" << "\n";
+    for (const auto& [metric_class, metric_class_title] : amdgpu_metrics_class_id_translation_table) {
+      auto has_metric_class_units = false;
+      for (auto unit_idx = size_t(0); unit_idx < kAMDGpuMetricsUnitTypeCount; ++unit_idx) {
+        const auto metric_unit = static_cast<AMDGpuMetricsUnitType_t>(unit_idx);
+        const auto& metric_slot = gpu_metrics_tbl.slot(metric_unit);
+        if ((metric_slot.m_num_values == 0) || (metric_slot.m_class_id != metric_class)) {
+          continue;
+        }
+        if (!has_metric_class_units) {
+          has_metric_class_units = true;
+          tmp_outstream_metrics << "\n";
+          tmp_outstream_metrics << "[ " << metric_class_title << " ]" << "\n";
+        }
 
-      for (const auto& [metric_unit, metric_values] : metric_data) {
         auto tmp_metric_info = ("[ " + amdgpu_metrics_unit_type_translation_table.at(metric_unit) + " ]");
-        for (const auto& metric_value : metric_values) {
-          switch (metric_value.m_original_type) {
+        const auto metric_values = gpu_metrics_tbl.values(metric_unit);
+        for (auto idx = uint16_t(0); idx < metric_slot.m_num_values; ++idx) {
+          const auto metric_value_info = (std::string(metric_slot.m_title) + " : " + std::to_string(idx));
+          switch (metric_slot.m_original_type) {
             case (AMDGpuMetricsDataType_t::kUInt16):
               {
-                auto value = get_casted_value<AMDGpuMetricsDataType_t::kUInt16>(metric_value);
-                tmp_outstream_metrics << print_unsigned_hex_and_int((value), metric_value.m_info) << " -> " << tmp_metric_info;
+                auto value = get_casted_value<AMDGpuMetricsDataType_t::kUInt16>(metric_values[idx]);
+                tmp_outstream_metrics << print_unsigned_hex_and_int((value), metric_value_info) << " -> " << tmp_metric_info;
               }
               break;
 
             case (AMDGpuMetricsDataType_t::kUInt32):
               {
-                auto value = get_casted_value<AMDGpuMetricsDataType_t::kUInt32>(metric_value);
-                tmp_outstream_metrics << print_unsigned_hex_and_int((value), metric_value.m_info) << " -> " << tmp_metric_info;
+                auto value = get_casted_value<AMDGpuMetricsDataType_t::kUInt32>(metric_values[idx]);
+                tmp_outstream_metrics << print_unsigned_hex_and_int((value), metric_value_info) << " -> " << tmp_metric_info;
               }
               break;
 
             case (AMDGpuMetricsDataType_t::kUInt64):
               {
-                auto value = get_casted_value<AMDGpuMetricsDataType_t::kUInt64>(metric_value);
-                tmp_outstream_metrics << print_unsigned_hex_and_int((value), metric_value.m_info) << " -> " << tmp_metric_info;
+                auto value = get_casted_value<AMDGpuMetricsDataType_t::kUInt64>(metric_values[idx]);
+                tmp_outstream_metrics << print_unsigned_hex_and_int((value), metric_value_info) << " -> " << tmp_metric_info;
               }
               break;
 
               default:
-                tmp_outstream_metrics << "Error: No data type conversion for original type: " << static_cast<AMDGpuMetricsDataTypeId_t>(metric_value.m_original_type) << "\n";
+                tmp_outstream_metrics << "Error: No data type conversion for original type: " << static_cast<AMDGpuMetricsDataTypeId_t>(metric_slot.m_original_type) << "\n";
                 break;
           }
         }
       }
-      tmp_outstream_metrics << "\n\n";
+      if (has_metric_class_units) {
+        tmp_outstream_metrics << "\n\n";
+      }
     }
     tmp_outstream_metrics << "\n" << kDoubleLine << "\n";
     return;
@@ -4451,6 +2993,8 @@ AMGpuMetricsPublicLatestTupl_t Device::dev_copy_internal_to_external_metrics()
   ss << __PRETTY_FUNCTION__ << " | ======= start =======";
   LOG_TRACE(ss);
 
+  std::lock_guard<std::recursive_mutex> metrics_guard(m_gpu_metrics_mutex);
+
   if (!m_gpu_metrics_ptr) {
     // At this point we should have a valid gpu_metrics pointer.
     status_code = rsmi_status_t::RSMI_STATUS_UNEXPECTED_DATA;
@@ -4483,13 +3027,15 @@ AMGpuMetricsPublicLatestTupl_t Device::dev_copy_internal_to_external_metrics()
 }
 
 
-rsmi_status_t Device::run_internal_gpu_metrics_query(AMDGpuMetricsUnitType_t metric_counter, AMDGpuDynamicMetricTblValues_t& values)
+rsmi_status_t Device::run_internal_gpu_metrics_query(AMDGpuMetricsUnitType_t metric_counter, AMDGpuMetricFieldValue_t& value)
 {
   std::ostringstream ss;
   auto status_code(rsmi_status_t::RSMI_STATUS_NOT_SUPPORTED);
   ss << __PRETTY_FUNCTION__ << " | ======= start =======";
   LOG_TRACE(ss);
 
+  std::lock_guard<std::recursive_mutex> metrics_guard(m_gpu_metrics_mutex);
+
   status_code = setup_gpu_metrics_reading();
   if ((status_code != rsmi_status_t::RSMI_STATUS_SUCCESS) || (!m_gpu_metrics_ptr)) {
     status_code = rsmi_status_t::RSMI_STATUS_UNEXPECTED_DATA;
@@ -4514,25 +3060,26 @@ rsmi_status_t Device::run_internal_gpu_metrics_query(AMDGpuMetricsUnitType_t met
               << " | Metric Unit: " << static_cast<AMDGpuMetricTypeId_t>(metric_counter)
               << " |";
   LOG_INFO(ss);
-  const auto gpu_metrics_tbl = m_gpu_metrics_ptr->get_metrics_dynamic_tbl();
-  for (const auto& [metric_class, metric_data] : gpu_metrics_tbl) {
-    for (const auto& [metric_unit, metric_values] : metric_data) {
-      if (metric_unit == metric_counter) {
-        values = metric_values;
-        status_code = rsmi_status_t::RSMI_STATUS_SUCCESS;
-        ss << __PRETTY_FUNCTION__
-                    << " | ======= end ======= "
-                    << " | Success "
-                    << " | Device #: " << index()
-                    << " | Metric Version: " << stringfy_metrics_header(dev_get_metrics_header())
-                    << " | Metric Unit: " << static_cast<AMDGpuMetricTypeId_t>(metric_counter)
-                    << " | Returning = "
-                    << getRSMIStatusString(status_code)
-                    << " |";
-        LOG_TRACE(ss);
-        return status_code;
-      }
-    }
+  const auto& gpu_metrics_tbl = m_gpu_metrics_ptr->get_metrics_dynamic_tbl();
+  value.m_status = rsmi_status_t::RSMI_STATUS_NOT_SUPPORTED;
+  value.m_num_values = 0;
+  if (gpu_metrics_tbl.contains(metric_counter)) {
+    const auto num_values = std::min<uint32_t>(gpu_metrics_tbl.slot(metric_counter).m_num_values,
+                                               kRSMI_MAX_NUM_METRIC_FIELD_VALUES);
+    std::copy_n(gpu_metrics_tbl.values(metric_counter), num_values, value.m_values);
+    value.m_num_values = num_values;
+    value.m_status = status_code = rsmi_status_t::RSMI_STATUS_SUCCESS;
+    ss << __PRETTY_FUNCTION__
+                << " | ======= end ======= "
+                << " | Success "
+                << " | Device #: " << index()
+                << " | Metric Version: " << stringfy_metrics_header(dev_get_metrics_header())
+                << " | Metric Unit: " << static_cast<AMDGpuMetricTypeId_t>(metric_counter)
+                << " | Returning = "
+                << getRSMIStatusString(status_code)
+                << " |";
+    LOG_TRACE(ss);
+    return status_code;
   }
 
   ss << __PRETTY_FUNCTION__
@@ -4547,6 +3094,62 @@ rsmi_status_t Device::run_internal_gpu_metrics_query(AMDGpuMetricsUnitType_t met
   return status_code;
 }
 
+rsmi_status_t Device::run_internal_gpu_metrics_fields_query(const AMDGpuMetricsUnitType_t* metric_counters,
+                                                            uint32_t num_counters,
+                                                            AMDGpuMetricFieldValue_t* metric_values)
+{
+  std::ostringstream ss;
+  auto status_code(rsmi_status_t::RSMI_STATUS_SUCCESS);
+  ss << __PRETTY_FUNCTION__ << " | ======= start =======";
+  LOG_TRACE(ss);
+
+  std::lock_guard<std::recursive_mutex> metrics_guard(m_gpu_metrics_mutex);
+  status_code = setup_gpu_metrics_reading();
+  if ((status_code != rsmi_status_t::RSMI_STATUS_SUCCESS) || (!m_gpu_metrics_ptr)) {
+    status_code = rsmi_status_t::RSMI_STATUS_UNEXPECTED_DATA;
+    ss << __PRETTY_FUNCTION__
+                << " | ======= end ======= "
+                << " | Fail "
+                << " | Device #: " << index()
+                << " | Metric Version: " << stringfy_metrics_header(dev_get_metrics_header())
+                << " | Cause: Couldn't get a valid metric object"
+                << " | Returning = "
+                << getRSMIStatusString(status_code)
+                << " |";
+    LOG_ERROR(ss);
+    return status_code;
+  }
+
+  const auto& gpu_metrics_tbl = m_gpu_metrics_ptr->get_metrics_dynamic_tbl();
+  for (auto idx = uint32_t(0); idx < num_counters; ++idx) {
+    auto& metric_value = metric_values[idx];
+    const auto metric_counter = metric_counters[idx];
+    metric_value.m_status = rsmi_status_t::RSMI_STATUS_NOT_SUPPORTED;
+    metric_value.m_num_values = 0;
+    if (!gpu_metrics_tbl.contains(metric_counter)) {
+      continue;
+    }
+
+    const auto num_values = std::min<uint32_t>(gpu_metrics_tbl.slot(metric_counter).m_num_values,
+                                               kRSMI_MAX_NUM_METRIC_FIELD_VALUES);
+    std::copy_n(gpu_metrics_tbl.values(metric_counter), num_values, metric_value.m_values);
+    metric_value.m_num_values = num_values;
+    metric_value.m_status = rsmi_status_t::RSMI_STATUS_SUCCESS;
+  }
+
+  ss << __PRETTY_FUNCTION__
+              << " | ======= end ======= "
+              << " | Success "
+              << " | Device #: " << index()
+              << " | Metric Version: " << stringfy_metrics_header(dev_get_metrics_header())
+              << " | Metric Units: " << num_counters
+              << " | Returning = "
+              << getRSMIStatusString(status_code)
+              << " |";
+  LOG_TRACE(ss);
+  return status_code;
+}
+
 
 template<typename T>
 constexpr inline bool is_metric_data_type_supported_v =
@@ -4593,10 +3196,10 @@ rsmi_status_t rsmi_dev_gpu_metrics_info_query(uint32_t dv_ind, AMDGpuMetricsUnit
 
   if constexpr ((is_supported_vector_type) || (is_metric_data_type_supported_v<T>)) {
     // Get all stored values for the metric unit/counter
-    AMDGpuDynamicMetricTblValues_t tmp_values{};
+    AMDGpuMetricFieldValue_t tmp_values{};
     GET_DEV_FROM_INDX
     status_code = dev->run_internal_gpu_metrics_query(metric_counter, tmp_values);
-    if ((status_code != rsmi_status_t::RSMI_STATUS_SUCCESS) || tmp_values.empty()) {
+    if ((status_code != rsmi_status_t::RSMI_STATUS_SUCCESS) || (tmp_values.m_num_values == 0)) {
       ss << __PRETTY_FUNCTION__
                   << " | ======= end ======= "
                   << " | Fail "
@@ -4605,7 +3208,7 @@ rsmi_status_t rsmi_dev_gpu_metrics_info_query(uint32_t dv_ind, AMDGpuMetricsUnit
                   << " | Cause: Couldn't find metric/counter requested"
                   << " | Metric Type: " << static_cast<uint32_t>(metric_counter)
                   << " " << amdgpu_metrics_unit_type_translation_table.at(metric_counter)
-                  << " | Values: " << tmp_values.size()
+                  << " | Values: " << tmp_values.m_num_values
                   << " | Returning = "
                   << getRSMIStatusString(status_code)
                   << " |";
@@ -4617,14 +3220,14 @@ rsmi_status_t rsmi_dev_gpu_metrics_info_query(uint32_t dv_ind, AMDGpuMetricsUnit
       using ValueType_t = typename T::value_type;
       ValueType_t tmp_value;
 
-      for (const auto& value : tmp_values) {
-        tmp_value = static_cast<ValueType_t>(value.m_value);
+      for (auto idx = uint32_t(0); idx < tmp_values.m_num_values; ++idx) {
+        tmp_value = static_cast<ValueType_t>(tmp_values.m_values[idx]);
         metric_value.push_back(tmp_value);
       }
     }
     else if constexpr (is_metric_data_type_supported_v<T>) {
       T tmp_value(0);
-      tmp_value = static_cast<decltype(tmp_value)>(tmp_values[0].m_value);
+      tmp_value = static_cast<decltype(tmp_value)>(tmp_values.m_values[0]);
       metric_value = tmp_value;
     }
   }
@@ -4643,6 +3246,35 @@ rsmi_status_t rsmi_dev_gpu_metrics_info_query(uint32_t dv_ind, AMDGpuMetricsUnit
   return status_code;
 }
 
+rsmi_status_t rsmi_dev_gpu_metrics_fields_query(uint32_t dv_ind,
+                                                const AMDGpuMetricsUnitType_t* metric_counters,
+                                                uint32_t num_counters,
+                                                AMDGpuMetricFieldValue_t* metric_values)
+{
+  std::ostringstream ss;
+  auto status_code(rsmi_status_t::RSMI_STATUS_SUCCESS);
+  ss << __PRETTY_FUNCTION__ << " | ======= start =======";
+  LOG_TRACE(ss);
+
+  if ((metric_counters == nullptr) || (metric_values == nullptr) || (num_counters == 0)) {
+    return rsmi_status_t::RSMI_STATUS_INVALID_ARGS;
+  }
+
+  GET_DEV_FROM_INDX
+  status_code = dev->run_internal_gpu_metrics_fields_query(metric_counters, num_counters,
+                                                           metric_values);
+
+  ss << __PRETTY_FUNCTION__
+              << " | ======= end ======= "
+              << " | Device #: " << dv_ind
+              << " | Metric Units: " << num_counters
+              << " | Returning = "
+              << getRSMIStatusString(status_code)
+              << " |";
+  LOG_TRACE(ss);
+  return status_code;
+}
+
 
 template
 rsmi_status_t rsmi_dev_gpu_metrics_info_query<uint16_t>
@@ -4709,7 +3341,7 @@ rsmi_dev_gpu_metrics_header_info_get(uint32_t dv_ind, metrics_table_header_t& he
 rsmi_status_t
 rsmi_dev_gpu_metrics_info_get(uint32_t dv_ind, rsmi_gpu_metrics_t* smu) {
   TRY
-  DEVICE_MUTEX
+  DEVICE_MUTEX_SHARED
   CHK_SUPPORT_NAME_ONLY(smu)
 
   auto status_code(rsmi_status_t::RSMI_STATUS_SUCCESS);
@@ -4733,11 +3365,31 @@ rsmi_dev_gpu_metrics_info_get(uint32_t dv_ind, rsmi_gpu_metrics_t* smu) {
     return status_code;
   }
 
+  std::lock_guard<std::recursive_mutex> metrics_guard(dev->dev_gpu_metrics_mutex());
   dev->set_smi_device_id(dv_ind);
   uint32_t partition_id = 0;
   rsmi_dev_partition_id_get(dv_ind, &partition_id);
   dev->set_smi_partition_id(partition_id);
-  dev->dev_log_gpu_metrics(ostrstream);
+
+  //  Formatting the whole table is only worth it when it gets logged
+  if (ROCmLogging::Logger::getInstance()->isLoggerEnabled()) {
+    ostrstream.str("");
+    status_code = dev->dev_log_gpu_metrics(ostrstream);
+  } else {
+    status_code = dev->setup_gpu_metrics_reading();
+  }
+  if (status_code != rsmi_status_t::RSMI_STATUS_SUCCESS) {
+    ss << __PRETTY_FUNCTION__
+               << " | ======= end ======= "
+               << " | Fail "
+               << " | Device #: " << dv_ind
+               << " | Cause: Couldn't read gpu metrics"
+               << " | Returning = "
+               << getRSMIStatusString(status_code)
+               << " |";
+    LOG_ERROR(ss);
+    return status_code;
+  }
 
   const auto [error_code, external_metrics] = dev->dev_copy_internal_to_external_metrics();
   if (error_code != rsmi_status_t::RSMI_STATUS_SUCCESS) {
@@ -44,6 +44,7 @@
 #include "rocm_smi/rocm_smi_utils.h"
 #include "rocm_smi/rocm_smi_main.h"
 #include "rocm_smi/rocm_smi_logger.h"
+#include "rocm_smi/rocm_smi_perf_stats.h"
 
 namespace amd {
 namespace smi {
@@ -104,7 +105,7 @@ static bool is_number(const std::string &s) {
 }
 
 static std::string KFDDevicePath(uint32_t dev_id) {
-  std::string node_path = kKFDNodesPathRoot;
+  std::string node_path = FsRootPath(kKFDNodesPathRoot);
   node_path += '/';
   node_path += std::to_string(dev_id);
   return node_path;
@@ -278,7 +279,7 @@ int GetProcessInfo(rsmi_process_info_t *procs, uint32_t num_allocated,
 
   *num_procs_found = 0;
   errno = 0;
-  auto proc_dir = opendir(kKFDProcPathRoot);
+  auto proc_dir = opendir(FsRootPath(kKFDProcPathRoot).c_str());
 
   if (proc_dir == nullptr) {
     perror("Unable to open process directory");
@@ -308,7 +309,7 @@ int GetProcessInfo(rsmi_process_info_t *procs, uint32_t num_allocated,
       procs[*num_procs_found].process_id =
                                 static_cast<uint32_t>(std::stoi(proc_id_str));
 
-      std::string pasid_str_path = kKFDProcPathRoot;
+      std::string pasid_str_path = FsRootPath(kKFDProcPathRoot);
       pasid_str_path += "/";
       pasid_str_path += proc_id_str;
       pasid_str_path += "/";
@@ -352,7 +353,7 @@ int GetProcessGPUs(uint32_t pid, std::unordered_set<uint64_t> *gpu_set) {
   }
   errno = 0;
 
-  std::string queues_dir = kKFDProcPathRoot;
+  std::string queues_dir = FsRootPath(kKFDProcPathRoot);
   queues_dir += "/";
   queues_dir += std::to_string(pid);
   queues_dir += "/queues";
@@ -428,7 +429,7 @@ int GetProcessInfoForPID(uint32_t pid, rsmi_process_info_t *proc,
   std::string tmp;
   std::unordered_set<uint64_t>::iterator itr;
 
-  std::string proc_str_path = kKFDProcPathRoot;
+  std::string proc_str_path = FsRootPath(kKFDProcPathRoot);
   proc_str_path += "/";
   proc_str_path +=  std::to_string(pid);
 
@@ -543,7 +544,7 @@ int DiscoverKFDNodes(std::map<uint64_t, std::shared_ptr<KFDNode>> *nodes) {
   std::shared_ptr<KFDNode> node;
   uint32_t node_indx;
 
-  auto kfd_node_dir = opendir(kKFDNodesPathRoot);
+  auto kfd_node_dir = opendir(FsRootPath(kKFDNodesPathRoot).c_str());
   if (kfd_node_dir == nullptr) {
     return errno;
   }
@@ -607,7 +608,7 @@ int DiscoverKFDNodes(std::map<uint64_t, std::shared_ptr<KFDNode>> *nodes) {
 
   if (closedir(kfd_node_dir)) {
     std::string err_str = "Failed to close KFD node directory ";
-    err_str += kKFDNodesPathRoot;
+    err_str += FsRootPath(kKFDNodesPathRoot);
     err_str += ".";
     perror(err_str.c_str());
     return 1;
@@ -805,7 +806,7 @@ int KFDNode::get_total_memory(uint64_t* total) {
   }
   *total = 0;
 
-  std::string f_path  = kKFDNodesPathRoot;
+  std::string f_path  = FsRootPath(kKFDNodesPathRoot);
   f_path += "/";
   f_path += std::to_string(node_indx_);
   f_path += "/mem_banks";
@@ -880,6 +881,7 @@ int KFDNode::get_used_memory(uint64_t* used) {
   }
   struct kfd_ioctl_get_available_memory_args mem = {0, 0, 0};
   mem.gpu_id = static_cast<uint32_t>(gpu_id_);
+  PerfStats::countIo(kPerfIoIoctl);
   if (ioctl(kfd_fd, AMDKFD_IOC_AVAILABLE_MEMORY , &mem) != 0) {
     close(kfd_fd);
     return 1;
@@ -904,7 +906,7 @@ int KFDNode::get_cache_info(rsmi_gpu_cache_info_t *info) {
   if (ret != 0)  return ret;
 
   // /sys/class/kfd/kfd/topology/nodes/1/caches/0/properties
-  std::string f_path  = kKFDNodesPathRoot;
+  std::string f_path  = FsRootPath(kKFDNodesPathRoot);
   f_path += "/";
   f_path += std::to_string(node_indx_);
   f_path += "/";
@@ -962,7 +964,7 @@ int KFDNode::get_cache_info(rsmi_gpu_cache_info_t *info) {
 int read_node_properties(uint32_t node, std::string property_name,
                          uint64_t *val) {
   std::ostringstream ss;
-  std::string propertiesFullPath = "/sys/class/kfd/kfd/topology/nodes/"
+  std::string propertiesFullPath = FsRootPath(kKFDNodesPathRoot) + "/"
     + std::to_string(node) + "/properties";
   int retVal = EINVAL;
   if (property_name.empty() || val == nullptr) {
@@ -1004,7 +1006,7 @@ int read_node_properties(uint32_t node, std::string property_name,
 // /sys/class/kfd/kfd/topology/nodes/*/gpu_id
 int get_gpu_id(uint32_t node, uint64_t *gpu_id) {
   std::ostringstream ss;
-  std::string gpu_id_FullPath = "/sys/class/kfd/kfd/topology/nodes/"
+  std::string gpu_id_FullPath = FsRootPath(kKFDNodesPathRoot) + "/"
     + std::to_string(node) + "/gpu_id";
   int retVal = EINVAL;
   if (gpu_id == nullptr) {
@@ -1046,7 +1048,7 @@ int get_gpu_id(uint32_t node, uint64_t *gpu_id) {
 // /sys/class/kfd/kfd/topology/nodes/*/properties | grep gfx_target_version
 int KFDNode::get_gfx_target_version(uint64_t *gfx_target_version) {
   std::ostringstream ss;
-  std::string properties_path = "/sys/class/kfd/kfd/topology/nodes/"
+  std::string properties_path = FsRootPath(kKFDNodesPathRoot) + "/"
     + std::to_string(this->node_indx_) + "/properties";
   uint64_t gfx_version = 0;
   int ret = read_node_properties(this->node_indx_, "gfx_target_version",
@@ -1066,7 +1068,7 @@ int KFDNode::get_gfx_target_version(uint64_t *gfx_target_version) {
 }
 
 int32_t KFDNode::get_simd_per_cu(uint64_t* simd_per_cu) const {
-    const std::string properties_path("/sys/class/kfd/kfd/topology/nodes/" +
+    const std::string properties_path(FsRootPath(kKFDNodesPathRoot) + "/" +
                                       std::to_string(this->node_indx_) +
                                       "/properties");
 
@@ -1078,7 +1080,7 @@ int32_t KFDNode::get_simd_per_cu(uint64_t* simd_per_cu) const {
 }
 
 int32_t KFDNode::get_simd_count(uint64_t* simd_count) const {
-    const std::string properties_path("/sys/class/kfd/kfd/topology/nodes/" +
+    const std::string properties_path(FsRootPath(kKFDNodesPathRoot) + "/" +
                                       std::to_string(this->node_indx_) +
                                       "/properties");
 
@@ -1093,7 +1095,7 @@ int32_t KFDNode::get_simd_count(uint64_t* simd_count) const {
 // /sys/class/kfd/kfd/topology/nodes/*/gpu_id
 int KFDNode::get_gpu_id(uint64_t *gpu_id) {
   std::ostringstream ss;
-  std::string gpuid_path = "/sys/class/kfd/kfd/topology/nodes/"
+  std::string gpuid_path = FsRootPath(kKFDNodesPathRoot) + "/"
     + std::to_string(this->node_indx_) + "/gpu_id";
   const uint64_t undefined_gpu_id = std::numeric_limits<uint64_t>::max();
   std::string gpu_id_string = "";
@@ -1132,7 +1134,7 @@ int KFDNode::get_gpu_id(uint64_t *gpu_id) {
 int KFDNode::get_node_id(uint32_t *node_id) {
   std::ostringstream ss;
   int ret = 0;
-  std::string nodeid_path = "/sys/class/kfd/kfd/topology/nodes/"
+  std::string nodeid_path = FsRootPath(kKFDNodesPathRoot) + "/"
     + std::to_string(this->node_indx_);
   ss << __PRETTY_FUNCTION__
      << " | File: " << nodeid_path
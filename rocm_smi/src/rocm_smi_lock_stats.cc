@@ -0,0 +1,270 @@
+/*
+ * Copyright (c) Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#include "rocm_smi/rocm_smi_lock_stats.h"
+
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>  // NOLINT
+#include <cstdio>
+#include <iomanip>
+#include <sstream>
+
+#include "rocm_smi/rocm_smi_perf_stats.h"
+#include "rocm_smi/rocm_smi_utils.h"
+#include "shared_mutex.h"  // NOLINT
+
+namespace amd::smi {
+
+std::atomic<bool> LockStats::s_enabled{false};
+
+uint64_t LockStats::NowNs(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return static_cast<uint64_t>(ts.tv_sec) * 1000000000 +
+         static_cast<uint64_t>(ts.tv_nsec);
+}
+
+const char *LockStats::kindName(LockKind kind) {
+  switch (kind) {
+    case kLockDevice:
+      return "device";
+    case kLockDeviceShared:
+      return "device (cross process)";
+    case kLockDrm:
+      return "drm";
+    case kLockKfdEvent:
+      return "kfd event";
+    case kLockLogger:
+      return "logger";
+    default:
+      return "unknown";
+  }
+}
+
+LockStats& LockStats::getInstance() {
+  static LockStats instance;
+  return instance;
+}
+
+LockStats::~LockStats() {
+  stopDump();
+}
+
+void LockStats::setEnabled(bool enable) {
+  s_enabled.store(enable, std::memory_order_relaxed);
+}
+
+void LockStats::reset(void) {
+  std::lock_guard<std::mutex> guard(records_mutex_);
+  // Locks held now stay held; keep who holds them
+  for (auto it = records_.begin(); it != records_.end();) {
+    Record_t& rec = it->second;
+    if (rec.holders == 0) {
+      it = records_.erase(it);
+      continue;
+    }
+    Record_t held = {};
+    held.holders = rec.holders;
+    held.holder_tid = rec.holder_tid;
+    held.held_since_ns = rec.held_since_ns;
+    rec = held;
+    ++it;
+  }
+}
+
+std::vector<LockStatsEntry_t> LockStats::entries(void) {
+  std::vector<LockStatsEntry_t> ret;
+  uint64_t now = NowNs();
+
+  {
+    std::lock_guard<std::mutex> guard(records_mutex_);
+    ret.reserve(records_.size());
+    for (const auto& [key, rec] : records_) {
+      LockStatsEntry_t entry = {};
+      entry.kind = key.first;
+      entry.dv_ind = key.second;
+      entry.acquisitions = rec.acquisitions;
+      entry.contended = rec.contended;
+      entry.failures = rec.failures;
+      entry.total_wait_ns = rec.total_wait_ns;
+      entry.max_wait_ns = rec.max_wait_ns;
+      uint64_t waits = rec.contended + rec.failures;
+      entry.p50_wait_ns = LatencyPercentile(rec.buckets, waits, 0,
+                                            rec.max_wait_ns, 0.50);
+      entry.p90_wait_ns = LatencyPercentile(rec.buckets, waits, 0,
+                                            rec.max_wait_ns, 0.90);
+      entry.p99_wait_ns = LatencyPercentile(rec.buckets, waits, 0,
+                                            rec.max_wait_ns, 0.99);
+      entry.wait_buckets = rec.buckets;
+      entry.holders = rec.holders;
+      if (rec.holders != 0) {
+        entry.holder_tid = rec.holder_tid;
+        entry.held_ns = now - rec.held_since_ns;
+      }
+      ret.push_back(entry);
+    }
+  }
+
+  // The holder in another process is only known to the mutex itself
+  for (auto& entry : ret) {
+    if (entry.kind != kLockDeviceShared || entry.dv_ind == kLockNoDevice) {
+      continue;
+    }
+    shared_mutex_t *mutex = GetMutex(entry.dv_ind);
+    if (mutex != nullptr && mutex->ptr != nullptr) {
+      entry.owner_pid = shared_mutex_owner(*mutex);
+    }
+  }
+  std::sort(ret.begin(), ret.end(),
+            [](const LockStatsEntry_t& a, const LockStatsEntry_t& b) {
+    return (a.kind != b.kind) ? (a.kind < b.kind) : (a.dv_ind < b.dv_ind);
+  });
+  return ret;
+}
+
+LockStats::Record_t& LockStats::recordOf(LockKind kind, uint32_t dv_ind) {
+  auto it = records_.find(Key(kind, dv_ind));
+  if (it == records_.end()) {
+    it = records_.emplace(Key(kind, dv_ind), Record_t{}).first;
+  }
+  return it->second;
+}
+
+void LockStats::acquired(LockKind kind, uint32_t dv_ind, uint64_t ns,
+                         bool contended) {
+  pid_t tid = static_cast<pid_t>(syscall(SYS_gettid));
+  uint64_t now = NowNs();
+
+  std::lock_guard<std::mutex> guard(records_mutex_);
+  Record_t& rec = recordOf(kind, dv_ind);
+  ++rec.acquisitions;
+  if (contended) {
+    ++rec.contended;
+    rec.total_wait_ns += ns;
+    rec.max_wait_ns = std::max(rec.max_wait_ns, ns);
+    ++rec.buckets[LatencyBucket<kLockWaitBuckets>(ns)];
+  }
+  if (rec.holders++ == 0) {
+    rec.held_since_ns = now;
+  }
+  rec.holder_tid = tid;
+}
+
+void LockStats::released(LockKind kind, uint32_t dv_ind) {
+  std::lock_guard<std::mutex> guard(records_mutex_);
+  Record_t& rec = recordOf(kind, dv_ind);
+  if (rec.holders != 0) {
+    --rec.holders;
+  }
+}
+
+void LockStats::failed(LockKind kind, uint32_t dv_ind, uint64_t ns) {
+  std::lock_guard<std::mutex> guard(records_mutex_);
+  Record_t& rec = recordOf(kind, dv_ind);
+  ++rec.failures;
+  rec.total_wait_ns += ns;
+  rec.max_wait_ns = std::max(rec.max_wait_ns, ns);
+  ++rec.buckets[LatencyBucket<kLockWaitBuckets>(ns)];
+}
+
+std::string LockStats::dump(void) {
+  std::ostringstream ss;
+  ss << std::fixed << std::setprecision(3);
+  ss << "amd_smi lock stats (pid " << getpid() << "):\n";
+  for (const auto& entry : entries()) {
+    ss << "  " << kindName(entry.kind);
+    if (entry.dv_ind != kLockNoDevice) {
+      ss << " gpu " << entry.dv_ind;
+    }
+    ss << ": " << entry.acquisitions << " acquired, " << entry.contended
+       << " contended, " << entry.failures << " failed; wait ms total "
+       << static_cast<double>(entry.total_wait_ns) / 1e6 << " p50 "
+       << static_cast<double>(entry.p50_wait_ns) / 1e6 << " p99 "
+       << static_cast<double>(entry.p99_wait_ns) / 1e6 << " max "
+       << static_cast<double>(entry.max_wait_ns) / 1e6;
+    if (entry.holders != 0) {
+      ss << "; held by tid " << entry.holder_tid << " for "
+         << static_cast<double>(entry.held_ns) / 1e6 << " ms";
+    }
+    if (entry.owner_pid != 0) {
+      ss << "; last locked by pid " << entry.owner_pid;
+    }
+    ss << "\n";
+  }
+  return ss.str();
+}
+
+void LockStats::startDump(uint32_t interval_secs) {
+  std::lock_guard<std::mutex> guard(dump_mutex_);
+  if (dump_thread_.joinable() || interval_secs == 0) {
+    return;
+  }
+  dump_stop_ = false;
+  dump_thread_ = std::thread(&LockStats::dumpLoop, this, interval_secs);
+}
+
+void LockStats::stopDump(void) {
+  std::thread thread;
+  {
+    std::lock_guard<std::mutex> guard(dump_mutex_);
+    dump_stop_ = true;
+    thread = std::move(dump_thread_);
+  }
+  dump_cv_.notify_all();
+  if (thread.joinable()) {
+    thread.join();
+  }
+}
+
+void LockStats::dumpLoop(uint32_t interval_secs) {
+  std::unique_lock<std::mutex> lock(dump_mutex_);
+  while (!dump_cv_.wait_for(lock, std::chrono::seconds(interval_secs),
+                            [this] { return dump_stop_; })) {
+    lock.unlock();
+    std::string out = dump();
+    fputs(out.c_str(), stderr);
+    lock.lock();
+  }
+}
+
+LockStatsGuard::LockStatsGuard(std::mutex& mutex, LockKind kind,
+                               uint32_t dv_ind) :
+               mutex_(mutex), kind_(kind), dv_ind_(dv_ind), recorded_(false) {
+  (void)LockStats::lock(kind_, dv_ind_,
+                        [this] { return mutex_.try_lock() ? 0 : EBUSY; },
+                        [this] { mutex_.lock(); return 0; }, &recorded_);
+}
+
+LockStatsGuard::~LockStatsGuard() {
+  if (recorded_) {
+    LockStats::getInstance().released(kind_, dv_ind_);
+  }
+  mutex_.unlock();
+}
+
+}  // namespace amd::smi
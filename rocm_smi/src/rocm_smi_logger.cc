@@ -42,6 +42,7 @@
  */
 
 // C++ Header File(s)
+#include <cerrno>
 #include <cstdlib>
 #include <chrono>
 #include <ctime>
@@ -52,6 +53,7 @@
 // Code Specific Header Files(s)
 #include "rocm_smi/rocm_smi_logger.h"
 #include "rocm_smi/rocm_smi_main.h"
+#include "rocm_smi/rocm_smi_lock_stats.h"
 
 
 ROCmLogging::Logger *ROCmLogging::Logger::m_Instance = nullptr;
@@ -85,10 +87,19 @@ ROCmLogging::Logger* ROCmLogging::Logger::getInstance() throw() {
 }
 
 void ROCmLogging::Logger::lock() {
-  m_Lock.lock();
+  bool recorded;
+  (void)amd::smi::LockStats::lock(amd::smi::kLockLogger,
+                                  amd::smi::kLockNoDevice,
+      [this] { return m_Lock.try_lock() ? 0 : EBUSY; },
+      [this] { m_Lock.lock(); return 0; }, &recorded);
+  m_LockRecorded = recorded;
 }
 
 void ROCmLogging::Logger::unlock() {
+  if (m_LockRecorded) {
+    amd::smi::LockStats::getInstance().released(amd::smi::kLockLogger,
+                                                amd::smi::kLockNoDevice);
+  }
   m_Lock.unlock();
 }
 
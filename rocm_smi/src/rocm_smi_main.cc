@@ -47,6 +47,7 @@
 #include "rocm_smi/rocm_smi_utils.h"
 #include "rocm_smi/rocm_smi_kfd.h"
 #include "rocm_smi/rocm_smi_logger.h"
+#include "rocm_smi/rocm_smi_lock_stats.h"
 
 
 static const char *kPathDRMRoot = "/sys/class/drm";
@@ -231,6 +232,12 @@ RocmSMI::Initialize(uint64_t flags) {
   // To help debug env variable issues
   // debugRSMIEnvVarInfo();
 
+  // Before the device mutexes are created, so their initialization counts
+  if (env_vars_.lock_stats_dump_secs != 0) {
+    LockStats::getInstance().setEnabled(true);
+    LockStats::getInstance().startDump(env_vars_.lock_stats_dump_secs);
+  }
+
   if (ROCmLogging::Logger::getInstance()->isLoggerEnabled()) {
     ROCmLogging::Logger::getInstance()->enableAllLogLevels();
     LOG_ALWAYS("=============== ROCM SMI initialize ================");
@@ -378,6 +385,13 @@ RocmSMI::Initialize(uint64_t flags) {
     logSystemDetails();
   }
 
+  if (env_vars_.device_watcher_disabled == 0 &&
+      !watcher_.start(devices_, &topology_generation_)) {
+    ss << __PRETTY_FUNCTION__ << " | device watcher could not be started;"
+       << " device generations will not change";
+    LOG_INFO(ss);
+  }
+
   // Leaving below to help debug temp file issues
   // displayAppTmpFilesContent();
   std::string amdGPUDeviceList = displayAllDevicePaths(devices_);
@@ -387,6 +401,10 @@ RocmSMI::Initialize(uint64_t flags) {
 
 void
 RocmSMI::Cleanup() {
+  // The watcher and the lock stats dump hold on to the devices; stop them
+  // first
+  watcher_.stop();
+  LockStats::getInstance().stopDump();
   devices_.clear();
   monitors_.clear();
 
@@ -399,6 +417,13 @@ RocmSMI::Cleanup() {
   }
 }
 
+void RocmSMI::bumpDeviceGenerations(void) {
+  for (auto& device : devices_) {
+    device->bumpGeneration();
+  }
+  topology_generation_.fetch_add(1, std::memory_order_acq_rel);
+}
+
 RocmSMI::RocmSMI(uint64_t flags) : init_options_(flags),
                           kfd_notif_evt_fh_(-1), kfd_notif_evt_fh_refcnt_(0) {
 }
@@ -442,6 +467,20 @@ static uint32_t getRSMIEnvVar_LoggingEnabled(const char *ev_str) {
   return ret;
 }
 
+// Release build safe version of GetEnvVarUInteger(); unset or invalid
+// values read as 0.
+static uint32_t getRSMIEnvVar_UInteger(const char *ev_str) {
+  uint32_t ret = 0;
+  ev_str = getenv(ev_str);
+  if (ev_str != nullptr) {
+    int ev_ret = atoi(ev_str);
+    if (ev_ret > 0) {
+      ret = static_cast<uint32_t>(ev_ret);
+    }
+  }
+  return ret;
+}
+
 static inline std::unordered_set<uint32_t> GetEnvVarUIntegerSets(
   const char *ev_str) {
   std::unordered_set<uint32_t> returnSet;
@@ -471,6 +510,13 @@ static inline std::unordered_set<uint32_t> GetEnvVarUIntegerSets(
 // Get and store env. variables in this method
 void RocmSMI::GetEnvVariables(void) {
   env_vars_.logging_on = getRSMIEnvVar_LoggingEnabled("RSMI_LOGGING");
+  env_vars_.gpu_metrics_max_age_ms =
+    getRSMIEnvVar_UInteger("RSMI_GPU_METRICS_MAX_AGE_MS");
+  env_vars_.device_watcher_disabled =
+    getRSMIEnvVar_UInteger("RSMI_DEVICE_WATCHER_DISABLE");
+  env_vars_.lock_stats_dump_secs =
+    getRSMIEnvVar_UInteger("RSMI_LOCK_STATS_DUMP_SECS");
+  env_vars_.path_fs_root = getenv("RSMI_FS_ROOT");
 #ifndef DEBUG
   (void)GetEnvVarUInteger(nullptr);  // This is to quiet release build warning.
   env_vars_.debug_output_bitfield = 0;
@@ -534,6 +580,22 @@ std::string RocmSMI::getRSMIEnvVarInfo(void) {
      << ((env_vars_.debug_inf_loop == 0) ? "<undefined>"
           : std::to_string(env_vars_.debug_inf_loop))
      << std::endl;
+  ss << "\tRSMI_GPU_METRICS_MAX_AGE_MS = "
+     << ((env_vars_.gpu_metrics_max_age_ms == 0) ? "<undefined>"
+          : std::to_string(env_vars_.gpu_metrics_max_age_ms))
+     << std::endl;
+  ss << "\tRSMI_DEVICE_WATCHER_DISABLE = "
+     << ((env_vars_.device_watcher_disabled == 0) ? "<undefined>"
+          : std::to_string(env_vars_.device_watcher_disabled))
+     << std::endl;
+  ss << "\tRSMI_LOCK_STATS_DUMP_SECS = "
+     << ((env_vars_.lock_stats_dump_secs == 0) ? "<undefined>"
+          : std::to_string(env_vars_.lock_stats_dump_secs))
+     << std::endl;
+  ss << "\tRSMI_FS_ROOT = "
+     << ((env_vars_.path_fs_root == nullptr)
+         ? "<undefined>" : env_vars_.path_fs_root)
+     << std::endl;
   ss << "\tRSMI_LOGGING = "
             << getLogSetting() << std::endl;
   bool isLoggingOn = RocmSMI::isLoggingOn() ? true : false;
@@ -626,7 +688,7 @@ void RocmSMI::AddToDeviceList(std::string dev_name, uint64_t bdfid) {
   std::ostringstream ss;
   ss << __PRETTY_FUNCTION__ << " | ======= start =======";
   LOG_TRACE(ss);
-  auto dev_path = std::string(kPathDRMRoot);
+  auto dev_path = FsRootPath(kPathDRMRoot);
   dev_path += "/";
   dev_path += dev_name;
 
@@ -702,10 +764,11 @@ uint32_t RocmSMI::DiscoverAmdgpuDevices(void) {
   devices_.clear();
   monitors_.clear();
 
-  auto drm_dir = opendir(kPathDRMRoot);
+  const std::string drm_root = FsRootPath(kPathDRMRoot);
+  auto drm_dir = opendir(drm_root.c_str());
   if (drm_dir == nullptr) {
     err_msg = "Failed to open drm root directory ";
-    err_msg += kPathDRMRoot;
+    err_msg += drm_root;
     err_msg += ".";
     perror(err_msg.c_str());
     return 1;
@@ -838,7 +901,7 @@ uint32_t RocmSMI::DiscoverAmdgpuDevices(void) {
   uint32_t cardAdded = 0;
   // Discover all root cards & gpu partitions associated with each
   for (int32_t cardId = 0; cardId <= max_cardId; cardId++) {
-    std::string path = kPathDRMRoot;
+    std::string path = drm_root;
     path += "/card";
     path += std::to_string(cardId);
     uint64_t primary_unique_id = 0;
@@ -1088,7 +1151,7 @@ uint32_t RocmSMI::DiscoverAmdgpuDevices(void) {
 
   if (closedir(drm_dir)) {
     err_msg = "Failed to close drm root directory ";
-    err_msg += kPathDRMRoot;
+    err_msg += drm_root;
     err_msg += ".";
     perror(err_msg.c_str());
     return 1;
@@ -1112,7 +1175,8 @@ int RocmSMI::DiscoverAMDPowerMonitors(bool force_update) {
   }
 
   errno = 0;
-  auto dri_dir = opendir(kPathPowerRoot);
+  const std::string power_root = FsRootPath(kPathPowerRoot);
+  auto dri_dir = opendir(power_root.c_str());
 
   if (dri_dir == nullptr) {
     return errno;
@@ -1128,7 +1192,7 @@ int RocmSMI::DiscoverAMDPowerMonitors(bool force_update) {
       continue;
     }
 
-    mon_name = kPathPowerRoot;
+    mon_name = power_root;
     mon_name += "/";
     mon_name += dentry->d_name;
     tmp = mon_name + "/amdgpu_pm_info";
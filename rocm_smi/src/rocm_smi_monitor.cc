@@ -21,6 +21,8 @@
  */
 
 #include <dirent.h>
+#include <fcntl.h>
+#include <unistd.h>
 
 #include <algorithm>
 #include <cassert>
@@ -30,12 +32,14 @@
 #include <map>
 #include <regex>  // NOLINT
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include "rocm_smi/rocm_smi_monitor.h"
 #include "rocm_smi/rocm_smi_utils.h"
 #include "rocm_smi/rocm_smi_exception.h"
 #include "rocm_smi/rocm_smi_logger.h"
+#include "rocm_smi/rocm_smi_text_parser.h"
 
 namespace amd {
 namespace smi {
@@ -266,16 +270,37 @@ static const std::map<const char *, monitor_depends_t> kMonFuncDependsMap = {
 #ifndef DEBUG
     env_ = nullptr;
 #endif
+    dir_fd_ = open(path_.c_str(), O_PATH | O_DIRECTORY | O_CLOEXEC);
+}
+Monitor::~Monitor(void) {
+  if (dir_fd_ >= 0) {
+    close(dir_fd_);
+  }
+}
+
+// The longest name template is "temp#_emergency_hyst"
+static const std::size_t kMonitorNameBufSize = 32;
+
+// Copy the file name of the monitor into name, with the '#' of the name
+// template replaced by the sensor index; no need to build a string for it.
+static void MakeMonitorName(MonitorTypes type, uint32_t sensor_id,
+                            char (&name)[kMonitorNameBufSize]) {
+  std::string_view fn = kMonitorNameMap.at(type);
+  assert(fn.size() < kMonitorNameBufSize);
+
+  auto len = std::min(fn.size(), kMonitorNameBufSize - 1);
+  for (std::size_t i = 0; i < len; ++i) {
+    name[i] = (fn[i] == '#') ? static_cast<char>('0' + sensor_id) : fn[i];
+  }
+  name[len] = '\0';
 }
-Monitor::~Monitor(void) = default;
 
 std::string
 Monitor::MakeMonitorPath(MonitorTypes type, uint32_t sensor_id) {
-  std::string tempPath = path_;
-  std::string fn = kMonitorNameMap.at(type);
-
-  std::replace(fn.begin(), fn.end(), '#', static_cast<char>('0' + sensor_id));
+  char fn[kMonitorNameBufSize];
+  MakeMonitorName(type, sensor_id, fn);
 
+  std::string tempPath = path_;
   tempPath += "/";
   tempPath += fn;
 
@@ -296,21 +321,100 @@ int Monitor::readMonitor(MonitorTypes type, uint32_t sensor_id,
   std::ostringstream ss;
   assert(val != nullptr);
 
-  std::string temp_str;
-  std::string sysfs_path = MakeMonitorPath(type, sensor_id);
+  char buf[kSysfsTextBufSize];
+  std::string_view text;
+  int ret;
 
-  DBG_FILE_ERROR(sysfs_path, (std::string *)nullptr)
-  int ret = ReadSysfsStr(sysfs_path, val);
-  ss << __PRETTY_FUNCTION__
-     << " | Success | Read hwmon file: " << sysfs_path
-     << " | Type: " << monitorTypesToString.at(type)
-     << " | Sensor id: " << std::to_string(sensor_id)
-     << " | Data: " << *val
-     << " | Returning: " << std::to_string(ret) << " |";
-  LOG_INFO(ss);
+  DBG_FILE_ERROR(MakeMonitorPath(type, sensor_id), (std::string *)nullptr)
+  if (dir_fd_ >= 0) {
+    char fn[kMonitorNameBufSize];
+    MakeMonitorName(type, sensor_id, fn);
+    ret = ReadSysfsTextAt(dir_fd_, fn, buf, sizeof(buf), &text);
+  } else {
+    ret = ReadSysfsText(MakeMonitorPath(type, sensor_id), buf, sizeof(buf),
+                        &text);
+  }
+  if (ret == 0) {
+    val->clear();
+    for (auto c : text) {
+      if (c != '\n') {
+        val->push_back(c);
+      }
+    }
+  }
+  if (ROCmLogging::Logger::getInstance()->isLoggerEnabled()) {
+    ss << __PRETTY_FUNCTION__
+       << (ret == 0 ? " | Success" : " | Fail")
+       << " | Read hwmon file: " << MakeMonitorPath(type, sensor_id)
+       << " | Type: " << monitorTypesToString.at(type)
+       << " | Sensor id: " << std::to_string(sensor_id)
+       << " | Data: " << (ret == 0 ? *val : std::string())
+       << " | Returning: " << std::to_string(ret) << " |";
+    LOG_INFO(ss);
+  }
   return ret;
 }
 
+void Monitor::readAll(MonitorSnapshot_t *snapshot) {
+  assert(snapshot != nullptr);
+
+  // hwmon inputs are single numbers
+  char buf[64];
+  auto read_value = [&](MonitorTypes type, uint32_t sensor_id,
+                        MonitorValue_t *mon_val) {
+    std::string_view text;
+    char fn[kMonitorNameBufSize];
+    MakeMonitorName(type, sensor_id, fn);
+    if (dir_fd_ >= 0) {
+      mon_val->err = ReadSysfsTextAt(dir_fd_, fn, buf, sizeof(buf), &text);
+    } else {
+      mon_val->err = ReadSysfsText(path_ + "/" + fn, buf, sizeof(buf), &text);
+    }
+    if ((mon_val->err == 0) &&
+        !ParseTextInt(NextTextToken(&text), &mon_val->value)) {
+      mon_val->err = EINVAL;
+    }
+  };
+
+  for (uint32_t t = RSMI_TEMP_TYPE_FIRST; t <= RSMI_TEMP_TYPE_LAST; ++t) {
+    auto& temp = snapshot->temperature[t];
+    temp = {0, ENOENT};
+    auto index_it =
+        temp_type_index_map_.find(static_cast<rsmi_temperature_type_t>(t));
+    if ((index_it != temp_type_index_map_.end()) &&
+        (index_it->second != RSMI_TEMP_TYPE_INVALID)) {
+      read_value(kMonTemp, index_it->second, &temp);
+    }
+  }
+  for (uint32_t v = RSMI_VOLT_TYPE_FIRST; v <= RSMI_VOLT_TYPE_LAST; ++v) {
+    auto& volt = snapshot->voltage[v];
+    volt = {0, ENOENT};
+    auto index_it =
+        volt_type_index_map_.find(static_cast<rsmi_voltage_type_t>(v));
+    if ((index_it != volt_type_index_map_.end()) &&
+        (index_it->second != RSMI_VOLT_TYPE_INVALID)) {
+      read_value(kMonVolt, index_it->second, &volt);
+    }
+  }
+  // fan and power sysfs files have 1-based indices
+  read_value(kMonFanRPMs, 1, &snapshot->fan_rpms);
+  read_value(kMonFanSpeed, 1, &snapshot->fan_speed);
+  read_value(kMonPowerAve, 1, &snapshot->power_average);
+  read_value(kMonPowerInput, 1, &snapshot->power_input);
+
+  if (ROCmLogging::Logger::getInstance()->isLoggerEnabled()) {
+    std::ostringstream ss;
+    ss << __PRETTY_FUNCTION__ << " | Read hwmon: " << path_
+       << " | Edge temp: " << snapshot->temperature[RSMI_TEMP_TYPE_EDGE].value
+       << " (" << snapshot->temperature[RSMI_TEMP_TYPE_EDGE].err << ")"
+       << " | Fan RPMs: " << snapshot->fan_rpms.value
+       << " (" << snapshot->fan_rpms.err << ")"
+       << " | Average power: " << snapshot->power_average.value
+       << " (" << snapshot->power_average.err << ") |";
+    LOG_INFO(ss);
+  }
+}
+
 int32_t
 Monitor::setTempSensorLabelMap(void) {
   std::ostringstream ss;
@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#include "rocm_smi/rocm_smi_pcie_throughput.h"
+
+#include <sstream>
+#include <string_view>
+
+#include "rocm_smi/rocm_smi_device.h"
+#include "rocm_smi/rocm_smi_logger.h"
+#include "rocm_smi/rocm_smi_text_parser.h"
+#include "rocm_smi/rocm_smi_utils.h"
+
+namespace amd::smi {
+
+PcieThroughputMonitor::~PcieThroughputMonitor(void) {
+  stop();
+}
+
+rsmi_status_t PcieThroughputMonitor::latest(uint64_t *sent, uint64_t *received,
+                                            uint64_t *max_pkt_sz,
+                                            uint64_t *age_ms) {
+  std::lock_guard<std::mutex> guard(mutex_);
+  const auto now = std::chrono::steady_clock::now();
+  last_query_ = now;
+
+  // pcie_bw reporting UINT64_MAX won't change; don't keep trying
+  if (!running_ && !stopping_ && (status_ != RSMI_STATUS_NOT_SUPPORTED)) {
+    // A thread that went idle has already returned
+    if (thread_.joinable()) {
+      thread_.join();
+    }
+    running_ = true;
+    thread_ = std::thread(&PcieThroughputMonitor::run, this);
+  }
+
+  if (status_ != RSMI_STATUS_SUCCESS) {
+    return status_;
+  }
+  for (auto [dst, src] : {std::pair{sent, sent_},
+                          std::pair{received, received_},
+                          std::pair{max_pkt_sz, max_pkt_sz_}}) {
+    if (dst != nullptr) {
+      *dst = src;
+    }
+  }
+  *age_ms = static_cast<uint64_t>(
+      std::chrono::duration_cast<std::chrono::milliseconds>(
+          now - completed_at_).count());
+  return RSMI_STATUS_SUCCESS;
+}
+
+void PcieThroughputMonitor::stop(void) {
+  {
+    std::lock_guard<std::mutex> guard(mutex_);
+    stopping_ = true;
+  }
+  if (thread_.joinable()) {
+    thread_.join();
+  }
+}
+
+rsmi_status_t PcieThroughputMonitor::measure(uint64_t *sent,
+                                             uint64_t *received,
+                                             uint64_t *max_pkt_sz) {
+  char buf[kSysfsTextBufSize];
+  std::string_view text;
+
+  int ret = dev_->readDevInfoTextUnlocked(kDevPCIEThruPut, buf, sizeof(buf),
+                                          &text);
+  if (ret != 0) {
+    return ErrnoToRsmiStatus(ret);
+  }
+
+  // "<sent> <received> <max packet size>"
+  for (uint64_t *val : {sent, received, max_pkt_sz}) {
+    auto token = NextTextToken(&text);
+    if (!ParseTextUInt(token, val)) {
+      return RSMI_STATUS_UNEXPECTED_DATA;
+    }
+  }
+  if ((*sent == UINT64_MAX) || (*received == UINT64_MAX)) {
+    return RSMI_STATUS_NOT_SUPPORTED;
+  }
+  return RSMI_STATUS_SUCCESS;
+}
+
+void PcieThroughputMonitor::run(void) {
+  while (true) {
+    uint64_t sent = 0;
+    uint64_t received = 0;
+    uint64_t max_pkt_sz = 0;
+    // Blocks for the length of the window
+    auto status = measure(&sent, &received, &max_pkt_sz);
+    const auto now = std::chrono::steady_clock::now();
+
+    std::lock_guard<std::mutex> guard(mutex_);
+    status_ = status;
+    if (status == RSMI_STATUS_SUCCESS) {
+      sent_ = sent;
+      received_ = received;
+      max_pkt_sz_ = max_pkt_sz;
+      completed_at_ = now;
+    } else {
+      std::ostringstream ss;
+      ss << __PRETTY_FUNCTION__ << " | Could not measure PCIe throughput of "
+         << dev_->path() << ", status " << status;
+      LOG_INFO(ss);
+    }
+    if (stopping_ || (status != RSMI_STATUS_SUCCESS) ||
+        (now - last_query_ > kIdleTimeout)) {
+      running_ = false;
+      return;
+    }
+  }
+}
+
+}  // namespace amd::smi
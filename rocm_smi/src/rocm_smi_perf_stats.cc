@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "rocm_smi/rocm_smi_perf_stats.h"
+
+#include <time.h>
+
+#include <algorithm>
+
+namespace amd::smi {
+
+std::atomic<bool> PerfStats::s_enabled{false};
+
+// Innermost active scope of this thread
+static thread_local PerfScope *t_current_scope = nullptr;
+
+static uint64_t NowNs(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return static_cast<uint64_t>(ts.tv_sec) * 1000000000 +
+         static_cast<uint64_t>(ts.tv_nsec);
+}
+
+PerfStats& PerfStats::getInstance() {
+  static PerfStats instance;
+  return instance;
+}
+
+void PerfStats::setEnabled(bool enable) {
+  s_enabled.store(enable, std::memory_order_relaxed);
+}
+
+void PerfStats::reset(void) {
+  std::lock_guard<std::mutex> guard(records_mutex_);
+  records_.clear();
+}
+
+std::vector<PerfStatsEntry_t> PerfStats::entries(void) {
+  std::vector<PerfStatsEntry_t> ret;
+
+  std::lock_guard<std::mutex> guard(records_mutex_);
+  ret.reserve(records_.size());
+  for (const auto& [key, rec] : records_) {
+    PerfStatsEntry_t entry;
+    entry.api = key.first;
+    entry.dv_ind = key.second;
+    entry.calls = rec.calls;
+    entry.total_ns = rec.total_ns;
+    entry.min_ns = rec.min_ns;
+    entry.max_ns = rec.max_ns;
+    entry.p50_ns = LatencyPercentile(rec.buckets, rec.calls, rec.min_ns,
+                                    rec.max_ns, 0.50);
+    entry.p90_ns = LatencyPercentile(rec.buckets, rec.calls, rec.min_ns,
+                                    rec.max_ns, 0.90);
+    entry.p99_ns = LatencyPercentile(rec.buckets, rec.calls, rec.min_ns,
+                                    rec.max_ns, 0.99);
+    entry.io = rec.io;
+    ret.push_back(entry);
+  }
+  return ret;
+}
+
+void PerfStats::record(const PerfScope& scope, uint64_t ns) {
+  std::lock_guard<std::mutex> guard(records_mutex_);
+  auto it = records_.find(Key(scope.api_, scope.dv_ind_));
+  if (it == records_.end()) {
+    Record_t rec = {};
+    rec.min_ns = UINT64_MAX;
+    it = records_.emplace(Key(scope.api_, scope.dv_ind_), rec).first;
+  }
+  Record_t& rec = it->second;
+  ++rec.calls;
+  rec.total_ns += ns;
+  rec.min_ns = std::min(rec.min_ns, ns);
+  rec.max_ns = std::max(rec.max_ns, ns);
+  ++rec.buckets[LatencyBucket<kPerfLatencyBuckets>(ns)];
+  for (std::size_t i = 0; i < kPerfIoTypeCount; ++i) {
+    rec.io[i] += scope.io_[i];
+  }
+}
+
+void PerfStats::countIoSlow(PerfIoType type) {
+  if (t_current_scope != nullptr) {
+    ++t_current_scope->io_[type];
+  }
+}
+
+void PerfScope::start(const char *api) {
+  active_ = true;
+  api_ = api;
+  parent_ = t_current_scope;
+  t_current_scope = this;
+  start_ns_ = NowNs();
+}
+
+void PerfScope::stop(void) {
+  uint64_t ns = NowNs() - start_ns_;
+
+  t_current_scope = parent_;
+  if (parent_ != nullptr) {
+    for (std::size_t i = 0; i < kPerfIoTypeCount; ++i) {
+      parent_->io_[i] += io_[i];
+    }
+  }
+  PerfStats::getInstance().record(*this, ns);
+}
+
+void PerfScope::setDeviceSlow(uint32_t dv_ind) {
+  for (auto scope = t_current_scope;
+       (scope != nullptr) && (scope->dv_ind_ == kPerfNoDevice);
+       scope = scope->parent_) {
+    scope->dv_ind_ = dv_ind;
+  }
+}
+
+}  // namespace amd::smi
@@ -27,8 +27,10 @@
 #include <map>
 #include <sstream>
 #include <string>
+#include <string_view>
 
 #include "rocm_smi/rocm_smi_utils.h"
+#include "rocm_smi/rocm_smi_text_parser.h"
 #include "rocm_smi/rocm_smi_common.h"
 #include "rocm_smi/rocm_smi_exception.h"
 
@@ -48,10 +50,10 @@ PowerMon::PowerMon(std::string path, RocmSMI_env_vars const *e) :
 }
 PowerMon::~PowerMon(void) = default;
 
-static int parse_power_str(std::string s, PowerMonTypes type, uint64_t *val) {
-  std::stringstream ss(s);
-  std::string ln;
-  std::string search_str;
+static int parse_power_str(std::string_view s, PowerMonTypes type,
+                                                              uint64_t *val) {
+  std::string_view ln;
+  std::string_view search_str;
 
   assert(val != nullptr);
 
@@ -65,30 +67,19 @@ static int parse_power_str(std::string s, PowerMonTypes type, uint64_t *val) {
       return EINVAL;
   }
 
-  bool found = false;
-  while (std::getline(ss, ln)) {
-    if (ln.rfind(search_str) != std::string::npos) {
-      found = true;
-      break;
-    }
-  }
-
-  if (!found) {
+  if (!FindTextLineContaining(s, search_str, &ln)) {
     return EPERM;
   }
 
-  ss.clear();
-  std::stringstream l_ss;
-
-  l_ss << ln;
-
   double num_units;
-  std::string sz;
+  std::string_view sz;
 
   switch (type) {
     case kPowerMaxGPUPower:
-      l_ss >> num_units;
-      l_ss >> sz;
+      if (!NextTextValueWithUnits(&ln, &num_units, &sz)) {
+        throw amd::smi::rsmi_exception(RSMI_STATUS_UNEXPECTED_DATA,
+                                                                __FUNCTION__);
+      }
       assert(sz == "W");  // We only expect Watts at this time
       if (sz != "W") {
         throw amd::smi::rsmi_exception(RSMI_STATUS_UNEXPECTED_DATA,
@@ -106,13 +97,14 @@ static int parse_power_str(std::string s, PowerMonTypes type, uint64_t *val) {
       assert(false);  // Invalid search Power type requested
       return EINVAL;
   }
-  ss.clear();
   return 0;
 }
 
 int PowerMon::readPowerValue(PowerMonTypes type, uint64_t *power) {
   auto tempPath = path_;
-  std::string fstr;
+  // debugfs files are not limited to a page
+  char buf[4 * kSysfsTextBufSize];
+  std::string_view fstr;
 
   assert(power != nullptr);
 
@@ -120,9 +112,10 @@ int PowerMon::readPowerValue(PowerMonTypes type, uint64_t *power) {
   tempPath += kMonitorNameMap.at(type);
 
   DBG_FILE_ERROR(tempPath, (std::string *)nullptr)
-  int ret = ReadSysfsStr(tempPath, &fstr);
+  int ret = ReadSysfsText(tempPath, buf, sizeof(buf), &fstr);
 
-  if (ret) {
+  // The max GPU power line is near the top, so a truncated read is fine
+  if (ret && ret != ENOBUFS) {
     return ret;
   }
 
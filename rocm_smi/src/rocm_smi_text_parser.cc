@@ -0,0 +1,311 @@
+/*
+ * Copyright (c) Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "rocm_smi/rocm_smi_text_parser.h"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <charconv>
+#include <system_error>
+
+#include "rocm_smi/rocm_smi_perf_stats.h"
+
+namespace amd::smi {
+
+namespace {
+
+constexpr std::string_view kTextWhiteSpace{" \t\n\v\f\r"};
+
+template <typename T>
+bool parse_text_float(std::string_view token, T *val,
+                      std::string_view *suffix) {
+  if (token.empty()) {
+    return false;
+  }
+  auto [end, ec] = std::from_chars(token.data(), token.data() + token.size(),
+                                   *val);
+  if (ec != std::errc()) {
+    return false;
+  }
+  if (suffix != nullptr) {
+    *suffix = token.substr(static_cast<std::size_t>(end - token.data()));
+  }
+  return true;
+}
+
+template <typename T>
+bool next_text_value_with_units(std::string_view *text, T *val,
+                                std::string_view *units) {
+  if (!parse_text_float(NextTextToken(text), val, units)) {
+    return false;
+  }
+  // Units are usually attached to the value ("500Mhz"), but may follow it
+  if (units->empty()) {
+    *units = NextTextToken(text);
+  }
+  return !units->empty();
+}
+
+}  // namespace
+
+int ReadSysfsText(const std::string& path, char *buf, std::size_t buf_size,
+                  std::string_view *text) {
+  return ReadSysfsTextAt(AT_FDCWD, path.c_str(), buf, buf_size, text);
+}
+
+int ReadSysfsTextAt(int dir_fd, const char *name, char *buf,
+                    std::size_t buf_size, std::string_view *text) {
+  int fd;
+  do {
+    PerfStats::countIo(kPerfIoOpen);
+    fd = openat(dir_fd, name, O_RDONLY | O_CLOEXEC);
+  } while ((fd < 0) && (errno == EINTR));
+  if (fd < 0) {
+    *text = std::string_view();
+    return errno;
+  }
+
+  auto ret = ReadTextFd(fd, buf, buf_size, text);
+  close(fd);
+  return ret;
+}
+
+int ReadTextFd(int fd, char *buf, std::size_t buf_size,
+               std::string_view *text) {
+  std::size_t len = 0;
+  int ret = 0;
+  while (len < buf_size) {
+    PerfStats::countIo(kPerfIoRead);
+    auto num = read(fd, buf + len, buf_size - len);
+    if (num < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      ret = errno;
+      break;
+    }
+    if (num == 0) {
+      break;
+    }
+    len += static_cast<std::size_t>(num);
+  }
+  if ((ret == 0) && (len == buf_size)) {
+    char extra;
+    PerfStats::countIo(kPerfIoRead);
+    if (read(fd, &extra, 1) > 0) {
+      ret = ENOBUFS;
+    }
+  }
+
+  *text = std::string_view(buf, len);
+  return ret;
+}
+
+std::string_view TrimText(std::string_view text) {
+  auto start = text.find_first_not_of(kTextWhiteSpace);
+  if (start == std::string_view::npos) {
+    return {};
+  }
+  auto end = text.find_last_not_of(kTextWhiteSpace);
+  return text.substr(start, end - start + 1);
+}
+
+std::string_view NextTextToken(std::string_view *text) {
+  auto start = text->find_first_not_of(kTextWhiteSpace);
+  if (start == std::string_view::npos) {
+    *text = {};
+    return {};
+  }
+  auto end = text->find_first_of(kTextWhiteSpace, start);
+  if (end == std::string_view::npos) {
+    end = text->size();
+  }
+  auto token = text->substr(start, end - start);
+  text->remove_prefix(end);
+  return token;
+}
+
+std::string_view NextTextLine(std::string_view *text) {
+  auto end = text->find('\n');
+  if (end == std::string_view::npos) {
+    auto line = *text;
+    *text = {};
+    return line;
+  }
+  auto line = text->substr(0, end);
+  text->remove_prefix(end + 1);
+  return line;
+}
+
+bool ParseTextUInt(std::string_view token, uint64_t *val, int base,
+                   std::string_view *suffix) {
+  if ((base == 16) && (token.size() > 2) && (token[0] == '0') &&
+      ((token[1] == 'x') || (token[1] == 'X'))) {
+    token.remove_prefix(2);
+  }
+  if (token.empty()) {
+    return false;
+  }
+  auto [end, ec] = std::from_chars(token.data(), token.data() + token.size(),
+                                   *val, base);
+  if (ec != std::errc()) {
+    return false;
+  }
+  if (suffix != nullptr) {
+    *suffix = token.substr(static_cast<std::size_t>(end - token.data()));
+  }
+  return true;
+}
+
+bool ParseTextInt(std::string_view token, int64_t *val,
+                  std::string_view *suffix) {
+  // from_chars() takes a '-' sign, but not a '+' one
+  if ((token.size() > 1) && (token[0] == '+')) {
+    token.remove_prefix(1);
+  }
+  if (token.empty()) {
+    return false;
+  }
+  auto [end, ec] = std::from_chars(token.data(), token.data() + token.size(),
+                                   *val);
+  if (ec != std::errc()) {
+    return false;
+  }
+  if (suffix != nullptr) {
+    *suffix = token.substr(static_cast<std::size_t>(end - token.data()));
+  }
+  return true;
+}
+
+bool ParseTextFloat(std::string_view token, float *val,
+                    std::string_view *suffix) {
+  return parse_text_float(token, val, suffix);
+}
+
+bool ParseTextFloat(std::string_view token, double *val,
+                    std::string_view *suffix) {
+  return parse_text_float(token, val, suffix);
+}
+
+bool NextTextValueWithUnits(std::string_view *text, float *val,
+                            std::string_view *units) {
+  return next_text_value_with_units(text, val, units);
+}
+
+bool NextTextValueWithUnits(std::string_view *text, double *val,
+                            std::string_view *units) {
+  return next_text_value_with_units(text, val, units);
+}
+
+bool ParseDpmLevelLine(std::string_view line, TextDpmLevel_t *level) {
+  auto index = NextTextToken(&line);
+  if (index.empty()) {
+    return false;
+  }
+  level->is_current = (line.find('*') != std::string_view::npos);
+  level->is_deep_sleep = (index[0] == 'S');
+  level->index = 0;
+  if (!level->is_deep_sleep && !ParseTextUInt(index, &level->index)) {
+    return false;
+  }
+  // The colon is normally attached to the index ("0:"), but may stand alone
+  auto after_colon = line;
+  if (NextTextToken(&after_colon) == ":") {
+    line = after_colon;
+  }
+  if (!NextTextValueWithUnits(&line, &level->value, &level->units)) {
+    return false;
+  }
+  level->extra = NextTextToken(&line);
+  return true;
+}
+
+bool ParseOdRangeLine(std::string_view line, TextOdRange_t *range) {
+  range->key = NextTextToken(&line);
+  if (range->key.empty()) {
+    return false;
+  }
+  return NextTextValueWithUnits(&line, &range->lower, &range->lower_units) &&
+         NextTextValueWithUnits(&line, &range->upper, &range->upper_units);
+}
+
+std::string_view TextLineKey(std::string_view line) {
+  auto colon = line.find(':');
+  if (colon == std::string_view::npos) {
+    return {};
+  }
+  return TrimText(line.substr(0, colon + 1));
+}
+
+bool FindTextKeyLine(std::string_view text, std::string_view key,
+                     std::string_view *line) {
+  while (!text.empty()) {
+    auto ln = TrimText(NextTextLine(&text));
+    if (TextLineKey(ln) == key) {
+      *line = ln;
+      return true;
+    }
+  }
+  return false;
+}
+
+bool FindTextLineContaining(std::string_view text, std::string_view needle,
+                            std::string_view *line) {
+  while (!text.empty()) {
+    auto ln = NextTextLine(&text);
+    if (ln.find(needle) != std::string_view::npos) {
+      *line = ln;
+      return true;
+    }
+  }
+  return false;
+}
+
+bool FindTextSection(std::string_view text, std::string_view title,
+                     std::string_view *body) {
+  auto is_title = [](std::string_view ln) {
+    return !ln.empty() && (ln.back() == ':');
+  };
+
+  while (!text.empty()) {
+    if (TrimText(NextTextLine(&text)) != title) {
+      continue;
+    }
+    auto rest = text;
+    std::size_t body_size = 0;
+    while (!rest.empty()) {
+      auto consumed = rest.size();
+      auto ln = NextTextLine(&rest);
+      if (is_title(TrimText(ln))) {
+        break;
+      }
+      body_size += consumed - rest.size();
+    }
+    *body = text.substr(0, body_size);
+    return true;
+  }
+  return false;
+}
+
+}  // namespace amd::smi
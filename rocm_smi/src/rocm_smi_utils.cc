@@ -52,6 +52,7 @@
 #include "rocm_smi/rocm_smi_main.h"
 #include "rocm_smi/rocm_smi_device.h"
 #include "rocm_smi/rocm_smi_logger.h"
+#include "rocm_smi/rocm_smi_lock_stats.h"
 
 
 namespace amd {
@@ -90,6 +91,14 @@ bool FileExists(char const *filename) {
   return (stat(filename, &buf) == 0);
 }
 
+std::string FsRootPath(const std::string &path) {
+  const char *root = RocmSMI::getInstance().getEnv().path_fs_root;
+  if ((root == nullptr) || (*root == '\0')) {
+    return path;
+  }
+  return root + path;
+}
+
 static inline void debugFilesDiscovered(std::vector<std::string> files) {
   std::ostringstream ss;
   int numberOfFilesFound = static_cast<int>(files.size());
@@ -288,7 +297,7 @@ rsmi_status_t handleException() {
   }
 }
 
-pthread_mutex_t *GetMutex(uint32_t dv_ind) {
+shared_mutex_t *GetMutex(uint32_t dv_ind) {
   amd::smi::RocmSMI& smi = amd::smi::RocmSMI::getInstance();
 
   if (dv_ind >= smi.devices().size()) {
@@ -300,6 +309,156 @@ pthread_mutex_t *GetMutex(uint32_t dv_ind) {
   return dev->mutex();
 }
 
+// Device locks held by this thread, with their nesting depth, how the
+// mutex is held underneath (which is exclusive for a shared lock when the
+// mutex had no reader slot left), whether LockStats counts the hold and the
+// device it counts it under
+struct DeviceLockHold {
+  const pthread_mutex_t *key;
+  uint32_t depth;
+  ScopedDeviceLock::Mode locked;
+  bool recorded;
+  uint32_t stats_dv_ind;
+};
+static thread_local std::vector<DeviceLockHold> t_device_lock_holds;
+
+static DeviceLockHold *FindDeviceLockHold(const shared_mutex_t *mutex) {
+  for (auto& hold : t_device_lock_holds) {
+    if (hold.key == mutex->ptr) {
+      return &hold;
+    }
+  }
+  return nullptr;
+}
+
+static LockKind DeviceLockStatsKind(const shared_mutex_t *mutex) {
+  return (mutex->shm_fd >= 0) ? kLockDeviceShared : kLockDevice;
+}
+
+// The device a mutex's lock stats are counted under; only looked up while
+// LockStats collects
+static uint32_t DeviceLockStatsIndex(const shared_mutex_t *mutex) {
+  if (!LockStats::enabled()) {
+    return kLockNoDevice;
+  }
+  const auto& devices = RocmSMI::getInstance().devices();
+  for (uint32_t i = 0; i < devices.size(); ++i) {
+    if (devices[i]->mutex()->ptr == mutex->ptr) {
+      return i;
+    }
+  }
+  return kLockNoDevice;
+}
+
+// Locks in the given mode, or exclusively when a shared lock finds no
+// reader slot left (*locked tells which); returns 0 or an errno value
+static int LockDevice(shared_mutex_t *mutex, ScopedDeviceLock::Mode mode,
+                      bool blocking, ScopedDeviceLock::Mode *locked) {
+  if (mode == ScopedDeviceLock::kExclusive) {
+    *locked = ScopedDeviceLock::kExclusive;
+    return shared_mutex_lock_exclusive(*mutex, blocking);
+  }
+  bool is_exclusive = false;
+  int ret = shared_mutex_lock_shared(*mutex, blocking, &is_exclusive);
+  *locked = is_exclusive ? ScopedDeviceLock::kExclusive :
+                           ScopedDeviceLock::kShared;
+  return ret;
+}
+
+// LockDevice(), recording the wait in LockStats (*recorded tells whether)
+// under device *stats_dv_ind; the release must be recorded under the same
+// device, even if LockStats stopped collecting in between.
+static int LockDeviceRecorded(shared_mutex_t *mutex,
+                              ScopedDeviceLock::Mode mode, bool blocking,
+                              ScopedDeviceLock::Mode *locked, bool *recorded,
+                              uint32_t *stats_dv_ind) {
+  *stats_dv_ind = DeviceLockStatsIndex(mutex);
+  return LockStats::lock(DeviceLockStatsKind(mutex), *stats_dv_ind,
+      [&] { return LockDevice(mutex, mode, false, locked); },
+      [&] { return LockDevice(mutex, mode, blocking, locked); }, recorded);
+}
+
+static void ReleaseDeviceRecorded(const shared_mutex_t *mutex,
+                                  uint32_t stats_dv_ind) {
+  LockStats::getInstance().released(DeviceLockStatsKind(mutex), stats_dv_ind);
+}
+
+static void UnlockDevice(shared_mutex_t *mutex, ScopedDeviceLock::Mode locked) {
+  if (locked == ScopedDeviceLock::kExclusive) {
+    shared_mutex_unlock_exclusive(*mutex);
+  } else {
+    shared_mutex_unlock_shared(*mutex);
+  }
+}
+
+ScopedDeviceLock::ScopedDeviceLock(shared_mutex_t *mutex, Mode mode,
+                                   bool blocking) :
+                 mutex_(mutex), mutex_not_acquired_(false), upgraded_(false),
+                 upgrade_recorded_(false), upgrade_stats_dv_ind_(kLockNoDevice) {
+  DeviceLockHold *hold = FindDeviceLockHold(mutex_);
+  if (hold == nullptr) {
+    Mode locked;
+    bool recorded;
+    uint32_t stats_dv_ind;
+    if (LockDeviceRecorded(mutex_, mode, blocking, &locked, &recorded,
+                           &stats_dv_ind) != 0) {
+      mutex_not_acquired_ = true;
+      return;
+    }
+    t_device_lock_holds.push_back({mutex_->ptr, 1, locked, recorded,
+                                   stats_dv_ind});
+    return;
+  }
+
+  if ((mode == kShared) || (hold->locked == kExclusive)) {
+    ++hold->depth;
+    return;
+  }
+
+  // Exclusive within shared: a shared holder waiting for the other shared
+  // holders to leave would wait for itself
+  shared_mutex_unlock_shared(*mutex_);
+  Mode locked;
+  if (LockDeviceRecorded(mutex_, kExclusive, blocking, &locked,
+                         &upgrade_recorded_, &upgrade_stats_dv_ind_) != 0) {
+    (void)LockDevice(mutex_, kShared, true, &locked);
+    hold->locked = locked;
+    mutex_not_acquired_ = true;
+    return;
+  }
+  hold->locked = kExclusive;
+  ++hold->depth;
+  upgraded_ = true;
+}
+
+ScopedDeviceLock::~ScopedDeviceLock() {
+  if (mutex_not_acquired_) {
+    return;
+  }
+  DeviceLockHold *hold = FindDeviceLockHold(mutex_);
+  assert(hold != nullptr);
+  --hold->depth;
+
+  if (upgraded_) {
+    shared_mutex_unlock_exclusive(*mutex_);
+    if (upgrade_recorded_) {
+      ReleaseDeviceRecorded(mutex_, upgrade_stats_dv_ind_);
+    }
+    Mode locked;
+    (void)LockDevice(mutex_, kShared, true, &locked);
+    hold->locked = locked;
+    return;
+  }
+  if (hold->depth == 0) {
+    UnlockDevice(mutex_, hold->locked);
+    if (hold->recorded) {
+      ReleaseDeviceRecorded(mutex_, hold->stats_dv_ind);
+    }
+    t_device_lock_holds.erase(t_device_lock_holds.begin() +
+                              (hold - t_device_lock_holds.data()));
+  }
+}
+
 rsmi_status_t GetDevValueVec(amd::smi::DevInfoTypes type,
                          uint32_t dv_ind, std::vector<std::string> *val_vec) {
   assert(val_vec != nullptr);
@@ -349,7 +508,7 @@ bool is_vm_guest() {
   std::string line;
 
   // default to false if cannot find the file
-  std::ifstream infile("/proc/cpuinfo");
+  std::ifstream infile(FsRootPath("/proc/cpuinfo"));
   if (infile.fail()) {
     return false;
   }
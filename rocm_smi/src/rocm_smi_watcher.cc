@@ -0,0 +1,350 @@
+/*
+ * Copyright (c) Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#include "rocm_smi/rocm_smi_watcher.h"
+
+#include <fcntl.h>
+#include <limits.h>
+#include <linux/netlink.h>
+#include <poll.h>
+#include <stdlib.h>
+#include <sys/eventfd.h>
+#include <sys/inotify.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#include <sstream>
+
+#include "rocm_smi/rocm_smi_device.h"
+#include "rocm_smi/rocm_smi_logger.h"
+#include "rocm_smi/rocm_smi_utils.h"
+
+namespace amd::smi {
+
+static const char *kKFDTopologyPath = "/sys/class/kfd/kfd/topology";
+static const char *kKFDTopologyNodesPath = "/sys/class/kfd/kfd/topology/nodes";
+static const char *kKFDGenerationIdPath =
+                                "/sys/class/kfd/kfd/topology/generation_id";
+static const char *kDRMClassPath = "/sys/class/drm";
+static const char *kPartitionFNames[] = {
+  "current_compute_partition",
+  "current_memory_partition",
+};
+
+// How often generation_id is re-read when no event arrives
+static const int kKfdGenerationPollMs = 1000;
+static const std::size_t kUeventBufSize = 8192;
+
+static std::string ReadSmallFile(const std::string& path) {
+  char buf[64];
+  int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    return "";
+  }
+  ssize_t num = read(fd, buf, sizeof(buf));
+  close(fd);
+  return (num > 0) ? std::string(buf, static_cast<std::size_t>(num)) : "";
+}
+
+static std::string RealPath(const std::string& path) {
+  char resolved[PATH_MAX];
+  if (realpath(path.c_str(), resolved) == nullptr) {
+    return "";
+  }
+  return resolved;
+}
+
+// Kernel devpath of the device behind a drm card, ie: the path uevents
+// report it under, relative to /sys
+static std::string KernelDevpath(const Device& dev) {
+  std::string sys_root = RealPath(FsRootPath("/sys"));
+  std::string dev_path = RealPath(dev.path() + "/device");
+  if (sys_root.empty() || dev_path.empty() ||
+      dev_path.compare(0, sys_root.size(), sys_root) != 0) {
+    return "";
+  }
+  return dev_path.substr(sys_root.size());
+}
+
+DeviceWatcher::~DeviceWatcher(void) {
+  stop();
+}
+
+void DeviceWatcher::addWatch(const std::string& path, uint32_t mask,
+                             int dv_ind) {
+  int wd = inotify_add_watch(inotify_fd_, path.c_str(), mask);
+  if (wd < 0) {
+    std::ostringstream ss;
+    ss << __PRETTY_FUNCTION__ << " | not watching " << path
+       << ": " << std::strerror(errno);
+    LOG_DEBUG(ss);
+    return;
+  }
+  // The same inode may be watched for a device and for all of them; the
+  // wider scope wins.
+  auto it = watches_.find(wd);
+  if (it == watches_.end() || dv_ind == kWatchAllDevices) {
+    watches_[wd] = dv_ind;
+  }
+}
+
+bool DeviceWatcher::start(const std::vector<std::shared_ptr<Device>>& devices,
+                          std::atomic<uint64_t> *topology_generation) {
+  stop();
+
+  devices_ = devices;
+  topology_generation_ = topology_generation;
+  devpaths_.clear();
+  for (const auto& dev : devices_) {
+    devpaths_.push_back(KernelDevpath(*dev));
+  }
+
+  inotify_fd_ = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+  if (inotify_fd_ >= 0) {
+    const uint32_t dir_mask = IN_CREATE | IN_DELETE | IN_MOVED_FROM |
+                              IN_MOVED_TO;
+    addWatch(FsRootPath(kKFDTopologyPath), dir_mask | IN_MODIFY,
+             kWatchAllDevices);
+    addWatch(FsRootPath(kKFDTopologyNodesPath), dir_mask, kWatchAllDevices);
+    addWatch(FsRootPath(kKFDGenerationIdPath), IN_MODIFY | IN_CLOSE_WRITE,
+             kWatchAllDevices);
+    addWatch(FsRootPath(kDRMClassPath), dir_mask, kWatchAllDevices);
+    for (std::size_t dv_ind = 0; dv_ind < devices_.size(); ++dv_ind) {
+      for (auto fname : kPartitionFNames) {
+        addWatch(devices_[dv_ind]->path() + "/device/" + fname,
+                 IN_MODIFY | IN_CLOSE_WRITE, static_cast<int>(dv_ind));
+      }
+    }
+  }
+
+  uevent_fd_ = socket(AF_NETLINK, SOCK_DGRAM | SOCK_CLOEXEC | SOCK_NONBLOCK,
+                      NETLINK_KOBJECT_UEVENT);
+  if (uevent_fd_ >= 0) {
+    struct sockaddr_nl addr;
+    std::memset(&addr, 0, sizeof(addr));
+    addr.nl_family = AF_NETLINK;
+    addr.nl_groups = 1;  // kernel events, not the ones udev re-broadcasts
+    if (bind(uevent_fd_, reinterpret_cast<struct sockaddr *>(&addr),
+             sizeof(addr)) != 0) {
+      close(uevent_fd_);
+      uevent_fd_ = -1;
+    }
+  }
+
+  if (watches_.empty() && uevent_fd_ < 0) {
+    closeFds();
+    return false;
+  }
+
+  stop_fd_ = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+  if (stop_fd_ < 0) {
+    closeFds();
+    return false;
+  }
+
+  kfd_generation_id_ = ReadSmallFile(FsRootPath(kKFDGenerationIdPath));
+  thread_ = std::thread(&DeviceWatcher::run, this);
+  return true;
+}
+
+void DeviceWatcher::stop(void) {
+  if (thread_.joinable()) {
+    uint64_t one = 1;
+    ssize_t ret = write(stop_fd_, &one, sizeof(one));
+    (void)ret;
+    thread_.join();
+  }
+  closeFds();
+  devices_.clear();
+  devpaths_.clear();
+}
+
+void DeviceWatcher::closeFds(void) {
+  for (auto fd : {&inotify_fd_, &uevent_fd_, &stop_fd_}) {
+    if (*fd >= 0) {
+      close(*fd);
+      *fd = -1;
+    }
+  }
+  watches_.clear();
+}
+
+void DeviceWatcher::run(void) {
+  struct pollfd fds[3] = {
+    {stop_fd_, POLLIN, 0},
+    {inotify_fd_, POLLIN, 0},
+    {uevent_fd_, POLLIN, 0},
+  };
+
+  while (true) {
+    int ret = poll(fds, 3, kKfdGenerationPollMs);
+    if (ret < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      std::ostringstream ss;
+      ss << __PRETTY_FUNCTION__ << " | poll() failed: "
+         << std::strerror(errno) << ", no longer watching devices";
+      LOG_ERROR(ss);
+      // Nothing is watched any more; caches can't be trusted
+      bumpAll(true);
+      return;
+    }
+    if (fds[0].revents != 0) {
+      return;
+    }
+    if (fds[1].revents != 0) {
+      handleInotify();
+    }
+    if (fds[2].revents != 0) {
+      handleUevent();
+    }
+    checkKfdGenerationId();
+  }
+}
+
+void DeviceWatcher::handleInotify(void) {
+  alignas(struct inotify_event) char buf[4096];
+
+  while (true) {
+    ssize_t len = read(inotify_fd_, buf, sizeof(buf));
+    if (len <= 0) {
+      return;
+    }
+    for (char *p = buf; p < buf + len;) {
+      auto *event = reinterpret_cast<struct inotify_event *>(p);
+      p += sizeof(struct inotify_event) + event->len;
+
+      if (event->mask & IN_Q_OVERFLOW) {
+        bumpAll(true);
+        continue;
+      }
+      auto it = watches_.find(event->wd);
+      if (it == watches_.end()) {
+        continue;
+      }
+      if (it->second == kWatchAllDevices) {
+        bumpAll(true);
+      } else {
+        // A partition change re-creates the partition devices
+        bumpDevice(static_cast<std::size_t>(it->second), true);
+      }
+    }
+  }
+}
+
+void DeviceWatcher::handleUevent(void) {
+  char buf[kUeventBufSize];
+
+  while (true) {
+    struct sockaddr_nl addr;
+    socklen_t addr_len = sizeof(addr);
+    ssize_t len = recvfrom(uevent_fd_, buf, sizeof(buf) - 1, 0,
+                           reinterpret_cast<struct sockaddr *>(&addr),
+                           &addr_len);
+    if (len < 0) {
+      if (errno == ENOBUFS) {
+        // Events were dropped
+        bumpAll(true);
+        continue;
+      }
+      return;
+    }
+    if (addr.nl_pid != 0) {
+      continue;  // not from the kernel
+    }
+    buf[len] = '\0';
+
+    // "ACTION@DEVPATH\0KEY=VALUE\0..."
+    std::string action;
+    std::string devpath;
+    std::string subsystem;
+    for (char *p = buf; p < buf + len; p += std::strlen(p) + 1) {
+      if (std::strncmp(p, "ACTION=", 7) == 0) {
+        action = p + 7;
+      } else if (std::strncmp(p, "DEVPATH=", 8) == 0) {
+        devpath = p + 8;
+      } else if (std::strncmp(p, "SUBSYSTEM=", 10) == 0) {
+        subsystem = p + 10;
+      }
+    }
+
+    bool is_gpu_subsystem = (subsystem == "drm" || subsystem == "kfd");
+    bool is_pci = (subsystem == "pci");
+    bool is_amdgpu_module = (subsystem == "module" &&
+                             devpath == "/module/amdgpu");
+    if (is_amdgpu_module) {
+      bumpAll(true);
+      continue;
+    }
+    if (!is_gpu_subsystem && !is_pci) {
+      continue;
+    }
+    bool topology = (action != "change") || subsystem == "kfd";
+
+    bool matched = false;
+    for (std::size_t dv_ind = 0; dv_ind < devpaths_.size(); ++dv_ind) {
+      const auto& dev_devpath = devpaths_[dv_ind];
+      if (!dev_devpath.empty() &&
+          devpath.compare(0, dev_devpath.size(), dev_devpath) == 0 &&
+          (devpath.size() == dev_devpath.size() ||
+           devpath[dev_devpath.size()] == '/')) {
+        bumpDevice(dv_ind, topology);
+        matched = true;
+      }
+    }
+    // Partition devices and kfd sit outside of the PCI device, so can't be
+    // told apart; other PCI devices are none of our business.
+    if (!matched && is_gpu_subsystem) {
+      bumpAll(topology);
+    }
+  }
+}
+
+void DeviceWatcher::checkKfdGenerationId(void) {
+  std::string generation_id = ReadSmallFile(FsRootPath(kKFDGenerationIdPath));
+  if (generation_id != kfd_generation_id_) {
+    kfd_generation_id_ = generation_id;
+    bumpAll(true);
+  }
+}
+
+void DeviceWatcher::bumpDevice(std::size_t dv_ind, bool topology) {
+  devices_[dv_ind]->bumpGeneration();
+  if (topology && topology_generation_ != nullptr) {
+    topology_generation_->fetch_add(1, std::memory_order_acq_rel);
+  }
+}
+
+void DeviceWatcher::bumpAll(bool topology) {
+  for (const auto& dev : devices_) {
+    dev->bumpGeneration();
+  }
+  if (topology && topology_generation_ != nullptr) {
+    topology_generation_->fetch_add(1, std::memory_order_acq_rel);
+  }
+}
+
+}  // namespace amd::smi
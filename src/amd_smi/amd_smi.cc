@@ -35,8 +35,11 @@
 #include <vector>
 #include <set>
 #include <map>
+#include <utility>
 #include <memory>
+#include <mutex>
 #include <limits>
+#include <iterator>
 #include <functional>
 #include <xf86drm.h>
 #include "amd_smi/amdsmi.h"
@@ -46,6 +49,9 @@
 #include "amd_smi/impl/amd_smi_socket.h"
 #include "amd_smi/impl/amd_smi_gpu_device.h"
 #include "amd_smi/impl/amd_smi_uuid.h"
+#include "amd_smi/impl/amd_smi_sampler.h"
+#include "amd_smi/impl/amd_smi_worker_pool.h"
+#include "amd_smi/impl/amd_smi_async.h"
 #include "rocm_smi/rocm_smi.h"
 #include "rocm_smi/rocm_smi_common.h"
 #include "amd_smi/impl/amdgpu_drm.h"
@@ -55,6 +61,11 @@
 #include "rocm_smi/rocm_smi_utils.h"
 #include "rocm_smi/rocm_smi.h"
 #include "rocm_smi/rocm_smi_kfd.h"
+#include "rocm_smi/rocm_smi_gpu_metrics.h"
+#include "rocm_smi/rocm_smi_batch_reader.h"
+#include "rocm_smi/rocm_smi_main.h"
+#include "rocm_smi/rocm_smi_text_parser.h"
+#include "rocm_smi/rocm_smi_lock_stats.h"
 
 // a global instance of std::mutex to protect data passed during threads
 std::mutex myMutex;
@@ -63,7 +74,10 @@ static bool initialized_lib = false;
 #define	SIZE	10
 char proc_id[SIZE] = "\0";
 
-#define AMDSMI_CHECK_INIT() do { \
+// Also times the calling API, see amdsmi_get_lib_perf_stats()
+#define AMDSMI_CHECK_INIT() \
+	amd::smi::PerfScope amdsmi_perf_scope(__func__); \
+	do { \
 	if (!initialized_lib) { \
 		return AMDSMI_STATUS_NOT_INIT; \
 	} \
@@ -107,7 +121,10 @@ static const std::map<amdsmi_memory_partition_type_t,
 static amdsmi_status_t get_gpu_device_from_handle(amdsmi_processor_handle processor_handle,
             amd::smi::AMDSmiGPUDevice** gpudevice) {
 
-    AMDSMI_CHECK_INIT();
+    // Not AMDSMI_CHECK_INIT(); the calling API's scope times the lookup
+    if (!initialized_lib) {
+        return AMDSMI_STATUS_NOT_INIT;
+    }
 
     if (processor_handle == nullptr || gpudevice == nullptr)
         return AMDSMI_STATUS_INVAL;
@@ -119,6 +136,7 @@ static amdsmi_status_t get_gpu_device_from_handle(amdsmi_processor_handle proces
 
     if (device->get_processor_type() == AMDSMI_PROCESSOR_TYPE_AMD_GPU) {
         *gpudevice = static_cast<amd::smi::AMDSmiGPUDevice*>(device);
+        amd::smi::PerfScope::setDevice((*gpudevice)->get_gpu_id());
         return AMDSMI_STATUS_SUCCESS;
     }
 
@@ -130,7 +148,10 @@ template <typename F, typename ...Args>
 amdsmi_status_t rsmi_wrapper(F && f,
     amdsmi_processor_handle processor_handle, uint32_t increment_gpu_id = 0, Args &&... args) {
 
-    AMDSMI_CHECK_INIT();
+    // Not AMDSMI_CHECK_INIT(); the caller's scope times the call
+    if (!initialized_lib) {
+        return AMDSMI_STATUS_NOT_INIT;
+    }
 
     std::ostringstream ss;
     amd::smi::AMDSmiGPUDevice* gpu_device = nullptr;
@@ -159,13 +180,48 @@ amdsmi_status_t rsmi_wrapper(F && f,
     return r;
 }
 
+// Returns the value as the matching amdsmi_gpu_metrics_t data member would
+// hold it; max of T when the field or value index is N/A.
+template <typename T>
+static T gpu_metric_field_value(const amdsmi_gpu_metric_field_value_t& field,
+                                uint32_t value_idx = 0) {
+    if ((field.status != AMDSMI_STATUS_SUCCESS) || (value_idx >= field.num_values)) {
+        return std::numeric_limits<T>::max();
+    }
+    return static_cast<T>(field.values[value_idx]);
+}
+
+// Throttle/violation accumulators of one gpu_metrics sample
+struct violation_metrics_sample_t {
+    uint64_t firmware_timestamp;
+    uint64_t accumulation_counter;
+    uint64_t prochot_residency_acc;
+    uint64_t ppt_residency_acc;
+    uint64_t socket_thm_residency_acc;
+    uint64_t vr_thm_residency_acc;
+    uint64_t hbm_thm_residency_acc;
+    uint64_t gfx_below_host_limit_acc;
+};
+
+// Last two distinct samples of a processor partition; the violation status
+// is computed over the interval between them
+struct violation_metrics_history_t {
+    violation_metrics_sample_t older;
+    violation_metrics_sample_t newer;
+};
+static std::mutex violation_history_mutex;
+static std::map<std::pair<amdsmi_processor_handle, uint32_t>,
+                violation_metrics_history_t> violation_history;
+
 amdsmi_status_t
 amdsmi_init(uint64_t flags) {
+    amd::smi::PerfScope perf_scope(__func__);
     if (initialized_lib)
         return AMDSMI_STATUS_SUCCESS;
 
     amdsmi_status_t status = amd::smi::AMDSmiSystem::getInstance().init(flags);
     if (status == AMDSMI_STATUS_SUCCESS) {
+        amd::smi::AMDSmiAsync::getInstance().start();
         initialized_lib = true;
     }
     return status;
@@ -175,9 +231,22 @@ amdsmi_status_t
 amdsmi_shut_down() {
     if (!initialized_lib)
         return AMDSMI_STATUS_SUCCESS;
+    // A worker (ie: running an async callback) can not wait for the pool
+    if (amd::smi::AMDSmiWorkerPool::is_worker_thread())
+        return AMDSMI_STATUS_BUSY;
+    amd::smi::AMDSmiAsync::getInstance().reject_requests();
+    amd::smi::AMDSmiSampler::getInstance().stop();
+    amd::smi::AMDSmiWorkerPool::getInstance().stop();
+    amd::smi::AMDSmiAsync::getInstance().stop();
+    {
+        std::lock_guard<std::mutex> lock(violation_history_mutex);
+        violation_history.clear();
+    }
     amdsmi_status_t status = amd::smi::AMDSmiSystem::getInstance().cleanup();
     if (status == AMDSMI_STATUS_SUCCESS) {
         initialized_lib = false;
+    } else {
+        amd::smi::AMDSmiAsync::getInstance().start();
     }
     return status;
 }
@@ -551,6 +620,23 @@ amdsmi_get_gpu_device_bdf(amdsmi_processor_handle processor_handle, amdsmi_bdf_t
     return AMDSMI_STATUS_SUCCESS;
 }
 
+amdsmi_status_t
+amdsmi_get_gpu_generation(amdsmi_processor_handle processor_handle, uint64_t *generation) {
+    AMDSMI_CHECK_INIT();
+
+    if (generation == nullptr) {
+        return AMDSMI_STATUS_INVAL;
+    }
+
+    amd::smi::AMDSmiGPUDevice* gpu_device = nullptr;
+    amdsmi_status_t r = get_gpu_device_from_handle(processor_handle, &gpu_device);
+    if (r != AMDSMI_STATUS_SUCCESS)
+        return r;
+
+    return amd::smi::AMDSmiSystem::getInstance()
+                .get_gpu_generation(gpu_device->get_gpu_id(), generation);
+}
+
 amdsmi_status_t
 amdsmi_get_gpu_device_uuid(amdsmi_processor_handle processor_handle,
                            unsigned int *uuid_length,
@@ -567,7 +653,7 @@ amdsmi_get_gpu_device_uuid(amdsmi_processor_handle processor_handle,
         return r;
 
     amdsmi_status_t status = AMDSMI_STATUS_SUCCESS;
-    SMIGPUDEVICE_MUTEX(gpu_device->get_mutex())
+    SMIGPUDEVICE_MUTEX_SHARED(gpu_device->get_mutex())
 
     amdsmi_asic_info_t asic_info = {};
     const uint8_t fcn = 0xff;
@@ -660,6 +746,11 @@ amdsmi_get_gpu_board_info(amdsmi_processor_handle processor_handle, amdsmi_board
     if (r != AMDSMI_STATUS_SUCCESS)
         return r;
 
+    uint64_t generation = 0;
+    if (gpu_device->load_static_info(board_info, &generation)) {
+        return AMDSMI_STATUS_SUCCESS;
+    }
+
     if (gpu_device->check_if_drm_is_supported()) {
         // Populate product_serial, product_name, & product_number from sysfs
         status = smi_amdgpu_get_board_info(gpu_device, board_info);
@@ -737,6 +828,7 @@ amdsmi_get_gpu_board_info(amdsmi_processor_handle processor_handle, amdsmi_board
        << "\n; info->product_name: |" << board_info->product_name << "|";
     LOG_INFO(ss);
 
+    gpu_device->store_static_info(*board_info, generation);
     return AMDSMI_STATUS_SUCCESS;
 }
 
@@ -798,12 +890,14 @@ amdsmi_status_t  amdsmi_get_temp_metric(amdsmi_processor_handle processor_handle
 
     // Get the PLX temperature from the gpu_metrics
     if (sensor_type == AMDSMI_TEMPERATURE_TYPE_PLX) {
-        amdsmi_gpu_metrics_t metric_info;
-        auto r_status =  amdsmi_get_gpu_metrics_info(
-                processor_handle, &metric_info);
+        const amdsmi_gpu_metric_field_t metric_field = AMDSMI_GPU_METRIC_TEMP_VRSOC;
+        amdsmi_gpu_metric_field_value_t metric_value = {};
+        auto r_status = amdsmi_get_gpu_metrics_fields(
+                processor_handle, &metric_field, 1, &metric_value);
         if (r_status != AMDSMI_STATUS_SUCCESS)
             return r_status;
-        *temperature = metric_info.temperature_vrsoc;
+        *temperature =
+            gpu_metric_field_value<decltype(amdsmi_gpu_metrics_t::temperature_vrsoc)>(metric_value);
         return r_status;
     }
     amdsmi_status_t amdsmi_status = rsmi_wrapper(rsmi_dev_temp_metric_get, processor_handle, 0,
@@ -880,6 +974,40 @@ static void system_wait(int milli_seconds) {
   LOG_DEBUG(ss);
 }
 
+static amdsmi_status_t get_violation_metrics_sample(
+                amdsmi_processor_handle processor_handle, uint32_t partition_id,
+                violation_metrics_sample_t* sample) {
+    const amdsmi_gpu_metric_field_t metric_fields[] = {
+        AMDSMI_GPU_METRIC_FIRMWARE_TIMESTAMP,
+        AMDSMI_GPU_METRIC_ACCUMULATION_COUNTER,
+        AMDSMI_GPU_METRIC_PROCHOT_RESIDENCY_ACC,
+        AMDSMI_GPU_METRIC_PPT_RESIDENCY_ACC,
+        AMDSMI_GPU_METRIC_SOCKET_THM_RESIDENCY_ACC,
+        AMDSMI_GPU_METRIC_VR_THM_RESIDENCY_ACC,
+        AMDSMI_GPU_METRIC_HBM_THM_RESIDENCY_ACC,
+        AMDSMI_GPU_METRIC_GFX_BELOW_HOST_LIMIT_ACC,
+    };
+    constexpr uint32_t kNumMetricFields = static_cast<uint32_t>(std::size(metric_fields));
+    amdsmi_gpu_metric_field_value_t metric_values[kNumMetricFields] = {};
+    amdsmi_status_t status = amdsmi_get_gpu_metrics_fields(processor_handle, metric_fields,
+                                                           kNumMetricFields, metric_values);
+    if (status != AMDSMI_STATUS_SUCCESS) {
+        return status;
+    }
+
+    sample->firmware_timestamp = gpu_metric_field_value<uint64_t>(metric_values[0]);
+    sample->accumulation_counter = gpu_metric_field_value<uint64_t>(metric_values[1]);
+    sample->prochot_residency_acc = gpu_metric_field_value<uint64_t>(metric_values[2]);
+    sample->ppt_residency_acc = gpu_metric_field_value<uint64_t>(metric_values[3]);
+    sample->socket_thm_residency_acc = gpu_metric_field_value<uint64_t>(metric_values[4]);
+    sample->vr_thm_residency_acc = gpu_metric_field_value<uint64_t>(metric_values[5]);
+    sample->hbm_thm_residency_acc = gpu_metric_field_value<uint64_t>(metric_values[6]);
+    // Per partition (xcp) value; N/A when the partition id is unknown
+    sample->gfx_below_host_limit_acc =
+        gpu_metric_field_value<uint64_t>(metric_values[7], partition_id);
+    return AMDSMI_STATUS_SUCCESS;
+}
+
 amdsmi_status_t amdsmi_get_violation_status(amdsmi_processor_handle processor_handle,
             amdsmi_violation_status_t *violation_status) {
     AMDSMI_CHECK_INIT();
@@ -950,24 +1078,23 @@ amdsmi_status_t amdsmi_get_violation_status(amdsmi_processor_handle processor_ha
         partitition_id = tmp_partition_id;
     }
 
-    amdsmi_gpu_metrics_t metric_info_a = {};
-    status =  amdsmi_get_gpu_metrics_info(
-                    processor_handle, &metric_info_a);
+    violation_metrics_sample_t latest_sample = {};
+    status = get_violation_metrics_sample(processor_handle, partitition_id, &latest_sample);
     if (status != AMDSMI_STATUS_SUCCESS) {
         std::ostringstream ss;
-        ss << __PRETTY_FUNCTION__ << " | amdsmi_get_gpu_metrics_info failed with status = " << smi_amdgpu_get_status_string(status, false);
+        ss << __PRETTY_FUNCTION__ << " | amdsmi_get_gpu_metrics_fields failed with status = " << smi_amdgpu_get_status_string(status, false);
         LOG_ERROR(ss);
         return status;
     }
 
     // if all of these values are "undefined" then the feature is not supported on the ASIC
-    if (metric_info_a.accumulation_counter == std::numeric_limits<uint64_t>::max()
-        && metric_info_a.prochot_residency_acc == std::numeric_limits<uint64_t>::max()
-        && metric_info_a.ppt_residency_acc == std::numeric_limits<uint64_t>::max()
-        && metric_info_a.socket_thm_residency_acc == std::numeric_limits<uint64_t>::max()
-        && metric_info_a.vr_thm_residency_acc == std::numeric_limits<uint64_t>::max()
-        && metric_info_a.hbm_thm_residency_acc == std::numeric_limits<uint64_t>::max()
-        && (metric_info_a.xcp_stats->gfx_below_host_limit_acc[partitition_id]
+    if (latest_sample.accumulation_counter == std::numeric_limits<uint64_t>::max()
+        && latest_sample.prochot_residency_acc == std::numeric_limits<uint64_t>::max()
+        && latest_sample.ppt_residency_acc == std::numeric_limits<uint64_t>::max()
+        && latest_sample.socket_thm_residency_acc == std::numeric_limits<uint64_t>::max()
+        && latest_sample.vr_thm_residency_acc == std::numeric_limits<uint64_t>::max()
+        && latest_sample.hbm_thm_residency_acc == std::numeric_limits<uint64_t>::max()
+        && (latest_sample.gfx_below_host_limit_acc
         == std::numeric_limits<uint64_t>::max())) {
         ss << __PRETTY_FUNCTION__
            << " | ASIC does not support throttle violations!, "
@@ -976,14 +1103,54 @@ amdsmi_status_t amdsmi_get_violation_status(amdsmi_processor_handle processor_ha
         return AMDSMI_STATUS_NOT_SUPPORTED;
     }
 
-    // wait 100ms before reading again
-    system_wait(static_cast<int>(kFASTEST_POLL_TIME_MS));
+    // Compare against the samples kept from the previous call; only the
+    // first call (or the first after the counters were reset) has to wait
+    // for a second sample. Without an accumulation counter there is no
+    // telling a new firmware sample from the last one, so nothing is kept.
+    const auto history_key = std::make_pair(processor_handle, partitition_id);
+    const bool is_counter_valid =
+        (latest_sample.accumulation_counter != std::numeric_limits<uint64_t>::max());
+    violation_metrics_sample_t metric_info_a = {};
+    violation_metrics_sample_t metric_info_b = {};
+    bool has_history = false;
+    if (is_counter_valid) {
+        std::lock_guard<std::mutex> lock(violation_history_mutex);
+        auto it = violation_history.find(history_key);
+        if (it != violation_history.end()) {
+            auto& history = it->second;
+            if (latest_sample.accumulation_counter < history.newer.accumulation_counter) {
+                violation_history.erase(it);
+            } else {
+                // Same firmware sample as last time: keep the last interval
+                if (latest_sample.accumulation_counter != history.newer.accumulation_counter) {
+                    history.older = history.newer;
+                    history.newer = latest_sample;
+                }
+                metric_info_a = history.older;
+                metric_info_b = history.newer;
+                has_history = true;
+            }
+        }
+    }
 
-    amdsmi_gpu_metrics_t metric_info_b = {};
-    status =  amdsmi_get_gpu_metrics_info(
-            processor_handle, &metric_info_b);
-    if (status != AMDSMI_STATUS_SUCCESS) {
-        return status;
+    if (!has_history) {
+        metric_info_a = latest_sample;
+
+        // wait 100ms before reading again
+        system_wait(static_cast<int>(kFASTEST_POLL_TIME_MS));
+
+        // The second sample must come from the driver, not the cached snapshot
+        rsmi_wrapper(rsmi_dev_gpu_metrics_cache_invalidate, processor_handle, 0);
+
+        status = get_violation_metrics_sample(processor_handle, partitition_id, &metric_info_b);
+        if (status != AMDSMI_STATUS_SUCCESS) {
+            return status;
+        }
+
+        if (is_counter_valid) {
+            std::lock_guard<std::mutex> lock(violation_history_mutex);
+            violation_history[history_key] = {metric_info_a, metric_info_b};
+        }
     }
 
     // Insert current accumulator counters into struct
@@ -995,7 +1162,7 @@ amdsmi_status_t amdsmi_get_violation_status(amdsmi_processor_handle processor_ha
     violation_status->acc_vr_thrm = metric_info_b.vr_thm_residency_acc;
     violation_status->acc_hbm_thrm = metric_info_b.hbm_thm_residency_acc;
     violation_status->acc_gfx_clk_below_host_limit
-        = metric_info_b.xcp_stats->gfx_below_host_limit_acc[partitition_id];
+        = metric_info_b.gfx_below_host_limit_acc;
 
     ss << __PRETTY_FUNCTION__ << " | "
        << "[gpu_metrics A] metric_info_a.accumulation_counter: " << std::dec
@@ -1011,7 +1178,7 @@ amdsmi_status_t amdsmi_get_violation_status(amdsmi_processor_handle processor_ha
        << "; metric_info_a.hbm_thm_residency_acc: " << std::dec
        << metric_info_a.hbm_thm_residency_acc << "\n"
        << "; metric_info_b.xcp_stats->gfx_below_host_limit_acc[" << partitition_id << "]: "
-       << std::dec << metric_info_a.xcp_stats->gfx_below_host_limit_acc[partitition_id] << "\n"
+       << std::dec << metric_info_a.gfx_below_host_limit_acc << "\n"
        << " [gpu_metrics B] metric_info_b.accumulation_counter: " << std::dec
        << metric_info_b.accumulation_counter << "\n"
        << "; metric_info_b.prochot_residency_acc: " << std::dec
@@ -1025,7 +1192,7 @@ amdsmi_status_t amdsmi_get_violation_status(amdsmi_processor_handle processor_ha
        << "; metric_info_b.hbm_thm_residency_acc: " << std::dec
        << metric_info_b.hbm_thm_residency_acc << "\n"
        << "; metric_info_b.xcp_stats->gfx_below_host_limit_acc[" << partitition_id << "]: "
-       << std::dec << metric_info_b.xcp_stats->gfx_below_host_limit_acc[partitition_id] << "\n";
+       << std::dec << metric_info_b.gfx_below_host_limit_acc << "\n";
     LOG_DEBUG(ss);
 
     if ( (metric_info_b.prochot_residency_acc != std::numeric_limits<uint64_t>::max()
@@ -1131,13 +1298,13 @@ amdsmi_status_t amdsmi_get_violation_status(amdsmi_processor_handle processor_ha
            << violation_status->active_hbm_thrm << "\n";
         LOG_DEBUG(ss);
     }
-    if ( (metric_info_b.xcp_stats->gfx_below_host_limit_acc[partitition_id] != std::numeric_limits<uint64_t>::max()
-        || metric_info_a.xcp_stats->gfx_below_host_limit_acc[partitition_id] != std::numeric_limits<uint64_t>::max())
-        && (metric_info_b.xcp_stats->gfx_below_host_limit_acc[partitition_id] >= metric_info_a.xcp_stats->gfx_below_host_limit_acc[partitition_id])
+    if ( (metric_info_b.gfx_below_host_limit_acc != std::numeric_limits<uint64_t>::max()
+        || metric_info_a.gfx_below_host_limit_acc != std::numeric_limits<uint64_t>::max())
+        && (metric_info_b.gfx_below_host_limit_acc >= metric_info_a.gfx_below_host_limit_acc)
         && ((metric_info_b.accumulation_counter - metric_info_a.accumulation_counter) > 0) ) {
         violation_status->per_gfx_clk_below_host_limit =
-            (((metric_info_b.xcp_stats->gfx_below_host_limit_acc[partitition_id] -
-                metric_info_a.xcp_stats->gfx_below_host_limit_acc[partitition_id]) * 100) /
+            (((metric_info_b.gfx_below_host_limit_acc -
+                metric_info_a.gfx_below_host_limit_acc) * 100) /
             (metric_info_b.accumulation_counter - metric_info_a.accumulation_counter));
 
         if (violation_status->per_gfx_clk_below_host_limit > 0) {
@@ -1295,14 +1462,19 @@ amdsmi_get_gpu_asic_info(amdsmi_processor_handle processor_handle, amdsmi_asic_i
     if (r != AMDSMI_STATUS_SUCCESS)
         return r;
 
+    uint64_t generation = 0;
+    if (gpu_device->load_static_info(info, &generation)) {
+        return AMDSMI_STATUS_SUCCESS;
+    }
+
     amdsmi_status_t status;
     if (gpu_device->check_if_drm_is_supported()){
         status = gpu_device->amdgpu_query_info(AMDGPU_INFO_DEV_INFO, sizeof(struct drm_amdgpu_info_device), &dev_info);
         if (status != AMDSMI_STATUS_SUCCESS) return status;
 
-        SMIGPUDEVICE_MUTEX(gpu_device->get_mutex())
+        SMIGPUDEVICE_MUTEX_SHARED(gpu_device->get_mutex())
 
-        std::string path = "/sys/class/drm/" + gpu_device->get_gpu_path() + "/device/unique_id";
+        std::string path = amd::smi::FsRootPath("/sys/class/drm/") + gpu_device->get_gpu_path() + "/device/unique_id";
         FILE *fp = fopen(path.c_str(), "r");
         if (fp) {
             fscanf(fp, "%s", info->asic_serial);
@@ -1372,6 +1544,7 @@ amdsmi_get_gpu_asic_info(amdsmi_processor_handle processor_handle, amdsmi_asic_i
         info->target_graphics_version = tmp_target_gfx_version;
     }
 
+    gpu_device->store_static_info(*info, generation);
     return AMDSMI_STATUS_SUCCESS;
 }
 
@@ -1497,6 +1670,11 @@ amdsmi_status_t amdsmi_get_gpu_vram_info(
     if (r != AMDSMI_STATUS_SUCCESS)
         return r;
 
+    uint64_t generation = 0;
+    if (gpu_device->load_static_info(info, &generation)) {
+        return AMDSMI_STATUS_SUCCESS;
+    }
+
     // init the info structure with default value
     info->vram_type = AMDSMI_VRAM_TYPE_UNKNOWN;
     info->vram_size = 0;
@@ -1560,6 +1738,7 @@ amdsmi_status_t amdsmi_get_gpu_vram_info(
         info->vram_size = total / (1024 * 1024);
     }
 
+    gpu_device->store_static_info(*info, generation);
     return AMDSMI_STATUS_SUCCESS;
 }
 
@@ -2620,6 +2799,254 @@ amdsmi_status_t  amdsmi_get_gpu_metrics_info(
                        reinterpret_cast<rsmi_gpu_metrics_t*>(pgpu_metrics));
 }
 
+amdsmi_status_t amdsmi_get_gpu_metrics_info_bulk(
+        const amdsmi_processor_handle *processor_handles, uint32_t num_handles,
+        amdsmi_gpu_metrics_t *pgpu_metrics, amdsmi_status_t *statuses) {
+    AMDSMI_CHECK_INIT();
+
+    if ((processor_handles == nullptr) || (pgpu_metrics == nullptr) ||
+        (statuses == nullptr) || (num_handles == 0)) {
+        return AMDSMI_STATUS_INVAL;
+    }
+
+    // Each device has its own locks, so the reads overlap
+    amd::smi::AMDSmiWorkerPool::getInstance().run_all(num_handles,
+        [&](uint32_t idx) {
+            statuses[idx] = amdsmi_get_gpu_metrics_info(processor_handles[idx],
+                                                        &pgpu_metrics[idx]);
+        });
+
+    return AMDSMI_STATUS_SUCCESS;
+}
+
+static_assert(static_cast<uint32_t>(AMDSMI_GPU_METRIC_FIRST) ==
+              static_cast<uint32_t>(amd::smi::AMDGpuMetricsUnitType_t::kMetricTempEdge),
+              "amdsmi_gpu_metric_field_t must match AMDGpuMetricsUnitType_t");
+static_assert(static_cast<uint32_t>(AMDSMI_GPU_METRIC_FIRMWARE_TIMESTAMP) ==
+              static_cast<uint32_t>(amd::smi::AMDGpuMetricsUnitType_t::kMetricTSFirmware),
+              "amdsmi_gpu_metric_field_t must match AMDGpuMetricsUnitType_t");
+static_assert(static_cast<uint32_t>(AMDSMI_GPU_METRIC__MAX) ==
+              static_cast<uint32_t>(amd::smi::AMDGpuMetricsUnitType_t::kMetricGfxBelowHostLimitAccumulator),
+              "amdsmi_gpu_metric_field_t must match AMDGpuMetricsUnitType_t");
+static_assert(AMDSMI_MAX_NUM_GPU_METRIC_FIELD_VALUES == amd::smi::kRSMI_MAX_NUM_METRIC_FIELD_VALUES,
+              "AMDSMI_MAX_NUM_GPU_METRIC_FIELD_VALUES must match kRSMI_MAX_NUM_METRIC_FIELD_VALUES");
+
+amdsmi_status_t amdsmi_get_gpu_metrics_fields(
+        amdsmi_processor_handle processor_handle,
+        const amdsmi_gpu_metric_field_t *fields, uint32_t num_fields,
+        amdsmi_gpu_metric_field_value_t *values) {
+    AMDSMI_CHECK_INIT();
+
+    if ((fields == nullptr) || (values == nullptr) || (num_fields == 0)) {
+        return AMDSMI_STATUS_INVAL;
+    }
+
+    std::vector<amd::smi::AMDGpuMetricsUnitType_t> metric_units(num_fields);
+    for (uint32_t i = 0; i < num_fields; ++i) {
+        if (static_cast<uint32_t>(fields[i]) > static_cast<uint32_t>(AMDSMI_GPU_METRIC__MAX)) {
+            return AMDSMI_STATUS_INVAL;
+        }
+        metric_units[i] = static_cast<amd::smi::AMDGpuMetricsUnitType_t>(fields[i]);
+    }
+
+    std::vector<amd::smi::AMDGpuMetricFieldValue_t> metric_values(num_fields);
+    amdsmi_status_t status = rsmi_wrapper(amd::smi::rsmi_dev_gpu_metrics_fields_query,
+                                          processor_handle, 0,
+                                          metric_units.data(), num_fields,
+                                          metric_values.data());
+    if (status != AMDSMI_STATUS_SUCCESS) {
+        return status;
+    }
+
+    for (uint32_t i = 0; i < num_fields; ++i) {
+        values[i].status = amd::smi::rsmi_to_amdsmi_status(metric_values[i].m_status);
+        values[i].num_values = metric_values[i].m_num_values;
+        std::copy_n(metric_values[i].m_values, metric_values[i].m_num_values, values[i].values);
+        std::fill(values[i].values + metric_values[i].m_num_values,
+                  values[i].values + AMDSMI_MAX_NUM_GPU_METRIC_FIELD_VALUES,
+                  std::numeric_limits<uint64_t>::max());
+    }
+
+    return AMDSMI_STATUS_SUCCESS;
+}
+
+amdsmi_status_t amdsmi_set_gpu_metrics_cache_max_age(
+        amdsmi_processor_handle processor_handle, uint32_t max_age_ms) {
+    AMDSMI_CHECK_INIT();
+
+    return rsmi_wrapper(rsmi_dev_gpu_metrics_cache_max_age_set, processor_handle, 0,
+                        max_age_ms);
+}
+
+amdsmi_status_t amdsmi_get_gpu_metrics_cache_max_age(
+        amdsmi_processor_handle processor_handle, uint32_t *max_age_ms) {
+    AMDSMI_CHECK_INIT();
+
+    if (max_age_ms == nullptr) {
+        return AMDSMI_STATUS_INVAL;
+    }
+    return rsmi_wrapper(rsmi_dev_gpu_metrics_cache_max_age_get, processor_handle, 0,
+                        max_age_ms);
+}
+
+amdsmi_status_t amdsmi_invalidate_gpu_metrics_cache(
+        amdsmi_processor_handle processor_handle) {
+    AMDSMI_CHECK_INIT();
+
+    return rsmi_wrapper(rsmi_dev_gpu_metrics_cache_invalidate, processor_handle, 0);
+}
+
+amdsmi_status_t amdsmi_refresh_gpu_metrics_cache(
+        amdsmi_processor_handle processor_handle) {
+    AMDSMI_CHECK_INIT();
+
+    return rsmi_wrapper(rsmi_dev_gpu_metrics_cache_refresh, processor_handle, 0);
+}
+
+amdsmi_status_t amdsmi_sampler_start(uint32_t period_us,
+                                     const amdsmi_gpu_metric_field_t *fields,
+                                     uint32_t num_fields, uint32_t history_depth) {
+    AMDSMI_CHECK_INIT();
+
+    if ((fields == nullptr) || (num_fields == 0) || (period_us == 0) ||
+        (history_depth == 0) || (history_depth > AMDSMI_MAX_SAMPLER_HISTORY_DEPTH)) {
+        return AMDSMI_STATUS_INVAL;
+    }
+    for (uint32_t i = 0; i < num_fields; ++i) {
+        if (static_cast<uint32_t>(fields[i]) > static_cast<uint32_t>(AMDSMI_GPU_METRIC__MAX)) {
+            return AMDSMI_STATUS_INVAL;
+        }
+    }
+
+    std::vector<amdsmi_processor_handle> processor_handles;
+    for (auto& socket : amd::smi::AMDSmiSystem::getInstance().get_sockets()) {
+        for (auto& processor : socket->get_processors(AMDSMI_PROCESSOR_TYPE_AMD_GPU)) {
+            processor_handles.push_back(processor);
+        }
+    }
+    if (processor_handles.empty()) {
+        return AMDSMI_STATUS_NOT_FOUND;
+    }
+
+    return amd::smi::AMDSmiSampler::getInstance().start(period_us, fields, num_fields,
+                                                        history_depth, processor_handles);
+}
+
+amdsmi_status_t amdsmi_sampler_stop(void) {
+    AMDSMI_CHECK_INIT();
+
+    amd::smi::AMDSmiSampler::getInstance().stop();
+    return AMDSMI_STATUS_SUCCESS;
+}
+
+amdsmi_status_t amdsmi_sampler_get_latest(amdsmi_processor_handle processor_handle,
+                                          uint64_t *timestamp_ns,
+                                          amdsmi_gpu_metric_field_value_t *values,
+                                          uint32_t num_fields) {
+    AMDSMI_CHECK_INIT();
+
+    if ((timestamp_ns == nullptr) || (values == nullptr) || (num_fields == 0)) {
+        return AMDSMI_STATUS_INVAL;
+    }
+    return amd::smi::AMDSmiSampler::getInstance().get_latest(processor_handle, timestamp_ns,
+                                                             values, num_fields);
+}
+
+amdsmi_status_t amdsmi_sampler_get_history(amdsmi_processor_handle processor_handle,
+                                           uint32_t *num_samples, uint64_t *timestamps_ns,
+                                           amdsmi_gpu_metric_field_value_t *values,
+                                           uint32_t num_fields) {
+    AMDSMI_CHECK_INIT();
+
+    if ((num_samples == nullptr) || (*num_samples == 0) || (timestamps_ns == nullptr) ||
+        (values == nullptr) || (num_fields == 0)) {
+        return AMDSMI_STATUS_INVAL;
+    }
+    return amd::smi::AMDSmiSampler::getInstance().get_history(processor_handle, num_samples,
+                                                              timestamps_ns, values,
+                                                              num_fields);
+}
+
+amdsmi_status_t amdsmi_async_submit(amdsmi_async_op_t op,
+                                    amdsmi_processor_handle processor_handle, void *out,
+                                    amdsmi_async_callback_t callback, void *user_data,
+                                    amdsmi_async_request_t *request) {
+    AMDSMI_CHECK_INIT();
+
+    return amd::smi::AMDSmiAsync::getInstance().submit(op, processor_handle, out, callback,
+                                                       user_data, request);
+}
+
+amdsmi_status_t amdsmi_async_get_eventfd(int *fd) {
+    AMDSMI_CHECK_INIT();
+
+    if (fd == nullptr) {
+        return AMDSMI_STATUS_INVAL;
+    }
+    return amd::smi::AMDSmiAsync::getInstance().get_eventfd(fd);
+}
+
+amdsmi_status_t amdsmi_async_get_completions(amdsmi_async_completion_t *completions,
+                                             uint32_t *num_completions) {
+    AMDSMI_CHECK_INIT();
+
+    if ((completions == nullptr) || (num_completions == nullptr) || (*num_completions == 0)) {
+        return AMDSMI_STATUS_INVAL;
+    }
+    *num_completions = amd::smi::AMDSmiAsync::getInstance().get_completions(completions,
+                                                                            *num_completions);
+    return AMDSMI_STATUS_SUCCESS;
+}
+
+amdsmi_status_t amdsmi_get_gpu_metrics_rates(amdsmi_processor_handle processor_handle,
+                                             const amdsmi_gpu_metric_field_t *fields,
+                                             uint32_t num_fields,
+                                             amdsmi_gpu_metric_rate_t *rates) {
+    AMDSMI_CHECK_INIT();
+
+    if ((fields == nullptr) || (rates == nullptr) || (num_fields == 0)) {
+        return AMDSMI_STATUS_INVAL;
+    }
+    for (uint32_t i = 0; i < num_fields; ++i) {
+        if (!amd::smi::AMDSmiGpuMetricsRates::is_rate_field(fields[i])) {
+            return AMDSMI_STATUS_INVAL;
+        }
+    }
+
+    amd::smi::AMDSmiGPUDevice* gpu_device = nullptr;
+    amdsmi_status_t r = get_gpu_device_from_handle(processor_handle, &gpu_device);
+    if (r != AMDSMI_STATUS_SUCCESS) {
+        return r;
+    }
+    return gpu_device->get_gpu_metrics_rates().get_rates(processor_handle, fields,
+                                                         num_fields, rates);
+}
+
+amdsmi_status_t amdsmi_set_gpu_metrics_rates_time_constant(
+        amdsmi_processor_handle processor_handle, uint32_t time_constant_ms) {
+    AMDSMI_CHECK_INIT();
+
+    amd::smi::AMDSmiGPUDevice* gpu_device = nullptr;
+    amdsmi_status_t r = get_gpu_device_from_handle(processor_handle, &gpu_device);
+    if (r != AMDSMI_STATUS_SUCCESS) {
+        return r;
+    }
+    gpu_device->get_gpu_metrics_rates().set_time_constant_ms(time_constant_ms);
+    return AMDSMI_STATUS_SUCCESS;
+}
+
+amdsmi_status_t amdsmi_reset_gpu_metrics_rates(amdsmi_processor_handle processor_handle) {
+    AMDSMI_CHECK_INIT();
+
+    amd::smi::AMDSmiGPUDevice* gpu_device = nullptr;
+    amdsmi_status_t r = get_gpu_device_from_handle(processor_handle, &gpu_device);
+    if (r != AMDSMI_STATUS_SUCCESS) {
+        return r;
+    }
+    gpu_device->get_gpu_metrics_rates().reset();
+    return AMDSMI_STATUS_SUCCESS;
+}
+
 
 amdsmi_status_t amdsmi_get_gpu_pm_metrics_info(
                       amdsmi_processor_handle processor_handle,
@@ -2936,6 +3363,101 @@ amdsmi_status_t amdsmi_get_gpu_memory_usage(amdsmi_processor_handle processor_ha
                     static_cast<rsmi_memory_type_t>(mem_type), used);
 }
 
+amdsmi_status_t amdsmi_get_gpu_sysfs_snapshot(
+        const amdsmi_processor_handle *processor_handles, uint32_t num_handles,
+        amdsmi_gpu_sysfs_snapshot_t *snapshots) {
+    AMDSMI_CHECK_INIT();
+
+    if ((processor_handles == nullptr) || (snapshots == nullptr) ||
+        (num_handles == 0)) {
+        return AMDSMI_STATUS_INVAL;
+    }
+
+    static const std::pair<amd::smi::DevInfoTypes,
+                           uint64_t amdsmi_gpu_sysfs_snapshot_t::*> kSnapshotAttribs[] = {
+        {amd::smi::kDevUsage, &amdsmi_gpu_sysfs_snapshot_t::gfx_activity},
+        {amd::smi::kDevMemBusyPercent, &amdsmi_gpu_sysfs_snapshot_t::umc_activity},
+        {amd::smi::kDevMemTotVRAM, &amdsmi_gpu_sysfs_snapshot_t::vram_total},
+        {amd::smi::kDevMemUsedVRAM, &amdsmi_gpu_sysfs_snapshot_t::vram_used},
+        {amd::smi::kDevMemTotVisVRAM, &amdsmi_gpu_sysfs_snapshot_t::vis_vram_total},
+        {amd::smi::kDevMemUsedVisVRAM, &amdsmi_gpu_sysfs_snapshot_t::vis_vram_used},
+        {amd::smi::kDevMemTotGTT, &amdsmi_gpu_sysfs_snapshot_t::gtt_total},
+        {amd::smi::kDevMemUsedGTT, &amdsmi_gpu_sysfs_snapshot_t::gtt_used},
+        {amd::smi::kDevPCIEReplayCount, &amdsmi_gpu_sysfs_snapshot_t::pcie_replay_count},
+    };
+    constexpr std::size_t kNumSnapshotAttribs = std::size(kSnapshotAttribs);
+    // Each attribute is a single number
+    constexpr std::size_t kAttribBufSize = 64;
+
+    const auto& devices = amd::smi::RocmSMI::getInstance().devices();
+    std::vector<char> bufs(num_handles * kNumSnapshotAttribs * kAttribBufSize);
+    std::vector<amd::smi::SysfsReadRequest_t> reqs;
+    std::vector<uint32_t> req_handle_idx;
+    reqs.reserve(bufs.size() / kAttribBufSize);
+    req_handle_idx.reserve(bufs.size() / kAttribBufSize);
+
+    for (uint32_t i = 0; i < num_handles; ++i) {
+        auto& snapshot = snapshots[i];
+        memset(&snapshot, 0, sizeof(snapshot));
+        for (const auto& [type, field] : kSnapshotAttribs) {
+            snapshot.*field = std::numeric_limits<uint64_t>::max();
+        }
+        snapshot.status = AMDSMI_STATUS_NOT_SUPPORTED;
+
+        amd::smi::AMDSmiGPUDevice* gpu_device = nullptr;
+        auto status = get_gpu_device_from_handle(processor_handles[i], &gpu_device);
+        if (status != AMDSMI_STATUS_SUCCESS) {
+            snapshot.status = status;
+            continue;
+        }
+        if (gpu_device->get_gpu_id() >= devices.size()) {
+            snapshot.status = AMDSMI_STATUS_NOT_FOUND;
+            continue;
+        }
+        auto device = devices[gpu_device->get_gpu_id()].get();
+        for (const auto& [type, field] : kSnapshotAttribs) {
+            reqs.push_back({device, type, &bufs[reqs.size() * kAttribBufSize],
+                            kAttribBufSize, {}, 0});
+            req_handle_idx.push_back(i);
+        }
+    }
+
+    amd::smi::SysfsBatchReader::getInstance().read(reqs.data(), reqs.size());
+
+    for (std::size_t r = 0; r < reqs.size(); ++r) {
+        auto& snapshot = snapshots[req_handle_idx[r]];
+        auto field = kSnapshotAttribs[r % kNumSnapshotAttribs].second;
+        uint64_t val = 0;
+        if ((reqs[r].err == 0) &&
+            amd::smi::ParseTextUInt(amd::smi::NextTextToken(&reqs[r].text), &val)) {
+            snapshot.*field = val;
+            snapshot.status = AMDSMI_STATUS_SUCCESS;
+        }
+    }
+
+    // Devices without VRAM (ie: APUs) report 0 in sysfs; like
+    // amdsmi_get_gpu_memory_total() and amdsmi_get_gpu_memory_usage(), fall
+    // back to the memory reported by KFD then.
+    for (uint32_t i = 0; i < num_handles; ++i) {
+        auto& snapshot = snapshots[i];
+        if ((snapshot.status != AMDSMI_STATUS_SUCCESS) || (snapshot.vram_total != 0)) {
+            continue;
+        }
+        uint64_t val = 0;
+        if ((snapshot.vram_used == 0) &&
+            (amdsmi_get_gpu_memory_usage(processor_handles[i], AMDSMI_MEM_TYPE_VRAM, &val) ==
+             AMDSMI_STATUS_SUCCESS)) {
+            snapshot.vram_used = val;
+        }
+        if ((amdsmi_get_gpu_memory_total(processor_handles[i], AMDSMI_MEM_TYPE_VRAM, &val) ==
+             AMDSMI_STATUS_SUCCESS)) {
+            snapshot.vram_total = val;
+        }
+    }
+
+    return AMDSMI_STATUS_SUCCESS;
+}
+
 amdsmi_status_t amdsmi_get_gpu_overdrive_level(
             amdsmi_processor_handle processor_handle,
             uint32_t *od) {
@@ -2964,6 +3486,14 @@ amdsmi_status_t amdsmi_get_gpu_pci_throughput(
             sent, received, max_pkt_sz);
 }
 
+amdsmi_status_t amdsmi_get_gpu_pci_throughput_latest(
+        amdsmi_processor_handle processor_handle,
+        uint64_t *sent, uint64_t *received, uint64_t *max_pkt_sz,
+        uint64_t *age_ms) {
+    return rsmi_wrapper(rsmi_dev_pci_throughput_latest_get, processor_handle, 0,
+            sent, received, max_pkt_sz, age_ms);
+}
+
 amdsmi_status_t  amdsmi_get_gpu_od_volt_info(amdsmi_processor_handle processor_handle,
                                             amdsmi_od_volt_freq_data_t *odv) {
     return rsmi_wrapper(rsmi_dev_od_volt_info_get, processor_handle, 0,
@@ -2985,6 +3515,60 @@ amdsmi_status_t  amdsmi_get_gpu_volt_metric(amdsmi_processor_handle processor_ha
                 static_cast<rsmi_voltage_metric_t>(metric), voltage);
 }
 
+amdsmi_status_t amdsmi_get_gpu_hwmon_snapshot(amdsmi_processor_handle processor_handle,
+                                              amdsmi_gpu_hwmon_snapshot_t *snapshot) {
+    AMDSMI_CHECK_INIT();
+
+    if (snapshot == nullptr) {
+        return AMDSMI_STATUS_INVAL;
+    }
+
+    amd::smi::AMDSmiGPUDevice* gpu_device = nullptr;
+    amdsmi_status_t status = get_gpu_device_from_handle(processor_handle, &gpu_device);
+    if (status != AMDSMI_STATUS_SUCCESS) {
+        return status;
+    }
+
+    const auto& devices = amd::smi::RocmSMI::getInstance().devices();
+    if (gpu_device->get_gpu_id() >= devices.size()) {
+        return AMDSMI_STATUS_NOT_FOUND;
+    }
+    const auto& monitor = devices[gpu_device->get_gpu_id()]->monitor();
+    if (monitor == nullptr) {
+        return AMDSMI_STATUS_NOT_SUPPORTED;
+    }
+
+    amd::smi::MonitorSnapshot_t mon_snapshot;
+    {
+        SMIGPUDEVICE_MUTEX_SHARED(gpu_device->get_mutex())
+        monitor->readAll(&mon_snapshot);
+    }
+
+    memset(snapshot, 0, sizeof(*snapshot));
+    status = AMDSMI_STATUS_NOT_SUPPORTED;
+    auto copy_value = [&status](const amd::smi::MonitorValue_t& mon_val,
+                                int64_t *val, int64_t divisor = 1) {
+        if (mon_val.err != 0) {
+            *val = std::numeric_limits<int64_t>::max();
+            return;
+        }
+        *val = mon_val.value / divisor;
+        status = AMDSMI_STATUS_SUCCESS;
+    };
+    for (uint32_t t = AMDSMI_TEMPERATURE_TYPE_FIRST;
+         t <= AMDSMI_TEMPERATURE_TYPE_VRAM; ++t) {
+        // The hwmon reports millidegrees
+        copy_value(mon_snapshot.temperature[t], &snapshot->temperature[t], 1000);
+    }
+    copy_value(mon_snapshot.voltage[RSMI_VOLT_TYPE_VDDGFX], &snapshot->gfx_voltage);
+    copy_value(mon_snapshot.fan_rpms, &snapshot->fan_rpms);
+    copy_value(mon_snapshot.fan_speed, &snapshot->fan_speed);
+    copy_value(mon_snapshot.power_average, &snapshot->average_socket_power);
+    copy_value(mon_snapshot.power_input, &snapshot->current_socket_power);
+
+    return status;
+}
+
 amdsmi_status_t  amdsmi_set_gpu_od_clk_info(amdsmi_processor_handle processor_handle,
                                         amdsmi_freq_ind_t level,
                                        uint64_t clkvalue,
@@ -3020,7 +3604,15 @@ amdsmi_status_t amdsmi_set_gpu_clk_limit(amdsmi_processor_handle processor_handl
 }
 
 amdsmi_status_t amdsmi_reset_gpu(amdsmi_processor_handle processor_handle) {
-    return rsmi_wrapper(rsmi_dev_gpu_reset, processor_handle, 0);
+    amdsmi_status_t status = rsmi_wrapper(rsmi_dev_gpu_reset, processor_handle, 0);
+    if (status == AMDSMI_STATUS_SUCCESS) {
+        // The accumulators start over after a reset
+        amd::smi::AMDSmiGPUDevice* gpu_device = nullptr;
+        if (get_gpu_device_from_handle(processor_handle, &gpu_device) == AMDSMI_STATUS_SUCCESS) {
+            gpu_device->get_gpu_metrics_rates().reset();
+        }
+    }
+    return status;
 }
 
 amdsmi_status_t amdsmi_get_utilization_count(amdsmi_processor_handle processor_handle,
@@ -3063,6 +3655,107 @@ amdsmi_status_t amdsmi_get_lib_version(amdsmi_version_t *version) {
     return AMDSMI_STATUS_SUCCESS;
 }
 
+amdsmi_status_t amdsmi_set_lib_perf_stats_enabled(bool enabled) {
+    amd::smi::PerfStats::getInstance().setEnabled(enabled);
+    return AMDSMI_STATUS_SUCCESS;
+}
+
+amdsmi_status_t
+amdsmi_get_lib_perf_stats(uint32_t *num_stats, amdsmi_lib_perf_stats_t *stats) {
+    if (num_stats == nullptr)
+        return AMDSMI_STATUS_INVAL;
+
+    auto entries = amd::smi::PerfStats::getInstance().entries();
+    std::sort(entries.begin(), entries.end(),
+              [](const amd::smi::PerfStatsEntry_t& a,
+                 const amd::smi::PerfStatsEntry_t& b) {
+        int cmp = strcmp(a.api, b.api);
+        return (cmp != 0) ? (cmp < 0) : (a.dv_ind < b.dv_ind);
+    });
+
+    if (stats == nullptr) {
+        *num_stats = static_cast<uint32_t>(entries.size());
+        return AMDSMI_STATUS_SUCCESS;
+    }
+
+    uint32_t num = std::min(*num_stats, static_cast<uint32_t>(entries.size()));
+    for (uint32_t i = 0; i < num; ++i) {
+        const auto& entry = entries[i];
+        stats[i] = {};
+        strncpy(stats[i].api, entry.api, AMDSMI_MAX_STRING_LENGTH - 1);
+        stats[i].gpu_index = entry.dv_ind;
+        stats[i].calls = entry.calls;
+        stats[i].total_ns = entry.total_ns;
+        stats[i].min_ns = entry.min_ns;
+        stats[i].max_ns = entry.max_ns;
+        stats[i].p50_ns = entry.p50_ns;
+        stats[i].p90_ns = entry.p90_ns;
+        stats[i].p99_ns = entry.p99_ns;
+        stats[i].file_opens = entry.io[amd::smi::kPerfIoOpen];
+        stats[i].file_reads = entry.io[amd::smi::kPerfIoRead];
+        stats[i].ioctls = entry.io[amd::smi::kPerfIoIoctl];
+    }
+    *num_stats = num;
+    return (num < entries.size()) ? AMDSMI_STATUS_OUT_OF_RESOURCES
+                                  : AMDSMI_STATUS_SUCCESS;
+}
+
+amdsmi_status_t amdsmi_reset_lib_perf_stats(void) {
+    amd::smi::PerfStats::getInstance().reset();
+    return AMDSMI_STATUS_SUCCESS;
+}
+
+amdsmi_status_t amdsmi_set_lib_lock_stats_enabled(bool enabled) {
+    amd::smi::LockStats::getInstance().setEnabled(enabled);
+    return AMDSMI_STATUS_SUCCESS;
+}
+
+amdsmi_status_t
+amdsmi_get_lib_lock_stats(uint32_t *num_stats, amdsmi_lib_lock_stats_t *stats) {
+    if (num_stats == nullptr)
+        return AMDSMI_STATUS_INVAL;
+
+    // Sorted by lock and then GPU
+    auto entries = amd::smi::LockStats::getInstance().entries();
+
+    if (stats == nullptr) {
+        *num_stats = static_cast<uint32_t>(entries.size());
+        return AMDSMI_STATUS_SUCCESS;
+    }
+
+    static_assert(AMDSMI_LIB_LOCK_WAIT_BUCKETS == amd::smi::kLockWaitBuckets,
+                  "lock wait histogram sizes differ");
+    uint32_t num = std::min(*num_stats, static_cast<uint32_t>(entries.size()));
+    for (uint32_t i = 0; i < num; ++i) {
+        const auto& entry = entries[i];
+        stats[i] = {};
+        stats[i].lock = static_cast<amdsmi_lib_lock_type_t>(entry.kind);
+        stats[i].gpu_index = entry.dv_ind;
+        stats[i].acquisitions = entry.acquisitions;
+        stats[i].contended = entry.contended;
+        stats[i].failures = entry.failures;
+        stats[i].total_wait_ns = entry.total_wait_ns;
+        stats[i].max_wait_ns = entry.max_wait_ns;
+        stats[i].p50_wait_ns = entry.p50_wait_ns;
+        stats[i].p90_wait_ns = entry.p90_wait_ns;
+        stats[i].p99_wait_ns = entry.p99_wait_ns;
+        std::copy(entry.wait_buckets.begin(), entry.wait_buckets.end(),
+                  stats[i].wait_histogram);
+        stats[i].holders = entry.holders;
+        stats[i].holder_tid = static_cast<uint32_t>(entry.holder_tid);
+        stats[i].held_ns = entry.held_ns;
+        stats[i].owner_pid = static_cast<uint32_t>(entry.owner_pid);
+    }
+    *num_stats = num;
+    return (num < entries.size()) ? AMDSMI_STATUS_OUT_OF_RESOURCES
+                                  : AMDSMI_STATUS_SUCCESS;
+}
+
+amdsmi_status_t amdsmi_reset_lib_lock_stats(void) {
+    amd::smi::LockStats::getInstance().reset();
+    return AMDSMI_STATUS_SUCCESS;
+}
+
 amdsmi_status_t
 amdsmi_get_gpu_vbios_info(amdsmi_processor_handle processor_handle, amdsmi_vbios_info_t *info) {
     AMDSMI_CHECK_INIT();
@@ -3114,19 +3807,30 @@ amdsmi_get_gpu_activity(amdsmi_processor_handle processor_handle, amdsmi_engine_
         return AMDSMI_STATUS_INVAL;
     }
 
-    amdsmi_gpu_metrics_t metrics = {};
     amd::smi::AMDSmiGPUDevice* gpu_device = nullptr;
     amdsmi_status_t r = get_gpu_device_from_handle(processor_handle, &gpu_device);
     if (r != AMDSMI_STATUS_SUCCESS)
         return r;
+
+    const amdsmi_gpu_metric_field_t metric_fields[] = {
+        AMDSMI_GPU_METRIC_AVG_GFX_ACTIVITY,
+        AMDSMI_GPU_METRIC_AVG_MM_ACTIVITY,
+        AMDSMI_GPU_METRIC_AVG_UMC_ACTIVITY,
+    };
+    constexpr uint32_t kNumMetricFields = static_cast<uint32_t>(std::size(metric_fields));
+    amdsmi_gpu_metric_field_value_t metric_values[kNumMetricFields] = {};
     amdsmi_status_t status;
-    status =  amdsmi_get_gpu_metrics_info(processor_handle, &metrics);
+    status = amdsmi_get_gpu_metrics_fields(processor_handle, metric_fields,
+                                           kNumMetricFields, metric_values);
     if (status != AMDSMI_STATUS_SUCCESS) {
         return status;
     }
-    info->gfx_activity = metrics.average_gfx_activity;
-    info->mm_activity = metrics.average_mm_activity;
-    info->umc_activity = metrics.average_umc_activity;
+    info->gfx_activity =
+        gpu_metric_field_value<decltype(amdsmi_gpu_metrics_t::average_gfx_activity)>(metric_values[0]);
+    info->mm_activity =
+        gpu_metric_field_value<decltype(amdsmi_gpu_metrics_t::average_mm_activity)>(metric_values[1]);
+    info->umc_activity =
+        gpu_metric_field_value<decltype(amdsmi_gpu_metrics_t::average_umc_activity)>(metric_values[2]);
 
     return AMDSMI_STATUS_SUCCESS;
 }
@@ -3161,17 +3865,39 @@ amdsmi_get_clock_info(amdsmi_processor_handle processor_handle, amdsmi_clk_type_
         return AMDSMI_STATUS_INVAL;
     }
 
-    amdsmi_gpu_metrics_t metrics = {};
     amd::smi::AMDSmiGPUDevice* gpu_device = nullptr;
     amdsmi_status_t r = get_gpu_device_from_handle(processor_handle, &gpu_device);
     if (r != AMDSMI_STATUS_SUCCESS)
         return r;
     amdsmi_status_t status;
 
-    status =  amdsmi_get_gpu_metrics_info(processor_handle, &metrics);
+    enum { kGfxClk, kUClk, kVClk0, kVClk1, kDClk0, kDClk1, kSocClk, kNumClkFields };
+    const amdsmi_gpu_metric_field_t metric_fields[kNumClkFields] = {
+        AMDSMI_GPU_METRIC_CURR_GFXCLK,
+        AMDSMI_GPU_METRIC_CURR_UCLK,
+        AMDSMI_GPU_METRIC_CURR_VCLK0,
+        AMDSMI_GPU_METRIC_CURR_VCLK1,
+        AMDSMI_GPU_METRIC_CURR_DCLK0,
+        AMDSMI_GPU_METRIC_CURR_DCLK1,
+        AMDSMI_GPU_METRIC_CURR_SOCCLK,
+    };
+    amdsmi_gpu_metric_field_value_t metric_values[kNumClkFields] = {};
+    status = amdsmi_get_gpu_metrics_fields(processor_handle, metric_fields,
+                                           kNumClkFields, metric_values);
     if (status != AMDSMI_STATUS_SUCCESS) {
         return status;
     }
+    // Note: Backwards compatibility; from v1.4 vclk1/dclk1 are the second
+    //       instance of the multi-valued vclk0/dclk0
+    auto current_clk = [&](int clk_field, int multi_valued_clk_field) {
+        using ClkValue_t = decltype(amdsmi_gpu_metrics_t::current_gfxclk);
+        if ((metric_values[clk_field].status != AMDSMI_STATUS_SUCCESS) &&
+            (multi_valued_clk_field != clk_field)) {
+            return gpu_metric_field_value<ClkValue_t>(metric_values[multi_valued_clk_field], 1);
+        }
+        return gpu_metric_field_value<ClkValue_t>(metric_values[clk_field]);
+    };
+
     int max_freq;
     int min_freq;
     int sleep_state_freq;
@@ -3186,25 +3912,25 @@ amdsmi_get_clock_info(amdsmi_processor_handle processor_handle, amdsmi_clk_type_
 
     switch (clk_type) {
     case AMDSMI_CLK_TYPE_GFX:
-        info->clk = metrics.current_gfxclk;
+        info->clk = current_clk(kGfxClk, kGfxClk);
         break;
     case AMDSMI_CLK_TYPE_MEM:
-        info->clk = metrics.current_uclk;
+        info->clk = current_clk(kUClk, kUClk);
         break;
     case AMDSMI_CLK_TYPE_VCLK0:
-        info->clk = metrics.current_vclk0;
+        info->clk = current_clk(kVClk0, kVClk0);
         break;
     case AMDSMI_CLK_TYPE_VCLK1:
-        info->clk = metrics.current_vclk1;
+        info->clk = current_clk(kVClk1, kVClk0);
         break;
     case AMDSMI_CLK_TYPE_DCLK0:
-        info->clk = metrics.current_dclk0;
+        info->clk = current_clk(kDClk0, kDClk0);
       break;
     case AMDSMI_CLK_TYPE_DCLK1:
-        info->clk = metrics.current_dclk1;
+        info->clk = current_clk(kDClk1, kDClk0);
         break;
     case AMDSMI_CLK_TYPE_SOC:
-        info->clk = metrics.current_socclk;
+        info->clk = current_clk(kSocClk, kSocClk);
         break;
     // fclk/df not supported by gpu metrics so providing default value which cannot be contrued to be valid
     case AMDSMI_CLK_TYPE_DF:
@@ -3437,14 +4163,28 @@ amdsmi_get_power_info(amdsmi_processor_handle processor_handle, __attribute__((u
     info->mem_voltage = 0xFFFF;
     info->power_limit = 0xFFFF;
 
-    amdsmi_gpu_metrics_t metrics = {};
-    status = amdsmi_get_gpu_metrics_info(processor_handle, &metrics);
+    const amdsmi_gpu_metric_field_t metric_fields[] = {
+        AMDSMI_GPU_METRIC_CURR_SOCKET_POWER,
+        AMDSMI_GPU_METRIC_AVG_SOCKET_POWER,
+        AMDSMI_GPU_METRIC_VOLTAGE_GFX,
+        AMDSMI_GPU_METRIC_VOLTAGE_SOC,
+        AMDSMI_GPU_METRIC_VOLTAGE_MEM,
+    };
+    constexpr uint32_t kNumMetricFields = static_cast<uint32_t>(std::size(metric_fields));
+    amdsmi_gpu_metric_field_value_t metric_values[kNumMetricFields] = {};
+    status = amdsmi_get_gpu_metrics_fields(processor_handle, metric_fields,
+                                           kNumMetricFields, metric_values);
     if (status == AMDSMI_STATUS_SUCCESS) {
-        info->current_socket_power = metrics.current_socket_power;
-        info->average_socket_power = metrics.average_socket_power;
-        info->gfx_voltage = metrics.voltage_gfx;
-        info->soc_voltage = metrics.voltage_soc;
-        info->mem_voltage = metrics.voltage_mem;
+        info->current_socket_power =
+            gpu_metric_field_value<decltype(amdsmi_gpu_metrics_t::current_socket_power)>(metric_values[0]);
+        info->average_socket_power =
+            gpu_metric_field_value<decltype(amdsmi_gpu_metrics_t::average_socket_power)>(metric_values[1]);
+        info->gfx_voltage =
+            gpu_metric_field_value<decltype(amdsmi_gpu_metrics_t::voltage_gfx)>(metric_values[2]);
+        info->soc_voltage =
+            gpu_metric_field_value<decltype(amdsmi_gpu_metrics_t::voltage_soc)>(metric_values[3]);
+        info->mem_voltage =
+            gpu_metric_field_value<decltype(amdsmi_gpu_metrics_t::voltage_mem)>(metric_values[4]);
     }
 
     int power_limit = 0;
@@ -3511,7 +4251,7 @@ amdsmi_status_t amdsmi_get_pcie_info(amdsmi_processor_handle processor_handle, a
     if (r != AMDSMI_STATUS_SUCCESS)
         return r;
 
-    SMIGPUDEVICE_MUTEX(gpu_device->get_mutex())
+    SMIGPUDEVICE_MUTEX_SHARED(gpu_device->get_mutex())
 
     char buff[AMDSMI_MAX_STRING_LENGTH];
     FILE* fp;
@@ -3520,7 +4260,7 @@ amdsmi_status_t amdsmi_get_pcie_info(amdsmi_processor_handle processor_handle, a
 
     memset((void *)info, 0, sizeof(*info));
 
-    std::string path_max_link_width = "/sys/class/drm/" +
+    std::string path_max_link_width = amd::smi::FsRootPath("/sys/class/drm/") +
         gpu_device->get_gpu_path() + "/device/max_link_width";
     fp = fopen(path_max_link_width.c_str(), "r");
     if (fp) {
@@ -3532,7 +4272,7 @@ amdsmi_status_t amdsmi_get_pcie_info(amdsmi_processor_handle processor_handle, a
     }
     info->pcie_static.max_pcie_width = (uint16_t)pcie_width;
 
-    std::string path_max_link_speed = "/sys/class/drm/" +
+    std::string path_max_link_speed = amd::smi::FsRootPath("/sys/class/drm/") +
         gpu_device->get_gpu_path() + "/device/max_link_speed";
     fp = fopen(path_max_link_speed.c_str(), "r");
     if (fp) {
@@ -3591,12 +4331,44 @@ amdsmi_status_t amdsmi_get_pcie_info(amdsmi_processor_handle processor_handle, a
     }
 
     // metrics
-    amdsmi_gpu_metrics_t metric_info = {};
-    status =  amdsmi_get_gpu_metrics_info(
-            processor_handle, &metric_info);
+    const amdsmi_gpu_metric_field_t metric_fields[] = {
+        AMDSMI_GPU_METRIC_PCIE_LINK_WIDTH,
+        AMDSMI_GPU_METRIC_PCIE_LINK_SPEED,
+        AMDSMI_GPU_METRIC_PCIE_BANDWIDTH_INST,
+        AMDSMI_GPU_METRIC_PCIE_REPLAY_COUNT_ACC,
+        AMDSMI_GPU_METRIC_PCIE_L0_TO_RECOV_COUNT_ACC,
+        AMDSMI_GPU_METRIC_PCIE_REPLAY_ROVER_COUNT_ACC,
+        AMDSMI_GPU_METRIC_PCIE_NAK_RCVD_COUNT_ACC,
+        AMDSMI_GPU_METRIC_PCIE_NAK_SENT_COUNT_ACC,
+        AMDSMI_GPU_METRIC_PCIE_LC_PERF_OTHER_END_RECOVERY,
+    };
+    constexpr uint32_t kNumMetricFields = static_cast<uint32_t>(std::size(metric_fields));
+    amdsmi_gpu_metric_field_value_t metric_values[kNumMetricFields] = {};
+    status = amdsmi_get_gpu_metrics_fields(processor_handle, metric_fields,
+                                           kNumMetricFields, metric_values);
     if (status != AMDSMI_STATUS_SUCCESS)
         return status;
 
+    amdsmi_gpu_metrics_t metric_info = {};
+    metric_info.pcie_link_width =
+        gpu_metric_field_value<decltype(metric_info.pcie_link_width)>(metric_values[0]);
+    metric_info.pcie_link_speed =
+        gpu_metric_field_value<decltype(metric_info.pcie_link_speed)>(metric_values[1]);
+    metric_info.pcie_bandwidth_inst =
+        gpu_metric_field_value<decltype(metric_info.pcie_bandwidth_inst)>(metric_values[2]);
+    metric_info.pcie_replay_count_acc =
+        gpu_metric_field_value<decltype(metric_info.pcie_replay_count_acc)>(metric_values[3]);
+    metric_info.pcie_l0_to_recov_count_acc =
+        gpu_metric_field_value<decltype(metric_info.pcie_l0_to_recov_count_acc)>(metric_values[4]);
+    metric_info.pcie_replay_rover_count_acc =
+        gpu_metric_field_value<decltype(metric_info.pcie_replay_rover_count_acc)>(metric_values[5]);
+    metric_info.pcie_nak_rcvd_count_acc =
+        gpu_metric_field_value<decltype(metric_info.pcie_nak_rcvd_count_acc)>(metric_values[6]);
+    metric_info.pcie_nak_sent_count_acc =
+        gpu_metric_field_value<decltype(metric_info.pcie_nak_sent_count_acc)>(metric_values[7]);
+    metric_info.pcie_lc_perf_other_end_recovery =
+        gpu_metric_field_value<decltype(metric_info.pcie_lc_perf_other_end_recovery)>(metric_values[8]);
+
     info->pcie_metric.pcie_width = metric_info.pcie_link_width;
     // gpu metrics is inconsistent with pcie_speed values, if 0-6 then it needs to be translated
     if (metric_info.pcie_link_speed <= 6) {
@@ -3873,7 +4645,7 @@ amdsmi_get_gpu_virtualization_mode(amdsmi_processor_handle processor_handle, amd
         status = gpu_device->amdgpu_query_info(AMDGPU_INFO_DEV_INFO, sizeof(struct drm_amdgpu_info_device), &dev_info);
         if (status != AMDSMI_STATUS_SUCCESS) return status;
 
-        SMIGPUDEVICE_MUTEX(gpu_device->get_mutex())
+        SMIGPUDEVICE_MUTEX_SHARED(gpu_device->get_mutex())
 
         // get drm version. If it's older than 3.62.0, then say not supported and exit.
         drmVersionPtr drm_version;
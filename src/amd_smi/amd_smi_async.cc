@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <sys/eventfd.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cstdint>
+#include "amd_smi/impl/amd_smi_async.h"
+#include "amd_smi/impl/amd_smi_worker_pool.h"
+
+namespace amd {
+namespace smi {
+
+amdsmi_status_t AMDSmiAsync::run(amdsmi_async_op_t op,
+                                 amdsmi_processor_handle processor_handle, void* out) {
+    switch (op) {
+        case AMDSMI_ASYNC_OP_GPU_METRICS_INFO:
+            return amdsmi_get_gpu_metrics_info(processor_handle,
+                                               static_cast<amdsmi_gpu_metrics_t*>(out));
+        case AMDSMI_ASYNC_OP_PCI_THROUGHPUT: {
+            auto* throughput = static_cast<amdsmi_async_pci_throughput_t*>(out);
+            return amdsmi_get_gpu_pci_throughput(processor_handle, &throughput->sent,
+                                                 &throughput->received,
+                                                 &throughput->max_pkt_sz);
+        }
+        case AMDSMI_ASYNC_OP_VIOLATION_STATUS:
+            return amdsmi_get_violation_status(processor_handle,
+                                               static_cast<amdsmi_violation_status_t*>(out));
+        case AMDSMI_ASYNC_OP_PROCESS_LIST: {
+            auto* processes = static_cast<amdsmi_async_process_list_t*>(out);
+            return amdsmi_get_gpu_process_list(processor_handle, &processes->max_processes,
+                                               processes->list);
+        }
+        case AMDSMI_ASYNC_OP_PM_METRICS_INFO: {
+            auto* metrics = static_cast<amdsmi_async_name_value_list_t*>(out);
+            metrics->metrics = nullptr;
+            metrics->num_metrics = 0;
+            return amdsmi_get_gpu_pm_metrics_info(processor_handle, &metrics->metrics,
+                                                  &metrics->num_metrics);
+        }
+        case AMDSMI_ASYNC_OP_ACTIVITY:
+            return amdsmi_get_gpu_activity(processor_handle,
+                                           static_cast<amdsmi_engine_usage_t*>(out));
+        case AMDSMI_ASYNC_OP_POWER_INFO:
+            return amdsmi_get_power_info(processor_handle, 0,
+                                         static_cast<amdsmi_power_info_t*>(out));
+        default:
+            return AMDSMI_STATUS_INVAL;
+    }
+}
+
+amdsmi_status_t AMDSmiAsync::submit(amdsmi_async_op_t op,
+                                    amdsmi_processor_handle processor_handle, void* out,
+                                    amdsmi_async_callback_t callback, void* user_data,
+                                    amdsmi_async_request_t* request) {
+    if ((out == nullptr) ||
+        (static_cast<uint32_t>(op) > static_cast<uint32_t>(AMDSMI_ASYNC_OP__MAX))) {
+        return AMDSMI_STATUS_INVAL;
+    }
+
+    amdsmi_async_completion_t completion = {};
+    completion.request = next_request_.fetch_add(1, std::memory_order_relaxed);
+    completion.op = op;
+    completion.processor_handle = processor_handle;
+    completion.out = out;
+    completion.user_data = user_data;
+
+    std::lock_guard<std::mutex> lock(submit_mutex_);
+    if (!accepting_) {
+        return AMDSMI_STATUS_NOT_INIT;
+    }
+    if (request != nullptr) {
+        *request = completion.request;
+    }
+    AMDSmiWorkerPool::getInstance().submit([this, completion, callback]() mutable {
+        completion.status = run(completion.op, completion.processor_handle, completion.out);
+        if (callback != nullptr) {
+            callback(&completion);
+        } else {
+            queue_completion(completion);
+        }
+    });
+    return AMDSMI_STATUS_SUCCESS;
+}
+
+void AMDSmiAsync::queue_completion(const amdsmi_async_completion_t& completion) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    completions_.push_back(completion);
+    if ((completions_.size() == 1) && (eventfd_ >= 0)) {
+        uint64_t one = 1;
+        // Can not fail: the counter is 0 here, see get_completions()
+        (void)write(eventfd_, &one, sizeof(one));
+    }
+}
+
+amdsmi_status_t AMDSmiAsync::get_eventfd(int* fd) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (eventfd_ < 0) {
+        eventfd_ = eventfd(completions_.empty() ? 0 : 1, EFD_CLOEXEC | EFD_NONBLOCK);
+        if (eventfd_ < 0) {
+            return AMDSMI_STATUS_OUT_OF_RESOURCES;
+        }
+    }
+    *fd = eventfd_;
+    return AMDSMI_STATUS_SUCCESS;
+}
+
+uint32_t AMDSmiAsync::get_completions(amdsmi_async_completion_t* completions,
+                                      uint32_t num_completions) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto num = static_cast<uint32_t>(
+        std::min<size_t>(num_completions, completions_.size()));
+    std::copy_n(completions_.begin(), num, completions);
+    completions_.erase(completions_.begin(), completions_.begin() + num);
+    if ((num > 0) && completions_.empty() && (eventfd_ >= 0)) {
+        uint64_t count;
+        (void)read(eventfd_, &count, sizeof(count));
+    }
+    return num;
+}
+
+void AMDSmiAsync::start() {
+    std::lock_guard<std::mutex> lock(submit_mutex_);
+    accepting_ = true;
+}
+
+void AMDSmiAsync::reject_requests() {
+    std::lock_guard<std::mutex> lock(submit_mutex_);
+    accepting_ = false;
+}
+
+void AMDSmiAsync::stop() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    completions_.clear();
+    if (eventfd_ >= 0) {
+        close(eventfd_);
+        eventfd_ = -1;
+    }
+}
+
+}  // namespace smi
+}  // namespace amd
@@ -34,6 +34,8 @@
 #include "rocm_smi/rocm_smi_main.h"
 #include "rocm_smi/rocm_smi_utils.h"
 #include "rocm_smi/rocm_smi_logger.h"
+#include "rocm_smi/rocm_smi_perf_stats.h"
+#include "rocm_smi/rocm_smi_lock_stats.h"
 
 namespace amd {
 namespace smi {
@@ -121,7 +123,7 @@ amdsmi_status_t AMDSmiDrm::init() {
         drmDevicePtr device;
 
         const std::string regex("renderD([0-9]+)");
-        const std::string renderD_folder = "/sys/class/drm/card"
+        const std::string renderD_folder = FsRootPath("/sys/class/drm/card")
                     + std::to_string(rocm_smi_device->index()) + "/../";
 
         // looking for /sys/class/drm/card0/../renderD*
@@ -148,6 +150,7 @@ amdsmi_status_t AMDSmiDrm::init() {
         }
 
         drm_fds_.push_back(fd);
+        drm_fd_mutexes_.push_back(std::make_unique<std::mutex>());
         drm_paths_.push_back(render_name);
         // even if fail, still add to prevent mismatch the index
         if (fd < 0) {
@@ -198,17 +201,32 @@ amdsmi_status_t AMDSmiDrm::cleanup() {
     }
 
     drm_fds_.clear();
+    drm_fd_mutexes_.clear();
     drm_paths_.clear();
     drm_bdfs_.clear();
     lib_loader_.unload();
     return AMDSMI_STATUS_SUCCESS;
 }
 
+std::mutex& AMDSmiDrm::fd_mutex(int fd, uint32_t *gpu_index) {
+    for (unsigned int i=0; i < drm_fds_.size(); i++) {
+        if (drm_fds_[i] == fd && fd >= 0) {
+            *gpu_index = i;
+            return *drm_fd_mutexes_[i];
+        }
+    }
+    *gpu_index = amd::smi::kLockNoDevice;
+    return drm_mutex_;
+}
+
 amdsmi_status_t AMDSmiDrm::amdgpu_query_driver_name(int fd, std::string& driver_name) {
     // RAII handler
     using drm_version_ptr = std::unique_ptr<drmVersion,
             decltype(&drmFreeVersion)>;
-    std::lock_guard<std::mutex> guard(drm_mutex_);
+    uint32_t gpu_index;
+    std::mutex& mutex = fd_mutex(fd, &gpu_index);
+    LockStatsGuard guard(mutex, kLockDrm, gpu_index);
+    amd::smi::PerfStats::countIo(amd::smi::kPerfIoIoctl);
     auto version = drm_version_ptr(
                 drm_get_version_(fd), drm_free_version_);
     if (version == nullptr) return AMDSMI_STATUS_DRM_ERROR;
@@ -220,7 +238,10 @@ amdsmi_status_t AMDSmiDrm::amdgpu_query_driver_date(int fd, std::string& driver_
     // RAII handler
     using drm_version_ptr = std::unique_ptr<drmVersion,
             decltype(&drmFreeVersion)>;
-    std::lock_guard<std::mutex> guard(drm_mutex_);
+    uint32_t gpu_index;
+    std::mutex& mutex = fd_mutex(fd, &gpu_index);
+    LockStatsGuard guard(mutex, kLockDrm, gpu_index);
+    amd::smi::PerfStats::countIo(amd::smi::kPerfIoIoctl);
     auto version = drm_version_ptr(
                 drm_get_version_(fd), drm_free_version_);
     if (version == nullptr) return AMDSMI_STATUS_DRM_ERROR;
@@ -231,13 +252,16 @@ amdsmi_status_t AMDSmiDrm::amdgpu_query_driver_date(int fd, std::string& driver_
 amdsmi_status_t AMDSmiDrm::amdgpu_query_info(int fd, unsigned info_id,
             unsigned size, void *value) {
     if (drm_cmd_write_ == nullptr) return AMDSMI_STATUS_NOT_SUPPORTED;
-    std::lock_guard<std::mutex> guard(drm_mutex_);
+    uint32_t gpu_index;
+    std::mutex& mutex = fd_mutex(fd, &gpu_index);
+    LockStatsGuard guard(mutex, kLockDrm, gpu_index);
 
     struct drm_amdgpu_info request;
     memset(&request, 0, sizeof(request));
     request.return_pointer = (uintptr_t)value;
     request.return_size = size;
     request.query = info_id;
+    amd::smi::PerfStats::countIo(amd::smi::kPerfIoIoctl);
     int status = drm_cmd_write_(fd, DRM_AMDGPU_INFO,
             &request, sizeof(struct drm_amdgpu_info));
     if (status == 0) return AMDSMI_STATUS_SUCCESS;
@@ -248,7 +272,9 @@ amdsmi_status_t AMDSmiDrm::amdgpu_query_fw(int fd, unsigned info_id,
         unsigned fw_type, unsigned size, void *value) {
     if (drm_cmd_write_ == nullptr) return AMDSMI_STATUS_NOT_SUPPORTED;
 
-    std::lock_guard<std::mutex> guard(drm_mutex_);
+    uint32_t gpu_index;
+    std::mutex& mutex = fd_mutex(fd, &gpu_index);
+    LockStatsGuard guard(mutex, kLockDrm, gpu_index);
 
     struct drm_amdgpu_info request;
     memset(&request, 0, sizeof(request));
@@ -256,6 +282,7 @@ amdsmi_status_t AMDSmiDrm::amdgpu_query_fw(int fd, unsigned info_id,
     request.return_size = size;
     request.query = info_id;
     request.query_fw.fw_type = fw_type;
+    amd::smi::PerfStats::countIo(amd::smi::kPerfIoIoctl);
     int status = drm_cmd_write_(fd, DRM_AMDGPU_INFO, &request,
                     sizeof(struct drm_amdgpu_info));
     if (status == 0) return AMDSMI_STATUS_SUCCESS;
@@ -266,7 +293,9 @@ amdsmi_status_t AMDSmiDrm::amdgpu_query_hw_ip(int fd, unsigned info_id,
         unsigned hw_ip_type, unsigned size, void *value) {
     if (drm_cmd_write_ == nullptr) return AMDSMI_STATUS_NOT_SUPPORTED;
 
-    std::lock_guard<std::mutex> guard(drm_mutex_);
+    uint32_t gpu_index;
+    std::mutex& mutex = fd_mutex(fd, &gpu_index);
+    LockStatsGuard guard(mutex, kLockDrm, gpu_index);
 
     struct drm_amdgpu_info request;
     memset(&request, 0, sizeof(request));
@@ -274,6 +303,7 @@ amdsmi_status_t AMDSmiDrm::amdgpu_query_hw_ip(int fd, unsigned info_id,
     request.return_size = size;
     request.query = info_id;
     request.query_hw_ip.type = hw_ip_type;
+    amd::smi::PerfStats::countIo(amd::smi::kPerfIoIoctl);
     int status = drm_cmd_write_(fd, DRM_AMDGPU_INFO, &request,
                 sizeof(struct drm_amdgpu_info));
     if (status == 0) return AMDSMI_STATUS_SUCCESS;
@@ -283,7 +313,9 @@ amdsmi_status_t AMDSmiDrm::amdgpu_query_hw_ip(int fd, unsigned info_id,
 amdsmi_status_t AMDSmiDrm::amdgpu_query_vbios(int fd, void *info) {
     if (drm_cmd_write_ == nullptr) return AMDSMI_STATUS_NOT_SUPPORTED;
 
-    std::lock_guard<std::mutex> guard(drm_mutex_);
+    uint32_t gpu_index;
+    std::mutex& mutex = fd_mutex(fd, &gpu_index);
+    LockStatsGuard guard(mutex, kLockDrm, gpu_index);
 
     struct drm_amdgpu_info request;
     memset(&request, 0, sizeof request);
@@ -291,6 +323,7 @@ amdsmi_status_t AMDSmiDrm::amdgpu_query_vbios(int fd, void *info) {
     request.return_size = sizeof(drm_amdgpu_info_vbios);
     request.query = AMDGPU_INFO_VBIOS;
     request.vbios_info.type = AMDGPU_INFO_VBIOS_INFO;
+    amd::smi::PerfStats::countIo(amd::smi::kPerfIoIoctl);
     int status = drm_cmd_write_(fd, DRM_AMDGPU_INFO, &request,
                     sizeof(struct drm_amdgpu_info));
     if (status == 0) return AMDSMI_STATUS_SUCCESS;
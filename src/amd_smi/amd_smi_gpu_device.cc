@@ -21,6 +21,7 @@
  */
 
 #include "amd_smi/impl/amd_smi_gpu_device.h"
+#include "amd_smi/impl/amd_smi_system.h"
 #include "amd_smi/impl/amd_smi_common.h"
 #include "amd_smi/impl/fdinfo.h"
 #include "rocm_smi/rocm_smi_kfd.h"
@@ -74,7 +75,7 @@ amdsmi_status_t AMDSmiGPUDevice::get_drm_data() {
     return AMDSMI_STATUS_SUCCESS;
 }
 
-pthread_mutex_t* AMDSmiGPUDevice::get_mutex() {
+shared_mutex_t* AMDSmiGPUDevice::get_mutex() {
     return amd::smi::GetMutex(gpu_id_);
 }
 
@@ -301,7 +302,7 @@ std::string AMDSmiGPUDevice::bdf_to_string() const {
 
 
 uint32_t AMDSmiGPUDevice::get_card_from_bdf() const {
-    const std::string drm_path = "/sys/class/drm/";
+    const std::string drm_path = FsRootPath("/sys/class/drm/");
 
     DIR* dir = opendir(drm_path.c_str());
     if (!dir) {
@@ -338,7 +339,7 @@ uint32_t AMDSmiGPUDevice::get_card_from_bdf() const {
 }
 
 uint32_t AMDSmiGPUDevice::get_render_id() const {
-    const std::string drm_path = "/sys/class/drm/";
+    const std::string drm_path = FsRootPath("/sys/class/drm/");
 
     DIR* dir = opendir(drm_path.c_str());
     if (!dir) {
@@ -374,6 +375,49 @@ uint32_t AMDSmiGPUDevice::get_render_id() const {
     return std::numeric_limits<uint32_t>::max();  // Return -1 if no matching render ID is found
 }
 
+// Generation that is never current; what isn't watched isn't kept
+static const uint64_t kNoGeneration = std::numeric_limits<uint64_t>::max();
+
+template <typename T>
+bool AMDSmiGPUDevice::load_static_info(T* info, uint64_t* generation) {
+    if (AMDSmiSystem::getInstance().get_gpu_generation(gpu_id_, generation)
+            != AMDSMI_STATUS_SUCCESS) {
+        *generation = kNoGeneration;
+        return false;
+    }
+    std::lock_guard<std::mutex> guard(static_info_mutex_);
+    const auto& entry = static_info(info);
+    if (!entry.is_valid || entry.generation != *generation) {
+        return false;
+    }
+    *info = entry.info;
+    return true;
+}
+
+template <typename T>
+void AMDSmiGPUDevice::store_static_info(const T& info, uint64_t generation) {
+    uint64_t current_generation = kNoGeneration;
+    // The device changed while the value was gathered; it may be stale
+    if (generation == kNoGeneration ||
+        AMDSmiSystem::getInstance().get_gpu_generation(gpu_id_, &current_generation)
+            != AMDSMI_STATUS_SUCCESS ||
+        current_generation != generation) {
+        return;
+    }
+    std::lock_guard<std::mutex> guard(static_info_mutex_);
+    auto& entry = static_info(static_cast<T*>(nullptr));
+    entry.info = info;
+    entry.generation = generation;
+    entry.is_valid = true;
+}
+
+template bool AMDSmiGPUDevice::load_static_info(amdsmi_asic_info_t*, uint64_t*);
+template bool AMDSmiGPUDevice::load_static_info(amdsmi_vram_info_t*, uint64_t*);
+template bool AMDSmiGPUDevice::load_static_info(amdsmi_board_info_t*, uint64_t*);
+template void AMDSmiGPUDevice::store_static_info(const amdsmi_asic_info_t&, uint64_t);
+template void AMDSmiGPUDevice::store_static_info(const amdsmi_vram_info_t&, uint64_t);
+template void AMDSmiGPUDevice::store_static_info(const amdsmi_board_info_t&, uint64_t);
+
 
 }  // namespace smi
 }  // namespace amd
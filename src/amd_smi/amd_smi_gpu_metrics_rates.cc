@@ -0,0 +1,266 @@
+/*
+ * Copyright (c) Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <vector>
+#include "amd_smi/impl/amd_smi_gpu_metrics_rates.h"
+
+namespace amd {
+namespace smi {
+
+// Same resolution as reported by amdsmi_get_energy_count()
+static const double kEnergyCounterResolutionUJ = 15.3;
+// PMFW firmware timestamp resolution
+static const uint64_t kFirmwareTimestampResolutionNs = 10;
+
+enum class AccumulatorKind {
+    kNone,
+    kEnergy,      // Rate in W
+    kDataKB,      // Rate in GB/s
+    kResidency,   // Percent of the accumulation counter
+    kCount,       // Rate in events/s
+};
+
+static AccumulatorKind get_accumulator_kind(amdsmi_gpu_metric_field_t field) {
+    switch (field) {
+        case AMDSMI_GPU_METRIC_ENERGY_ACC:
+            return AccumulatorKind::kEnergy;
+        case AMDSMI_GPU_METRIC_XGMI_READ_DATA_ACC:
+        case AMDSMI_GPU_METRIC_XGMI_WRITE_DATA_ACC:
+            return AccumulatorKind::kDataKB;
+        case AMDSMI_GPU_METRIC_PROCHOT_RESIDENCY_ACC:
+        case AMDSMI_GPU_METRIC_PPT_RESIDENCY_ACC:
+        case AMDSMI_GPU_METRIC_SOCKET_THM_RESIDENCY_ACC:
+        case AMDSMI_GPU_METRIC_VR_THM_RESIDENCY_ACC:
+        case AMDSMI_GPU_METRIC_HBM_THM_RESIDENCY_ACC:
+        case AMDSMI_GPU_METRIC_GFX_BELOW_HOST_LIMIT_ACC:
+            return AccumulatorKind::kResidency;
+        case AMDSMI_GPU_METRIC_ACCUMULATION_COUNTER:
+        case AMDSMI_GPU_METRIC_PCIE_L0_TO_RECOV_COUNT_ACC:
+        case AMDSMI_GPU_METRIC_PCIE_REPLAY_COUNT_ACC:
+        case AMDSMI_GPU_METRIC_PCIE_REPLAY_ROVER_COUNT_ACC:
+        case AMDSMI_GPU_METRIC_PCIE_NAK_SENT_COUNT_ACC:
+        case AMDSMI_GPU_METRIC_PCIE_NAK_RCVD_COUNT_ACC:
+            return AccumulatorKind::kCount;
+        default:
+            return AccumulatorKind::kNone;
+    }
+}
+
+// Difference between two reads of an accumulator. Older tables have 32 bit
+// accumulators which do wrap; any other accumulator going backwards (or a
+// 32 bit one by more than half its range) was reset.
+static bool get_accumulator_delta(uint64_t prev, uint64_t cur, uint64_t* delta) {
+    const uint64_t kMax32 = std::numeric_limits<uint32_t>::max();
+    if (cur >= prev) {
+        *delta = cur - prev;
+        return true;
+    }
+    if (prev <= kMax32) {
+        const uint64_t wrapped_delta = (kMax32 - prev) + cur + 1;
+        if (wrapped_delta <= (kMax32 / 2)) {
+            *delta = wrapped_delta;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool AMDSmiGpuMetricsRates::is_rate_field(amdsmi_gpu_metric_field_t field) {
+    return get_accumulator_kind(field) != AccumulatorKind::kNone;
+}
+
+void AMDSmiGpuMetricsRates::set_time_constant_ms(uint32_t time_constant_ms) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    time_constant_ms_ = time_constant_ms;
+}
+
+uint32_t AMDSmiGpuMetricsRates::get_time_constant_ms() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return time_constant_ms_;
+}
+
+void AMDSmiGpuMetricsRates::reset() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    states_.clear();
+}
+
+amdsmi_status_t AMDSmiGpuMetricsRates::get_rates(amdsmi_processor_handle processor_handle,
+                                                 const amdsmi_gpu_metric_field_t* fields,
+                                                 uint32_t num_fields,
+                                                 amdsmi_gpu_metric_rate_t* rates) {
+    // The time base and accumulation counter come from the same read
+    std::vector<amdsmi_gpu_metric_field_t> read_fields(fields, fields + num_fields);
+    read_fields.push_back(AMDSMI_GPU_METRIC_FIRMWARE_TIMESTAMP);
+    read_fields.push_back(AMDSMI_GPU_METRIC_ACCUMULATION_COUNTER);
+    std::vector<amdsmi_gpu_metric_field_value_t> values(read_fields.size());
+
+    // Held over the read, so that concurrent callers can not feed samples
+    // out of order
+    std::lock_guard<std::mutex> lock(mutex_);
+    amdsmi_status_t status = amdsmi_get_gpu_metrics_fields(
+        processor_handle, read_fields.data(), static_cast<uint32_t>(read_fields.size()),
+        values.data());
+    if (status != AMDSMI_STATUS_SUCCESS) {
+        return status;
+    }
+
+    const auto& fw_timestamp = values[num_fields];
+    const auto& acc_counter = values[num_fields + 1];
+    uint64_t time_ns = 0;
+    if ((fw_timestamp.status == AMDSMI_STATUS_SUCCESS) &&
+        (fw_timestamp.values[0] != std::numeric_limits<uint64_t>::max())) {
+        time_ns = fw_timestamp.values[0] * kFirmwareTimestampResolutionNs;
+    } else {
+        time_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+    const uint64_t acc_counter_value = (acc_counter.status == AMDSMI_STATUS_SUCCESS) ?
+        acc_counter.values[0] : std::numeric_limits<uint64_t>::max();
+
+    for (uint32_t i = 0; i < num_fields; ++i) {
+        update_locked(time_ns, acc_counter_value, fields[i], values[i], &rates[i]);
+    }
+    return AMDSMI_STATUS_SUCCESS;
+}
+
+void AMDSmiGpuMetricsRates::update(uint64_t time_ns, uint64_t acc_counter,
+                                   const amdsmi_gpu_metric_field_t* fields,
+                                   const amdsmi_gpu_metric_field_value_t* values,
+                                   uint32_t num_fields, amdsmi_gpu_metric_rate_t* rates) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (uint32_t i = 0; i < num_fields; ++i) {
+        update_locked(time_ns, acc_counter, fields[i], values[i], &rates[i]);
+    }
+}
+
+void AMDSmiGpuMetricsRates::update_locked(uint64_t time_ns, uint64_t acc_counter,
+                                          amdsmi_gpu_metric_field_t field,
+                                          const amdsmi_gpu_metric_field_value_t& value,
+                                          amdsmi_gpu_metric_rate_t* rate) {
+    const auto kind = get_accumulator_kind(field);
+    const uint64_t kNA = std::numeric_limits<uint64_t>::max();
+
+    rate->status = AMDSMI_STATUS_NO_DATA;
+    rate->num_values = 0;
+    rate->interval_ns = 0;
+    std::fill(std::begin(rate->rate), std::end(rate->rate),
+              std::numeric_limits<double>::quiet_NaN());
+    std::fill(std::begin(rate->ewma_rate), std::end(rate->ewma_rate),
+              std::numeric_limits<double>::quiet_NaN());
+
+    if (kind == AccumulatorKind::kNone) {
+        rate->status = AMDSMI_STATUS_INVAL;
+        return;
+    }
+    if (value.status != AMDSMI_STATUS_SUCCESS) {
+        rate->status = value.status;
+        return;
+    }
+    if ((kind == AccumulatorKind::kResidency) && (acc_counter == kNA)) {
+        rate->status = AMDSMI_STATUS_NOT_SUPPORTED;
+        return;
+    }
+
+    rate->num_values = value.num_values;
+    for (uint32_t idx = 0; idx < value.num_values; ++idx) {
+        const auto key = std::make_pair(field, idx);
+        const uint64_t cur = value.values[idx];
+        if (cur == kNA) {
+            states_.erase(key);
+            continue;
+        }
+
+        auto it = states_.find(key);
+        if (it == states_.end()) {
+            AccumulatorState& state = states_[key];
+            state.prev_value = cur;
+            state.prev_time_ns = time_ns;
+            state.prev_acc_counter = acc_counter;
+            continue;
+        }
+
+        AccumulatorState& state = it->second;
+        uint64_t delta = 0;
+        const bool is_valid = (time_ns >= state.prev_time_ns) &&
+            ((kind != AccumulatorKind::kResidency) || (acc_counter >= state.prev_acc_counter)) &&
+            get_accumulator_delta(state.prev_value, cur, &delta);
+        if (!is_valid) {
+            // Counters or time base were reset; start over from this read
+            state = AccumulatorState{};
+            state.prev_value = cur;
+            state.prev_time_ns = time_ns;
+            state.prev_acc_counter = acc_counter;
+            continue;
+        }
+
+        const uint64_t interval_ns = time_ns - state.prev_time_ns;
+        const uint64_t acc_delta = acc_counter - state.prev_acc_counter;
+        // Same sample as the previous read: keep the previous rate
+        const bool is_new_sample = (kind == AccumulatorKind::kResidency) ?
+            (acc_delta > 0) : (interval_ns > 0);
+        if (is_new_sample) {
+            const double interval_s = static_cast<double>(interval_ns) / 1e9;
+            double new_rate = 0;
+            switch (kind) {
+                case AccumulatorKind::kEnergy:
+                    new_rate = static_cast<double>(delta) * kEnergyCounterResolutionUJ / 1e6 /
+                               interval_s;
+                    break;
+                case AccumulatorKind::kDataKB:
+                    new_rate = static_cast<double>(delta) / 1e6 / interval_s;
+                    break;
+                case AccumulatorKind::kResidency:
+                    new_rate = static_cast<double>(delta) * 100.0 / static_cast<double>(acc_delta);
+                    break;
+                default:
+                    new_rate = static_cast<double>(delta) / interval_s;
+                    break;
+            }
+
+            // Time aware smoothing, so irregular reads weigh by their interval
+            const double alpha = (time_constant_ms_ == 0) ? 1.0 :
+                1.0 - std::exp(-interval_s * 1000.0 / time_constant_ms_);
+            state.ewma_rate = state.has_rate ?
+                state.ewma_rate + alpha * (new_rate - state.ewma_rate) : new_rate;
+            state.rate = new_rate;
+            state.interval_ns = interval_ns;
+            state.has_rate = true;
+            state.prev_value = cur;
+            state.prev_time_ns = time_ns;
+            state.prev_acc_counter = acc_counter;
+        }
+
+        if (state.has_rate) {
+            rate->rate[idx] = state.rate;
+            rate->ewma_rate[idx] = state.ewma_rate;
+            rate->interval_ns = std::max(rate->interval_ns, state.interval_ns);
+            rate->status = AMDSMI_STATUS_SUCCESS;
+        }
+    }
+}
+
+}  // namespace smi
+}  // namespace amd
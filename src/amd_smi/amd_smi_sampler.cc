@@ -0,0 +1,250 @@
+/*
+ * Copyright (c) Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <new>
+#include "amd_smi/impl/amd_smi_sampler.h"
+
+namespace amd {
+namespace smi {
+
+static_assert(sizeof(amdsmi_gpu_metric_field_value_t) % sizeof(uint64_t) == 0,
+              "amdsmi_gpu_metric_field_value_t must be stored as whole words");
+static const uint32_t kFieldValueWords =
+    sizeof(amdsmi_gpu_metric_field_value_t) / sizeof(uint64_t);
+
+static uint64_t steady_clock_ns() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+AMDSmiSampleRing::AMDSmiSampleRing(uint32_t num_fields, uint32_t depth)
+    : num_fields_(num_fields), num_words_(num_fields * kFieldValueWords),
+      num_slots_(depth + 1), slots_(new Slot[depth + 1]) {
+    for (uint32_t i = 0; i < num_slots_; ++i) {
+        slots_[i].words.reset(new std::atomic<uint64_t>[num_words_]);
+    }
+}
+
+void AMDSmiSampleRing::push(uint64_t timestamp_ns,
+                            const amdsmi_gpu_metric_field_value_t* values) {
+    const uint64_t sample = num_pushed_.load(std::memory_order_relaxed) + 1;
+    Slot& slot = slots_[(sample - 1) % num_slots_];
+    const auto* src = reinterpret_cast<const unsigned char*>(values);
+
+    slot.seq.store(2 * sample - 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    slot.timestamp_ns.store(timestamp_ns, std::memory_order_relaxed);
+    for (uint32_t i = 0; i < num_words_; ++i) {
+        uint64_t word;
+        std::memcpy(&word, src + i * sizeof(word), sizeof(word));
+        slot.words[i].store(word, std::memory_order_relaxed);
+    }
+    slot.seq.store(2 * sample, std::memory_order_release);
+    num_pushed_.store(sample, std::memory_order_release);
+}
+
+bool AMDSmiSampleRing::read_slot(uint64_t sample, uint64_t* timestamp_ns,
+                                 amdsmi_gpu_metric_field_value_t* values) const {
+    const Slot& slot = slots_[(sample - 1) % num_slots_];
+    auto* dst = reinterpret_cast<unsigned char*>(values);
+
+    const uint64_t seq = slot.seq.load(std::memory_order_acquire);
+    if (seq != 2 * sample) {
+        return false;
+    }
+    *timestamp_ns = slot.timestamp_ns.load(std::memory_order_relaxed);
+    for (uint32_t i = 0; i < num_words_; ++i) {
+        uint64_t word = slot.words[i].load(std::memory_order_relaxed);
+        std::memcpy(dst + i * sizeof(word), &word, sizeof(word));
+    }
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return slot.seq.load(std::memory_order_relaxed) == seq;
+}
+
+bool AMDSmiSampleRing::read_latest(uint64_t* timestamp_ns,
+                                   amdsmi_gpu_metric_field_value_t* values) const {
+    while (true) {
+        const uint64_t sample = num_pushed_.load(std::memory_order_acquire);
+        if (sample == 0) {
+            return false;
+        }
+        // Only fails if the writer went all the way around the ring
+        // meanwhile; the newest sample is then a newer one.
+        if (read_slot(sample, timestamp_ns, values)) {
+            return true;
+        }
+    }
+}
+
+uint32_t AMDSmiSampleRing::read_history(uint32_t max_samples, uint64_t* timestamps_ns,
+                                        amdsmi_gpu_metric_field_value_t* values) const {
+    const uint64_t newest = num_pushed_.load(std::memory_order_acquire);
+    const uint64_t count = std::min<uint64_t>({max_samples, newest, num_slots_ - 1});
+
+    uint32_t num_read = 0;
+    for (uint64_t sample = newest - count + 1; sample <= newest; ++sample) {
+        if (!read_slot(sample, &timestamps_ns[num_read],
+                       &values[static_cast<size_t>(num_read) * num_fields_])) {
+            // Overwritten, and so is everything older; restart from the
+            // next sample.
+            num_read = 0;
+            continue;
+        }
+        ++num_read;
+    }
+    return num_read;
+}
+
+amdsmi_status_t AMDSmiSampler::start(uint32_t period_us,
+                                     const amdsmi_gpu_metric_field_t* fields,
+                                     uint32_t num_fields, uint32_t history_depth,
+                                     const std::vector<amdsmi_processor_handle>& processor_handles) {
+    std::lock_guard<std::mutex> control_lock(control_mutex_);
+    stop_locked();
+
+    std::unique_lock<std::shared_mutex> rings_lock(rings_mutex_);
+    fields_.assign(fields, fields + num_fields);
+    period_ = std::chrono::microseconds(period_us);
+    try {
+        for (auto processor_handle : processor_handles) {
+            rings_[processor_handle] =
+                std::make_unique<AMDSmiSampleRing>(num_fields, history_depth);
+        }
+    } catch (const std::bad_alloc&) {
+        rings_.clear();
+        fields_.clear();
+        return AMDSMI_STATUS_OUT_OF_RESOURCES;
+    }
+    rings_lock.unlock();
+
+    stopping_ = false;
+    thread_ = std::thread(&AMDSmiSampler::sampler_loop, this);
+    return AMDSMI_STATUS_SUCCESS;
+}
+
+void AMDSmiSampler::stop() {
+    std::lock_guard<std::mutex> control_lock(control_mutex_);
+    stop_locked();
+}
+
+void AMDSmiSampler::stop_locked() {
+    // control_mutex_ is held by the caller
+    if (thread_.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock(thread_mutex_);
+            stopping_ = true;
+        }
+        thread_cond_.notify_all();
+        thread_.join();
+    }
+
+    std::unique_lock<std::shared_mutex> rings_lock(rings_mutex_);
+    rings_.clear();
+    fields_.clear();
+}
+
+void AMDSmiSampler::sampler_loop() {
+    // The configuration and rings are not changed while this thread runs
+    const auto num_fields = static_cast<uint32_t>(fields_.size());
+    std::vector<amdsmi_gpu_metric_field_value_t> values(num_fields);
+
+    auto next_tick = std::chrono::steady_clock::now();
+    std::unique_lock<std::mutex> lock(thread_mutex_);
+    while (!stopping_) {
+        lock.unlock();
+        for (auto& ring : rings_) {
+            auto status = amdsmi_get_gpu_metrics_fields(ring.first, fields_.data(),
+                                                        num_fields, values.data());
+            if (status != AMDSMI_STATUS_SUCCESS) {
+                for (auto& value : values) {
+                    value.status = status;
+                    value.num_values = 0;
+                    std::fill(std::begin(value.values), std::end(value.values),
+                              std::numeric_limits<uint64_t>::max());
+                }
+            }
+            ring.second->push(steady_clock_ns(), values.data());
+        }
+
+        // Keep to the period; if a round took longer, skip the ticks missed
+        const auto now = std::chrono::steady_clock::now();
+        next_tick += period_;
+        if (next_tick < now) {
+            next_tick += ((now - next_tick) / period_ + 1) * period_;
+        }
+        lock.lock();
+        thread_cond_.wait_until(lock, next_tick, [this] { return stopping_; });
+    }
+}
+
+const AMDSmiSampleRing* AMDSmiSampler::find_ring(amdsmi_processor_handle processor_handle,
+                                                 uint32_t num_fields) const {
+    // rings_mutex_ is held shared by the caller
+    auto it = rings_.find(processor_handle);
+    if ((it == rings_.end()) || (num_fields != fields_.size())) {
+        return nullptr;
+    }
+    return it->second.get();
+}
+
+amdsmi_status_t AMDSmiSampler::get_latest(amdsmi_processor_handle processor_handle,
+                                          uint64_t* timestamp_ns,
+                                          amdsmi_gpu_metric_field_value_t* values,
+                                          uint32_t num_fields) {
+    std::shared_lock<std::shared_mutex> rings_lock(rings_mutex_);
+    if (rings_.empty()) {
+        return AMDSMI_STATUS_NO_DATA;
+    }
+    const AMDSmiSampleRing* ring = find_ring(processor_handle, num_fields);
+    if (ring == nullptr) {
+        return AMDSMI_STATUS_INVAL;
+    }
+    if (!ring->read_latest(timestamp_ns, values)) {
+        return AMDSMI_STATUS_NO_DATA;
+    }
+    return AMDSMI_STATUS_SUCCESS;
+}
+
+amdsmi_status_t AMDSmiSampler::get_history(amdsmi_processor_handle processor_handle,
+                                           uint32_t* num_samples, uint64_t* timestamps_ns,
+                                           amdsmi_gpu_metric_field_value_t* values,
+                                           uint32_t num_fields) {
+    std::shared_lock<std::shared_mutex> rings_lock(rings_mutex_);
+    if (rings_.empty()) {
+        return AMDSMI_STATUS_NO_DATA;
+    }
+    const AMDSmiSampleRing* ring = find_ring(processor_handle, num_fields);
+    if (ring == nullptr) {
+        return AMDSMI_STATUS_INVAL;
+    }
+    *num_samples = ring->read_history(*num_samples, timestamps_ns, values);
+    if (*num_samples == 0) {
+        return AMDSMI_STATUS_NO_DATA;
+    }
+    return AMDSMI_STATUS_SUCCESS;
+}
+
+}  // namespace smi
+}  // namespace amd
@@ -279,6 +279,20 @@ amdsmi_status_t AMDSmiSystem::cleanup() {
     return AMDSMI_STATUS_SUCCESS;
 }
 
+amdsmi_status_t AMDSmiSystem::get_gpu_generation(uint32_t gpu_index,
+            uint64_t* generation) {
+    amd::smi::RocmSMI& smi = amd::smi::RocmSMI::getInstance();
+    if (!smi.is_watching_devices()) {
+        return AMDSMI_STATUS_NOT_SUPPORTED;
+    }
+    const auto& devices = smi.devices();
+    if (gpu_index >= devices.size()) {
+        return AMDSMI_STATUS_NOT_FOUND;
+    }
+    *generation = devices[gpu_index]->generation();
+    return AMDSMI_STATUS_SUCCESS;
+}
+
 amdsmi_status_t AMDSmiSystem::handle_to_socket(
             amdsmi_socket_handle socket_handle,
             AMDSmiSocket** socket) {
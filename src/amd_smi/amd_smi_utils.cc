@@ -47,6 +47,8 @@
 #include <limits.h>
 
 #include "amd_smi/impl/amd_smi_utils.h"
+#include "rocm_smi/rocm_smi_text_parser.h"
+#include "rocm_smi/rocm_smi_utils.h"
 #include "shared_mutex.h"  // NOLINT
 #include "rocm_smi/rocm_smi_logger.h"
 
@@ -149,10 +151,10 @@ amdsmi_status_t smi_amdgpu_find_hwmon_dir(amd::smi::AMDSmiGPUDevice *device, std
     if (full_path == nullptr) {
         return AMDSMI_STATUS_API_FAILED;
     }
-    SMIGPUDEVICE_MUTEX(device->get_mutex())
+    SMIGPUDEVICE_MUTEX_SHARED(device->get_mutex())
         DIR *dh;
     struct dirent * contents;
-    std::string device_path = "/sys/class/drm/" + device->get_gpu_path();
+    std::string device_path = amd::smi::FsRootPath("/sys/class/drm/") + device->get_gpu_path();
     std::string directory_path = device_path + "/device/hwmon/";
 
     if (!isAMDGPU(device_path)) {
@@ -184,12 +186,12 @@ amdsmi_status_t smi_amdgpu_get_board_info(amd::smi::AMDSmiGPUDevice* device, amd
     if (!device->check_if_drm_is_supported()) {
         return AMDSMI_STATUS_NOT_SUPPORTED;
     }
-    SMIGPUDEVICE_MUTEX(device->get_mutex())
-    std::string model_number_path = "/sys/class/drm/" + device->get_gpu_path() + std::string("/device/product_number");
-    std::string product_serial_path = "/sys/class/drm/" + device->get_gpu_path() + std::string("/device/serial_number");
-    std::string fru_id_path = "/sys/class/drm/" + device->get_gpu_path() + std::string("/device/fru_id");
-    std::string manufacturer_name_path = "/sys/class/drm/" + device->get_gpu_path() + std::string("/device/manufacturer");
-    std::string product_name_path = "/sys/class/drm/" + device->get_gpu_path() + std::string("/device/product_name");
+    SMIGPUDEVICE_MUTEX_SHARED(device->get_mutex())
+    std::string model_number_path = amd::smi::FsRootPath("/sys/class/drm/") + device->get_gpu_path() + std::string("/device/product_number");
+    std::string product_serial_path = amd::smi::FsRootPath("/sys/class/drm/") + device->get_gpu_path() + std::string("/device/serial_number");
+    std::string fru_id_path = amd::smi::FsRootPath("/sys/class/drm/") + device->get_gpu_path() + std::string("/device/fru_id");
+    std::string manufacturer_name_path = amd::smi::FsRootPath("/sys/class/drm/") + device->get_gpu_path() + std::string("/device/manufacturer");
+    std::string product_name_path = amd::smi::FsRootPath("/sys/class/drm/") + device->get_gpu_path() + std::string("/device/product_name");
 
     openFileAndModifyBuffer(model_number_path, info->model_number, AMDSMI_MAX_STRING_LENGTH);
     openFileAndModifyBuffer(product_serial_path, info->product_serial, AMDSMI_MAX_STRING_LENGTH);
@@ -227,7 +229,7 @@ amdsmi_status_t smi_amdgpu_get_power_cap(amd::smi::AMDSmiGPUDevice* device, int
 
     ret = smi_amdgpu_find_hwmon_dir(device, &fullpath);
 
-    SMIGPUDEVICE_MUTEX(device->get_mutex())
+    SMIGPUDEVICE_MUTEX_SHARED(device->get_mutex())
 
     if (ret)
         return ret;
@@ -254,8 +256,8 @@ amdsmi_status_t smi_amdgpu_get_ranges(amd::smi::AMDSmiGPUDevice* device, amdsmi_
     if (!device->check_if_drm_is_supported()) {
         return AMDSMI_STATUS_NOT_SUPPORTED;
     }
-    SMIGPUDEVICE_MUTEX(device->get_mutex())
-        std::string fullpath = "/sys/class/drm/" + device->get_gpu_path() + "/device";
+    SMIGPUDEVICE_MUTEX_SHARED(device->get_mutex())
+        std::string fullpath = amd::smi::FsRootPath("/sys/class/drm/") + device->get_gpu_path() + "/device";
 
     switch (domain) {
         case AMDSMI_CLK_TYPE_GFX:
@@ -286,39 +288,38 @@ amdsmi_status_t smi_amdgpu_get_ranges(amd::smi::AMDSmiGPUDevice* device, amdsmi_
             return AMDSMI_STATUS_INVAL;
     }
 
-    std::ifstream ranges(fullpath.c_str());
-
-    if (ranges.fail()) {
+    char buf[amd::smi::kSysfsTextBufSize];
+    std::string_view ranges;
+    if (amd::smi::ReadSysfsText(fullpath, buf, sizeof(buf), &ranges) != 0) {
         return AMDSMI_STATUS_API_FAILED;
     }
 
     unsigned int max, min, dpm, sleep_freq;
-    char str[10];
-    char single_char;
     max = 0;
     min = UINT_MAX;
     dpm = 0;
     sleep_freq = UINT_MAX;
 
-    for (std::string line; getline(ranges, line);) {
-        unsigned int dpm_level, freq;
+    while (!ranges.empty()) {
+        amd::smi::TextDpmLevel_t level;
+        auto line = amd::smi::NextTextLine(&ranges);
+        bool is_level = amd::smi::ParseDpmLevelLine(line, &level);
 
-        char firstChar = line[0];
-        if (firstChar == 'S') {
-            if (sscanf(line.c_str(), "%c: %d%s", &single_char, &sleep_freq, str) <= 2) {
-                ranges.close();
+        if (!line.empty() && line[0] == 'S') {
+            if (!is_level) {
                 return AMDSMI_STATUS_NO_DATA;
             }
+            sleep_freq = static_cast<unsigned int>(level.value);
         } else {
             // skip this line if it contains a * which indicates the current level
-            const char *current_indicator = strstr(line.c_str(), "*");
-            if (current_indicator != nullptr){
+            if (line.find('*') != std::string_view::npos) {
                 continue;
             }
-            if (sscanf(line.c_str(), "%u: %d%c", &dpm_level, &freq, str) <= 2){
-                ranges.close();
+            if (!is_level || level.is_deep_sleep) {
                 return AMDSMI_STATUS_IO;
             }
+            auto freq = static_cast<unsigned int>(level.value);
+            auto dpm_level = static_cast<unsigned int>(level.index);
             max = freq > max ? freq : max;
             min = freq < min ? freq: min;
             dpm = dpm_level > dpm ? dpm_level : dpm;
@@ -334,7 +335,6 @@ amdsmi_status_t smi_amdgpu_get_ranges(amd::smi::AMDSmiGPUDevice* device, amdsmi_
     if (sleep_state_freq)
         *sleep_state_freq = sleep_freq;
 
-    ranges.close();
     return AMDSMI_STATUS_SUCCESS;
 }
 
@@ -342,8 +342,8 @@ amdsmi_status_t smi_amdgpu_get_enabled_blocks(amd::smi::AMDSmiGPUDevice* device,
     if (!device->check_if_drm_is_supported()) {
         return AMDSMI_STATUS_NOT_SUPPORTED;
     }
-    SMIGPUDEVICE_MUTEX(device->get_mutex())
-        std::string fullpath = "/sys/class/drm/" + device->get_gpu_path() + "/device/ras/features";
+    SMIGPUDEVICE_MUTEX_SHARED(device->get_mutex())
+        std::string fullpath = amd::smi::FsRootPath("/sys/class/drm/") + device->get_gpu_path() + "/device/ras/features";
     std::ifstream f(fullpath.c_str());
     std::string tmp_str;
 
@@ -375,11 +375,11 @@ amdsmi_status_t smi_amdgpu_get_bad_page_info(amd::smi::AMDSmiGPUDevice* device,
     if (!device->check_if_drm_is_supported()) {
         return AMDSMI_STATUS_NOT_SUPPORTED;
     }
-    SMIGPUDEVICE_MUTEX(device->get_mutex())
+    SMIGPUDEVICE_MUTEX_SHARED(device->get_mutex())
         std::string line;
     std::vector<std::string> badPagesVec;
 
-    std::string fullpath = "/sys/class/drm/" + device->get_gpu_path() + std::string("/device/ras/gpu_vram_bad_pages");
+    std::string fullpath = amd::smi::FsRootPath("/sys/class/drm/") + device->get_gpu_path() + std::string("/device/ras/gpu_vram_bad_pages");
     std::ifstream fs(fullpath.c_str());
 
     if (fs.fail()) {
@@ -452,11 +452,11 @@ amdsmi_status_t smi_amdgpu_get_bad_page_threshold(amd::smi::AMDSmiGPUDevice* dev
     if (!device->check_if_drm_is_supported()) {
         return AMDSMI_STATUS_NOT_SUPPORTED;
     }
-    SMIGPUDEVICE_MUTEX(device->get_mutex())
+    SMIGPUDEVICE_MUTEX_SHARED(device->get_mutex())
 
     //TODO: Accessing the node requires root privileges, and its interface may need to be exposed in another path
     uint32_t index = GetDeviceIndex(device->get_gpu_path());
-    std::string fullpath = "/sys/kernel/debug/dri/" + std::to_string(index) + std::string("/ras/bad_page_cnt_threshold");
+    std::string fullpath = amd::smi::FsRootPath("/sys/kernel/debug/dri/") + std::to_string(index) + std::string("/ras/bad_page_cnt_threshold");
     std::ifstream fs(fullpath.c_str());
 
     if (fs.fail()) {
@@ -478,7 +478,7 @@ amdsmi_status_t smi_amdgpu_validate_ras_eeprom(amd::smi::AMDSmiGPUDevice* device
     if (!device->check_if_drm_is_supported()) {
         return AMDSMI_STATUS_NOT_SUPPORTED;
     }
-    SMIGPUDEVICE_MUTEX(device->get_mutex())
+    SMIGPUDEVICE_MUTEX_SHARED(device->get_mutex())
 
     //uint32_t index = GetDeviceIndex(device->get_gpu_path());
     //TODO: need to expose the corresponding interface to validate the checksum of ras eeprom table.
@@ -490,10 +490,10 @@ amdsmi_status_t smi_amdgpu_get_ecc_error_count(amd::smi::AMDSmiGPUDevice* device
     if (!device->check_if_drm_is_supported()) {
         return AMDSMI_STATUS_NOT_SUPPORTED;
     }
-    SMIGPUDEVICE_MUTEX(device->get_mutex())
+    SMIGPUDEVICE_MUTEX_SHARED(device->get_mutex())
         char str[10];
 
-    std::string fullpath = "/sys/class/drm/" + device->get_gpu_path() + std::string("/device/ras/umc_err_count");
+    std::string fullpath = amd::smi::FsRootPath("/sys/class/drm/") + device->get_gpu_path() + std::string("/device/ras/umc_err_count");
     std::ifstream f(fullpath.c_str());
 
     if (f.fail()) {
@@ -516,7 +516,7 @@ amdsmi_status_t smi_amdgpu_get_driver_version(amd::smi::AMDSmiGPUDevice* device,
     if (!device->check_if_drm_is_supported()) {
         return AMDSMI_STATUS_NOT_SUPPORTED;
     }
-    SMIGPUDEVICE_MUTEX(device->get_mutex())
+    SMIGPUDEVICE_MUTEX_SHARED(device->get_mutex())
         amdsmi_status_t status = AMDSMI_STATUS_SUCCESS;
     FILE *fp;
     char *tmp, *ptr, *token;
@@ -529,11 +529,11 @@ amdsmi_status_t smi_amdgpu_get_driver_version(amd::smi::AMDSmiGPUDevice* device,
     else
         len = AMDSMI_MAX_DRIVER_VERSION_LENGTH;
 
-    std::string path = "/sys/module/amdgpu/version";
+    std::string path = amd::smi::FsRootPath("/sys/module/amdgpu/version");
 
     fp = fopen(path.c_str(), "r");
     if (fp == nullptr){
-        fp = fopen("/proc/version", "r");
+        fp = fopen(amd::smi::FsRootPath("/proc/version").c_str(), "r");
         if (fp == nullptr) {
             status = AMDSMI_STATUS_IO;
             return status;
@@ -658,8 +658,8 @@ amdsmi_status_t smi_amdgpu_is_gpu_power_management_enabled(amd::smi::AMDSmiGPUDe
         return AMDSMI_STATUS_API_FAILED;
     }
 
-    SMIGPUDEVICE_MUTEX(device->get_mutex())
-    std::string fullpath = "/sys/class/drm/" + device->get_gpu_path() + std::string("/device/pp_features");
+    SMIGPUDEVICE_MUTEX_SHARED(device->get_mutex())
+    std::string fullpath = amd::smi::FsRootPath("/sys/class/drm/") + device->get_gpu_path() + std::string("/device/pp_features");
     std::ifstream fs(fullpath.c_str());
 
     if (fs.fail()) {
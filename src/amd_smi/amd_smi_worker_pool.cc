@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <utility>
+#include "amd_smi/impl/amd_smi_worker_pool.h"
+
+namespace amd {
+namespace smi {
+
+// Reading sysfs is mostly waiting on the driver, so having more threads
+// than cores still helps; but keep it bounded.
+static const uint32_t kMinNumWorkers = 4;
+static const uint32_t kMaxNumWorkers = 32;
+
+static thread_local bool t_is_worker = false;
+
+bool AMDSmiWorkerPool::is_worker_thread() {
+    return t_is_worker;
+}
+
+void AMDSmiWorkerPool::start() {
+    // mutex_ is held by the caller
+    if (!workers_.empty()) {
+        return;
+    }
+    auto num_workers = std::clamp(std::thread::hardware_concurrency(),
+                                  kMinNumWorkers, kMaxNumWorkers);
+    stopping_ = false;
+    for (uint32_t i = 0; i < num_workers; ++i) {
+        workers_.emplace_back(&AMDSmiWorkerPool::worker_loop, this);
+    }
+}
+
+void AMDSmiWorkerPool::stop() {
+    if (t_is_worker) {
+        return;
+    }
+    std::vector<std::thread> workers;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+        workers.swap(workers_);
+    }
+    cond_.notify_all();
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
+void AMDSmiWorkerPool::worker_loop() {
+    t_is_worker = true;
+    while (true) {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            cond_.wait(lock, [this] { return stopping_ || !tasks_.empty(); });
+            if (tasks_.empty()) {
+                return;
+            }
+            task = std::move(tasks_.front());
+            tasks_.pop_front();
+        }
+        task();
+    }
+}
+
+void AMDSmiWorkerPool::submit(std::function<void()> task) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        start();
+        tasks_.emplace_back(std::move(task));
+    }
+    cond_.notify_one();
+}
+
+void AMDSmiWorkerPool::run_all(uint32_t num_tasks,
+                               const std::function<void(uint32_t)>& task) {
+    if (num_tasks == 0) {
+        return;
+    }
+
+    // Every runner (workers and the calling thread) claims the next task
+    // index until there is none left; the caller waits for all tasks to be
+    // done, not for the runners, so a runner still queued behind busy
+    // workers can not hold it up. Runners only touch the shared state.
+    struct RunState {
+        std::function<void(uint32_t)> task;
+        uint32_t num_tasks;
+        std::atomic<uint32_t> next_task{0};
+        std::mutex mutex;
+        std::condition_variable done_cond;
+        uint32_t num_done = 0;
+    };
+    auto state = std::make_shared<RunState>();
+    state->task = task;
+    state->num_tasks = num_tasks;
+    auto runner = [state]() {
+        uint32_t num_done = 0;
+        for (auto idx = state->next_task.fetch_add(1); idx < state->num_tasks;
+             idx = state->next_task.fetch_add(1)) {
+            state->task(idx);
+            ++num_done;
+        }
+        if (num_done == 0) {
+            return;
+        }
+        std::lock_guard<std::mutex> lock(state->mutex);
+        state->num_done += num_done;
+        if (state->num_done == state->num_tasks) {
+            state->done_cond.notify_all();
+        }
+    };
+
+    uint32_t num_helpers = 0;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        start();
+        num_helpers = std::min(static_cast<uint32_t>(workers_.size()), num_tasks - 1);
+        for (uint32_t i = 0; i < num_helpers; ++i) {
+            tasks_.emplace_back(runner);
+        }
+    }
+    if (num_helpers > 0) {
+        cond_.notify_all();
+    }
+
+    runner();
+    std::unique_lock<std::mutex> lock(state->mutex);
+    state->done_cond.wait(lock, [&state] { return state->num_done == state->num_tasks; });
+}
+
+}  // namespace smi
+}  // namespace amd
@@ -33,6 +33,7 @@
 
 #include "amd_smi/amdsmi.h"
 #include "amd_smi/impl/amd_smi_utils.h"
+#include "rocm_smi/rocm_smi_utils.h"
 
 extern "C" {
 
@@ -82,7 +83,8 @@ amdsmi_status_t gpuvsmi_get_pids(const amdsmi_bdf_t &bdf, std::vector<long int>
 			static_cast<uint32_t>(bdf.device_number & 0x1f),
 			static_cast<uint32_t>(bdf.function_number & 0x7));
 
-	d = opendir("/proc");
+	const std::string proc_root = amd::smi::FsRootPath("/proc");
+	d = opendir(proc_root.c_str());
 	if (!d)
 		return AMDSMI_STATUS_NO_PERM;
 
@@ -100,7 +102,7 @@ amdsmi_status_t gpuvsmi_get_pids(const amdsmi_bdf_t &bdf, std::vector<long int>
 				continue;
 
 			/* Check if fdinfo is accesible */
-			std::string path = "/proc/" + std::string(dir->d_name) + "/fdinfo/";
+			std::string path = proc_root + "/" + std::string(dir->d_name) + "/fdinfo/";
 
 			if (access(path.c_str(), R_OK))
 				continue;
@@ -131,9 +133,10 @@ amdsmi_status_t gpuvsmi_get_pid_info(const amdsmi_bdf_t &bdf, long int pid,
 			static_cast<uint32_t>(bdf.device_number & 0x1f),
 			static_cast<uint32_t>(bdf.function_number & 0x7));
 
-	std::string path = "/proc/" + std::to_string(pid) + "/fdinfo/";
-	std::string name_path = "/proc/" + std::to_string(pid) + "/comm";
-	std::string cgroup_path = "/proc/" + std::to_string(pid) + "/cgroup";
+	const std::string pid_path = amd::smi::FsRootPath("/proc/") + std::to_string(pid);
+	std::string path = pid_path + "/fdinfo/";
+	std::string name_path = pid_path + "/comm";
+	std::string cgroup_path = pid_path + "/cgroup";
 
 	if (gpuvsmi_pid_is_gpu(path.c_str(), bdf_str)) {
 		return AMDSMI_STATUS_INVAL;
@@ -0,0 +1,226 @@
+/*
+ * Copyright (c) Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+#include <dlfcn.h>
+#include <fcntl.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/types.h>
+
+#include <atomic>
+#include <cstddef>
+#include <new>
+
+#include "amd_smi_bench/bench_counters.h"
+
+static std::atomic<bool> s_counting(false);
+static std::atomic<uint64_t> s_allocs(0);
+static std::atomic<uint64_t> s_alloc_bytes(0);
+static std::atomic<uint64_t> s_opens(0);
+static std::atomic<uint64_t> s_reads(0);
+static std::atomic<uint64_t> s_ioctls(0);
+static std::atomic<uint64_t> s_closes(0);
+
+static inline void Count(std::atomic<uint64_t> *counter, uint64_t n = 1) {
+  if (s_counting.load(std::memory_order_relaxed)) {
+    counter->fetch_add(n, std::memory_order_relaxed);
+  }
+}
+
+void StartCounting(void) {
+  s_allocs = 0;
+  s_alloc_bytes = 0;
+  s_opens = 0;
+  s_reads = 0;
+  s_ioctls = 0;
+  s_closes = 0;
+  s_counting = true;
+}
+
+BenchCounts StopCounting(void) {
+  s_counting = false;
+
+  BenchCounts counts;
+  counts.allocs = s_allocs;
+  counts.alloc_bytes = s_alloc_bytes;
+  counts.opens = s_opens;
+  counts.reads = s_reads;
+  counts.ioctls = s_ioctls;
+  counts.closes = s_closes;
+  return counts;
+}
+
+// Look up the next definition of a libc symbol once, on first use
+template <typename F>
+static F NextSymbol(const char *name) {
+  F fn = reinterpret_cast<F>(dlsym(RTLD_NEXT, name));
+  if (fn == nullptr) {
+    abort();
+  }
+  return fn;
+}
+
+// The mode argument is only passed when a file may be created
+static mode_t OpenMode(int flags, va_list args) {
+  if ((flags & O_CREAT) || (flags & O_TMPFILE) == O_TMPFILE) {
+    return static_cast<mode_t>(va_arg(args, int));
+  }
+  return 0;
+}
+
+extern "C" {
+
+int open(const char *path, int flags, ...) {
+  static auto next = NextSymbol<int (*)(const char *, int, ...)>("open");
+  va_list args;
+  va_start(args, flags);
+  mode_t mode = OpenMode(flags, args);
+  va_end(args);
+  Count(&s_opens);
+  return next(path, flags, mode);
+}
+
+int open64(const char *path, int flags, ...) {
+  static auto next = NextSymbol<int (*)(const char *, int, ...)>("open64");
+  va_list args;
+  va_start(args, flags);
+  mode_t mode = OpenMode(flags, args);
+  va_end(args);
+  Count(&s_opens);
+  return next(path, flags, mode);
+}
+
+int openat(int dir_fd, const char *path, int flags, ...) {
+  static auto next =
+               NextSymbol<int (*)(int, const char *, int, ...)>("openat");
+  va_list args;
+  va_start(args, flags);
+  mode_t mode = OpenMode(flags, args);
+  va_end(args);
+  Count(&s_opens);
+  return next(dir_fd, path, flags, mode);
+}
+
+FILE *fopen(const char *path, const char *mode) {
+  static auto next =
+             NextSymbol<FILE *(*)(const char *, const char *)>("fopen");
+  Count(&s_opens);
+  return next(path, mode);
+}
+
+FILE *fopen64(const char *path, const char *mode) {
+  static auto next =
+             NextSymbol<FILE *(*)(const char *, const char *)>("fopen64");
+  Count(&s_opens);
+  return next(path, mode);
+}
+
+ssize_t read(int fd, void *buf, size_t count) {
+  static auto next = NextSymbol<ssize_t (*)(int, void *, size_t)>("read");
+  Count(&s_reads);
+  return next(fd, buf, count);
+}
+
+ssize_t pread(int fd, void *buf, size_t count, off_t offset) {
+  static auto next =
+             NextSymbol<ssize_t (*)(int, void *, size_t, off_t)>("pread");
+  Count(&s_reads);
+  return next(fd, buf, count, offset);
+}
+
+ssize_t pread64(int fd, void *buf, size_t count, off64_t offset) {
+  static auto next =
+         NextSymbol<ssize_t (*)(int, void *, size_t, off64_t)>("pread64");
+  Count(&s_reads);
+  return next(fd, buf, count, offset);
+}
+
+int ioctl(int fd, unsigned long request, ...) {  // NOLINT
+  static auto next =
+     NextSymbol<int (*)(int, unsigned long, void *)>("ioctl");  // NOLINT
+  va_list args;
+  va_start(args, request);
+  void *arg = va_arg(args, void *);
+  va_end(args);
+  Count(&s_ioctls);
+  return next(fd, request, arg);
+}
+
+int close(int fd) {
+  static auto next = NextSymbol<int (*)(int)>("close");
+  Count(&s_closes);
+  return next(fd);
+}
+
+int fclose(FILE *stream) {
+  static auto next = NextSymbol<int (*)(FILE *)>("fclose");
+  Count(&s_closes);
+  return next(stream);
+}
+
+}  // extern "C"
+
+// Allocation counting. The over-aligned forms are left to the runtime; the
+// library has no over-aligned types.
+void *operator new(size_t size) {
+  Count(&s_allocs);
+  Count(&s_alloc_bytes, size);
+  void *p = malloc(size == 0 ? 1 : size);
+  if (p == nullptr) {
+    throw std::bad_alloc();
+  }
+  return p;
+}
+
+void *operator new[](size_t size) {
+  return operator new(size);
+}
+
+void *operator new(size_t size, const std::nothrow_t &) noexcept {
+  Count(&s_allocs);
+  Count(&s_alloc_bytes, size);
+  return malloc(size == 0 ? 1 : size);
+}
+
+void *operator new[](size_t size, const std::nothrow_t &tag) noexcept {
+  return operator new(size, tag);
+}
+
+void operator delete(void *p) noexcept {
+  free(p);
+}
+
+void operator delete[](void *p) noexcept {
+  free(p);
+}
+
+void operator delete(void *p, size_t) noexcept {
+  free(p);
+}
+
+void operator delete[](void *p, size_t) noexcept {
+  free(p);
+}
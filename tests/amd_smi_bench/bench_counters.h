@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef TESTS_AMD_SMI_BENCH_BENCH_COUNTERS_H_
+#define TESTS_AMD_SMI_BENCH_BENCH_COUNTERS_H_
+
+#include <cstdint>
+
+// Heap allocations and file syscalls made by the process while counting is
+// on. The benchmark binary interposes operator new and the libc open, read
+// and ioctl entry points, so calls made from inside libamd_smi are seen too.
+struct BenchCounts {
+  uint64_t allocs;
+  uint64_t alloc_bytes;
+  uint64_t opens;
+  uint64_t reads;
+  uint64_t ioctls;
+  uint64_t closes;
+
+  uint64_t syscalls(void) const {return opens + reads + ioctls + closes;}
+};
+
+// Zero the counts and start counting
+void StartCounting(void);
+
+// Stop counting and return what was counted since StartCounting()
+BenchCounts StopCounting(void);
+
+#endif  // TESTS_AMD_SMI_BENCH_BENCH_COUNTERS_H_
@@ -0,0 +1,273 @@
+/*
+ * Copyright (c) Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdlib.h>
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "amd_smi/amdsmi.h"
+#include "amd_smi_bench/bench_counters.h"
+#include "amd_smi_bench/sysfs_fixture.h"
+
+// Each fixture is built once per GPU count and shared by all benchmarks;
+// they are removed at exit.
+static SysfsFixture &Fixture(uint32_t num_gpus) {
+  static std::map<uint32_t, std::unique_ptr<SysfsFixture>> fixtures;
+
+  std::unique_ptr<SysfsFixture> &fixture = fixtures[num_gpus];
+  if (fixture == nullptr) {
+    fixture.reset(new SysfsFixture(num_gpus));
+  }
+  return *fixture;
+}
+
+// Point the library at the fixture for state.range(0) GPUs
+static const SysfsFixture &UseFixture(const benchmark::State &state) {
+  const SysfsFixture &fixture =
+                       Fixture(static_cast<uint32_t>(state.range(0)));
+  setenv("RSMI_FS_ROOT", fixture.root().c_str(), 1);
+  return fixture;
+}
+
+// The library initialized against a fixture, with its GPU handles
+class Session {
+ public:
+  explicit Session(benchmark::State &state) {
+    UseFixture(state);
+    status_ = amdsmi_init(AMDSMI_INIT_AMD_GPUS);
+    if (status_ != AMDSMI_STATUS_SUCCESS) {
+      state.SkipWithError("amdsmi_init failed");
+      return;
+    }
+
+    uint32_t socket_count = 0;
+    amdsmi_get_socket_handles(&socket_count, nullptr);
+    std::vector<amdsmi_socket_handle> sockets(socket_count);
+    amdsmi_get_socket_handles(&socket_count, sockets.data());
+    for (auto socket : sockets) {
+      uint32_t count = 0;
+      amdsmi_get_processor_handles(socket, &count, nullptr);
+      std::vector<amdsmi_processor_handle> processors(count);
+      amdsmi_get_processor_handles(socket, &count, processors.data());
+      gpus_.insert(gpus_.end(), processors.begin(), processors.end());
+    }
+    if (gpus_.size() != static_cast<size_t>(state.range(0))) {
+      state.SkipWithError("the library did not find every fixture GPU");
+    }
+  }
+
+  ~Session() {
+    if (status_ == AMDSMI_STATUS_SUCCESS) {
+      amdsmi_shut_down();
+    }
+  }
+
+  Session(const Session&) = delete;
+  Session& operator=(const Session&) = delete;
+
+  const std::vector<amdsmi_processor_handle>& gpus(void) const {
+    return gpus_;
+  }
+
+ private:
+  amdsmi_status_t status_;
+  std::vector<amdsmi_processor_handle> gpus_;
+};
+
+// Run body once per iteration, counting allocations and syscalls over the
+// whole timed loop, and report them per iteration.
+template <typename F>
+static void Measure(benchmark::State &state, F body) {
+  StartCounting();
+  for (auto _ : state) {
+    body();
+  }
+  BenchCounts counts = StopCounting();
+
+  const auto per_iter = benchmark::Counter::kAvgIterations;
+  state.counters["gpus"] = static_cast<double>(state.range(0));
+  state.counters["allocs"] = benchmark::Counter(counts.allocs, per_iter);
+  state.counters["alloc_bytes"] =
+                       benchmark::Counter(counts.alloc_bytes, per_iter);
+  state.counters["opens"] = benchmark::Counter(counts.opens, per_iter);
+  state.counters["reads"] = benchmark::Counter(counts.reads, per_iter);
+  state.counters["ioctls"] = benchmark::Counter(counts.ioctls, per_iter);
+  state.counters["syscalls"] = benchmark::Counter(counts.syscalls(), per_iter);
+}
+
+static void GpuCounts(benchmark::internal::Benchmark *b) {
+  b->ArgName("gpus");
+  for (int64_t n : {1, 8, 64, 256}) {
+    b->Arg(n);
+  }
+}
+
+static void BM_InitShutDown(benchmark::State &state) {
+  UseFixture(state);
+  Measure(state, [&]() {
+    if (amdsmi_init(AMDSMI_INIT_AMD_GPUS) != AMDSMI_STATUS_SUCCESS) {
+      state.SkipWithError("amdsmi_init failed");
+      return;
+    }
+    amdsmi_shut_down();
+  });
+}
+BENCHMARK(BM_InitShutDown)->Apply(GpuCounts)->Unit(benchmark::kMillisecond);
+
+static void BM_ProcessorHandles(benchmark::State &state) {
+  Session session(state);
+  std::vector<amdsmi_socket_handle> sockets(session.gpus().size());
+  std::vector<amdsmi_processor_handle> processors(session.gpus().size());
+  Measure(state, [&]() {
+    uint32_t socket_count = static_cast<uint32_t>(sockets.size());
+    amdsmi_get_socket_handles(&socket_count, sockets.data());
+    for (uint32_t i = 0; i < socket_count; ++i) {
+      uint32_t count = static_cast<uint32_t>(processors.size());
+      amdsmi_get_processor_handles(sockets[i], &count, processors.data());
+    }
+  });
+}
+BENCHMARK(BM_ProcessorHandles)->Apply(GpuCounts);
+
+static void BM_GpuMetrics(benchmark::State &state) {
+  Session session(state);
+  amdsmi_gpu_metrics_t metrics;
+  Measure(state, [&]() {
+    for (auto gpu : session.gpus()) {
+      benchmark::DoNotOptimize(amdsmi_get_gpu_metrics_info(gpu, &metrics));
+    }
+  });
+}
+BENCHMARK(BM_GpuMetrics)->Apply(GpuCounts);
+
+static void BM_GpuMetricsBulk(benchmark::State &state) {
+  Session session(state);
+  std::vector<amdsmi_gpu_metrics_t> metrics(session.gpus().size());
+  std::vector<amdsmi_status_t> statuses(session.gpus().size());
+  Measure(state, [&]() {
+    benchmark::DoNotOptimize(amdsmi_get_gpu_metrics_info_bulk(
+        session.gpus().data(), static_cast<uint32_t>(session.gpus().size()),
+        metrics.data(), statuses.data()));
+  });
+}
+BENCHMARK(BM_GpuMetricsBulk)->Apply(GpuCounts);
+
+static void BM_SysfsSnapshot(benchmark::State &state) {
+  Session session(state);
+  std::vector<amdsmi_gpu_sysfs_snapshot_t> snapshots(session.gpus().size());
+  Measure(state, [&]() {
+    benchmark::DoNotOptimize(amdsmi_get_gpu_sysfs_snapshot(
+        session.gpus().data(), static_cast<uint32_t>(session.gpus().size()),
+        snapshots.data()));
+  });
+}
+BENCHMARK(BM_SysfsSnapshot)->Apply(GpuCounts);
+
+static void BM_HwmonSnapshot(benchmark::State &state) {
+  Session session(state);
+  amdsmi_gpu_hwmon_snapshot_t snapshot;
+  Measure(state, [&]() {
+    for (auto gpu : session.gpus()) {
+      benchmark::DoNotOptimize(amdsmi_get_gpu_hwmon_snapshot(gpu, &snapshot));
+    }
+  });
+}
+BENCHMARK(BM_HwmonSnapshot)->Apply(GpuCounts);
+
+static void BM_ProcessList(benchmark::State &state) {
+  Session session(state);
+  std::vector<amdsmi_proc_info_t> procs(Fixture(
+                   static_cast<uint32_t>(state.range(0))).num_processes());
+  Measure(state, [&]() {
+    for (auto gpu : session.gpus()) {
+      uint32_t count = static_cast<uint32_t>(procs.size());
+      benchmark::DoNotOptimize(
+                     amdsmi_get_gpu_process_list(gpu, &count, procs.data()));
+    }
+  });
+}
+BENCHMARK(BM_ProcessList)->Apply(GpuCounts);
+
+static void BM_TopoLinks(benchmark::State &state) {
+  Session session(state);
+  Measure(state, [&]() {
+    const auto &gpus = session.gpus();
+    for (size_t i = 1; i < gpus.size(); ++i) {
+      uint64_t weight = 0;
+      uint64_t hops = 0;
+      amdsmi_io_link_type_t type;
+      amdsmi_topo_get_link_weight(gpus[0], gpus[i], &weight);
+      amdsmi_topo_get_link_type(gpus[0], gpus[i], &hops, &type);
+    }
+  });
+}
+BENCHMARK(BM_TopoLinks)->Apply(GpuCounts);
+
+// Roughly what `amd-smi metric` queries for each GPU
+static void BM_CliSweep(benchmark::State &state) {
+  Session session(state);
+  Measure(state, [&]() {
+    for (auto gpu : session.gpus()) {
+      amdsmi_asic_info_t asic;
+      amdsmi_engine_usage_t usage;
+      amdsmi_power_info_t power;
+      amdsmi_clk_info_t clk;
+      amdsmi_vram_usage_t vram;
+      amdsmi_pcie_info_t pcie;
+      uint64_t value = 0;
+      int64_t temp = 0;
+      int64_t rpms = 0;
+      float resolution = 0;
+      uint64_t timestamp = 0;
+      unsigned int uuid_len = AMDSMI_GPU_UUID_SIZE;
+      char uuid[AMDSMI_GPU_UUID_SIZE];
+
+      amdsmi_get_gpu_bdf_id(gpu, &value);
+      amdsmi_get_gpu_device_uuid(gpu, &uuid_len, uuid);
+      amdsmi_get_gpu_asic_info(gpu, &asic);
+      amdsmi_get_gpu_activity(gpu, &usage);
+      amdsmi_get_power_info(gpu, 0, &power);
+      amdsmi_get_energy_count(gpu, &value, &resolution, &timestamp);
+      amdsmi_get_clock_info(gpu, AMDSMI_CLK_TYPE_GFX, &clk);
+      amdsmi_get_clock_info(gpu, AMDSMI_CLK_TYPE_MEM, &clk);
+      for (auto type : {AMDSMI_TEMPERATURE_TYPE_EDGE,
+                        AMDSMI_TEMPERATURE_TYPE_HOTSPOT,
+                        AMDSMI_TEMPERATURE_TYPE_VRAM}) {
+        amdsmi_get_temp_metric(gpu, type, AMDSMI_TEMP_CURRENT, &temp);
+      }
+      amdsmi_get_gpu_fan_rpms(gpu, 0, &rpms);
+      amdsmi_get_gpu_memory_usage(gpu, AMDSMI_MEM_TYPE_VRAM, &value);
+      amdsmi_get_gpu_vram_usage(gpu, &vram);
+      amdsmi_get_pcie_info(gpu, &pcie);
+      amdsmi_get_gpu_pci_replay_counter(gpu, &value);
+    }
+  });
+}
+BENCHMARK(BM_CliSweep)->Apply(GpuCounts)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,344 @@
+/*
+ * Copyright (c) Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdlib.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+#include "amd_smi_bench/sysfs_fixture.h"
+#include "rocm_smi/rocm_smi_gpu_metrics.h"
+
+namespace fs = std::filesystem;
+
+// At most this many compute processes, whatever the number of GPUs
+static const uint32_t kMaxProcesses = 32;
+static const uint32_t kFirstPid = 4000;
+static const uint32_t kFirstRenderMinor = 128;
+// Buses per PCI domain; more GPUs than this spill over to the next domain
+static const uint32_t kBusesPerDomain = 128;
+static const uint64_t kUniqueIdBase = 0x5a17c0de00000000;
+static const uint64_t kGpuIdBase = 1000;
+
+static void WriteFile(const fs::path &path, const std::string &contents) {
+  fs::create_directories(path.parent_path());
+  std::ofstream ofs(path, std::ios::binary | std::ios::trunc);
+  if (!ofs) {
+    throw std::runtime_error("Failed to create " + path.string());
+  }
+  ofs << contents;
+}
+
+static void WriteFile(const fs::path &path, const void *data, size_t size) {
+  WriteFile(path, std::string(static_cast<const char *>(data), size));
+}
+
+static void Symlink(const std::string &target, const fs::path &link) {
+  fs::create_directories(link.parent_path());
+  fs::create_directory_symlink(target, link);
+}
+
+static std::string BdfString(uint32_t ind) {
+  char bdf[16];
+  snprintf(bdf, sizeof(bdf), "%04x:%02x:00.0", ind / kBusesPerDomain,
+           ind % kBusesPerDomain + 1);
+  return bdf;
+}
+
+static uint64_t GpuId(uint32_t ind) {
+  return kGpuIdBase + ind;
+}
+
+SysfsFixture::SysfsFixture(uint32_t num_gpus) : num_gpus_(num_gpus),
+                                 num_processes_(std::min(num_gpus, kMaxProcesses)) {
+  const char *tmp_dir = getenv("TMPDIR");
+  std::string templ = (tmp_dir != nullptr) ? tmp_dir : "/tmp";
+  templ += "/amdsmi_bench.XXXXXX";
+  if (mkdtemp(&templ[0]) == nullptr) {
+    throw std::runtime_error("Failed to create a directory from " + templ);
+  }
+  root_ = templ;
+
+  WriteFile(root_ + "/sys/module/amdgpu/initstate", "live\n");
+  WriteFile(root_ + "/sys/module/amdgpu/version", "6.10.5\n");
+  WriteFile(root_ + "/proc/cpuinfo",
+            "processor\t: 0\nvendor_id\t: AuthenticAMD\nflags\t\t: fpu sse2\n");
+  WriteFile(root_ + "/proc/version", "Linux version 6.8.0 (bench)\n");
+  fs::create_directories(root_ + "/sys/class/kfd/kfd/proc");
+  fs::create_directories(root_ + "/sys/bus/event_source/devices");
+
+  AddCpuNode();
+  for (uint32_t i = 0; i < num_gpus_; ++i) {
+    AddGpu(i);
+  }
+  for (uint32_t p = 0; p < num_processes_; ++p) {
+    AddProcess(kFirstPid + p, p % num_gpus_);
+  }
+}
+
+SysfsFixture::~SysfsFixture() {
+  std::error_code ec;
+  fs::remove_all(root_, ec);
+}
+
+void SysfsFixture::AddCpuNode(void) {
+  const std::string node = root_ + "/sys/class/kfd/kfd/topology/nodes/0";
+
+  WriteFile(node + "/gpu_id", "0\n");
+  WriteFile(node + "/name", "\n");
+  std::ostringstream props;
+  props << "cpu_cores_count 64\n"
+        << "simd_count 0\n"
+        << "mem_banks_count 1\n"
+        << "caches_count 0\n"
+        << "io_links_count " << num_gpus_ << "\n"
+        << "p2p_links_count 0\n"
+        << "cpu_core_id_base 0\n"
+        << "gfx_target_version 0\n"
+        << "vendor_id 0\n"
+        << "device_id 0\n"
+        << "location_id 0\n"
+        << "domain 0\n"
+        << "drm_render_minor 0\n"
+        << "unique_id 0\n";
+  WriteFile(node + "/properties", props.str());
+  fs::create_directories(node + "/p2p_links");
+
+  // The CPU node links to every GPU over PCIe
+  for (uint32_t i = 0; i < num_gpus_; ++i) {
+    std::ostringstream link;
+    link << "type 2\n"
+         << "version_major 0\n"
+         << "version_minor 0\n"
+         << "node_from 0\n"
+         << "node_to " << (i + 1) << "\n"
+         << "weight 20\n"
+         << "min_latency 0\n"
+         << "max_latency 0\n"
+         << "min_bandwidth 312\n"
+         << "max_bandwidth 64000\n"
+         << "recommended_transfer_size 0\n"
+         << "flags 3\n";
+    WriteFile(node + "/io_links/" + std::to_string(i) + "/properties",
+              link.str());
+  }
+  if (num_gpus_ == 0) {
+    fs::create_directories(node + "/io_links");
+  }
+}
+
+void SysfsFixture::AddGpu(uint32_t ind) {
+  const std::string bdf = BdfString(ind);
+  const uint32_t domain = ind / kBusesPerDomain;
+  const uint32_t bus = ind % kBusesPerDomain + 1;
+  const uint32_t render_minor = kFirstRenderMinor + ind;
+  const uint64_t unique_id = kUniqueIdBase + ind;
+  const std::string card = "card" + std::to_string(ind);
+  const std::string render = "renderD" + std::to_string(render_minor);
+
+  char pci_root[16];
+  snprintf(pci_root, sizeof(pci_root), "pci%04x:00", domain);
+  const std::string pci_rel = std::string("devices/") + pci_root + "/" + bdf;
+  const std::string dev = root_ + "/sys/" + pci_rel;
+
+  // drm nodes, and the class and bus links to them, as the kernel has them
+  Symlink("../..", dev + "/drm/" + card + "/device");
+  Symlink("../..", dev + "/drm/" + render + "/device");
+  Symlink("../../" + pci_rel + "/drm/" + card,
+          root_ + "/sys/class/drm/" + card);
+  Symlink("../../" + pci_rel + "/drm/" + render,
+          root_ + "/sys/class/drm/" + render);
+  Symlink("../../../" + pci_rel, root_ + "/sys/bus/pci/devices/" + bdf);
+
+  char hex[32];
+  snprintf(hex, sizeof(hex), "%llx\n",
+           static_cast<unsigned long long>(unique_id));  // NOLINT
+  WriteFile(dev + "/vendor", "0x1002\n");
+  WriteFile(dev + "/device", "0x74a1\n");
+  WriteFile(dev + "/subsystem_vendor", "0x1002\n");
+  WriteFile(dev + "/subsystem_device", "0x74a1\n");
+  WriteFile(dev + "/revision", "0x00\n");
+  WriteFile(dev + "/unique_id", hex);
+  WriteFile(dev + "/numa_node", "0\n");
+  WriteFile(dev + "/uevent",
+            "DRIVER=amdgpu\nPCI_CLASS=38000\nPCI_ID=1002:74A1\n"
+            "PCI_SLOT_NAME=" + bdf + "\n");
+  WriteFile(dev + "/product_name", "Synthetic GPU\n");
+  WriteFile(dev + "/gpu_busy_percent", "42\n");
+  WriteFile(dev + "/mem_busy_percent", "7\n");
+  WriteFile(dev + "/mem_info_vram_total", "68702699520\n");
+  WriteFile(dev + "/mem_info_vram_used", "1073741824\n");
+  WriteFile(dev + "/mem_info_vis_vram_total", "68702699520\n");
+  WriteFile(dev + "/mem_info_vis_vram_used", "1073741824\n");
+  WriteFile(dev + "/mem_info_gtt_total", "269818445824\n");
+  WriteFile(dev + "/mem_info_gtt_used", "16777216\n");
+  WriteFile(dev + "/pcie_replay_count", "0\n");
+  WriteFile(dev + "/current_link_speed", "32.0 GT/s PCIe\n");
+  WriteFile(dev + "/current_link_width", "16\n");
+  WriteFile(dev + "/max_link_speed", "32.0 GT/s PCIe\n");
+  WriteFile(dev + "/max_link_width", "16\n");
+  WriteFile(dev + "/power_dpm_force_performance_level", "auto\n");
+  WriteFile(dev + "/pp_dpm_sclk", "0: 500Mhz\n1: 1200Mhz *\n2: 2100Mhz\n");
+  WriteFile(dev + "/pp_dpm_mclk", "0: 900Mhz\n1: 1300Mhz *\n");
+  WriteFile(dev + "/pp_dpm_socclk", "0: 500Mhz\n1: 1143Mhz *\n");
+  WriteFile(dev + "/pp_dpm_fclk", "0: 1200Mhz *\n");
+  WriteFile(dev + "/pp_dpm_pcie", "0: 2.5GT/s, x16 97Mhz\n1: 32.0GT/s, x16 1200Mhz *\n");
+
+  amd::smi::AMDGpuMetrics_v13_t metrics;
+  memset(&metrics, 0, sizeof(metrics));
+  metrics.m_common_header.m_structure_size = sizeof(metrics);
+  metrics.m_common_header.m_format_revision = 1;
+  metrics.m_common_header.m_content_revision = 3;
+  metrics.m_temperature_edge = 45;
+  metrics.m_temperature_hotspot = 50;
+  metrics.m_temperature_mem = 40;
+  metrics.m_average_gfx_activity = 42;
+  metrics.m_average_umc_activity = 7;
+  metrics.m_average_socket_power = 150;
+  metrics.m_energy_accumulator = 1000000 + ind;
+  metrics.m_system_clock_counter = 1000000000;
+  metrics.m_average_gfxclk_frequency = 1200;
+  metrics.m_average_socclk_frequency = 1143;
+  metrics.m_average_uclk_frequency = 1300;
+  metrics.m_current_gfxclk = 1200;
+  metrics.m_current_socclk = 1143;
+  metrics.m_current_uclk = 1300;
+  metrics.m_current_fan_speed = 1200;
+  metrics.m_pcie_link_width = 16;
+  metrics.m_pcie_link_speed = 320;
+  metrics.m_firmware_timestamp = 100000000;
+  metrics.m_voltage_soc = 800;
+  metrics.m_voltage_gfx = 850;
+  metrics.m_voltage_mem = 1200;
+  WriteFile(dev + "/gpu_metrics", &metrics, sizeof(metrics));
+
+  const std::string hwmon = dev + "/hwmon/hwmon" + std::to_string(ind);
+  WriteFile(hwmon + "/name", "amdgpu\n");
+  WriteFile(hwmon + "/temp1_input", "45000\n");
+  WriteFile(hwmon + "/temp1_label", "edge\n");
+  WriteFile(hwmon + "/temp1_crit", "100000\n");
+  WriteFile(hwmon + "/temp2_input", "50000\n");
+  WriteFile(hwmon + "/temp2_label", "junction\n");
+  WriteFile(hwmon + "/temp2_crit", "110000\n");
+  WriteFile(hwmon + "/temp3_input", "40000\n");
+  WriteFile(hwmon + "/temp3_label", "mem\n");
+  WriteFile(hwmon + "/temp3_crit", "95000\n");
+  WriteFile(hwmon + "/in0_input", "850\n");
+  WriteFile(hwmon + "/in0_label", "vddgfx\n");
+  WriteFile(hwmon + "/fan1_input", "1200\n");
+  WriteFile(hwmon + "/fan1_max", "3000\n");
+  WriteFile(hwmon + "/pwm1", "80\n");
+  WriteFile(hwmon + "/pwm1_max", "255\n");
+  WriteFile(hwmon + "/power1_average", "150000000\n");
+  WriteFile(hwmon + "/power1_input", "152000000\n");
+  WriteFile(hwmon + "/power1_cap", "300000000\n");
+  WriteFile(hwmon + "/power1_cap_max", "400000000\n");
+  WriteFile(hwmon + "/power1_cap_min", "0\n");
+
+  // KFD node; node 0 is the CPU
+  const uint32_t node_ind = ind + 1;
+  const std::string node = root_ + "/sys/class/kfd/kfd/topology/nodes/" +
+                                                   std::to_string(node_ind);
+  WriteFile(node + "/gpu_id", std::to_string(GpuId(ind)) + "\n");
+  WriteFile(node + "/name", "gfx942\n");
+  std::ostringstream props;
+  props << "cpu_cores_count 0\n"
+        << "simd_count 304\n"
+        << "mem_banks_count 1\n"
+        << "caches_count 0\n"
+        << "io_links_count 1\n"
+        << "p2p_links_count 0\n"
+        << "max_waves_per_simd 8\n"
+        << "lds_size_in_kb 64\n"
+        << "wave_front_size 64\n"
+        << "array_count 32\n"
+        << "simd_arrays_per_engine 1\n"
+        << "cu_per_simd_array 10\n"
+        << "simd_per_cu 4\n"
+        << "gfx_target_version 90402\n"
+        << "vendor_id 4098\n"
+        << "device_id 29857\n"
+        << "location_id " << (bus << 8) << "\n"
+        << "domain " << domain << "\n"
+        << "drm_render_minor " << render_minor << "\n"
+        << "hive_id 0\n"
+        << "num_sdma_engines 2\n"
+        << "num_sdma_xgmi_engines 0\n"
+        << "num_cp_queues 24\n"
+        << "max_engine_clk_fcompute 2100\n"
+        << "local_mem_size 0\n"
+        << "fw_version 0\n"
+        << "capability 0\n"
+        << "unique_id " << unique_id << "\n"
+        << "num_xcc 1\n"
+        << "max_engine_clk_ccompute 3000\n";
+  WriteFile(node + "/properties", props.str());
+  WriteFile(node + "/mem_banks/0/properties",
+            "heap_type 1\nsize_in_bytes 68702699520\nflags 0\nwidth 64\n"
+            "mem_clk_max 1300\n");
+  fs::create_directories(node + "/p2p_links");
+  std::ostringstream link;
+  link << "type 2\n"
+       << "version_major 0\n"
+       << "version_minor 0\n"
+       << "node_from " << node_ind << "\n"
+       << "node_to 0\n"
+       << "weight 20\n"
+       << "min_latency 0\n"
+       << "max_latency 0\n"
+       << "min_bandwidth 312\n"
+       << "max_bandwidth 64000\n"
+       << "recommended_transfer_size 0\n"
+       << "flags 3\n";
+  WriteFile(node + "/io_links/0/properties", link.str());
+}
+
+void SysfsFixture::AddProcess(uint32_t pid, uint32_t gpu_ind) {
+  const std::string pid_str = std::to_string(pid);
+  const std::string gpu_id = std::to_string(GpuId(gpu_ind));
+  const std::string kfd_proc = root_ + "/sys/class/kfd/kfd/proc/" + pid_str;
+
+  WriteFile(kfd_proc + "/pasid", std::to_string(pid - kFirstPid + 1) + "\n");
+  WriteFile(kfd_proc + "/queues/0/gpuid", gpu_id + "\n");
+  WriteFile(kfd_proc + "/vram_" + gpu_id, "1048576\n");
+  WriteFile(kfd_proc + "/sdma_" + gpu_id, "0\n");
+  WriteFile(kfd_proc + "/stats_" + gpu_id + "/cu_occupancy", "0\n");
+
+  const std::string proc = root_ + "/proc/" + pid_str;
+  WriteFile(proc + "/comm", "bench_proc_" + pid_str + "\n");
+  WriteFile(proc + "/cgroup", "0::/user.slice\n");
+  WriteFile(proc + "/fdinfo/3",
+            "pos:\t0\nflags:\t02100002\nmnt_id:\t26\n"
+            "drm-driver:\tamdgpu\n"
+            "drm-client-id:\t" + pid_str + "\n"
+            "drm-pdev:\t" + BdfString(gpu_ind) + "\n"
+            "drm-memory-vram:\t1024 KiB\n"
+            "drm-memory-gtt:\t512 KiB\n"
+            "drm-memory-cpu:\t0 KiB\n"
+            "drm-engine-gfx:\t123456 ns\n");
+}
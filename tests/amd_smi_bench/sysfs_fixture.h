@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef TESTS_AMD_SMI_BENCH_SYSFS_FIXTURE_H_
+#define TESTS_AMD_SMI_BENCH_SYSFS_FIXTURE_H_
+
+#include <cstdint>
+#include <string>
+
+// A synthetic /sys and /proc tree with a number of GPUs, laid out the way
+// the amdgpu and kfd drivers lay them out. Point RSMI_FS_ROOT at root() to
+// run the library against it on a machine without GPUs.
+//
+// Each GPU gets a PCI device directory with the drm card and renderD nodes,
+// an hwmon, a v1.3 gpu_metrics table and the usual text attributes, and a
+// KFD topology node with an io link to the CPU node. A few compute
+// processes are spread over the GPUs, both in kfd/proc and in /proc fdinfo.
+class SysfsFixture {
+ public:
+  // Build the tree for num_gpus GPUs in a new directory under $TMPDIR
+  explicit SysfsFixture(uint32_t num_gpus);
+  ~SysfsFixture();
+
+  SysfsFixture(const SysfsFixture&) = delete;
+  SysfsFixture& operator=(const SysfsFixture&) = delete;
+
+  const std::string& root(void) const {return root_;}
+  uint32_t num_gpus(void) const {return num_gpus_;}
+  uint32_t num_processes(void) const {return num_processes_;}
+
+ private:
+  void AddGpu(uint32_t ind);
+  void AddCpuNode(void);
+  void AddProcess(uint32_t pid, uint32_t gpu_ind);
+
+  std::string root_;
+  uint32_t num_gpus_;
+  uint32_t num_processes_;
+};
+
+#endif  // TESTS_AMD_SMI_BENCH_SYSFS_FIXTURE_H_
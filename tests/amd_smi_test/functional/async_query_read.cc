@@ -0,0 +1,230 @@
+/*
+ * Copyright (c) Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <poll.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <iostream>
+#include <iterator>
+#include <map>
+#include <mutex>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include "amd_smi/amdsmi.h"
+#include "async_query_read.h"
+#include "../test_common.h"
+
+TestAsyncQueryRead::TestAsyncQueryRead() : TestBase() {
+  set_title("AMDSMI Async Query Read Test");
+  set_description("The Async Query Read tests verifies that queries submitted "
+                  "asynchronously complete through the eventfd and through callbacks.");
+}
+
+TestAsyncQueryRead::~TestAsyncQueryRead(void) {
+}
+
+void TestAsyncQueryRead::SetUp(void) {
+  TestBase::SetUp();
+
+  return;
+}
+
+void TestAsyncQueryRead::DisplayTestInfo(void) {
+  TestBase::DisplayTestInfo();
+}
+
+void TestAsyncQueryRead::DisplayResults(void) const {
+  TestBase::DisplayResults();
+  return;
+}
+
+void TestAsyncQueryRead::Close() {
+  // This will close handles opened within amdsmitst utility calls and call
+  // amdsmi_shut_down(), so it should be done after other hsa cleanup
+  TestBase::Close();
+}
+
+// The outputs of a request must outlive it. These wait for the requests
+// still in flight when they go out of scope, ie: when an assert fails, so
+// declare them after the outputs.
+
+// Requests whose completions are queued
+struct QueuedRequests {
+  explicit QueuedRequests(int eventfd) : fd(eventfd) {}
+  ~QueuedRequests() {
+    while (num_pending > 0) {
+      struct pollfd pfd = {fd, POLLIN, 0};
+      if (poll(&pfd, 1, -1) != 1) {
+        continue;
+      }
+      amdsmi_async_completion_t completions[4];
+      uint32_t num_completions = static_cast<uint32_t>(std::size(completions));
+      if (amdsmi_async_get_completions(completions, &num_completions) ==
+          AMDSMI_STATUS_SUCCESS) {
+        num_pending -= num_completions;
+      }
+    }
+  }
+
+  int fd;
+  uint32_t num_pending = 0;
+};
+
+// Requests completed by Complete()
+struct CallbackRequests {
+  ~CallbackRequests() {
+    std::unique_lock<std::mutex> lock(mutex);
+    cond.wait(lock, [this] { return num_completed == num_submitted; });
+  }
+
+  void Submitted() {
+    std::lock_guard<std::mutex> lock(mutex);
+    ++num_submitted;
+  }
+
+  bool WaitFor(std::chrono::seconds timeout) {
+    std::unique_lock<std::mutex> lock(mutex);
+    return cond.wait_for(lock, timeout,
+                         [this] { return num_completed == num_submitted; });
+  }
+
+  static void Complete(const amdsmi_async_completion_t *completion) {
+    auto requests = static_cast<CallbackRequests *>(completion->user_data);
+    // A callback can not shut the library down
+    auto shut_down_status = amdsmi_shut_down();
+    std::lock_guard<std::mutex> lock(requests->mutex);
+    requests->is_matched = requests->is_matched &&
+                           (completion->op == AMDSMI_ASYNC_OP_ACTIVITY) &&
+                           (shut_down_status == AMDSMI_STATUS_BUSY);
+    ++requests->num_completed;
+    requests->cond.notify_all();
+  }
+
+  std::mutex mutex;
+  std::condition_variable cond;
+  uint32_t num_submitted = 0;
+  uint32_t num_completed = 0;
+  bool is_matched = true;
+};
+
+void TestAsyncQueryRead::Run(void) {
+  amdsmi_status_t err;
+
+  TestBase::Run();
+  if (setup_failed_) {
+    std::cout << "** SetUp Failed for this test. Skipping.**" << std::endl;
+    return;
+  }
+  if (num_monitor_devs() == 0) {
+    return;
+  }
+
+  const uint32_t num_devs = num_monitor_devs();
+  int fd = -1;
+  err = amdsmi_async_get_eventfd(&fd);
+  CHK_ERR_ASRT(err);
+  ASSERT_GE(fd, 0);
+
+  // Completions queued, signalled by the eventfd
+  {
+    std::vector<amdsmi_gpu_metrics_t> async_metrics(num_devs);
+    QueuedRequests queued(fd);
+    std::map<amdsmi_async_request_t, uint32_t> async_requests;
+    for (uint32_t i = 0; i < num_devs; ++i) {
+      amdsmi_async_request_t request = 0;
+      err = amdsmi_async_submit(AMDSMI_ASYNC_OP_GPU_METRICS_INFO, processor_handles_[i],
+                                &async_metrics[i], nullptr, &async_metrics[i], &request);
+      CHK_ERR_ASRT(err);
+      ++queued.num_pending;
+      ASSERT_NE(request, 0u);
+      async_requests[request] = i;
+    }
+    while (queued.num_pending > 0) {
+      struct pollfd pfd = {fd, POLLIN, 0};
+      ASSERT_EQ(poll(&pfd, 1, 5000), 1);
+      amdsmi_async_completion_t completions[4];
+      uint32_t num_completions = static_cast<uint32_t>(std::size(completions));
+      err = amdsmi_async_get_completions(completions, &num_completions);
+      CHK_ERR_ASRT(err);
+      queued.num_pending -= num_completions;
+      for (uint32_t c = 0; c < num_completions; ++c) {
+        const auto& completion = completions[c];
+        ASSERT_EQ(async_requests.count(completion.request), 1u);
+        const uint32_t i = async_requests[completion.request];
+        ASSERT_EQ(completion.op, AMDSMI_ASYNC_OP_GPU_METRICS_INFO);
+        ASSERT_EQ(completion.processor_handle, processor_handles_[i]);
+        ASSERT_EQ(completion.out, &async_metrics[i]);
+        ASSERT_EQ(completion.user_data, &async_metrics[i]);
+        amdsmi_gpu_metrics_t sync_metrics;
+        ASSERT_EQ(completion.status,
+                  amdsmi_get_gpu_metrics_info(processor_handles_[i], &sync_metrics));
+        if (completion.status == AMDSMI_STATUS_SUCCESS) {
+          ASSERT_EQ(async_metrics[i].common_header.format_revision,
+                    sync_metrics.common_header.format_revision);
+          ASSERT_EQ(async_metrics[i].common_header.content_revision,
+                    sync_metrics.common_header.content_revision);
+        }
+      }
+    }
+    // Everything read: the eventfd is cleared
+    struct pollfd pfd = {fd, POLLIN, 0};
+    ASSERT_EQ(poll(&pfd, 1, 0), 0);
+  }
+
+  // Completions passed to a callback
+  {
+    std::vector<amdsmi_engine_usage_t> async_activity(num_devs);
+    CallbackRequests callbacks;
+    for (uint32_t i = 0; i < num_devs; ++i) {
+      err = amdsmi_async_submit(AMDSMI_ASYNC_OP_ACTIVITY, processor_handles_[i],
+                                &async_activity[i], CallbackRequests::Complete,
+                                &callbacks, nullptr);
+      CHK_ERR_ASRT(err);
+      callbacks.Submitted();
+    }
+    ASSERT_TRUE(callbacks.WaitFor(std::chrono::seconds(5)));
+    ASSERT_TRUE(callbacks.is_matched);
+
+    // Callback completions are not queued
+    amdsmi_async_completion_t completion;
+    uint32_t num_completions = 1;
+    err = amdsmi_async_get_completions(&completion, &num_completions);
+    CHK_ERR_ASRT(err);
+    ASSERT_EQ(num_completions, 0u);
+  }
+  IF_VERB(STANDARD) {
+    std::cout << "\t** Async: " << num_devs << " queued and " << num_devs
+              << " callback completions\n";
+  }
+
+  amdsmi_engine_usage_t activity;
+  err = amdsmi_async_submit(AMDSMI_ASYNC_OP_ACTIVITY, processor_handles_[0], nullptr,
+                            nullptr, nullptr, nullptr);
+  ASSERT_EQ(err, AMDSMI_STATUS_INVAL);
+  err = amdsmi_async_submit(static_cast<amdsmi_async_op_t>(AMDSMI_ASYNC_OP__MAX + 1),
+                            processor_handles_[0], &activity, nullptr, nullptr, nullptr);
+  ASSERT_EQ(err, AMDSMI_STATUS_INVAL);
+}
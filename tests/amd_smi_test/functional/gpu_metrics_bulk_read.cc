@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include <iostream>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include "amd_smi/amdsmi.h"
+#include "gpu_metrics_bulk_read.h"
+#include "../test_common.h"
+
+TestGpuMetricsBulkRead::TestGpuMetricsBulkRead() : TestBase() {
+  set_title("AMDSMI GPU Metrics Bulk Read Test");
+  set_description("The GPU Metrics Bulk Read tests verifies that the gpu metrics of all "
+                  "devices can be read at once, and match the per device reads.");
+}
+
+TestGpuMetricsBulkRead::~TestGpuMetricsBulkRead(void) {
+}
+
+void TestGpuMetricsBulkRead::SetUp(void) {
+  TestBase::SetUp();
+
+  return;
+}
+
+void TestGpuMetricsBulkRead::DisplayTestInfo(void) {
+  TestBase::DisplayTestInfo();
+}
+
+void TestGpuMetricsBulkRead::DisplayResults(void) const {
+  TestBase::DisplayResults();
+  return;
+}
+
+void TestGpuMetricsBulkRead::Close() {
+  // This will close handles opened within amdsmitst utility calls and call
+  // amdsmi_shut_down(), so it should be done after other hsa cleanup
+  TestBase::Close();
+}
+
+void TestGpuMetricsBulkRead::Run(void) {
+  amdsmi_status_t err;
+
+  TestBase::Run();
+  if (setup_failed_) {
+    std::cout << "** SetUp Failed for this test. Skipping.**" << std::endl;
+    return;
+  }
+  if (num_monitor_devs() == 0) {
+    return;
+  }
+
+  const auto num_devs = num_monitor_devs();
+  std::vector<amdsmi_gpu_metrics_t> bulk_metrics(num_devs);
+  std::vector<amdsmi_status_t> bulk_statuses(num_devs, AMDSMI_STATUS_INVAL);
+  err = amdsmi_get_gpu_metrics_info_bulk(processor_handles_, num_devs,
+                                         bulk_metrics.data(), bulk_statuses.data());
+  const char *status_string;
+  amdsmi_status_code_to_string(err, &status_string);
+  std::cout << "\t** amdsmi_get_gpu_metrics_info_bulk(): " << status_string << "\n";
+  CHK_ERR_ASRT(err);
+  for (uint32_t i = 0; i < num_devs; ++i) {
+    amdsmi_gpu_metrics_t single_metrics = {};
+    auto single_err = amdsmi_get_gpu_metrics_info(processor_handles_[i], &single_metrics);
+    ASSERT_EQ(bulk_statuses[i], single_err);
+    if (single_err == AMDSMI_STATUS_SUCCESS) {
+      ASSERT_EQ(bulk_metrics[i].common_header.format_revision,
+                single_metrics.common_header.format_revision);
+      ASSERT_EQ(bulk_metrics[i].common_header.content_revision,
+                single_metrics.common_header.content_revision);
+    }
+  }
+
+  err = amdsmi_get_gpu_metrics_info_bulk(processor_handles_, 0,
+                                         bulk_metrics.data(), bulk_statuses.data());
+  ASSERT_EQ(err, AMDSMI_STATUS_INVAL);
+  err = amdsmi_get_gpu_metrics_info_bulk(processor_handles_, num_devs,
+                                         nullptr, bulk_statuses.data());
+  ASSERT_EQ(err, AMDSMI_STATUS_INVAL);
+}
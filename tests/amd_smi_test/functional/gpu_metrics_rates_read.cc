@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include <chrono>
+#include <iostream>
+#include <iterator>
+#include <thread>
+
+#include <gtest/gtest.h>
+#include "amd_smi/amdsmi.h"
+#include "gpu_metrics_rates_read.h"
+#include "../test_common.h"
+
+TestGpuMetricsRatesRead::TestGpuMetricsRatesRead() : TestBase() {
+  set_title("AMDSMI GPU Metrics Rates Read Test");
+  set_description("The GPU Metrics Rates Read tests verifies that the rates of the "
+                  "gpu metrics accumulators can be read properly.");
+}
+
+TestGpuMetricsRatesRead::~TestGpuMetricsRatesRead(void) {
+}
+
+void TestGpuMetricsRatesRead::SetUp(void) {
+  TestBase::SetUp();
+
+  return;
+}
+
+void TestGpuMetricsRatesRead::DisplayTestInfo(void) {
+  TestBase::DisplayTestInfo();
+}
+
+void TestGpuMetricsRatesRead::DisplayResults(void) const {
+  TestBase::DisplayResults();
+  return;
+}
+
+void TestGpuMetricsRatesRead::Close() {
+  // This will close handles opened within amdsmitst utility calls and call
+  // amdsmi_shut_down(), so it should be done after other hsa cleanup
+  TestBase::Close();
+}
+
+void TestGpuMetricsRatesRead::Run(void) {
+  amdsmi_status_t err;
+
+  TestBase::Run();
+  if (setup_failed_) {
+    std::cout << "** SetUp Failed for this test. Skipping.**" << std::endl;
+    return;
+  }
+  if (num_monitor_devs() == 0) {
+    return;
+  }
+
+  for (uint32_t i = 0; i < num_monitor_devs(); ++i) {
+    const amdsmi_gpu_metric_field_t rate_fields[] = {
+      AMDSMI_GPU_METRIC_ENERGY_ACC,
+      AMDSMI_GPU_METRIC_XGMI_READ_DATA_ACC,
+      AMDSMI_GPU_METRIC_PPT_RESIDENCY_ACC,
+    };
+    const uint32_t num_rate_fields = static_cast<uint32_t>(std::size(rate_fields));
+    amdsmi_gpu_metric_rate_t rates[num_rate_fields] = {};
+
+    err = amdsmi_reset_gpu_metrics_rates(processor_handles_[i]);
+    CHK_ERR_ASRT(err);
+    err = amdsmi_get_gpu_metrics_rates(processor_handles_[i], rate_fields, num_rate_fields,
+                                       rates);
+    if (err == AMDSMI_STATUS_NOT_SUPPORTED) {
+      continue;
+    }
+    CHK_ERR_ASRT(err);
+    for (const auto& rate : rates) {
+      // Nothing to compare the first read with
+      ASSERT_NE(rate.status, AMDSMI_STATUS_SUCCESS);
+    }
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    err = amdsmi_get_gpu_metrics_rates(processor_handles_[i], rate_fields, num_rate_fields,
+                                       rates);
+    CHK_ERR_ASRT(err);
+    if (rates[0].status == AMDSMI_STATUS_SUCCESS) {
+      ASSERT_GT(rates[0].interval_ns, 0u);
+      ASSERT_GE(rates[0].rate[0], 0.0);
+      IF_VERB(STANDARD) {
+        std::cout << "\t\t** Power from energy accumulator: " << rates[0].rate[0]
+                  << " W (average " << rates[0].ewma_rate[0] << " W)\n";
+      }
+    }
+    if (rates[2].status == AMDSMI_STATUS_SUCCESS) {
+      ASSERT_GE(rates[2].rate[0], 0.0);
+      ASSERT_LE(rates[2].rate[0], 100.0);
+    }
+
+    // Only accumulators have a rate
+    const amdsmi_gpu_metric_field_t temp_field = AMDSMI_GPU_METRIC_TEMP_HOTSPOT;
+    err = amdsmi_get_gpu_metrics_rates(processor_handles_[i], &temp_field, 1, rates);
+    ASSERT_EQ(err, AMDSMI_STATUS_INVAL);
+  }
+}
@@ -381,6 +381,83 @@ void TestGpuMetricsRead::Run(void) {
     std::cout << "\t\t** amdsmi_get_gpu_metrics_info(nullptr check): " << status_string << "\n";
     ASSERT_EQ(err, AMDSMI_STATUS_INVAL);
 
+    // Snapshot cache: within the max age, reads must return the same snapshot
+    err = amdsmi_refresh_gpu_metrics_cache(processor_handles_[i]);
+    amdsmi_status_code_to_string(err, &status_string);
+    std::cout << "\t\t** amdsmi_refresh_gpu_metrics_cache(): " << status_string << "\n";
+    if (err == AMDSMI_STATUS_SUCCESS) {
+      constexpr uint32_t kMAX_AGE_MS = 60000;
+      uint32_t max_age_ms = 0;
+      err = amdsmi_set_gpu_metrics_cache_max_age(processor_handles_[i], kMAX_AGE_MS);
+      CHK_ERR_ASRT(err);
+      err = amdsmi_get_gpu_metrics_cache_max_age(processor_handles_[i], &max_age_ms);
+      CHK_ERR_ASRT(err);
+      ASSERT_EQ(max_age_ms, kMAX_AGE_MS);
+
+      amdsmi_gpu_metrics_t cached_a = {};
+      amdsmi_gpu_metrics_t cached_b = {};
+      err = amdsmi_get_gpu_metrics_info(processor_handles_[i], &cached_a);
+      CHK_ERR_ASRT(err);
+      err = amdsmi_get_gpu_metrics_info(processor_handles_[i], &cached_b);
+      CHK_ERR_ASRT(err);
+      ASSERT_EQ(cached_a.firmware_timestamp, cached_b.firmware_timestamp);
+      ASSERT_EQ(cached_a.system_clock_counter, cached_b.system_clock_counter);
+
+      err = amdsmi_invalidate_gpu_metrics_cache(processor_handles_[i]);
+      CHK_ERR_ASRT(err);
+      err = amdsmi_get_gpu_metrics_info(processor_handles_[i], &cached_b);
+      CHK_ERR_ASRT(err);
+      IF_VERB(STANDARD) {
+        std::cout << "\t\t -> firmware_timestamp [cached]: " << cached_a.firmware_timestamp
+                  << " [invalidated]: " << cached_b.firmware_timestamp << "\n";
+      }
+
+      // Batched field query must agree with the full metrics table
+      const amdsmi_gpu_metric_field_t metric_fields[] = {
+        AMDSMI_GPU_METRIC_FIRMWARE_TIMESTAMP,
+        AMDSMI_GPU_METRIC_SYSTEM_CLOCK_COUNTER,
+        AMDSMI_GPU_METRIC_TEMP_HOTSPOT,
+        AMDSMI_GPU_METRIC_CURR_GFXCLK,
+      };
+      constexpr uint32_t kNUM_FIELDS = static_cast<uint32_t>(std::size(metric_fields));
+      amdsmi_gpu_metric_field_value_t metric_values[kNUM_FIELDS] = {};
+      err = amdsmi_get_gpu_metrics_fields(processor_handles_[i], metric_fields,
+                                          kNUM_FIELDS, metric_values);
+      amdsmi_status_code_to_string(err, &status_string);
+      std::cout << "\t\t** amdsmi_get_gpu_metrics_fields(): " << status_string << "\n";
+      CHK_ERR_ASRT(err);
+      if (metric_values[0].status == AMDSMI_STATUS_SUCCESS) {
+        ASSERT_EQ(metric_values[0].num_values, 1U);
+        ASSERT_EQ(metric_values[0].values[0], cached_b.firmware_timestamp);
+      }
+      if (metric_values[1].status == AMDSMI_STATUS_SUCCESS) {
+        ASSERT_EQ(metric_values[1].values[0], cached_b.system_clock_counter);
+      }
+      if (metric_values[2].status == AMDSMI_STATUS_SUCCESS) {
+        ASSERT_EQ(metric_values[2].values[0], cached_b.temperature_hotspot);
+      }
+      if (metric_values[3].status == AMDSMI_STATUS_SUCCESS) {
+        ASSERT_EQ(metric_values[3].values[0], cached_b.current_gfxclk);
+      }
+
+      err = amdsmi_get_gpu_metrics_fields(processor_handles_[i], nullptr,
+                                          kNUM_FIELDS, metric_values);
+      ASSERT_EQ(err, AMDSMI_STATUS_INVAL);
+      err = amdsmi_get_gpu_metrics_fields(processor_handles_[i], metric_fields,
+                                          0, metric_values);
+      ASSERT_EQ(err, AMDSMI_STATUS_INVAL);
+      const auto bad_field =
+          static_cast<amdsmi_gpu_metric_field_t>(AMDSMI_GPU_METRIC__MAX + 1);
+      err = amdsmi_get_gpu_metrics_fields(processor_handles_[i], &bad_field,
+                                          1, metric_values);
+      ASSERT_EQ(err, AMDSMI_STATUS_INVAL);
+
+      err = amdsmi_set_gpu_metrics_cache_max_age(processor_handles_[i], 0);
+      CHK_ERR_ASRT(err);
+      err = amdsmi_get_gpu_metrics_cache_max_age(processor_handles_[i], nullptr);
+      ASSERT_EQ(err, AMDSMI_STATUS_INVAL);
+    }
+
 
     // TODO(AMD_SMI_team): add xcd_counter_get for amd smi
     // auto temp_xcd_counter_value = uint16_t(0);
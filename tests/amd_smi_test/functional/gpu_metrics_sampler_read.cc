@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include <chrono>
+#include <iostream>
+#include <iterator>
+#include <limits>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include "amd_smi/amdsmi.h"
+#include "gpu_metrics_sampler_read.h"
+#include "../test_common.h"
+
+TestGpuMetricsSamplerRead::TestGpuMetricsSamplerRead() : TestBase() {
+  set_title("AMDSMI GPU Metrics Sampler Read Test");
+  set_description("The GPU Metrics Sampler Read tests verifies that the background "
+                  "sampler keeps the latest samples and history of each device.");
+}
+
+TestGpuMetricsSamplerRead::~TestGpuMetricsSamplerRead(void) {
+}
+
+void TestGpuMetricsSamplerRead::SetUp(void) {
+  TestBase::SetUp();
+
+  return;
+}
+
+void TestGpuMetricsSamplerRead::DisplayTestInfo(void) {
+  TestBase::DisplayTestInfo();
+}
+
+void TestGpuMetricsSamplerRead::DisplayResults(void) const {
+  TestBase::DisplayResults();
+  return;
+}
+
+void TestGpuMetricsSamplerRead::Close() {
+  // This will close handles opened within amdsmitst utility calls and call
+  // amdsmi_shut_down(), so it should be done after other hsa cleanup
+  TestBase::Close();
+}
+
+void TestGpuMetricsSamplerRead::Run(void) {
+  amdsmi_status_t err;
+
+  TestBase::Run();
+  if (setup_failed_) {
+    std::cout << "** SetUp Failed for this test. Skipping.**" << std::endl;
+    return;
+  }
+  if (num_monitor_devs() == 0) {
+    return;
+  }
+
+  const amdsmi_gpu_metric_field_t sampler_fields[] = {
+    AMDSMI_GPU_METRIC_TEMP_HOTSPOT,
+    AMDSMI_GPU_METRIC_AVG_GFX_ACTIVITY,
+    AMDSMI_GPU_METRIC_ENERGY_ACC,
+  };
+  const uint32_t num_sampler_fields = static_cast<uint32_t>(std::size(sampler_fields));
+  const uint32_t sampler_depth = 8;
+  err = amdsmi_sampler_start(10000, sampler_fields, num_sampler_fields, sampler_depth);
+  const char *status_string;
+  amdsmi_status_code_to_string(err, &status_string);
+  std::cout << "\t** amdsmi_sampler_start(): " << status_string << "\n";
+  CHK_ERR_ASRT(err);
+  std::this_thread::sleep_for(std::chrono::milliseconds(200));
+
+  for (uint32_t i = 0; i < num_monitor_devs(); ++i) {
+    uint64_t timestamp_ns = 0;
+    std::vector<amdsmi_gpu_metric_field_value_t> latest(num_sampler_fields);
+    err = amdsmi_sampler_get_latest(processor_handles_[i], &timestamp_ns,
+                                    latest.data(), num_sampler_fields);
+    CHK_ERR_ASRT(err);
+    ASSERT_NE(timestamp_ns, 0u);
+
+    uint32_t num_samples = sampler_depth;
+    std::vector<uint64_t> timestamps_ns(num_samples);
+    std::vector<amdsmi_gpu_metric_field_value_t> history(num_samples * num_sampler_fields);
+    err = amdsmi_sampler_get_history(processor_handles_[i], &num_samples,
+                                     timestamps_ns.data(), history.data(),
+                                     num_sampler_fields);
+    CHK_ERR_ASRT(err);
+    ASSERT_GT(num_samples, 0u);
+    ASSERT_LE(num_samples, sampler_depth);
+    for (uint32_t s = 1; s < num_samples; ++s) {
+      ASSERT_LT(timestamps_ns[s - 1], timestamps_ns[s]);
+    }
+    IF_VERB(STANDARD) {
+      std::cout << "\t\t** Sampler: " << num_samples << " samples, latest at "
+                << timestamp_ns << " ns\n";
+    }
+
+    // Number of fields must match the sampled fields
+    err = amdsmi_sampler_get_latest(processor_handles_[i], &timestamp_ns,
+                                    latest.data(), num_sampler_fields - 1);
+    ASSERT_EQ(err, AMDSMI_STATUS_INVAL);
+  }
+
+  err = amdsmi_sampler_stop();
+  CHK_ERR_ASRT(err);
+  uint64_t timestamp_ns = 0;
+  std::vector<amdsmi_gpu_metric_field_value_t> latest(num_sampler_fields);
+  err = amdsmi_sampler_get_latest(processor_handles_[0], &timestamp_ns,
+                                  latest.data(), num_sampler_fields);
+  ASSERT_EQ(err, AMDSMI_STATUS_NO_DATA);
+  err = amdsmi_sampler_start(0, sampler_fields, num_sampler_fields, sampler_depth);
+  ASSERT_EQ(err, AMDSMI_STATUS_INVAL);
+  err = amdsmi_sampler_start(10000, sampler_fields, num_sampler_fields,
+                             AMDSMI_MAX_SAMPLER_HISTORY_DEPTH + 1);
+  ASSERT_EQ(err, AMDSMI_STATUS_INVAL);
+  err = amdsmi_sampler_start(10000, sampler_fields, num_sampler_fields,
+                             std::numeric_limits<uint32_t>::max());
+  ASSERT_EQ(err, AMDSMI_STATUS_INVAL);
+}
@@ -105,6 +105,18 @@ void TestIdInfoRead::Run(void) {
     err = amdsmi_get_gpu_asic_info(processor_handles_[0], &asic_info);
     CHK_ERR_ASRT(err)
 
+    // Served from memory on repeated calls; must read back the same
+    amdsmi_asic_info_t asic_info_again;
+    err = amdsmi_get_gpu_asic_info(processor_handles_[0], &asic_info_again);
+    CHK_ERR_ASRT(err)
+    ASSERT_EQ(asic_info.vendor_id, asic_info_again.vendor_id);
+    ASSERT_EQ(asic_info.device_id, asic_info_again.device_id);
+    ASSERT_EQ(asic_info.rev_id, asic_info_again.rev_id);
+    ASSERT_EQ(std::string(asic_info.market_name),
+              std::string(asic_info_again.market_name));
+    ASSERT_EQ(std::string(asic_info.asic_serial),
+              std::string(asic_info_again.asic_serial));
+
     // device name, brand, serial_number
     amdsmi_board_info_t board_info;
     err = amdsmi_get_gpu_board_info(processor_handles_[0], &board_info);
@@ -193,6 +205,27 @@ void TestIdInfoRead::Run(void) {
       ASSERT_EQ(err, AMDSMI_STATUS_INVAL);
     }
 
+    // Nothing changes the device while it is read, so neither does its
+    // generation
+    uint64_t generation = 0;
+    err = amdsmi_get_gpu_generation(processor_handles_[i], &generation);
+    if (err == AMDSMI_STATUS_NOT_SUPPORTED) {
+      std::cout << "\t**Device changes are not watched on this system." <<
+                                                                    std::endl;
+    } else {
+      CHK_ERR_ASRT(err)
+      IF_VERB(STANDARD) {
+        std::cout << "\t**Device generation: " << std::dec << generation
+                  << std::endl;
+      }
+      uint64_t generation_again = 0;
+      err = amdsmi_get_gpu_generation(processor_handles_[i], &generation_again);
+      CHK_ERR_ASRT(err)
+      ASSERT_EQ(generation, generation_again);
+    }
+    err = amdsmi_get_gpu_generation(processor_handles_[i], nullptr);
+    ASSERT_EQ(err, AMDSMI_STATUS_INVAL);
+
     IF_VERB(STANDARD) {
         std::cout << "\t**Sub-system Vendor ID: 0x" << std::hex <<
                                             asic_info.subvendor_id << std::endl;
@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include <iostream>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include "amd_smi/amdsmi.h"
+#include "lib_lock_stats_read.h"
+#include "../test_common.h"
+
+TestLibLockStatsRead::TestLibLockStatsRead() : TestBase() {
+  set_title("AMDSMI Library Lock Stats Read Test");
+  set_description("The Library Lock Stats Read tests verifies that the lock wait "
+                  "statistics can be enabled, read and reset properly.");
+}
+
+TestLibLockStatsRead::~TestLibLockStatsRead(void) {
+}
+
+void TestLibLockStatsRead::SetUp(void) {
+  TestBase::SetUp();
+
+  return;
+}
+
+void TestLibLockStatsRead::DisplayTestInfo(void) {
+  TestBase::DisplayTestInfo();
+}
+
+void TestLibLockStatsRead::DisplayResults(void) const {
+  TestBase::DisplayResults();
+  return;
+}
+
+void TestLibLockStatsRead::Close() {
+  // This will close handles opened within amdsmitst utility calls and call
+  // amdsmi_shut_down(), so it should be done after other hsa cleanup
+  TestBase::Close();
+}
+
+void TestLibLockStatsRead::Run(void) {
+  amdsmi_status_t err;
+
+  TestBase::Run();
+  if (setup_failed_) {
+    std::cout << "** SetUp Failed for this test. Skipping.**" << std::endl;
+    return;
+  }
+  if (num_monitor_devs() == 0) {
+    return;
+  }
+
+  err = amdsmi_reset_lib_lock_stats();
+  CHK_ERR_ASRT(err);
+  err = amdsmi_set_lib_lock_stats_enabled(true);
+  CHK_ERR_ASRT(err);
+  amdsmi_dev_perf_level_t perf_level;
+  auto perf_level_err = amdsmi_get_gpu_perf_level(processor_handles_[0], &perf_level);
+  err = amdsmi_set_lib_lock_stats_enabled(false);
+  CHK_ERR_ASRT(err);
+
+  uint32_t num_stats = 0;
+  err = amdsmi_get_lib_lock_stats(&num_stats, nullptr);
+  CHK_ERR_ASRT(err);
+  std::vector<amdsmi_lib_lock_stats_t> stats(num_stats);
+  err = amdsmi_get_lib_lock_stats(&num_stats, stats.data());
+  CHK_ERR_ASRT(err);
+  bool is_found = false;
+  for (uint32_t i = 0; i < num_stats; ++i) {
+    IF_VERB(STANDARD) {
+      std::cout << "\tlock " << stats[i].lock << " gpu " << stats[i].gpu_index
+                << ": " << stats[i].acquisitions << " acquired, "
+                << stats[i].contended << " contended, " << stats[i].max_wait_ns
+                << " ns max wait\n";
+    }
+    ASSERT_LE(stats[i].contended, stats[i].acquisitions);
+    ASSERT_LE(stats[i].p50_wait_ns, stats[i].max_wait_ns);
+    ASSERT_LE(stats[i].p99_wait_ns, stats[i].max_wait_ns);
+    uint64_t waits = 0;
+    for (auto count : stats[i].wait_histogram) {
+      waits += count;
+    }
+    ASSERT_EQ(waits, stats[i].contended + stats[i].failures);
+    if ((stats[i].lock == AMDSMI_LIB_LOCK_DEVICE ||
+         stats[i].lock == AMDSMI_LIB_LOCK_DEVICE_CROSS_PROCESS) &&
+        stats[i].gpu_index == 0) {
+      is_found = true;
+      ASSERT_GT(stats[i].acquisitions, 0u);
+      ASSERT_EQ(stats[i].holders, 0u);
+      ASSERT_EQ(stats[i].held_ns, 0u);
+    }
+  }
+  if (perf_level_err != AMDSMI_STATUS_NOT_SUPPORTED) {
+    ASSERT_TRUE(is_found);
+  }
+
+  // Only locks held right now, if any, are left after a reset
+  err = amdsmi_reset_lib_lock_stats();
+  CHK_ERR_ASRT(err);
+  std::vector<amdsmi_lib_lock_stats_t> held_stats(16);
+  num_stats = static_cast<uint32_t>(held_stats.size());
+  err = amdsmi_get_lib_lock_stats(&num_stats, held_stats.data());
+  CHK_ERR_ASRT(err);
+  for (uint32_t i = 0; i < num_stats; ++i) {
+    ASSERT_EQ(held_stats[i].acquisitions, 0u);
+    ASSERT_GT(held_stats[i].holders, 0u);
+  }
+  err = amdsmi_get_lib_lock_stats(nullptr, nullptr);
+  ASSERT_EQ(err, AMDSMI_STATUS_INVAL);
+}
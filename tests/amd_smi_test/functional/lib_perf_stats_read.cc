@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include "amd_smi/amdsmi.h"
+#include "lib_perf_stats_read.h"
+#include "../test_common.h"
+
+TestLibPerfStatsRead::TestLibPerfStatsRead() : TestBase() {
+  set_title("AMDSMI Library Perf Stats Read Test");
+  set_description("The Library Perf Stats Read tests verifies that the library "
+                  "performance counters can be enabled, read and reset properly.");
+}
+
+TestLibPerfStatsRead::~TestLibPerfStatsRead(void) {
+}
+
+void TestLibPerfStatsRead::SetUp(void) {
+  TestBase::SetUp();
+
+  return;
+}
+
+void TestLibPerfStatsRead::DisplayTestInfo(void) {
+  TestBase::DisplayTestInfo();
+}
+
+void TestLibPerfStatsRead::DisplayResults(void) const {
+  TestBase::DisplayResults();
+  return;
+}
+
+void TestLibPerfStatsRead::Close() {
+  // This will close handles opened within amdsmitst utility calls and call
+  // amdsmi_shut_down(), so it should be done after other hsa cleanup
+  TestBase::Close();
+}
+
+void TestLibPerfStatsRead::Run(void) {
+  amdsmi_status_t err;
+
+  TestBase::Run();
+  if (setup_failed_) {
+    std::cout << "** SetUp Failed for this test. Skipping.**" << std::endl;
+    return;
+  }
+  if (num_monitor_devs() == 0) {
+    return;
+  }
+
+  err = amdsmi_reset_lib_perf_stats();
+  CHK_ERR_ASRT(err);
+  err = amdsmi_set_lib_perf_stats_enabled(true);
+  CHK_ERR_ASRT(err);
+  amdsmi_gpu_metrics_t metrics = {};
+  auto metrics_err = amdsmi_get_gpu_metrics_info(processor_handles_[0], &metrics);
+  err = amdsmi_set_lib_perf_stats_enabled(false);
+  CHK_ERR_ASRT(err);
+
+  uint32_t num_stats = 0;
+  err = amdsmi_get_lib_perf_stats(&num_stats, nullptr);
+  CHK_ERR_ASRT(err);
+  ASSERT_GT(num_stats, 0u);
+  std::vector<amdsmi_lib_perf_stats_t> stats(num_stats);
+  err = amdsmi_get_lib_perf_stats(&num_stats, stats.data());
+  CHK_ERR_ASRT(err);
+  bool is_found = false;
+  for (uint32_t i = 0; i < num_stats; ++i) {
+    IF_VERB(STANDARD) {
+      std::cout << "\t" << stats[i].api << " gpu " << stats[i].gpu_index
+                << ": " << stats[i].calls << " calls, " << stats[i].total_ns
+                << " ns, " << stats[i].file_reads << " reads\n";
+    }
+    if (std::string(stats[i].api) == "amdsmi_get_gpu_metrics_info") {
+      is_found = true;
+      ASSERT_EQ(stats[i].calls, 1u);
+      ASSERT_LE(stats[i].min_ns, stats[i].p50_ns);
+      ASSERT_LE(stats[i].p99_ns, stats[i].max_ns);
+      if (metrics_err == AMDSMI_STATUS_SUCCESS) {
+        ASSERT_GT(stats[i].file_reads, 0u);
+      }
+    }
+  }
+  ASSERT_TRUE(is_found);
+
+  // Nothing is collected while disabled
+  err = amdsmi_get_gpu_metrics_info(processor_handles_[0], &metrics);
+  uint32_t num_stats_disabled = 0;
+  err = amdsmi_get_lib_perf_stats(&num_stats_disabled, nullptr);
+  CHK_ERR_ASRT(err);
+  ASSERT_EQ(num_stats_disabled, num_stats);
+
+  err = amdsmi_reset_lib_perf_stats();
+  CHK_ERR_ASRT(err);
+  err = amdsmi_get_lib_perf_stats(&num_stats, nullptr);
+  CHK_ERR_ASRT(err);
+  ASSERT_EQ(num_stats, 0u);
+  err = amdsmi_get_lib_perf_stats(nullptr, nullptr);
+  ASSERT_EQ(err, AMDSMI_STATUS_INVAL);
+}
@@ -26,6 +26,8 @@
 #include <iostream>
 #include <string>
 #include <map>
+#include <vector>
+#include <thread>
 
 #include <gtest/gtest.h>
 #include "amd_smi/amdsmi.h"
@@ -123,4 +125,62 @@ void TestMemUtilRead::Run(void) {
       }
     }
   }
+
+  // A snapshot of all devices should match the single attribute reads
+  std::vector<amdsmi_gpu_sysfs_snapshot_t> snapshots(num_monitor_devs());
+  err = amdsmi_get_gpu_sysfs_snapshot(processor_handles_, num_monitor_devs(),
+                                      snapshots.data());
+  CHK_ERR_ASRT(err)
+  for (uint32_t i = 0; i < num_monitor_devs(); ++i) {
+    PrintDeviceHeader(processor_handles_[i]);
+    if (snapshots[i].status != AMDSMI_STATUS_SUCCESS) {
+      IF_VERB(STANDARD) {
+        std::cout << "\t** amdsmi_get_gpu_sysfs_snapshot(): Not supported on "
+                     "this machine" << std::endl;
+      }
+      continue;
+    }
+    err = amdsmi_get_gpu_memory_total(processor_handles_[i],
+                                      AMDSMI_MEM_TYPE_VRAM, &total);
+    if (err == AMDSMI_STATUS_SUCCESS) {
+      ASSERT_EQ(snapshots[i].vram_total, total);
+    }
+    IF_VERB(STANDARD) {
+      std::cout << "\t**Snapshot VRAM: " << snapshots[i].vram_used << "/"
+                << snapshots[i].vram_total << ", GTT: " << snapshots[i].gtt_used
+                << "/" << snapshots[i].gtt_total << std::endl;
+    }
+  }
+
+  // DRM queries to different devices run concurrently; each must read the
+  // same as when queried alone
+  std::vector<amdsmi_vram_usage_t> usages(num_monitor_devs());
+  std::vector<amdsmi_status_t> rets(num_monitor_devs());
+  for (uint32_t i = 0; i < num_monitor_devs(); ++i) {
+    rets[i] = amdsmi_get_gpu_vram_usage(processor_handles_[i], &usages[i]);
+  }
+  std::vector<std::thread> threads;
+  std::vector<amdsmi_status_t> thread_rets(num_monitor_devs(),
+                                           AMDSMI_STATUS_SUCCESS);
+  for (uint32_t i = 0; i < num_monitor_devs(); ++i) {
+    threads.emplace_back([&, i]() {
+      for (int n = 0; n < 100 && thread_rets[i] == AMDSMI_STATUS_SUCCESS; ++n) {
+        amdsmi_vram_usage_t usage;
+        thread_rets[i] = amdsmi_get_gpu_vram_usage(processor_handles_[i],
+                                                   &usage);
+        if (thread_rets[i] == AMDSMI_STATUS_SUCCESS &&
+            usage.vram_total != usages[i].vram_total) {
+          thread_rets[i] = AMDSMI_STATUS_UNEXPECTED_DATA;
+        }
+      }
+    });
+  }
+  for (auto &t : threads) {
+    t.join();
+  }
+  for (uint32_t i = 0; i < num_monitor_devs(); ++i) {
+    if (rets[i] == AMDSMI_STATUS_SUCCESS) {
+      ASSERT_EQ(thread_rets[i], AMDSMI_STATUS_SUCCESS);
+    }
+  }
 }
@@ -27,6 +27,8 @@
 #include <bitset>
 #include <string>
 #include <algorithm>
+#include <chrono>
+#include <thread>
 
 #include <gtest/gtest.h>
 #include "amd_smi/amdsmi.h"
@@ -121,6 +123,48 @@ void TestPciReadWrite::Run(void) {
       std::cout << std::endl;
     }
 
+    // The first call starts the background measurement; a window
+    // completes about a second later.
+    uint64_t age_ms = 0;
+    ret = amdsmi_get_gpu_pci_throughput_latest(processor_handles_[dv_ind],
+                                     &sent, &received, &max_pkt_sz, &age_ms);
+    for (int retry = 0; (ret == AMDSMI_STATUS_NO_DATA) && (retry < 30); ++retry) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(100));
+      ret = amdsmi_get_gpu_pci_throughput_latest(processor_handles_[dv_ind],
+                                     &sent, &received, &max_pkt_sz, &age_ms);
+    }
+    CHK_ERR_ASRT(ret)
+    IF_VERB(STANDARD) {
+      std::cout << "\tLast PCIe Throughput Window (" << age_ms
+                << " ms old): " << std::endl;
+      std::cout << "\t\tSent: " << sent << " bytes" << std::endl;
+      std::cout << "\t\tReceived: " << received << " bytes" << std::endl;
+    }
+    // Measurements are back to back, so the window can't be much older
+    // than one window
+    ASSERT_LT(age_ms, 3000u);
+    ret = amdsmi_get_gpu_pci_throughput_latest(processor_handles_[dv_ind],
+                                     &sent, &received, &max_pkt_sz, nullptr);
+    ASSERT_EQ(ret, AMDSMI_STATUS_INVAL);
+
+    // Queries lock the device shared, so one on the same GPU must not wait
+    // for a blocking throughput measurement to finish
+    std::thread measurement([&]() {
+      uint64_t dmy_sent, dmy_received, dmy_max_pkt_sz;
+      (void)amdsmi_get_gpu_pci_throughput(processor_handles_[dv_ind],
+                                &dmy_sent, &dmy_received, &dmy_max_pkt_sz);
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    auto query_start = std::chrono::steady_clock::now();
+    amdsmi_dev_perf_level_t perf_level;
+    ret = amdsmi_get_gpu_perf_level(processor_handles_[dv_ind], &perf_level);
+    auto query_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+                        std::chrono::steady_clock::now() - query_start).count();
+    measurement.join();
+    if (ret == AMDSMI_STATUS_SUCCESS) {
+      ASSERT_LT(query_ms, 500);
+    }
+
     ret = amdsmi_get_gpu_pci_bandwidth(processor_handles_[dv_ind], &bw);
     if (ret == AMDSMI_STATUS_NOT_SUPPORTED) {
       std::cout << "WARNING: Current PCIe bandwidth is not detected. "
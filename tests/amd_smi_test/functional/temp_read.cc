@@ -143,6 +143,33 @@ void TestTempRead::Run(void) {
         print_temp_metric(AMDSMI_TEMP_LOWEST, "Historical minimum temperature");
         print_temp_metric(AMDSMI_TEMP_HIGHEST, "Historical maximum temperature");
       }
+
+      // The hwmon snapshot should have every temperature the single
+      // sensor reads have
+      amdsmi_gpu_hwmon_snapshot_t snapshot;
+      err = amdsmi_get_gpu_hwmon_snapshot(processor_handles_[i], &snapshot);
+      if (err == AMDSMI_STATUS_NOT_SUPPORTED) {
+        IF_VERB(STANDARD) {
+          std::cout << "\t** amdsmi_get_gpu_hwmon_snapshot(): Not supported "
+                       "on this machine" << std::endl;
+        }
+        continue;
+      }
+      CHK_ERR_ASRT(err)
+      for (type = AMDSMI_TEMPERATURE_TYPE_FIRST;
+           type <= AMDSMI_TEMPERATURE_TYPE_VRAM; ++type) {
+        err = amdsmi_get_temp_metric(processor_handles_[i],
+                                     static_cast<amdsmi_temperature_type_t>(type),
+                                     AMDSMI_TEMP_CURRENT, &val_i64);
+        if (err == AMDSMI_STATUS_SUCCESS) {
+          ASSERT_NE(snapshot.temperature[type], INT64_MAX);
+        }
+        IF_VERB(STANDARD) {
+          std::cout << "\t**Snapshot " << kTempSensorNameMap.at(type)
+                    << " Temp.: " << snapshot.temperature[type] << "C"
+                    << std::endl;
+        }
+      }
     }
   }  // x
 }
@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include <iostream>
+#include <limits>
+
+#include <gtest/gtest.h>
+#include "amd_smi/amdsmi.h"
+#include "violation_status_read.h"
+#include "../test_common.h"
+
+TestViolationStatusRead::TestViolationStatusRead() : TestBase() {
+  set_title("AMDSMI Violation Status Read Test");
+  set_description("The Violation Status Read tests verifies that the violation status "
+                  "is computed against the samples kept from the previous calls.");
+}
+
+TestViolationStatusRead::~TestViolationStatusRead(void) {
+}
+
+void TestViolationStatusRead::SetUp(void) {
+  TestBase::SetUp();
+
+  return;
+}
+
+void TestViolationStatusRead::DisplayTestInfo(void) {
+  TestBase::DisplayTestInfo();
+}
+
+void TestViolationStatusRead::DisplayResults(void) const {
+  TestBase::DisplayResults();
+  return;
+}
+
+void TestViolationStatusRead::Close() {
+  // This will close handles opened within amdsmitst utility calls and call
+  // amdsmi_shut_down(), so it should be done after other hsa cleanup
+  TestBase::Close();
+}
+
+void TestViolationStatusRead::Run(void) {
+  amdsmi_status_t err;
+
+  TestBase::Run();
+  if (setup_failed_) {
+    std::cout << "** SetUp Failed for this test. Skipping.**" << std::endl;
+    return;
+  }
+  if (num_monitor_devs() == 0) {
+    return;
+  }
+
+  // Only the first call waits for a second sample; the next ones compare
+  // against the samples kept from the calls before
+  for (uint32_t i = 0; i < num_monitor_devs(); ++i) {
+    amdsmi_violation_status_t first_status = {};
+    err = amdsmi_get_violation_status(processor_handles_[i], &first_status);
+    if (err == AMDSMI_STATUS_NOT_SUPPORTED) {
+      continue;
+    }
+    CHK_ERR_ASRT(err);
+    // Nothing is kept without an accumulation counter
+    if (first_status.acc_counter == std::numeric_limits<uint64_t>::max()) {
+      continue;
+    }
+
+    amdsmi_violation_status_t second_status = {};
+    err = amdsmi_get_violation_status(processor_handles_[i], &second_status);
+    CHK_ERR_ASRT(err);
+    IF_VERB(STANDARD) {
+      std::cout << "\t\t** Violation status accumulation counter: "
+                << first_status.acc_counter << ", then "
+                << second_status.acc_counter << "\n";
+    }
+    ASSERT_GE(second_status.acc_counter, first_status.acc_counter);
+    if (second_status.acc_counter != first_status.acc_counter) {
+      continue;
+    }
+    // No new firmware sample in between: the same window is reported
+    ASSERT_EQ(second_status.violation_timestamp, first_status.violation_timestamp);
+    ASSERT_EQ(second_status.acc_prochot_thrm, first_status.acc_prochot_thrm);
+    ASSERT_EQ(second_status.acc_ppt_pwr, first_status.acc_ppt_pwr);
+    ASSERT_EQ(second_status.acc_socket_thrm, first_status.acc_socket_thrm);
+    ASSERT_EQ(second_status.per_prochot_thrm, first_status.per_prochot_thrm);
+    ASSERT_EQ(second_status.per_ppt_pwr, first_status.per_ppt_pwr);
+    ASSERT_EQ(second_status.per_socket_thrm, first_status.per_socket_thrm);
+    ASSERT_EQ(second_status.per_vr_thrm, first_status.per_vr_thrm);
+    ASSERT_EQ(second_status.per_hbm_thrm, first_status.per_hbm_thrm);
+    ASSERT_EQ(second_status.per_gfx_clk_below_host_limit,
+              first_status.per_gfx_clk_below_host_limit);
+  }
+}
@@ -41,6 +41,13 @@
 #include "functional/process_info_read.h"
 #include "functional/gpu_busy_read.h"
 #include "functional/gpu_metrics_read.h"
+#include "functional/gpu_metrics_bulk_read.h"
+#include "functional/gpu_metrics_sampler_read.h"
+#include "functional/gpu_metrics_rates_read.h"
+#include "functional/violation_status_read.h"
+#include "functional/async_query_read.h"
+#include "functional/lib_lock_stats_read.h"
+#include "functional/lib_perf_stats_read.h"
 #include "functional/err_cnt_read.h"
 #include "functional/power_read.h"
 #include "functional/power_read_write.h"
@@ -220,6 +227,34 @@ TEST(amdsmitstReadOnly, TestGpuMetricsRead) {
   TestGpuMetricsRead tst;
   RunGenericTest(&tst);
 }
+TEST(amdsmitstReadOnly, TestGpuMetricsBulkRead) {
+  TestGpuMetricsBulkRead tst;
+  RunGenericTest(&tst);
+}
+TEST(amdsmitstReadOnly, TestGpuMetricsSamplerRead) {
+  TestGpuMetricsSamplerRead tst;
+  RunGenericTest(&tst);
+}
+TEST(amdsmitstReadOnly, TestGpuMetricsRatesRead) {
+  TestGpuMetricsRatesRead tst;
+  RunGenericTest(&tst);
+}
+TEST(amdsmitstReadOnly, TestViolationStatusRead) {
+  TestViolationStatusRead tst;
+  RunGenericTest(&tst);
+}
+TEST(amdsmitstReadOnly, TestLibPerfStatsRead) {
+  TestLibPerfStatsRead tst;
+  RunGenericTest(&tst);
+}
+TEST(amdsmitstReadOnly, TestLibLockStatsRead) {
+  TestLibLockStatsRead tst;
+  RunGenericTest(&tst);
+}
+TEST(amdsmitstReadOnly, TestAsyncQueryRead) {
+  TestAsyncQueryRead tst;
+  RunGenericTest(&tst);
+}
 TEST(amdsmitstReadOnly, TestMetricsCounterRead) {
   TestMetricsCounterRead tst;
   RunGenericTest(&tst);
@@ -34,20 +34,51 @@ THE SOFTWARE.
 #include <string.h>  // strcpy
 #include <time.h>   // clock_gettime
 #include <assert.h>
+#include <limits.h>  // INT_MAX
+#include <linux/futex.h>  // FUTEX_WAIT, FUTEX_WAKE
+#include <signal.h>  // kill
+#include <sys/stat.h>  // stat
+#include <sys/syscall.h>  // SYS_futex
 
 #include <sys/types.h>
-#include <dirent.h>
 #include <algorithm>
-#include <string>
-#include <vector>
+#include <iterator>
 
 #include "rocm_smi/rocm_smi_exception.h"
 #include "rocm_smi/rocm_smi_main.h"
+#include "rocm_smi/rocm_smi_lock_stats.h"
 
 // Default to thread only mutex unless export AMDSMI_MUTEX_CROSS_PROCESS=1
 #define PROCESS_CROSS_PROCESS_ENV_VAR "AMDSMI_MUTEX_CROSS_PROCESS"
 #define MUTEX_TIME_OUT_ENV_VAR "RSMI_MUTEX_TIMEOUT"
 #define DEFAULT_MUTEX_TIMEOUT_SECONDS 5
+// How long an exclusive locker sleeps between checks for dead shared holders
+#define READERS_WAIT_NSECS 100000000
+
+// Stored in shared_mutex_mem_t::initialized once the mutex is usable
+#define SHARED_MUTEX_MAGIC 0x52534d49
+// Appended to the name of the shared memory object. Older libraries laid
+// out a bare pthread_mutex_t under the plain name; they keep using theirs,
+// and this one is never mistaken for it.
+#define SHARED_MUTEX_LAYOUT_SUFFIX "_v2"
+// How long to wait for the process that created the shared memory to
+// initialize the mutex in it
+#define INIT_WAIT_NSECS 1000000
+#define INIT_WAIT_TRIES 1000
+
+// What a shared mutex allocates or maps: the pthread mutex, the last
+// process to lock it, and its shared holders
+typedef struct shared_mutex_mem_t {
+  pthread_mutex_t mutex;
+  uint32_t initialized;  // SHARED_MUTEX_MAGIC once mutex is initialized
+  pid_t owner_pid;       // Last process to lock mutex
+  shared_mutex_readers_t readers;
+} shared_mutex_mem_t;
+
+static shared_mutex_mem_t *get_mem(pthread_mutex_t *mutex_ptr) {
+  // mutex is the first member
+  return reinterpret_cast<shared_mutex_mem_t *>(mutex_ptr);
+}
 
 static int GetEnvVarUInteger(const char *ev_str) {
   ev_str = getenv(ev_str);
@@ -60,84 +91,70 @@ static int GetEnvVarUInteger(const char *ev_str) {
   return -1;
 }
 
-// find which processes are using the file by searching /proc/*/fd
-static std::vector<std::string> lsof(const char* filename) {
-  struct dirent *entry = nullptr;
-  DIR *dp = nullptr;
-  std::vector<std::string> process_id;
-
-  pid_t cur_pid = getpid();
-  dp = opendir("/proc");
-  if (dp != nullptr) {
-    while ((entry = readdir(dp))) {
-      std::string id(entry->d_name);
-      // ignore current process
-      if (id == std::to_string(cur_pid)) continue;
-      // the process id should be a number
-      if (std::all_of(id.begin(), id.end(), ::isdigit)) {
-        process_id.push_back(entry->d_name);
-      }
-    }
-    closedir(dp);
-  }
-
-  std::vector<std::string> matched_process;
-  for (unsigned int i=0; i < process_id.size(); i++) {
-      std::string folder_name("/proc/");
-      folder_name += process_id[i]+"/fd/";
-      dp = opendir(folder_name.c_str());
-      if (dp == nullptr) continue;
-      while ((entry = readdir(dp))) {
-         std::string p(folder_name+entry->d_name);
-         char buf[512];
-         memset(buf, 0, 512);
-         if (readlink(p.c_str(), buf, sizeof(buf)-1) < 0) continue;
-         if (!strcmp(filename, buf)) matched_process.push_back(process_id[i]);
-      }
-      closedir(dp);
-  }
-  return matched_process;
-}
-
-// RSMI_MUTEX_THREAD_ONLY = 1 to enable thread safe mutex
-shared_mutex_t init_thread_safe_only(const char *name) {
-  shared_mutex_t mutex = {nullptr, 0, nullptr, 0};
-  errno = 0;
-  mutex.shm_fd = -1;
-  mutex.created = 0;
-  pthread_mutex_t *mutex_ptr =  new pthread_mutex_t();
-
+// Initialize the robust, recursive, process shared pthread mutex and mark
+// the memory initialized. Returns 0, or -1 after printing the error.
+static int init_mem(shared_mutex_mem_t *mem) {
   pthread_mutexattr_t attr;
   if (pthread_mutexattr_init(&attr)) {
     perror("pthread_mutexattr_init");
-    return mutex;
+    return -1;
   }
   if (pthread_mutexattr_setpshared(&attr, PTHREAD_PROCESS_SHARED)) {
     perror("pthread_mutexattr_setpshared");
-    return mutex;
+    return -1;
   }
-
   if (pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE)) {
     perror("pthread_mutexattr_settype");
-    return mutex;
+    return -1;
   }
   if (pthread_mutexattr_setrobust(&attr, PTHREAD_MUTEX_ROBUST)) {
     perror("pthread_mutexattr_setrobust");
-    return mutex;
+    return -1;
   }
-  if (pthread_mutex_init(mutex_ptr, &attr)) {
+  if (pthread_mutex_init(&mem->mutex, &attr)) {
     perror("pthread_mutex_init");
+    return -1;
+  }
+  (void)pthread_mutexattr_destroy(&attr);
+  __atomic_store_n(&mem->owner_pid, 0, __ATOMIC_RELAXED);
+  __atomic_store_n(&mem->initialized, SHARED_MUTEX_MAGIC, __ATOMIC_RELEASE);
+  return 0;
+}
+
+// Wait for the process that created the shared memory to initialize it
+static bool wait_for_init(shared_mutex_mem_t *mem) {
+  const struct timespec delay = {0, INIT_WAIT_NSECS};
+  for (int i = 0; i < INIT_WAIT_TRIES; ++i) {
+    if (__atomic_load_n(&mem->initialized, __ATOMIC_ACQUIRE) ==
+                                                        SHARED_MUTEX_MAGIC) {
+      return true;
+    }
+    nanosleep(&delay, nullptr);
+  }
+  return false;
+}
+
+// RSMI_MUTEX_THREAD_ONLY = 1 to enable thread safe mutex
+shared_mutex_t init_thread_safe_only(const char *name) {
+  shared_mutex_t mutex = {nullptr, nullptr, 0, nullptr, 0};
+  errno = 0;
+  mutex.shm_fd = -1;
+  mutex.created = 0;
+  shared_mutex_mem_t *mem = new shared_mutex_mem_t();
+  if (init_mem(mem) != 0) {
+    delete mem;
     return mutex;
   }
 
-  mutex.ptr = mutex_ptr;
+  mutex.ptr = &mem->mutex;
+  mutex.readers = &mem->readers;
   mutex.name = reinterpret_cast<char *>(malloc(NAME_MAX+1));
   (void)snprintf(mutex.name, NAME_MAX + 1, "%s", name);
   return mutex;
 }
 
-shared_mutex_t shared_mutex_init(const char *name, mode_t mode, bool retried) {
-  shared_mutex_t mutex = {nullptr, 0, nullptr, 0};
+shared_mutex_t shared_mutex_init(const char *name, mode_t mode) {
+  shared_mutex_t mutex = {nullptr, nullptr, 0, nullptr, 0};
   errno = 0;
 
   amd::smi::RocmSMI& smi = amd::smi::RocmSMI::getInstance();
@@ -146,35 +163,41 @@ shared_mutex_t shared_mutex_init(const char *name, mode_t mode, bool retried) {
     return init_thread_safe_only(name);
   }
 
-  // Open existing shared memory object, or create one.
-  // Two separate calls are needed here, to mark fact of creation
-  // for later initialization of pthread mutex.
-  mutex.shm_fd = shm_open(name, O_RDWR, mode);
-  if (errno == ENOENT) {
-    mutex.shm_fd = shm_open(name, O_RDWR|O_CREAT, mode);
+  char shm_name[NAME_MAX + 1];
+  (void)snprintf(shm_name, sizeof(shm_name), "%s%s", name,
+                 SHARED_MUTEX_LAYOUT_SUFFIX);
+  name = shm_name;
+
+  // Open existing shared memory object, or create one. Only the process
+  // that creates it initializes the mutex; O_EXCL tells which one that is.
+  mutex.shm_fd = shm_open(name, O_RDWR|O_CREAT|O_EXCL, mode);
+  if (mutex.shm_fd != -1) {
     mutex.created = 1;
     // Change permissions of shared memory, so everybody can access it.
     // Avoiding the umask of shm_open
     if (fchmod(mutex.shm_fd, mode) != 0) {
       perror("fchmod");
     }
+  } else if (errno == EEXIST) {
+    mutex.shm_fd = shm_open(name, O_RDWR, mode);
   }
   if (mutex.shm_fd == -1) {
     perror("shm_open");
     return mutex;
   }
 
-  // Truncate shared memory segment so it would contain
-  // pthread_mutex_t AND the ref. count
-  if (ftruncate(mutex.shm_fd, sizeof(pthread_mutex_t)) != 0) {
+  // Truncate shared memory segment so it would contain the pthread mutex,
+  // its owner AND its shared holders
+  if (ftruncate(mutex.shm_fd, sizeof(shared_mutex_mem_t)) != 0) {
     perror("ftruncate");
+    close(mutex.shm_fd);
     return mutex;
   }
 
   // Map pthread mutex into the shared memory.
   void *addr = mmap(
     nullptr,
-    sizeof(pthread_mutex_t),
+    sizeof(shared_mutex_mem_t),
     PROT_READ|PROT_WRITE,
     MAP_SHARED,
     mutex.shm_fd,
@@ -182,51 +205,61 @@ shared_mutex_t shared_mutex_init(const char *name, mode_t mode, bool retried) {
 
   if (addr == MAP_FAILED) {
     perror("mmap");
+    close(mutex.shm_fd);
     return mutex;
   }
 
-  pthread_mutex_t *mutex_ptr =  reinterpret_cast<pthread_mutex_t *>(addr);
+  shared_mutex_mem_t *mem = reinterpret_cast<shared_mutex_mem_t *>(addr);
+  pthread_mutex_t *mutex_ptr = &mem->mutex;
+  pid_t cur_pid = getpid();
 
-  // Make sure the mutex wasn't left in a locked state. If we can't
-  // acquire it in 5 sec., re-do everything.
+  if (mutex.created) {
+    if (init_mem(mem) != 0) {
+      munmap(addr, sizeof(shared_mutex_mem_t));
+      close(mutex.shm_fd);
+      return mutex;
+    }
+  } else if (!wait_for_init(mem)) {
+    // The creator died before initializing it. Whatever is in there, it
+    // may be in use, so it is left alone.
+    fprintf(stderr, "%d found the mutex %s uninitialized. To fix problem, "
+            "stop all rocm_smi programs, and then delete the rocm_smi* "
+            "shared memory files in /dev/shm.\n", cur_pid, name);
+    munmap(addr, sizeof(shared_mutex_mem_t));
+    close(mutex.shm_fd);
+
+    throw amd::smi::rsmi_exception(RSMI_STATUS_BUSY, __FUNCTION__);
+  }
+
+  // Make sure the mutex wasn't left in a locked state. A robust mutex
+  // whose owner died is handed over with EOWNERDEAD; one that can't be
+  // acquired within the timeout is held by someone, who is reported.
   struct timespec expireTime;
   clock_gettime(CLOCK_REALTIME, &expireTime);
   int time_out = GetEnvVarUInteger(MUTEX_TIME_OUT_ENV_VAR);
   time_out = time_out < DEFAULT_MUTEX_TIMEOUT_SECONDS ? DEFAULT_MUTEX_TIMEOUT_SECONDS: time_out;
   expireTime.tv_sec += time_out;
 
-  pid_t cur_pid = getpid();
-  int ret;
-
-  // also need to set the attribute when retried as the mutex is re-initialized.
-  if (mutex.created || retried) {
-    pthread_mutexattr_t attr;
-    if (pthread_mutexattr_init(&attr)) {
-      perror("pthread_mutexattr_init");
-      return mutex;
-    }
-    if (pthread_mutexattr_setpshared(&attr, PTHREAD_PROCESS_SHARED)) {
-      perror("pthread_mutexattr_setpshared");
-      return mutex;
-    }
-
-    if (pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE)) {
-      perror("pthread_mutexattr_settype");
-      return mutex;
-    }
-    if (pthread_mutexattr_setrobust(&attr, PTHREAD_MUTEX_ROBUST)) {
-      perror("pthread_mutexattr_setrobust");
-      return mutex;
-    }
-    if (pthread_mutex_init(mutex_ptr, &attr)) {
-      perror("pthread_mutex_init");
-      return mutex;
+  const uint64_t wait_start = amd::smi::LockStats::NowNs();
+  int ret = pthread_mutex_trylock(mutex_ptr);
+  const bool contended = (ret == EBUSY);
+  if (contended) {
+    ret = pthread_mutex_timedlock(mutex_ptr, &expireTime);
+  }
+  if (amd::smi::LockStats::enabled()) {
+    // Counted as a cross process device lock of no device yet
+    amd::smi::LockStats& stats = amd::smi::LockStats::getInstance();
+    const uint64_t ns = contended ?
+                        amd::smi::LockStats::NowNs() - wait_start : 0;
+    if (ret == 0 || ret == EOWNERDEAD) {
+      stats.acquired(amd::smi::kLockDeviceShared, amd::smi::kLockNoDevice,
+                     ns, contended);
+      stats.released(amd::smi::kLockDeviceShared, amd::smi::kLockNoDevice);
+    } else {
+      stats.failed(amd::smi::kLockDeviceShared, amd::smi::kLockNoDevice, ns);
     }
   }
 
-  ret = pthread_mutex_timedlock(mutex_ptr, &expireTime);
-
-
   if (ret == EOWNERDEAD) {
     ret = pthread_mutex_consistent(mutex_ptr);
     // This function should not fail unless mutex_ptr is not robust
@@ -238,7 +271,8 @@ shared_mutex_t shared_mutex_init(const char *name, mode_t mode, bool retried) {
     // pthread_mutex_consistent() handle them for release builds.
     if (ret) {
       fprintf(stderr, "pthread_mutex_consistent() returned %d\n", ret);
-      free(mutex.name);
+      munmap(addr, sizeof(shared_mutex_mem_t));
+      close(mutex.shm_fd);
 
       throw amd::smi::rsmi_exception(RSMI_STATUS_BUSY, __FUNCTION__);
       return mutex;
@@ -250,32 +284,16 @@ shared_mutex_t shared_mutex_init(const char *name, mode_t mode, bool retried) {
     if (pthread_mutex_unlock(mutex_ptr)) {
       perror("pthread_mutex_unlock");
     }
-  } else if (ret || (mutex.created == 0 &&
-                     reinterpret_cast<shared_mutex_t *>(addr)->ptr == nullptr)) {
-    // Something is out of sync.
-
-    // When process crash before unlock the mutex, the mutex is in bad status.
-    // reset the mutex if no process is using it, and then retry lock
-    if (!retried) {
-      std::string shared_mutex_filename = "/dev/shm" + std::string(name);
-      std::vector<std::string> ids = lsof(shared_mutex_filename.c_str());
-      if (ids.size() == 0) {  // no process is using it
-        fprintf(stderr, "%d re-init the mutex %s since no one use it. ret:%d ptr:%p\n",
-              cur_pid, shared_mutex_filename.c_str(), ret, reinterpret_cast<shared_mutex_t *>(addr)->ptr);
-        memset(mutex_ptr, 0, sizeof(pthread_mutex_t));
-        // Set mutex.created == 1 so that it can be initialized latter.
-        mutex.created = 1;
-        free(mutex.name);
-        return shared_mutex_init(name, mode, true);
-      }
-    }
-
-    fprintf(stderr, "pthread_mutex_timedlock() returned %d\n", ret);
+  } else if (ret) {
+    const pid_t owner_pid = __atomic_load_n(&mem->owner_pid, __ATOMIC_RELAXED);
+    fprintf(stderr, "pthread_mutex_timedlock() returned %d; mutex %s was last "
+            "locked by process %d\n", ret, name, owner_pid);
     perror("Failed to initialize RSMI device mutex after 5 seconds. Previous "
      "execution may not have shutdown cleanly. To fix problem, stop all "
      "rocm_smi programs, and then delete the rocm_smi* shared memory files in"
                                                                 " /dev/shm.");
-    free(mutex.name);
+    munmap(addr, sizeof(shared_mutex_mem_t));
+    close(mutex.shm_fd);
 
     throw amd::smi::rsmi_exception(RSMI_STATUS_BUSY, __FUNCTION__);
     return mutex;
@@ -287,9 +305,8 @@ shared_mutex_t shared_mutex_init(const char *name, mode_t mode, bool retried) {
     }
   }
 
-
-
   mutex.ptr = mutex_ptr;
+  mutex.readers = &mem->readers;
   mutex.name = reinterpret_cast<char *>(malloc(NAME_MAX+1));
   (void)snprintf(mutex.name, NAME_MAX + 1, "%s", name);
   return mutex;
@@ -300,12 +317,13 @@ int shared_mutex_close(shared_mutex_t mutex) {
   const bool is_thread_only = GetEnvVarUInteger(PROCESS_CROSS_PROCESS_ENV_VAR) != 1 ||
           smi.is_thread_only_mutex();
   if (is_thread_only) {
-    delete mutex.ptr;
-  } else if (munmap(reinterpret_cast<void *>(mutex.ptr), sizeof(pthread_mutex_t))) {
+    delete reinterpret_cast<shared_mutex_mem_t *>(mutex.ptr);
+  } else if (munmap(reinterpret_cast<void *>(mutex.ptr), sizeof(shared_mutex_mem_t))) {
     perror("munmap");
     return -1;
   }
   mutex.ptr = nullptr;
+  mutex.readers = nullptr;
   if (!is_thread_only && close(mutex.shm_fd)) {
     perror("close");
     return -1;
@@ -325,12 +343,13 @@ int shared_mutex_destroy(shared_mutex_t mutex) {
     return -1;
   }
   if (is_thread_only) {
-    delete mutex.ptr;
-  } else if (munmap(reinterpret_cast<void *>(mutex.ptr), sizeof(pthread_mutex_t))) {
+    delete reinterpret_cast<shared_mutex_mem_t *>(mutex.ptr);
+  } else if (munmap(reinterpret_cast<void *>(mutex.ptr), sizeof(shared_mutex_mem_t))) {
     perror("munmap");
     return -1;
   }
   mutex.ptr = nullptr;
+  mutex.readers = nullptr;
   if (!is_thread_only && close(mutex.shm_fd)) {
     perror("close");
     return -1;
@@ -343,3 +362,165 @@ int shared_mutex_destroy(shared_mutex_t mutex) {
   free(mutex.name);
   return 0;
 }
+
+static int futex(uint32_t *uaddr, int op, uint32_t val,
+                 const struct timespec *timeout) {
+  // Not FUTEX_PRIVATE_FLAG: the word may be in memory shared by processes
+  return static_cast<int>(syscall(SYS_futex, uaddr, op, val, timeout,
+                                  nullptr, 0));
+}
+
+// Lock the pthread mutex itself, making it consistent if its owner died,
+// and record this process as its owner
+static int lock_pthread_mutex(pthread_mutex_t *mutex_ptr, bool blocking) {
+  int ret = blocking ? pthread_mutex_lock(mutex_ptr) :
+                       pthread_mutex_trylock(mutex_ptr);
+  if (ret == EOWNERDEAD) {
+    fprintf(stderr, "%d detected dead process %d holding a device mutex, "
+            "and making it consistent.\n", getpid(),
+            __atomic_load_n(&get_mem(mutex_ptr)->owner_pid, __ATOMIC_RELAXED));
+    ret = pthread_mutex_consistent(mutex_ptr);
+  }
+  if (ret == 0) {
+    __atomic_store_n(&get_mem(mutex_ptr)->owner_pid, getpid(),
+                     __ATOMIC_RELAXED);
+  }
+  return ret;
+}
+
+// Inode of the PID namespace of this process, which tells processes of
+// different namespaces sharing /dev/shm apart; 0 if /proc can't tell
+static uint64_t pid_namespace() {
+  static const uint64_t pid_ns = [] {
+    struct stat st;
+    return stat("/proc/self/ns/pid", &st) == 0 ?
+           static_cast<uint64_t>(st.st_ino) : 0;
+  }();
+  return pid_ns;
+}
+
+// Whether the slot is held by this process
+template <typename Slot>
+static bool is_own_slot(const Slot& slot, pid_t cur_pid, uint64_t cur_ns) {
+  return __atomic_load_n(&slot.pid, __ATOMIC_RELAXED) == cur_pid &&
+         __atomic_load_n(&slot.pid_ns, __ATOMIC_RELAXED) == cur_ns &&
+         __atomic_load_n(&slot.count, __ATOMIC_ACQUIRE) != 0;
+}
+
+// Forget the shared holds of processes that are gone. A PID only means
+// something in its own namespace, so the holds of other namespaces are
+// kept. Only called with the pthread mutex locked, so no slot is being
+// taken meanwhile.
+static void drop_dead_readers(shared_mutex_readers_t *readers) {
+  const pid_t cur_pid = getpid();
+  const uint64_t cur_ns = pid_namespace();
+  for (auto& slot : readers->slots) {
+    const uint32_t count = __atomic_load_n(&slot.count, __ATOMIC_ACQUIRE);
+    const pid_t pid = __atomic_load_n(&slot.pid, __ATOMIC_RELAXED);
+    const uint64_t pid_ns = __atomic_load_n(&slot.pid_ns, __ATOMIC_RELAXED);
+    if (count == 0 || cur_ns == 0 || pid_ns != cur_ns || pid == cur_pid ||
+        kill(pid, 0) == 0 || errno != ESRCH) {
+      continue;
+    }
+    fprintf(stderr, "%d dropping %u shared holds of dead process %d.\n",
+            cur_pid, count, pid);
+    __atomic_store_n(&slot.count, 0, __ATOMIC_RELEASE);
+    __atomic_store_n(&slot.pid, 0, __ATOMIC_RELAXED);
+    __atomic_store_n(&slot.pid_ns, 0, __ATOMIC_RELAXED);
+    if (__atomic_sub_fetch(&readers->num_readers, count,
+                           __ATOMIC_ACQ_REL) == 0) {
+      futex(&readers->num_readers, FUTEX_WAKE, INT_MAX, nullptr);
+    }
+  }
+}
+
+static void wait_for_readers(shared_mutex_readers_t *readers) {
+  const struct timespec timeout = {0, READERS_WAIT_NSECS};
+  uint32_t num_readers;
+  while ((num_readers = __atomic_load_n(&readers->num_readers,
+                                        __ATOMIC_ACQUIRE)) != 0) {
+    if (futex(&readers->num_readers, FUTEX_WAIT, num_readers, &timeout) != 0
+        && errno == ETIMEDOUT) {
+      drop_dead_readers(readers);
+    }
+  }
+}
+
+int shared_mutex_lock_shared(shared_mutex_t mutex, bool blocking,
+                             bool *is_exclusive) {
+  *is_exclusive = false;
+  int ret = lock_pthread_mutex(mutex.ptr, blocking);
+  if (ret != 0) {
+    return ret;
+  }
+
+  shared_mutex_readers_t *readers = mutex.readers;
+  const pid_t cur_pid = getpid();
+  const uint64_t cur_ns = pid_namespace();
+  auto *slot = std::find_if(std::begin(readers->slots),
+                            std::end(readers->slots), [&](auto& s) {
+    return is_own_slot(s, cur_pid, cur_ns);
+  });
+  if (slot == std::end(readers->slots)) {
+    drop_dead_readers(readers);
+    slot = std::find_if(std::begin(readers->slots),
+                        std::end(readers->slots), [](auto& s) {
+      return __atomic_load_n(&s.count, __ATOMIC_ACQUIRE) == 0;
+    });
+  }
+  if (slot == std::end(readers->slots)) {
+    // Every slot is in use; hold the mutex exclusively instead
+    wait_for_readers(readers);
+    *is_exclusive = true;
+    return 0;
+  }
+
+  __atomic_store_n(&slot->pid, cur_pid, __ATOMIC_RELAXED);
+  __atomic_store_n(&slot->pid_ns, cur_ns, __ATOMIC_RELAXED);
+  __atomic_add_fetch(&slot->count, 1, __ATOMIC_ACQ_REL);
+  __atomic_add_fetch(&readers->num_readers, 1, __ATOMIC_ACQ_REL);
+  pthread_mutex_unlock(mutex.ptr);
+  return 0;
+}
+
+void shared_mutex_unlock_shared(shared_mutex_t mutex) {
+  shared_mutex_readers_t *readers = mutex.readers;
+  const pid_t cur_pid = getpid();
+  const uint64_t cur_ns = pid_namespace();
+  // Our slot keeps its pid while we hold it, so no lock is needed to find it
+  for (auto& slot : readers->slots) {
+    if (!is_own_slot(slot, cur_pid, cur_ns)) {
+      continue;
+    }
+    __atomic_sub_fetch(&slot.count, 1, __ATOMIC_ACQ_REL);
+    if (__atomic_sub_fetch(&readers->num_readers, 1, __ATOMIC_ACQ_REL) == 0) {
+      futex(&readers->num_readers, FUTEX_WAKE, INT_MAX, nullptr);
+    }
+    return;
+  }
+}
+
+int shared_mutex_lock_exclusive(shared_mutex_t mutex, bool blocking) {
+  int ret = lock_pthread_mutex(mutex.ptr, blocking);
+  if (ret != 0) {
+    return ret;
+  }
+  if (!blocking &&
+      __atomic_load_n(&mutex.readers->num_readers, __ATOMIC_ACQUIRE) != 0) {
+    drop_dead_readers(mutex.readers);
+    if (__atomic_load_n(&mutex.readers->num_readers, __ATOMIC_ACQUIRE) != 0) {
+      pthread_mutex_unlock(mutex.ptr);
+      return EBUSY;
+    }
+  }
+  wait_for_readers(mutex.readers);
+  return 0;
+}
+
+void shared_mutex_unlock_exclusive(shared_mutex_t mutex) {
+  pthread_mutex_unlock(mutex.ptr);
+}
+
+pid_t shared_mutex_owner(shared_mutex_t mutex) {
+  return __atomic_load_n(&get_mem(mutex.ptr)->owner_pid, __ATOMIC_RELAXED);
+}
@@ -30,11 +30,32 @@ THE SOFTWARE.
 #include <pthread.h>  // pthread_mutex_t, pthread_mutexattr_t,
                       // pthread_mutexattr_init, pthread_mutexattr_setpshared,
                       // pthread_mutex_init, pthread_mutex_destroy
+#include <stdint.h>
+#include <sys/types.h>  // pid_t
+
+// Number of processes that can hold the mutex shared at the same time.
+// Once all slots are in use, shared_mutex_lock_shared() locks exclusively.
+#define SHARED_MUTEX_READER_SLOTS 32
+
+// Shared holders of a mutex, kept in the same memory as the pthread mutex.
+// They register under the pthread mutex, so an exclusive holder, which
+// keeps the pthread mutex locked, only has to wait for num_readers to drop
+// to 0.
+typedef struct shared_mutex_readers_t {
+  uint32_t num_readers;  // Sum of the slot counts; futex word
+  uint32_t reserved;
+  struct {
+    pid_t pid;           // Process holding the mutex shared
+    uint32_t count;      // Number of its threads holding it
+    uint64_t pid_ns;     // Inode of its PID namespace, 0 if unknown
+  } slots[SHARED_MUTEX_READER_SLOTS];
+} shared_mutex_readers_t;
 
 // Structure of a shared mutex.
 typedef struct shared_mutex_t {
   pthread_mutex_t *ptr;  // Pointer to the pthread mutex and
                          // shared memory segment.
+  shared_mutex_readers_t *readers;  // Shared holders, right after *ptr
   int shm_fd;            // Descriptor of shared memory object.
   char* name;            // Name of the mutex and associated
                          // shared memory object.
@@ -53,15 +74,13 @@ typedef struct shared_mutex_t {
 // and the returned structure will have `ptr` equal `NULL`.
 // `errno` wil not be reset in such case, so you may used it.
 //
-// **NOTE:** In case when the mutex appears to be uncreated,
-// this function becomes *non-thread-safe*. If multiple threads
-// call it at one moment, there occur several race conditions,
-// in which one call might recreate another's shared memory
-// object or rewrite another's pthread mutex in the shared memory.
-// There is no workaround currently, except to run first
-// initialization only before multi-threaded or multi-process
-// functionality.
-shared_mutex_t shared_mutex_init(const char *name, mode_t mode, bool retried=false);
+// The shared memory object is named after `name` plus a layout version, so
+// it never clashes with the one of an older library. Only the process that
+// creates it initializes the mutex in it; the others wait for it to, and
+// throw RSMI_STATUS_BUSY if it never is. A mutex whose owner died is made
+// consistent; one that can not be acquired within the timeout is never
+// reset, but reported as busy with the process that last locked it.
+shared_mutex_t shared_mutex_init(const char *name, mode_t mode);
 
 // Close access to the shared mutex and free all the resources,
 // used by the structure.
@@ -88,4 +107,31 @@ int shared_mutex_close(shared_mutex_t mutex);
 // **NOTE:** It will not unlock locked mutex.
 int shared_mutex_destroy(shared_mutex_t mutex);
 
+// Lock the mutex shared: other shared holders get in as well, exclusive
+// holders don't. Unlike the pthread mutex, shared locking is not recursive;
+// callers track nesting themselves.
+//
+// Returns 0 on success, with `*is_exclusive` set if the mutex had to be
+// locked exclusively instead (no reader slot left); unlock it with
+// shared_mutex_unlock_exclusive() then. If `blocking` is false and the
+// mutex is held exclusively, returns EBUSY without waiting.
+int shared_mutex_lock_shared(shared_mutex_t mutex, bool blocking,
+                             bool *is_exclusive);
+void shared_mutex_unlock_shared(shared_mutex_t mutex);
+
+// Lock the mutex exclusively: lock the (recursive) pthread mutex, which
+// keeps new shared holders out, and wait for the current ones to leave.
+// Shared holders of processes that died are dropped while waiting, but
+// only those of this PID namespace: a process of another one can't be told
+// apart from a dead one, so its holds are waited for.
+//
+// Returns 0 on success. If `blocking` is false and the mutex is held,
+// shared or exclusively, by someone else, returns EBUSY without waiting.
+int shared_mutex_lock_exclusive(shared_mutex_t mutex, bool blocking);
+void shared_mutex_unlock_exclusive(shared_mutex_t mutex);
+
+// The process that last locked the mutex, shared or exclusively; it may
+// have unlocked it since. 0 if nobody locked it yet.
+pid_t shared_mutex_owner(shared_mutex_t mutex);
+
 #endif  // SRC_SHARED_MUTEX_SHARED_MUTEX_H_